@@ -0,0 +1,2002 @@
+/** @file
+
+Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+This program and the accompanying materials
+are licensed and made available under the terms and conditions of the BSD License
+which accompanies this distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+Module Name:
+
+  Benchmark.c
+
+Abstract:
+
+  Throughput micro benchmarks for the routines in the Common library, a
+  speed, ratio and memory regression suite for the EFI, Tiano and LZMA
+  codecs, and the PE/COFF relocation walker against relocation indexes.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#include <psapi.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#endif
+
+#include "ParseInf.h"
+#include "EfiUtilityMsgs.h"
+#include "CommonLib.h"
+#include "Crc32.h"
+#include "Compress.h"
+#include "Decompress.h"
+#include "DecompressRef.h"
+#include "LzmaCodec.h"
+#include <IndustryStandard/PeImage.h>
+#include "PeCoffLib.h"
+
+#define UTILITY_NAME            "Benchmark"
+#define UTILITY_MAJOR_VERSION   0
+#define UTILITY_MINOR_VERSION   1
+
+#define DEFAULT_BUFFER_SIZE     (16 * 1024 * 1024)
+#define DEFAULT_ITERATIONS      8
+#define DEFAULT_MARGIN          10
+
+typedef
+EFI_STATUS
+(*BENCHMARK_FUNCTION) (
+  IN UINT8    *Buffer,
+  IN UINTN    BufferSize,
+  IN UINTN    Iterations
+  );
+
+typedef struct {
+  CHAR8               *Name;
+  CHAR8               *Help;
+  BENCHMARK_FUNCTION  Function;
+} BENCHMARK_ENTRY;
+
+typedef struct {
+  CHAR8   *Name;
+  UINT8   *Data;
+  UINT32  Size;
+} CORPUS_FILE;
+
+typedef struct {
+  CHAR8   Name[32];
+  CHAR8   Variant[32];
+  UINT64  Size;
+  UINT64  Compressed;
+  UINT64  Iterations;
+  UINT64  ElapsedUs;
+  double  MegaBytesPerSecond;
+  UINT64  PeakKb;
+} BENCHMARK_RESULT;
+
+//
+// Files given with --input. Compression benchmarks measure these instead
+// of the generated buffer when any are present.
+//
+STATIC CORPUS_FILE  *mCorpus      = NULL;
+STATIC UINTN        mCorpusCount  = 0;
+
+//
+// Every measurement of the run, written by --json and checked against
+// --baseline at the end.
+//
+STATIC BENCHMARK_RESULT  *mResults     = NULL;
+STATIC UINTN             mResultCount  = 0;
+STATIC UINTN             mResultMax    = 0;
+
+//
+// Directory holding the TianoCompress and LzmaCompress tools, set by
+// --tool-path. The codec benchmark only runs the tools when it is given.
+//
+STATIC CHAR8        *mToolPath    = NULL;
+
+VOID
+Version (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Displays the standard utility information to SDTOUT
+
+Arguments:
+
+  None
+
+Returns:
+
+  None
+
+--*/
+{
+  fprintf (stdout, "%s Version %d.%d %s \n", UTILITY_NAME, UTILITY_MAJOR_VERSION, UTILITY_MINOR_VERSION, __BUILD_VERSION);
+}
+
+STATIC
+UINT64
+GetTimeInMicroseconds (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Read a monotonic clock.
+
+Arguments:
+
+  None
+
+Returns:
+
+  The current time in microseconds from an arbitrary origin.
+
+--*/
+{
+#ifdef _WIN32
+  LARGE_INTEGER  Counter;
+  LARGE_INTEGER  Frequency;
+
+  QueryPerformanceCounter (&Counter);
+  QueryPerformanceFrequency (&Frequency);
+  return (UINT64) (Counter.QuadPart / (Frequency.QuadPart / 1000000));
+#else
+  struct timespec  Time;
+
+  clock_gettime (CLOCK_MONOTONIC, &Time);
+  return (UINT64) Time.tv_sec * 1000000 + (UINT64) Time.tv_nsec / 1000;
+#endif
+}
+
+STATIC
+VOID
+ResetPeakMemory (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Start a new peak memory measurement. Only Linux can reset the high water
+  mark of a running process, elsewhere the peak covers the whole run.
+
+Arguments:
+
+  None
+
+Returns:
+
+  None
+
+--*/
+{
+#ifdef __linux__
+  FILE  *File;
+
+  File = fopen ("/proc/self/clear_refs", "w");
+  if (File != NULL) {
+    fputs ("5", File);
+    fclose (File);
+  }
+#endif
+}
+
+STATIC
+UINT64
+GetPeakMemoryKb (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Read the peak resident memory of this process.
+
+Arguments:
+
+  None
+
+Returns:
+
+  The peak resident memory in KB since the last ResetPeakMemory(), 0 if
+  the host does not report it.
+
+--*/
+{
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS  Counters;
+
+  if (!GetProcessMemoryInfo (GetCurrentProcess (), &Counters, sizeof (Counters))) {
+    return 0;
+  }
+  return (UINT64) Counters.PeakWorkingSetSize / 1024;
+#elif defined (__linux__)
+  FILE                *File;
+  CHAR8               Line[128];
+  unsigned long long  Value;
+
+  Value = 0;
+  File  = fopen ("/proc/self/status", "r");
+  if (File != NULL) {
+    while (fgets (Line, sizeof (Line), File) != NULL) {
+      if (sscanf (Line, "VmHWM: %llu", &Value) == 1) {
+        break;
+      }
+    }
+    fclose (File);
+  }
+  return (UINT64) Value;
+#else
+  struct rusage  Usage;
+
+  if (getrusage (RUSAGE_SELF, &Usage) != 0) {
+    return 0;
+  }
+#ifdef __APPLE__
+  return (UINT64) Usage.ru_maxrss / 1024;
+#else
+  return (UINT64) Usage.ru_maxrss;
+#endif
+#endif
+}
+
+STATIC
+VOID
+RecordResult (
+  IN CONST CHAR8 *Name,
+  IN CONST CHAR8 *Variant,
+  IN UINT64   Size,
+  IN UINT64   Compressed,
+  IN UINT64   Iterations,
+  IN UINT64   ElapsedUs,
+  IN UINT64   PeakKb
+  )
+/*++
+
+Routine Description:
+
+  Add one measurement to mResults and start the peak memory measurement
+  of the next one.
+
+Arguments:
+
+  Name        - Name of the benchmark
+  Variant     - Name of the measured implementation
+  Size        - Bytes processed per iteration
+  Compressed  - Bytes produced per iteration, 0 if not a compression
+  Iterations  - Number of iterations measured
+  ElapsedUs   - Total time of all iterations in microseconds, not 0
+  PeakKb      - Peak resident memory during the measurement
+
+Returns:
+
+  None
+
+--*/
+{
+  BENCHMARK_RESULT  *Result;
+
+  ResetPeakMemory ();
+
+  if (mResultCount == mResultMax) {
+    Result = (BENCHMARK_RESULT *) realloc (mResults, (mResultMax + 16) * sizeof (BENCHMARK_RESULT));
+    if (Result == NULL) {
+      Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+      return;
+    }
+    mResults    = Result;
+    mResultMax += 16;
+  }
+
+  Result = &mResults[mResultCount++];
+  memset (Result, 0, sizeof (BENCHMARK_RESULT));
+  strncpy (Result->Name, Name, sizeof (Result->Name) - 1);
+  strncpy (Result->Variant, Variant, sizeof (Result->Variant) - 1);
+  Result->Size                = Size;
+  Result->Compressed          = Compressed;
+  Result->Iterations          = Iterations;
+  Result->ElapsedUs           = ElapsedUs;
+  Result->MegaBytesPerSecond  = ((double) Size * (double) Iterations) / (double) ElapsedUs;
+  Result->PeakKb              = PeakKb;
+}
+
+STATIC
+VOID
+ReportThroughput (
+  IN CHAR8    *Name,
+  IN CONST CHAR8 *Variant,
+  IN UINTN    BufferSize,
+  IN UINTN    Iterations,
+  IN UINT64   ElapsedUs,
+  IN UINT64   PeakKb
+  )
+/*++
+
+Routine Description:
+
+  Print and record one measurement.
+
+Arguments:
+
+  Name        - Name of the benchmark
+  Variant     - Name of the measured implementation
+  BufferSize  - Bytes processed per iteration
+  Iterations  - Number of iterations measured
+  ElapsedUs   - Total time of all iterations in microseconds
+  PeakKb      - Peak resident memory during the measurement
+
+Returns:
+
+  None
+
+--*/
+{
+  double  MegaBytesPerSecond;
+
+  if (ElapsedUs == 0) {
+    ElapsedUs = 1;
+  }
+  MegaBytesPerSecond = ((double) BufferSize * (double) Iterations) / (double) ElapsedUs;
+  fprintf (
+    stdout,
+    "%-12s %-10s size=%lu iterations=%lu time_us=%llu MB/s=%.1f peak_kb=%llu\n",
+    Name,
+    Variant,
+    (unsigned long) BufferSize,
+    (unsigned long) Iterations,
+    (unsigned long long) ElapsedUs,
+    MegaBytesPerSecond,
+    (unsigned long long) PeakKb
+    );
+  RecordResult (Name, Variant, BufferSize, 0, Iterations, ElapsedUs, PeakKb);
+}
+
+STATIC
+EFI_STATUS
+BenchmarkCrc32 (
+  IN UINT8    *Buffer,
+  IN UINTN    BufferSize,
+  IN UINTN    Iterations
+  )
+/*++
+
+Routine Description:
+
+  Measure every CRC32 engine available on this host and check that all of
+  them agree with the byte at a time reference engine, both for the whole
+  buffer and for the buffer fed in odd sized pieces.
+
+Arguments:
+
+  Buffer      - Data to checksum
+  BufferSize  - Size of Buffer
+  Iterations  - Number of times the buffer is processed per engine
+
+Returns:
+
+  EFI_SUCCESS  - All engines produced the reference result.
+  EFI_ABORTED  - An engine produced a different result.
+
+--*/
+{
+  CRC32_ENGINE   Engine;
+  CRC32_ENGINE   Active;
+  CRC32_CONTEXT  Context;
+  UINT32         Reference;
+  UINT32         Crc;
+  UINTN          Index;
+  UINTN          Offset;
+  UINTN          Piece;
+  UINT64         Start;
+  EFI_STATUS     Status;
+
+  Active = Crc32GetEngine ();
+  Status = EFI_SUCCESS;
+
+  Crc32SelectEngine (Crc32EngineByte);
+  CalculateCrc32 (Buffer, BufferSize, &Reference);
+
+  for (Engine = Crc32EngineByte; Engine < Crc32EngineMax; Engine++) {
+    if (EFI_ERROR (Crc32SelectEngine (Engine))) {
+      fprintf (stdout, "%-12s %-10s not supported on this processor\n", "crc32", Crc32GetEngineName (Engine));
+      continue;
+    }
+
+    Start = GetTimeInMicroseconds ();
+    for (Index = 0; Index < Iterations; Index++) {
+      CalculateCrc32 (Buffer, BufferSize, &Crc);
+    }
+    ReportThroughput ("crc32", Crc32GetEngineName (Engine), BufferSize, Iterations, GetTimeInMicroseconds () - Start, GetPeakMemoryKb ());
+
+    if (Crc != Reference) {
+      Error (NULL, 0, 3000, "Invalid", "CRC32 engine %s returned 0x%08x, expected 0x%08x", Crc32GetEngineName (Engine), (unsigned) Crc, (unsigned) Reference);
+      Status = EFI_ABORTED;
+    }
+
+    //
+    // Feed the same data in pieces of varying size so every head and tail
+    // path of the engine is exercised.
+    //
+    Crc32Init (&Context);
+    for (Offset = 0, Piece = 1; Offset < BufferSize; Offset += Piece, Piece = (Piece * 7 + 3) % 4099) {
+      if (Piece > BufferSize - Offset) {
+        Piece = BufferSize - Offset;
+      }
+      Crc32Update (&Context, Buffer + Offset, Piece);
+    }
+    Crc = Crc32Final (&Context);
+    if (Crc != Reference) {
+      Error (NULL, 0, 3000, "Invalid", "CRC32 engine %s returned 0x%08x for incremental input, expected 0x%08x", Crc32GetEngineName (Engine), (unsigned) Crc, (unsigned) Reference);
+      Status = EFI_ABORTED;
+    }
+  }
+
+  Crc32SelectEngine (Active);
+  return Status;
+}
+
+STATIC
+VOID
+ReportCompression (
+  IN CHAR8    *Name,
+  IN CONST CHAR8 *Variant,
+  IN UINT64   InputSize,
+  IN UINT64   OutputSize,
+  IN UINTN    Iterations,
+  IN UINT64   ElapsedUs,
+  IN UINT64   PeakKb
+  )
+/*++
+
+Routine Description:
+
+  Print and record one compression measurement.
+
+Arguments:
+
+  Name        - Name of the benchmark
+  Variant     - Name of the measured encoder setting
+  InputSize   - Bytes compressed per iteration
+  OutputSize  - Bytes produced per iteration
+  Iterations  - Number of iterations measured
+  ElapsedUs   - Total time of all iterations in microseconds
+  PeakKb      - Peak resident memory during the measurement
+
+Returns:
+
+  None
+
+--*/
+{
+  double  MegaBytesPerSecond;
+
+  if (ElapsedUs == 0) {
+    ElapsedUs = 1;
+  }
+  if (InputSize == 0) {
+    InputSize = 1;
+  }
+  MegaBytesPerSecond = ((double) InputSize * (double) Iterations) / (double) ElapsedUs;
+  fprintf (
+    stdout,
+    "%-12s %-10s size=%llu compressed=%llu ratio=%.2f%% iterations=%lu time_us=%llu MB/s=%.2f peak_kb=%llu\n",
+    Name,
+    Variant,
+    (unsigned long long) InputSize,
+    (unsigned long long) OutputSize,
+    100.0 * (double) OutputSize / (double) InputSize,
+    (unsigned long) Iterations,
+    (unsigned long long) ElapsedUs,
+    MegaBytesPerSecond,
+    (unsigned long long) PeakKb
+    );
+  RecordResult (Name, Variant, InputSize, OutputSize, Iterations, ElapsedUs, PeakKb);
+}
+
+STATIC
+EFI_STATUS
+TianoRoundTrip (
+  IN     TIANO_COMPRESS_CONTEXT  *Context,
+  IN     UINT8                   *Data,
+  IN     UINT32                  Size,
+  IN OUT UINT8                   **Output,
+  IN OUT UINT32                  *OutputSize,
+  OUT    UINT32                  *CompressedSize,
+  IN OUT UINT64                  *ElapsedUs
+  )
+/*++
+
+Routine Description:
+
+  Compress Data with the level selected on Context, add the encode time
+  to ElapsedUs and check that the result decompresses to Data again.
+
+Arguments:
+
+  Context         - Encoder context with the level to measure
+  Data            - Data to compress
+  Size            - Size of Data
+  Output          - Output buffer, grown as needed
+  OutputSize      - Allocated size of Output
+  CompressedSize  - Receives the compressed size
+  ElapsedUs       - Encode time accumulator
+
+Returns:
+
+  EFI_SUCCESS           - Data was compressed and verified.
+  EFI_OUT_OF_RESOURCES  - No resource to complete function.
+  EFI_ABORTED           - The compressed data did not decode to Data.
+
+--*/
+{
+  EFI_STATUS  Status;
+  UINT64      Start;
+  UINT32      DstSize;
+  UINT32      ScratchSize;
+  UINT8       *Decoded;
+  UINT8       *Scratch;
+
+  //
+  // The encoder never expands by more than its block headers, so this
+  // size avoids a second call inside the timed region.
+  //
+  if (*OutputSize < Size + Size / 8 + 1024) {
+    free (*Output);
+    *OutputSize = Size + Size / 8 + 1024;
+    *Output     = (UINT8 *) malloc (*OutputSize);
+    if (*Output == NULL) {
+      *OutputSize = 0;
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  *CompressedSize = *OutputSize;
+  Start   = GetTimeInMicroseconds ();
+  Status  = TianoCompressEx (Context, Data, Size, *Output, CompressedSize);
+  *ElapsedUs += GetTimeInMicroseconds () - Start;
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = TianoGetInfo (*Output, *CompressedSize, &DstSize, &ScratchSize);
+  if (EFI_ERROR (Status) || DstSize != Size) {
+    return EFI_ABORTED;
+  }
+
+  Decoded = (UINT8 *) malloc (DstSize + 1);
+  Scratch = (UINT8 *) malloc (ScratchSize);
+  if (Decoded == NULL || Scratch == NULL) {
+    free (Decoded);
+    free (Scratch);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = TianoDecompress (*Output, *CompressedSize, Decoded, DstSize, Scratch, ScratchSize);
+  if (EFI_ERROR (Status) || memcmp (Decoded, Data, Size) != 0) {
+    Status = EFI_ABORTED;
+  }
+
+  free (Decoded);
+  free (Scratch);
+  return Status;
+}
+
+STATIC
+EFI_STATUS
+BenchmarkTianoParse (
+  IN UINT8    *Buffer,
+  IN UINTN    BufferSize,
+  IN UINTN    Iterations
+  )
+/*++
+
+Routine Description:
+
+  Compare the greedy Tiano parser (CompressLevelDefault) with the optimal
+  parser (CompressLevelOptimal). Every --input file is compressed on its
+  own, as GenSec compresses each driver; without --input the generated
+  buffer is compressed. Every result is decoded and checked.
+
+Arguments:
+
+  Buffer      - Generated data, used when no corpus is given
+  BufferSize  - Size of Buffer
+  Iterations  - Number of times each file is compressed per level
+
+Returns:
+
+  EFI_SUCCESS  - All files round tripped at both levels.
+  other        - A file failed to compress or decode.
+
+--*/
+{
+  STATIC CONST struct {
+    COMPRESS_LEVEL  Level;
+    CHAR8           *Name;
+  } Parsers[] = {
+    { CompressLevelDefault, "greedy"  },
+    { CompressLevelOptimal, "optimal" }
+  };
+  TIANO_COMPRESS_CONTEXT  *Context;
+  CORPUS_FILE             Generated;
+  CORPUS_FILE             *Files;
+  UINTN                   FileCount;
+  UINTN                   ParserIndex;
+  UINTN                   FileIndex;
+  UINTN                   Index;
+  UINT8                   *Output;
+  UINT32                  OutputSize;
+  UINT32                  CompressedSize;
+  UINT64                  InputTotal;
+  UINT64                  OutputTotal;
+  UINT64                  Elapsed;
+  EFI_STATUS              Status;
+
+  if (mCorpusCount != 0) {
+    Files     = mCorpus;
+    FileCount = mCorpusCount;
+  } else {
+    Generated.Name  = "generated";
+    Generated.Data  = Buffer;
+    Generated.Size  = (UINT32) BufferSize;
+    Files           = &Generated;
+    FileCount       = 1;
+  }
+
+  Status = TianoCompressCreateContext (&Context);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Output      = NULL;
+  OutputSize  = 0;
+  for (ParserIndex = 0; ParserIndex < sizeof (Parsers) / sizeof (Parsers[0]); ParserIndex++) {
+    Status = TianoCompressSetLevel (Context, Parsers[ParserIndex].Level);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    InputTotal  = 0;
+    OutputTotal = 0;
+    Elapsed     = 0;
+    for (FileIndex = 0; FileIndex < FileCount && !EFI_ERROR (Status); FileIndex++) {
+      for (Index = 0; Index < Iterations; Index++) {
+        Status = TianoRoundTrip (
+                   Context,
+                   Files[FileIndex].Data,
+                   Files[FileIndex].Size,
+                   &Output,
+                   &OutputSize,
+                   &CompressedSize,
+                   &Elapsed
+                   );
+        if (EFI_ERROR (Status)) {
+          Error (NULL, 0, 3000, "Invalid", "%s parse of %s failed to round trip", Parsers[ParserIndex].Name, Files[FileIndex].Name);
+          break;
+        }
+      }
+      InputTotal  += Files[FileIndex].Size;
+      OutputTotal += CompressedSize;
+    }
+
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+    ReportCompression ("tiano-parse", Parsers[ParserIndex].Name, InputTotal, OutputTotal, Iterations, Elapsed, GetPeakMemoryKb ());
+  }
+
+  free (Output);
+  TianoCompressFreeContext (Context);
+  return Status;
+}
+
+STATIC
+VOID
+MakeCompressibleSample (
+  IN  UINT8   *Buffer,
+  IN  UINTN   BufferSize,
+  OUT UINT8   *Sample
+  )
+/*++
+
+Routine Description:
+
+  Build reproducible compressible data from the random generated buffer:
+  random literals mixed with copies of earlier data at near and far
+  distances, a mix closer to executable images than random bytes are.
+
+Arguments:
+
+  Buffer      - Random data to take literals from
+  BufferSize  - Size of Buffer and Sample
+  Sample      - Receives the sample
+
+Returns:
+
+  None
+
+--*/
+{
+  UINTN   Index;
+  UINTN   Length;
+  UINTN   Distance;
+  UINT32  Seed;
+
+  Seed  = 0x87654321;
+  Index = 0;
+  while (Index < BufferSize) {
+    Seed = Seed * 1103515245 + 12345;
+    if (Index < 64 || ((Seed >> 16) & 3) == 0) {
+      Sample[Index] = Buffer[Index];
+      Index++;
+      continue;
+    }
+
+    Length    = 3 + ((Seed >> 8) & 0x1F);
+    Distance  = 1 + ((Seed >> 13) & ((Seed & 0x80000000) != 0 ? 0xFFFF : 0x3F));
+    if (Distance > Index) {
+      Distance = Index;
+    }
+    if (Length > BufferSize - Index) {
+      Length = BufferSize - Index;
+    }
+    while (Length-- > 0) {
+      Sample[Index] = Sample[Index - Distance];
+      Index++;
+    }
+  }
+}
+
+STATIC
+EFI_STATUS
+BenchmarkDecompress (
+  IN UINT8    *Buffer,
+  IN UINTN    BufferSize,
+  IN UINTN    Iterations
+  )
+/*++
+
+Routine Description:
+
+  Measure EfiDecompress() and TianoDecompress() against the reference
+  decoder in DecompressRef.c. Every --input file, or without them a
+  compressible sample built from the generated buffer, is compressed with
+  both algorithms, and every decoder must reproduce it exactly.
+
+Arguments:
+
+  Buffer      - Generated data, used when no corpus is given
+  BufferSize  - Size of Buffer
+  Iterations  - Number of times each file is decompressed per decoder
+
+Returns:
+
+  EFI_SUCCESS           - All decoders reproduced every file.
+  EFI_OUT_OF_RESOURCES  - No resource to complete function.
+  EFI_ABORTED           - A decoder produced different data.
+
+--*/
+{
+  STATIC CONST struct {
+    CHAR8                 *Name[2];
+    COMPRESS_FUNCTION     Compress;
+    DECOMPRESS_FUNCTION   Decompress[2];
+  } Algorithms[] = {
+    { { "efi",   "efi-ref"   }, EfiCompress,   { EfiDecompress,   RefEfiDecompress   } },
+    { { "tiano", "tiano-ref" }, TianoCompress, { TianoDecompress, RefTianoDecompress } }
+  };
+  CORPUS_FILE   Generated;
+  CORPUS_FILE   *Files;
+  UINTN         FileCount;
+  UINTN         Algorithm;
+  UINTN         Decoder;
+  UINTN         FileIndex;
+  UINTN         Index;
+  UINT8         *Compressed;
+  UINT8         *Decoded;
+  UINT8         *Scratch;
+  UINT32        CompressedSize;
+  UINT32        DstSize;
+  UINT32        ScratchSize;
+  UINT64        InputTotal;
+  UINT64        Elapsed[2];
+  UINT64        Start;
+  EFI_STATUS    Status;
+
+  Generated.Data = NULL;
+  if (mCorpusCount != 0) {
+    Files     = mCorpus;
+    FileCount = mCorpusCount;
+  } else {
+    Generated.Name  = "generated";
+    Generated.Size  = (UINT32) BufferSize;
+    Generated.Data  = (UINT8 *) malloc (BufferSize);
+    if (Generated.Data == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+    MakeCompressibleSample (Buffer, BufferSize, Generated.Data);
+    Files     = &Generated;
+    FileCount = 1;
+  }
+
+  Status = EFI_SUCCESS;
+  for (Algorithm = 0; Algorithm < sizeof (Algorithms) / sizeof (Algorithms[0]) && !EFI_ERROR (Status); Algorithm++) {
+    InputTotal  = 0;
+    Elapsed[0]  = 0;
+    Elapsed[1]  = 0;
+    for (FileIndex = 0; FileIndex < FileCount && !EFI_ERROR (Status); FileIndex++) {
+      CompressedSize  = Files[FileIndex].Size + Files[FileIndex].Size / 8 + 1024;
+      Compressed      = (UINT8 *) malloc (CompressedSize);
+      Decoded         = (UINT8 *) malloc (Files[FileIndex].Size + 1);
+      Scratch         = NULL;
+      if (Compressed == NULL || Decoded == NULL) {
+        Status = EFI_OUT_OF_RESOURCES;
+      } else {
+        Status = Algorithms[Algorithm].Compress (Files[FileIndex].Data, Files[FileIndex].Size, Compressed, &CompressedSize);
+      }
+
+      if (!EFI_ERROR (Status)) {
+        Status = TianoGetInfo (Compressed, CompressedSize, &DstSize, &ScratchSize);
+      }
+
+      if (!EFI_ERROR (Status)) {
+        Scratch = (UINT8 *) malloc (ScratchSize);
+        if (Scratch == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+        }
+      }
+
+      for (Decoder = 0; Decoder < 2 && !EFI_ERROR (Status); Decoder++) {
+        memset (Decoded, 0, DstSize);
+        Start = GetTimeInMicroseconds ();
+        for (Index = 0; Index < Iterations && !EFI_ERROR (Status); Index++) {
+          Status = Algorithms[Algorithm].Decompress[Decoder] (Compressed, CompressedSize, Decoded, DstSize, Scratch, ScratchSize);
+        }
+        Elapsed[Decoder] += GetTimeInMicroseconds () - Start;
+
+        if (EFI_ERROR (Status) || DstSize != Files[FileIndex].Size ||
+            memcmp (Decoded, Files[FileIndex].Data, DstSize) != 0) {
+          Error (NULL, 0, 3000, "Invalid", "%s decoder did not reproduce %s", Algorithms[Algorithm].Name[Decoder], Files[FileIndex].Name);
+          Status = EFI_ABORTED;
+        }
+      }
+      InputTotal += Files[FileIndex].Size;
+
+      free (Compressed);
+      free (Decoded);
+      free (Scratch);
+    }
+
+    for (Decoder = 0; Decoder < 2 && !EFI_ERROR (Status); Decoder++) {
+      ReportThroughput ("decompress", Algorithms[Algorithm].Name[Decoder], (UINTN) InputTotal, Iterations, Elapsed[Decoder], GetPeakMemoryKb ());
+    }
+  }
+
+  free (Generated.Data);
+  return Status;
+}
+
+STATIC
+EFI_STATUS
+RunTool (
+  IN  CHAR8   *ToolName,
+  IN  CHAR8   *Mode,
+  IN  CHAR8   *InputFile,
+  IN  CHAR8   *OutputFile,
+  OUT UINT64  *PeakKb
+  )
+/*++
+
+Routine Description:
+
+  Run a compression tool from mToolPath on one file and wait for it.
+
+Arguments:
+
+  ToolName    - File name of the tool
+  Mode        - "-e" or "-d"
+  InputFile   - File to encode or decode
+  OutputFile  - File the tool writes
+  PeakKb      - Raised to the peak resident memory of the tool if that is
+                larger, left unchanged if the host does not report it
+
+Returns:
+
+  EFI_SUCCESS  - The tool ran and exited with status 0.
+  EFI_ABORTED  - The tool could not be started or failed.
+
+--*/
+{
+  CHAR8   Path[_MAX_PATH];
+  CHAR8   *Args[7];
+
+  if (strlen (mToolPath) + strlen (ToolName) + 2 > sizeof (Path)) {
+    return EFI_ABORTED;
+  }
+  sprintf (Path, "%s/%s", mToolPath, ToolName);
+  Args[0] = Path;
+  Args[1] = Mode;
+  Args[2] = "-q";
+  Args[3] = "-o";
+  Args[4] = OutputFile;
+  Args[5] = InputFile;
+  Args[6] = NULL;
+
+#ifdef _WIN32
+  {
+    HANDLE                   Process;
+    DWORD                    ExitCode;
+    PROCESS_MEMORY_COUNTERS  Counters;
+
+    Process = (HANDLE) _spawnv (_P_NOWAIT, Path, Args);
+    if (Process == (HANDLE) -1) {
+      return EFI_ABORTED;
+    }
+    WaitForSingleObject (Process, INFINITE);
+    if (!GetExitCodeProcess (Process, &ExitCode)) {
+      ExitCode = 1;
+    }
+    if (GetProcessMemoryInfo (Process, &Counters, sizeof (Counters)) &&
+        *PeakKb < (UINT64) Counters.PeakWorkingSetSize / 1024) {
+      *PeakKb = (UINT64) Counters.PeakWorkingSetSize / 1024;
+    }
+    CloseHandle (Process);
+    return ExitCode == 0 ? EFI_SUCCESS : EFI_ABORTED;
+  }
+#else
+  {
+    pid_t          Pid;
+    int            ExitStatus;
+    struct rusage  Usage;
+
+    Pid = fork ();
+    if (Pid == 0) {
+      execv (Path, Args);
+      _exit (127);
+    }
+    if (Pid < 0 || wait4 (Pid, &ExitStatus, 0, &Usage) != Pid) {
+      return EFI_ABORTED;
+    }
+#ifdef __APPLE__
+    Usage.ru_maxrss /= 1024;
+#endif
+    if (*PeakKb < (UINT64) Usage.ru_maxrss) {
+      *PeakKb = (UINT64) Usage.ru_maxrss;
+    }
+    return (WIFEXITED (ExitStatus) && WEXITSTATUS (ExitStatus) == 0) ? EFI_SUCCESS : EFI_ABORTED;
+  }
+#endif
+}
+
+STATIC
+EFI_STATUS
+BenchmarkCodecTool (
+  IN CHAR8        *Name,
+  IN CHAR8        *ToolName,
+  IN CORPUS_FILE  *Files,
+  IN UINTN        FileCount,
+  IN UINTN        Iterations
+  )
+/*++
+
+Routine Description:
+
+  Measure a compression tool the way the build runs it, one process per
+  file. The times include process start and file I/O. Every file is
+  decoded again by the tool and compared with the original.
+
+Arguments:
+
+  Name        - Variant name of the results
+  ToolName    - File name of the tool in mToolPath
+  Files       - Corpus to compress
+  FileCount   - Number of entries in Files
+  Iterations  - Number of times each file is encoded and decoded
+
+Returns:
+
+  EFI_SUCCESS           - The tool round tripped every file.
+  EFI_OUT_OF_RESOURCES  - No resource to complete function.
+  EFI_ABORTED           - The tool failed or produced different data.
+
+--*/
+{
+  STATIC CHAR8  InputFile[]       = "Benchmark.in.tmp";
+  STATIC CHAR8  CompressedFile[]  = "Benchmark.cmp.tmp";
+  STATIC CHAR8  DecodedFile[]     = "Benchmark.out.tmp";
+  FILE          *File;
+  UINTN         FileIndex;
+  UINTN         Index;
+  UINT8         *Decoded;
+  UINT32        CompressedSize;
+  UINT32        DecodedSize;
+  UINT64        InputTotal;
+  UINT64        OutputTotal;
+  UINT64        Elapsed[2];
+  UINT64        PeakKb[2];
+  UINT64        Start;
+  EFI_STATUS    Status;
+
+  Status          = EFI_SUCCESS;
+  InputTotal      = 0;
+  OutputTotal     = 0;
+  CompressedSize  = 0;
+  Elapsed[0]      = 0;
+  Elapsed[1]      = 0;
+  PeakKb[0]       = 0;
+  PeakKb[1]       = 0;
+  for (FileIndex = 0; FileIndex < FileCount && !EFI_ERROR (Status); FileIndex++) {
+    File = fopen (InputFile, "wb");
+    if (File == NULL) {
+      Error (NULL, 0, 0001, "Error opening file", InputFile);
+      return EFI_ABORTED;
+    }
+    if (fwrite (Files[FileIndex].Data, 1, Files[FileIndex].Size, File) != Files[FileIndex].Size) {
+      Status = EFI_ABORTED;
+    }
+    fclose (File);
+
+    for (Index = 0; Index < Iterations && !EFI_ERROR (Status); Index++) {
+      Start   = GetTimeInMicroseconds ();
+      Status  = RunTool (ToolName, "-e", InputFile, CompressedFile, &PeakKb[0]);
+      Elapsed[0] += GetTimeInMicroseconds () - Start;
+    }
+    for (Index = 0; Index < Iterations && !EFI_ERROR (Status); Index++) {
+      Start   = GetTimeInMicroseconds ();
+      Status  = RunTool (ToolName, "-d", CompressedFile, DecodedFile, &PeakKb[1]);
+      Elapsed[1] += GetTimeInMicroseconds () - Start;
+    }
+
+    if (!EFI_ERROR (Status)) {
+      Status = GetFileImage (DecodedFile, (CHAR8 **) &Decoded, &DecodedSize);
+      if (!EFI_ERROR (Status)) {
+        if (DecodedSize != Files[FileIndex].Size || memcmp (Decoded, Files[FileIndex].Data, DecodedSize) != 0) {
+          Status = EFI_ABORTED;
+        }
+        free (Decoded);
+      }
+    }
+    if (!EFI_ERROR (Status)) {
+      File = fopen (CompressedFile, "rb");
+      if (File == NULL) {
+        Status = EFI_ABORTED;
+      } else {
+        CompressedSize = _filelength (fileno (File));
+        fclose (File);
+      }
+    }
+    if (EFI_ERROR (Status)) {
+      Error (NULL, 0, 3000, "Invalid", "%s did not round trip %s", ToolName, Files[FileIndex].Name);
+    }
+
+    InputTotal  += Files[FileIndex].Size;
+    OutputTotal += CompressedSize;
+  }
+
+  remove (InputFile);
+  remove (CompressedFile);
+  remove (DecodedFile);
+
+  if (!EFI_ERROR (Status)) {
+    ReportCompression ("encode", Name, InputTotal, OutputTotal, Iterations, Elapsed[0], PeakKb[0]);
+    ReportThroughput ("decode", Name, (UINTN) InputTotal, Iterations, Elapsed[1], PeakKb[1]);
+  }
+  return Status;
+}
+
+STATIC
+EFI_STATUS
+BenchmarkCodecs (
+  IN UINT8    *Buffer,
+  IN UINTN    BufferSize,
+  IN UINTN    Iterations
+  )
+/*++
+
+Routine Description:
+
+  Measure encode and decode speed, ratio and peak memory of every codec
+  GenSec and GenFfs can use: the Efi and Tiano routines of the Common
+  library, the LZMA encoder of LzmaCompress with one and two threads and,
+  with --tool-path, the TianoCompress and LzmaCompress tools. The corpus
+  is every --input file, or without them a compressible sample built from
+  the generated buffer. Every file must decode to its original data.
+
+Arguments:
+
+  Buffer      - Generated data, used when no corpus is given
+  BufferSize  - Size of Buffer
+  Iterations  - Number of times each file is encoded and decoded
+
+Returns:
+
+  EFI_SUCCESS           - All codecs round tripped every file.
+  EFI_OUT_OF_RESOURCES  - No resource to complete function.
+  EFI_ABORTED           - A codec failed or produced different data.
+
+--*/
+{
+  STATIC CONST struct {
+    CHAR8                 *Name;
+    COMPRESS_FUNCTION     Compress;
+    GETINFO_FUNCTION      GetInfo;
+    DECOMPRESS_FUNCTION   Decompress;
+  } Codecs[] = {
+    { "efi",     EfiCompress,         EfiGetInfo,       EfiDecompress       },
+    { "tiano",   TianoCompress,       TianoGetInfo,     TianoDecompress     },
+    { "lzma",    LzmaCodecCompress,   LzmaCodecGetInfo, LzmaCodecDecompress },
+    { "lzma-mt", LzmaCodecMtCompress, LzmaCodecGetInfo, LzmaCodecDecompress }
+  };
+  STATIC CONST struct {
+    CHAR8   *Name;
+    CHAR8   *ToolName;
+  } Tools[] = {
+    { "tiano-tool", "TianoCompress" },
+    { "lzma-tool",  "LzmaCompress"  }
+  };
+  CORPUS_FILE   Generated;
+  CORPUS_FILE   *Files;
+  UINTN         FileCount;
+  UINTN         Codec;
+  UINTN         FileIndex;
+  UINTN         Index;
+  UINT8         **Compressed;
+  UINT32        *CompressedSize;
+  UINT8         *Decoded;
+  UINT8         *Scratch;
+  UINT32        BufferLimit;
+  UINT32        DstSize;
+  UINT32        ScratchSize;
+  UINT64        InputTotal;
+  UINT64        OutputTotal;
+  UINT64        Elapsed;
+  UINT64        Start;
+  EFI_STATUS    Status;
+
+  Generated.Data = NULL;
+  if (mCorpusCount != 0) {
+    Files     = mCorpus;
+    FileCount = mCorpusCount;
+  } else {
+    Generated.Name  = "generated";
+    Generated.Size  = (UINT32) BufferSize;
+    Generated.Data  = (UINT8 *) malloc (BufferSize);
+    if (Generated.Data == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+    MakeCompressibleSample (Buffer, BufferSize, Generated.Data);
+    Files     = &Generated;
+    FileCount = 1;
+  }
+
+  //
+  // Every file is encoded before any is decoded, so the peak memory of
+  // the encoder and of the decoder are reported separately.
+  //
+  Compressed      = (UINT8 **) calloc (FileCount, sizeof (UINT8 *));
+  CompressedSize  = (UINT32 *) calloc (FileCount, sizeof (UINT32));
+  if (Compressed == NULL || CompressedSize == NULL) {
+    free (Compressed);
+    free (CompressedSize);
+    free (Generated.Data);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = EFI_SUCCESS;
+  for (Codec = 0; Codec < sizeof (Codecs) / sizeof (Codecs[0]) && !EFI_ERROR (Status); Codec++) {
+    InputTotal  = 0;
+    OutputTotal = 0;
+    Elapsed     = 0;
+    ResetPeakMemory ();
+    for (FileIndex = 0; FileIndex < FileCount && !EFI_ERROR (Status); FileIndex++) {
+      BufferLimit = Files[FileIndex].Size + Files[FileIndex].Size / 8 + 1024;
+      Compressed[FileIndex] = (UINT8 *) malloc (BufferLimit);
+      if (Compressed[FileIndex] == NULL) {
+        Status = EFI_OUT_OF_RESOURCES;
+        break;
+      }
+
+      Start = GetTimeInMicroseconds ();
+      for (Index = 0; Index < Iterations && !EFI_ERROR (Status); Index++) {
+        CompressedSize[FileIndex] = BufferLimit;
+        Status = Codecs[Codec].Compress (Files[FileIndex].Data, Files[FileIndex].Size, Compressed[FileIndex], &CompressedSize[FileIndex]);
+      }
+      Elapsed += GetTimeInMicroseconds () - Start;
+      if (EFI_ERROR (Status)) {
+        Error (NULL, 0, 3000, "Invalid", "%s encoder failed on %s", Codecs[Codec].Name, Files[FileIndex].Name);
+      }
+
+      InputTotal  += Files[FileIndex].Size;
+      OutputTotal += CompressedSize[FileIndex];
+    }
+    if (!EFI_ERROR (Status)) {
+      ReportCompression ("encode", Codecs[Codec].Name, InputTotal, OutputTotal, Iterations, Elapsed, GetPeakMemoryKb ());
+    }
+
+    Elapsed = 0;
+    for (FileIndex = 0; FileIndex < FileCount && !EFI_ERROR (Status); FileIndex++) {
+      Scratch = NULL;
+      Decoded = NULL;
+      Status  = Codecs[Codec].GetInfo (Compressed[FileIndex], CompressedSize[FileIndex], &DstSize, &ScratchSize);
+      if (!EFI_ERROR (Status)) {
+        Decoded = (UINT8 *) malloc (DstSize + 1);
+        Scratch = (UINT8 *) malloc (ScratchSize);
+        if (Decoded == NULL || Scratch == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+        }
+      }
+
+      Start = GetTimeInMicroseconds ();
+      for (Index = 0; Index < Iterations && !EFI_ERROR (Status); Index++) {
+        Status = Codecs[Codec].Decompress (Compressed[FileIndex], CompressedSize[FileIndex], Decoded, DstSize, Scratch, ScratchSize);
+      }
+      Elapsed += GetTimeInMicroseconds () - Start;
+
+      if (EFI_ERROR (Status) || DstSize != Files[FileIndex].Size ||
+          memcmp (Decoded, Files[FileIndex].Data, DstSize) != 0) {
+        Error (NULL, 0, 3000, "Invalid", "%s decoder did not reproduce %s", Codecs[Codec].Name, Files[FileIndex].Name);
+        Status = EFI_ABORTED;
+      }
+      free (Decoded);
+      free (Scratch);
+    }
+    if (!EFI_ERROR (Status)) {
+      ReportThroughput ("decode", Codecs[Codec].Name, (UINTN) InputTotal, Iterations, Elapsed, GetPeakMemoryKb ());
+    }
+
+    for (FileIndex = 0; FileIndex < FileCount; FileIndex++) {
+      free (Compressed[FileIndex]);
+      Compressed[FileIndex] = NULL;
+    }
+  }
+
+  if (mToolPath != NULL) {
+    for (Index = 0; Index < sizeof (Tools) / sizeof (Tools[0]) && !EFI_ERROR (Status); Index++) {
+      Status = BenchmarkCodecTool (Tools[Index].Name, Tools[Index].ToolName, Files, FileCount, Iterations);
+    }
+  }
+
+  free (Compressed);
+  free (CompressedSize);
+  free (Generated.Data);
+  return Status;
+}
+
+STATIC
+UINT8 *
+MakeRelocatableImage (
+  IN  UINT8                         *Buffer,
+  IN  UINTN                         BufferSize,
+  IN  BOOLEAN                       Pe32Plus,
+  OUT PE_COFF_LOADER_IMAGE_CONTEXT  *ImageContext
+  )
+/*++
+
+Routine Description:
+
+  Build a loaded PE32 or PE32+ image whose data pages are taken from the
+  generated buffer and hold one fixup about every 16 bytes, as dense as the
+  data sections of a typical driver. The PE32+ image has DIR64 fixups with
+  the pages in increasing order, like the images GenFw writes. The PE32
+  image has HIGHLOW fixups with some HIGH and LOW pairs and the pages in
+  decreasing order, so the index also has to sort and split its runs.
+
+Arguments:
+
+  Buffer        - Generated data for the image pages
+  BufferSize    - Size of Buffer
+  Pe32Plus      - TRUE for an X64 PE32+ image, FALSE for an IA32 PE32 image
+  ImageContext  - Receives the context of the loaded image
+
+Returns:
+
+  The image, NULL if it could not be allocated.
+
+--*/
+{
+  EFI_IMAGE_DOS_HEADER              *DosHdr;
+  EFI_IMAGE_OPTIONAL_HEADER_UNION   *PeHdr;
+  EFI_IMAGE_DATA_DIRECTORY          *RelocDir;
+  EFI_IMAGE_BASE_RELOCATION         *Block;
+  UINT8                             *Image;
+  UINT16                            *Entry;
+  UINT32                            PageCount;
+  UINT32                            Page;
+  UINT32                            PageRva;
+  UINT32                            Slot;
+  UINT32                            Fixup;
+  UINT32                            RelocRva;
+  UINT32                            RelocSize;
+  UINT32                            ImageSize;
+  UINT32                            Seed;
+
+  PageCount = (UINT32) ((BufferSize + EFI_PAGE_SIZE - 1) / EFI_PAGE_SIZE);
+  RelocRva  = (PageCount + 1) * EFI_PAGE_SIZE;
+  RelocSize = PageCount * (sizeof (EFI_IMAGE_BASE_RELOCATION) + (EFI_PAGE_SIZE / 16 * 2 + 1) * sizeof (UINT16));
+  ImageSize = RelocRva + ((RelocSize + EFI_PAGE_SIZE - 1) & ~(EFI_PAGE_SIZE - 1));
+
+  Image = (UINT8 *) calloc (1, ImageSize);
+  if (Image == NULL) {
+    return NULL;
+  }
+  memcpy (Image + EFI_PAGE_SIZE, Buffer, BufferSize);
+
+  DosHdr            = (EFI_IMAGE_DOS_HEADER *) Image;
+  DosHdr->e_magic   = EFI_IMAGE_DOS_SIGNATURE;
+  DosHdr->e_lfanew  = sizeof (EFI_IMAGE_DOS_HEADER);
+  PeHdr             = (EFI_IMAGE_OPTIONAL_HEADER_UNION *) (Image + DosHdr->e_lfanew);
+  PeHdr->Pe32.Signature = EFI_IMAGE_NT_SIGNATURE;
+  if (Pe32Plus) {
+    PeHdr->Pe32Plus.FileHeader.Machine                    = EFI_IMAGE_MACHINE_X64;
+    PeHdr->Pe32Plus.FileHeader.SizeOfOptionalHeader       = sizeof (EFI_IMAGE_OPTIONAL_HEADER64);
+    PeHdr->Pe32Plus.OptionalHeader.Magic                  = EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC;
+    PeHdr->Pe32Plus.OptionalHeader.ImageBase              = 0x180000000ULL;
+    PeHdr->Pe32Plus.OptionalHeader.SectionAlignment       = EFI_PAGE_SIZE;
+    PeHdr->Pe32Plus.OptionalHeader.FileAlignment          = EFI_PAGE_SIZE;
+    PeHdr->Pe32Plus.OptionalHeader.SizeOfImage            = ImageSize;
+    PeHdr->Pe32Plus.OptionalHeader.NumberOfRvaAndSizes    = EFI_IMAGE_NUMBER_OF_DIRECTORY_ENTRIES;
+    RelocDir = &PeHdr->Pe32Plus.OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC];
+  } else {
+    PeHdr->Pe32.FileHeader.Machine                        = EFI_IMAGE_MACHINE_IA32;
+    PeHdr->Pe32.FileHeader.SizeOfOptionalHeader           = sizeof (EFI_IMAGE_OPTIONAL_HEADER32);
+    PeHdr->Pe32.OptionalHeader.Magic                      = EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC;
+    PeHdr->Pe32.OptionalHeader.ImageBase                  = 0x10000000;
+    PeHdr->Pe32.OptionalHeader.SectionAlignment           = EFI_PAGE_SIZE;
+    PeHdr->Pe32.OptionalHeader.FileAlignment              = EFI_PAGE_SIZE;
+    PeHdr->Pe32.OptionalHeader.SizeOfImage                = ImageSize;
+    PeHdr->Pe32.OptionalHeader.NumberOfRvaAndSizes        = EFI_IMAGE_NUMBER_OF_DIRECTORY_ENTRIES;
+    RelocDir = &PeHdr->Pe32.OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC];
+  }
+
+  //
+  // One block per data page. The fixup of each 16 byte slot is at a
+  // pseudo random offset that keeps it inside the slot.
+  //
+  Block = (EFI_IMAGE_BASE_RELOCATION *) (Image + RelocRva);
+  Seed  = 0x2545F491;
+  for (Page = 0; Page < PageCount; Page++) {
+    PageRva = Pe32Plus ? Page + 1 : PageCount - Page;
+    if ((PageRva - 1) * EFI_PAGE_SIZE >= BufferSize) {
+      continue;
+    }
+    Block->VirtualAddress = PageRva * EFI_PAGE_SIZE;
+    Entry = (UINT16 *) (Block + 1);
+    for (Slot = 0; Slot < EFI_PAGE_SIZE / 16; Slot++) {
+      Seed  = Seed * 1103515245 + 12345;
+      Fixup = Slot * 16 + ((Seed >> 16) & 7);
+      if ((PageRva - 1) * EFI_PAGE_SIZE + Fixup + sizeof (UINT64) > BufferSize) {
+        break;
+      }
+      if (Pe32Plus) {
+        *Entry++ = (UINT16) ((EFI_IMAGE_REL_BASED_DIR64 << 12) | Fixup);
+      } else if ((Seed >> 24) < 4) {
+        *Entry++ = (UINT16) ((EFI_IMAGE_REL_BASED_LOW << 12) | Fixup);
+        *Entry++ = (UINT16) ((EFI_IMAGE_REL_BASED_HIGH << 12) | (Fixup + 2));
+      } else {
+        *Entry++ = (UINT16) ((EFI_IMAGE_REL_BASED_HIGHLOW << 12) | Fixup);
+      }
+    }
+    if (((UINTN) Entry & 3) != 0) {
+      *Entry++ = EFI_IMAGE_REL_BASED_ABSOLUTE;
+    }
+    Block->SizeOfBlock = (UINT32) ((UINT8 *) Entry - (UINT8 *) Block);
+    Block = (EFI_IMAGE_BASE_RELOCATION *) Entry;
+  }
+  RelocDir->VirtualAddress  = RelocRva;
+  RelocDir->Size            = (UINT32) ((UINT8 *) Block - (Image + RelocRva));
+
+  memset (ImageContext, 0, sizeof (PE_COFF_LOADER_IMAGE_CONTEXT));
+  ImageContext->ImageAddress        = (UINTN) Image;
+  ImageContext->ImageSize           = ImageSize;
+  ImageContext->PeCoffHeaderOffset  = DosHdr->e_lfanew;
+  ImageContext->SectionAlignment    = EFI_PAGE_SIZE;
+  ImageContext->Machine             = Pe32Plus ? EFI_IMAGE_MACHINE_X64 : EFI_IMAGE_MACHINE_IA32;
+  return Image;
+}
+
+STATIC
+EFI_STATUS
+BenchmarkRebase (
+  IN UINT8    *Buffer,
+  IN UINTN    BufferSize,
+  IN UINTN    Iterations
+  )
+/*++
+
+Routine Description:
+
+  Measure PeCoffLoaderRelocateImage, which walks the relocation blocks of
+  the image at every rebase, against PeCoffLoaderRelocateImageWithIndex,
+  which applies a relocation index built once, and the time to build the
+  index. Two copies of a PE32+ and of a PE32 image are moved through the
+  same base addresses, and must be identical at the end.
+
+Arguments:
+
+  Buffer      - Generated data for the image pages
+  BufferSize  - Size of Buffer
+  Iterations  - Number of times each image is rebased per variant
+
+Returns:
+
+  EFI_SUCCESS           - Both ways gave the same images.
+  EFI_OUT_OF_RESOURCES  - No resource to complete function.
+  EFI_ABORTED           - A rebase failed or the images differ.
+
+--*/
+{
+  STATIC CONST struct {
+    BOOLEAN   Pe32Plus;
+    CHAR8     *Name[3];
+  } Images[] = {
+    { TRUE,  { "x64-walk",  "x64-index",  "x64-build"  } },
+    { FALSE, { "ia32-walk", "ia32-index", "ia32-build" } }
+  };
+  PE_COFF_LOADER_IMAGE_CONTEXT  Context[2];
+  PE_COFF_RELOCATION_INDEX      *RelocIndex;
+  UINT8                         *Image[2];
+  UINTN                         ImageIndex;
+  UINTN                         Index;
+  UINT64                        Start;
+  UINT64                        Elapsed[3];
+  EFI_STATUS                    Status;
+
+  Status = EFI_SUCCESS;
+  for (ImageIndex = 0; ImageIndex < sizeof (Images) / sizeof (Images[0]) && !EFI_ERROR (Status); ImageIndex++) {
+    RelocIndex  = NULL;
+    Image[0]    = MakeRelocatableImage (Buffer, BufferSize, Images[ImageIndex].Pe32Plus, &Context[0]);
+    Image[1]    = MakeRelocatableImage (Buffer, BufferSize, Images[ImageIndex].Pe32Plus, &Context[1]);
+    if (Image[0] == NULL || Image[1] == NULL) {
+      free (Image[0]);
+      free (Image[1]);
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    Start = GetTimeInMicroseconds ();
+    for (Index = 0; Index < Iterations && !EFI_ERROR (Status); Index++) {
+      PeCoffLoaderFreeRelocationIndex (RelocIndex);
+      Status = PeCoffLoaderBuildRelocationIndex (&Context[1], &RelocIndex);
+    }
+    Elapsed[2] = GetTimeInMicroseconds () - Start;
+    if (EFI_ERROR (Status)) {
+      Error (NULL, 0, 3000, "Invalid", "the relocation index of the %s image could not be built", Images[ImageIndex].Name[1]);
+      Status = EFI_ABORTED;
+    }
+
+    //
+    // Alternate between bases below and above the link address so every
+    // carry and borrow of the fixups is exercised.
+    //
+    Start = GetTimeInMicroseconds ();
+    for (Index = 0; Index < Iterations && !EFI_ERROR (Status); Index++) {
+      Context[0].DestinationAddress = 0x100000 * (Index + 1) + ((Index & 1) != 0 ? 0xFFFFF000 : 0);
+      Status = PeCoffLoaderRelocateImage (&Context[0]);
+    }
+    Elapsed[0] = GetTimeInMicroseconds () - Start;
+
+    Start = GetTimeInMicroseconds ();
+    for (Index = 0; Index < Iterations && !EFI_ERROR (Status); Index++) {
+      Context[1].DestinationAddress = 0x100000 * (Index + 1) + ((Index & 1) != 0 ? 0xFFFFF000 : 0);
+      Status = PeCoffLoaderRelocateImageWithIndex (&Context[1], RelocIndex);
+    }
+    Elapsed[1] = GetTimeInMicroseconds () - Start;
+
+    if (EFI_ERROR (Status) || memcmp (Image[0], Image[1], (UINTN) Context[0].ImageSize) != 0) {
+      Error (NULL, 0, 3000, "Invalid", "%s and %s gave different images", Images[ImageIndex].Name[0], Images[ImageIndex].Name[1]);
+      Status = EFI_ABORTED;
+    }
+
+    for (Index = 0; Index < 3 && !EFI_ERROR (Status); Index++) {
+      ReportThroughput ("rebase", Images[ImageIndex].Name[Index], (UINTN) Context[0].ImageSize, Iterations, Elapsed[Index], GetPeakMemoryKb ());
+    }
+
+    PeCoffLoaderFreeRelocationIndex (RelocIndex);
+    free (Image[0]);
+    free (Image[1]);
+  }
+
+  return Status;
+}
+
+STATIC BENCHMARK_ENTRY  mBenchmarks[] = {
+  { "crc32",       "CalculateCrc32 with every available engine",          BenchmarkCrc32 },
+  { "tiano-parse", "TianoCompress ratio and time, greedy versus optimal", BenchmarkTianoParse },
+  { "decompress",  "Efi and Tiano decoders versus the reference decoder",  BenchmarkDecompress },
+  { "codecs",      "Efi, Tiano and LZMA speed, ratio and peak memory",     BenchmarkCodecs },
+  { "rebase",      "PE/COFF relocation walker versus relocation index",    BenchmarkRebase },
+  { NULL,          NULL,                                                   NULL }
+};
+
+STATIC
+EFI_STATUS
+WriteResults (
+  IN CHAR8    *FileName
+  )
+/*++
+
+Routine Description:
+
+  Write mResults as a JSON array with one measurement per line, the
+  format --baseline reads back.
+
+Arguments:
+
+  FileName  - File to write
+
+Returns:
+
+  EFI_SUCCESS  - The file was written.
+  EFI_ABORTED  - The file could not be written.
+
+--*/
+{
+  FILE    *File;
+  UINTN   Index;
+
+  File = fopen (FileName, "w");
+  if (File == NULL) {
+    Error (NULL, 0, 0001, "Error opening file", FileName);
+    return EFI_ABORTED;
+  }
+
+  fprintf (File, "[\n");
+  for (Index = 0; Index < mResultCount; Index++) {
+    fprintf (
+      File,
+      "  {\"benchmark\": \"%s\", \"variant\": \"%s\", \"size\": %llu, \"compressed\": %llu, "
+      "\"iterations\": %llu, \"time_us\": %llu, \"mbps\": %.3f, \"peak_kb\": %llu}%s\n",
+      mResults[Index].Name,
+      mResults[Index].Variant,
+      (unsigned long long) mResults[Index].Size,
+      (unsigned long long) mResults[Index].Compressed,
+      (unsigned long long) mResults[Index].Iterations,
+      (unsigned long long) mResults[Index].ElapsedUs,
+      mResults[Index].MegaBytesPerSecond,
+      (unsigned long long) mResults[Index].PeakKb,
+      Index + 1 < mResultCount ? "," : ""
+      );
+  }
+  fprintf (File, "]\n");
+
+  if (fclose (File) != 0) {
+    Error (NULL, 0, 0002, "Error writing file", FileName);
+    return EFI_ABORTED;
+  }
+  return EFI_SUCCESS;
+}
+
+STATIC
+BOOLEAN
+GetJsonValue (
+  IN  CHAR8   *Line,
+  IN  CHAR8   *Key,
+  OUT CHAR8   *Value,
+  IN  UINTN   ValueSize
+  )
+/*++
+
+Routine Description:
+
+  Find "Key": Value in one line written by WriteResults() and copy the
+  value, without quotes, to Value.
+
+Arguments:
+
+  Line      - Line to search
+  Key       - Key to look for
+  Value     - Receives the value
+  ValueSize - Size of Value
+
+Returns:
+
+  TRUE   - The key was found.
+  FALSE  - The key is not on the line.
+
+--*/
+{
+  CHAR8   Pattern[40];
+  CHAR8   *Start;
+  UINTN   Length;
+
+  sprintf (Pattern, "\"%.32s\": ", Key);
+  Start = strstr (Line, Pattern);
+  if (Start == NULL) {
+    return FALSE;
+  }
+  Start += strlen (Pattern);
+  if (*Start == '"') {
+    Start++;
+    Length = strcspn (Start, "\"");
+  } else {
+    Length = strcspn (Start, ",}");
+  }
+  if (Length >= ValueSize) {
+    Length = ValueSize - 1;
+  }
+  memcpy (Value, Start, Length);
+  Value[Length] = '\0';
+  return TRUE;
+}
+
+STATIC
+EFI_STATUS
+CheckBaseline (
+  IN CHAR8    *FileName,
+  IN UINTN    Margin
+  )
+/*++
+
+Routine Description:
+
+  Compare mResults with the results of an earlier run saved by --json.
+  A measurement fails if its throughput is more than Margin percent below
+  the baseline. Measurements missing from the baseline are not checked.
+
+Arguments:
+
+  FileName  - JSON file written by an earlier --json
+  Margin    - Allowed throughput loss in percent
+
+Returns:
+
+  EFI_SUCCESS  - No measurement regressed.
+  EFI_ABORTED  - The baseline could not be read or a measurement regressed.
+
+--*/
+{
+  CHAR8       *Data;
+  UINT32      Size;
+  CHAR8       *Text;
+  CHAR8       *Line;
+  CHAR8       Name[32];
+  CHAR8       Variant[32];
+  CHAR8       Value[32];
+  double      Baseline;
+  double      Limit;
+  UINTN       Index;
+  UINTN       Checked;
+  EFI_STATUS  Status;
+
+  Status = GetFileImage (FileName, &Data, &Size);
+  if (EFI_ERROR (Status)) {
+    Error (NULL, 0, 0001, "Error opening file", FileName);
+    return EFI_ABORTED;
+  }
+  Text = (CHAR8 *) malloc (Size + 1);
+  if (Text == NULL) {
+    free (Data);
+    return EFI_OUT_OF_RESOURCES;
+  }
+  memcpy (Text, Data, Size);
+  Text[Size] = '\0';
+  free (Data);
+
+  Checked = 0;
+  Status  = EFI_SUCCESS;
+  for (Line = strtok (Text, "\r\n"); Line != NULL; Line = strtok (NULL, "\r\n")) {
+    if (!GetJsonValue (Line, "benchmark", Name, sizeof (Name)) ||
+        !GetJsonValue (Line, "variant", Variant, sizeof (Variant)) ||
+        !GetJsonValue (Line, "mbps", Value, sizeof (Value))) {
+      continue;
+    }
+    Baseline = atof (Value);
+
+    for (Index = 0; Index < mResultCount; Index++) {
+      if (strcmp (mResults[Index].Name, Name) == 0 && strcmp (mResults[Index].Variant, Variant) == 0) {
+        break;
+      }
+    }
+    if (Index == mResultCount) {
+      continue;
+    }
+
+    Checked++;
+    Limit = Baseline * (double) (100 - Margin) / 100.0;
+    if (mResults[Index].MegaBytesPerSecond < Limit) {
+      Error (
+        NULL,
+        0,
+        3000,
+        "Throughput regression",
+        "%s %s: %.2f MB/s, baseline %.2f MB/s, limit %.2f MB/s",
+        Name,
+        Variant,
+        mResults[Index].MegaBytesPerSecond,
+        Baseline,
+        Limit
+        );
+      Status = EFI_ABORTED;
+    }
+  }
+  free (Text);
+
+  fprintf (stdout, "baseline %s: %lu measurements checked, margin %lu%%\n", FileName, (unsigned long) Checked, (unsigned long) Margin);
+  return Status;
+}
+
+VOID
+Usage (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Displays the utility usage syntax to STDOUT
+
+Arguments:
+
+  None
+
+Returns:
+
+  None
+
+--*/
+{
+  BENCHMARK_ENTRY  *Entry;
+
+  //
+  // Summary usage
+  //
+  fprintf (stdout, "\nUsage: %s [options] [benchmark ...]\n\n", UTILITY_NAME);
+
+  //
+  // Copyright declaration
+  //
+  fprintf (stdout, "Copyright (c) 2012, Intel Corporation. All rights reserved.\n\n");
+
+  //
+  // Details Option
+  //
+  fprintf (stdout, "Options:\n");
+  fprintf (stdout, "  -s Size, --size Size  Size in bytes of the generated input buffer.\n");
+  fprintf (stdout, "  -n Count, --iterations Count\n\
+                        Number of times each benchmark processes the buffer.\n");
+  fprintf (stdout, "  -i File, --input File Add File to the corpus used by the compression\n\
+                        benchmarks, e.g. the PE32 images of a build. May be\n\
+                        repeated. The generated buffer is used without it.\n");
+  fprintf (stdout, "  --tool-path Dir       Also run the TianoCompress and LzmaCompress tools\n\
+                        found in Dir in the codecs benchmark.\n");
+  fprintf (stdout, "  --json File           Write the results to File in JSON format.\n");
+  fprintf (stdout, "  --baseline File       Fail when a throughput is more than the margin below\n\
+                        the same measurement in File, written by --json.\n");
+  fprintf (stdout, "  --margin Percent      Allowed throughput loss for --baseline, default %d.\n", DEFAULT_MARGIN);
+  fprintf (stdout, "  --version             Show program's version number and exit.\n");
+  fprintf (stdout, "  -h, --help            Show this help message and exit.\n");
+  fprintf (stdout, "\nBenchmarks (all are run when none is given):\n");
+  for (Entry = mBenchmarks; Entry->Name != NULL; Entry++) {
+    fprintf (stdout, "  %-20s  %s\n", Entry->Name, Entry->Help);
+  }
+}
+
+int
+main (
+  int   argc,
+  CHAR8 *argv[]
+  )
+/*++
+
+Routine Description:
+
+  Main function.
+
+Arguments:
+
+  argc - Number of command line parameters.
+  argv - Array of pointers to parameter strings.
+
+Returns:
+  STATUS_SUCCESS - Utility exits successfully.
+  STATUS_ERROR   - Some error occurred during execution.
+
+--*/
+{
+  EFI_STATUS       Status;
+  UINT64           Value;
+  UINTN            BufferSize;
+  UINTN            Iterations;
+  UINT8            *Buffer;
+  UINTN            Index;
+  UINT32           Seed;
+  BENCHMARK_ENTRY  *Entry;
+  CHAR8            **Selected;
+  UINTN            SelectedCount;
+  CHAR8            *JsonFile;
+  CHAR8            *BaselineFile;
+  UINTN            Margin;
+
+  SetUtilityName (UTILITY_NAME);
+
+  BufferSize    = DEFAULT_BUFFER_SIZE;
+  Iterations    = DEFAULT_ITERATIONS;
+  Selected      = (CHAR8 **) calloc (argc, sizeof (CHAR8 *));
+  SelectedCount = 0;
+  Buffer        = NULL;
+  JsonFile      = NULL;
+  BaselineFile  = NULL;
+  Margin        = DEFAULT_MARGIN;
+  mCorpus       = (CORPUS_FILE *) calloc (argc, sizeof (CORPUS_FILE));
+  if (Selected == NULL || mCorpus == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    return STATUS_ERROR;
+  }
+
+  argc --;
+  argv ++;
+
+  while (argc > 0) {
+    if ((stricmp (argv[0], "-h") == 0) || (stricmp (argv[0], "--help") == 0)) {
+      Version ();
+      Usage ();
+      goto Finish;
+    }
+
+    if (stricmp (argv[0], "--version") == 0) {
+      Version ();
+      goto Finish;
+    }
+
+    if ((stricmp (argv[0], "-s") == 0) || (stricmp (argv[0], "--size") == 0) ||
+        (stricmp (argv[0], "-n") == 0) || (stricmp (argv[0], "--iterations") == 0)) {
+      if (argc < 2) {
+        Error (NULL, 0, 1003, "Invalid option value", "%s requires a value", argv[0]);
+        goto Finish;
+      }
+      Status = AsciiStringToUint64 (argv[1], FALSE, &Value);
+      if (EFI_ERROR (Status) || (Value == 0)) {
+        Error (NULL, 0, 1003, "Invalid option value", "%s = %s", argv[0], argv[1]);
+        goto Finish;
+      }
+      if (argv[0][1] == 's' || argv[0][2] == 's') {
+        BufferSize = (UINTN) Value;
+      } else {
+        Iterations = (UINTN) Value;
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    if (stricmp (argv[0], "--margin") == 0) {
+      if (argc < 2) {
+        Error (NULL, 0, 1003, "Invalid option value", "%s requires a value", argv[0]);
+        goto Finish;
+      }
+      Status = AsciiStringToUint64 (argv[1], FALSE, &Value);
+      if (EFI_ERROR (Status) || (Value > 100)) {
+        Error (NULL, 0, 1003, "Invalid option value", "%s = %s", argv[0], argv[1]);
+        goto Finish;
+      }
+      Margin = (UINTN) Value;
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    if ((stricmp (argv[0], "--json") == 0) || (stricmp (argv[0], "--baseline") == 0) ||
+        (stricmp (argv[0], "--tool-path") == 0)) {
+      if (argc < 2) {
+        Error (NULL, 0, 1003, "Invalid option value", "%s requires a value", argv[0]);
+        goto Finish;
+      }
+      if (stricmp (argv[0], "--json") == 0) {
+        JsonFile = argv[1];
+      } else if (stricmp (argv[0], "--baseline") == 0) {
+        BaselineFile = argv[1];
+      } else {
+        mToolPath = argv[1];
+      }
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    if ((stricmp (argv[0], "-i") == 0) || (stricmp (argv[0], "--input") == 0)) {
+      if (argc < 2) {
+        Error (NULL, 0, 1003, "Invalid option value", "%s requires a value", argv[0]);
+        goto Finish;
+      }
+      mCorpus[mCorpusCount].Name = argv[1];
+      Status = GetFileImage (argv[1], (CHAR8 **) &mCorpus[mCorpusCount].Data, &mCorpus[mCorpusCount].Size);
+      if (EFI_ERROR (Status)) {
+        Error (NULL, 0, 0001, "Error opening file", argv[1]);
+        goto Finish;
+      }
+      mCorpusCount++;
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    if (argv[0][0] == '-') {
+      Error (NULL, 0, 1000, "Unknown option", argv[0]);
+      goto Finish;
+    }
+
+    for (Entry = mBenchmarks; Entry->Name != NULL; Entry++) {
+      if (stricmp (argv[0], Entry->Name) == 0) {
+        break;
+      }
+    }
+    if (Entry->Name == NULL) {
+      Error (NULL, 0, 1000, "Unknown benchmark", argv[0]);
+      goto Finish;
+    }
+    Selected[SelectedCount++] = Entry->Name;
+    argc --;
+    argv ++;
+  }
+
+  //
+  // Fill the input with reproducible pseudo random data.
+  //
+  Buffer = (UINT8 *) malloc (BufferSize);
+  if (Buffer == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    goto Finish;
+  }
+  Seed = 0x12345678;
+  for (Index = 0; Index < BufferSize; Index++) {
+    Seed = Seed * 1103515245 + 12345;
+    Buffer[Index] = (UINT8) (Seed >> 16);
+  }
+
+  for (Entry = mBenchmarks; Entry->Name != NULL; Entry++) {
+    if (SelectedCount != 0) {
+      for (Index = 0; Index < SelectedCount; Index++) {
+        if (Selected[Index] == Entry->Name) {
+          break;
+        }
+      }
+      if (Index == SelectedCount) {
+        continue;
+      }
+    }
+    ResetPeakMemory ();
+    Status = Entry->Function (Buffer, BufferSize, Iterations);
+    if (EFI_ERROR (Status)) {
+      Error (NULL, 0, 3000, "Invalid", "benchmark %s failed", Entry->Name);
+    }
+  }
+
+  if (JsonFile != NULL) {
+    WriteResults (JsonFile);
+  }
+  if (BaselineFile != NULL) {
+    CheckBaseline (BaselineFile, Margin);
+  }
+
+Finish:
+  if (Buffer != NULL) {
+    free (Buffer);
+  }
+  free (Selected);
+  free (mResults);
+  if (mCorpus != NULL) {
+    for (Index = 0; Index < mCorpusCount; Index++) {
+      free (mCorpus[Index].Data);
+    }
+    free (mCorpus);
+  }
+
+  return GetUtilityStatus ();
+}
@@ -0,0 +1,48 @@
+/** @file
+
+Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+This program and the accompanying materials
+are licensed and made available under the terms and conditions of the BSD License
+which accompanies this distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+Module Name:
+
+  DecompressRef.h
+
+Abstract:
+
+  Reference Efi and Tiano decompressor used by the decompress benchmark.
+  Scratch buffers sized by EfiGetInfo()/TianoGetInfo() are large enough.
+
+**/
+
+#ifndef _DECOMPRESS_REF_H
+#define _DECOMPRESS_REF_H
+
+#include <Common/UefiBaseTypes.h>
+
+EFI_STATUS
+RefEfiDecompress (
+  IN      VOID    *Source,
+  IN      UINT32  SrcSize,
+  IN OUT  VOID    *Destination,
+  IN      UINT32  DstSize,
+  IN OUT  VOID    *Scratch,
+  IN      UINT32  ScratchSize
+  );
+
+EFI_STATUS
+RefTianoDecompress (
+  IN      VOID    *Source,
+  IN      UINT32  SrcSize,
+  IN OUT  VOID    *Destination,
+  IN      UINT32  DstSize,
+  IN OUT  VOID    *Scratch,
+  IN      UINT32  ScratchSize
+  );
+
+#endif
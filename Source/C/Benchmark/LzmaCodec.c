@@ -0,0 +1,277 @@
+/** @file
+
+Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+This program and the accompanying materials
+are licensed and made available under the terms and conditions of the BSD License
+which accompanies this distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+Module Name:
+
+  LzmaCodec.c
+
+Abstract:
+
+  LZMA SDK glue for the codec benchmark.
+
+**/
+
+#include <stdlib.h>
+#include "LzmaCodec.h"
+#include "../LzmaCompress/Sdk/C/Alloc.h"
+#include "../LzmaCompress/Sdk/C/LzmaDec.h"
+#include "../LzmaCompress/Sdk/C/LzmaEnc.h"
+
+#define LZMA_HEADER_SIZE (LZMA_PROPS_SIZE + 8)
+
+STATIC VOID *SzAlloc (VOID *P, size_t Size) { return MyAlloc (Size); }
+STATIC VOID SzFree (VOID *P, VOID *Address) { MyFree (Address); }
+STATIC ISzAlloc mAlloc = { SzAlloc, SzFree };
+
+STATIC
+EFI_STATUS
+LzmaEncodeBuffer (
+  IN      UINT8   *SrcBuffer,
+  IN      UINT32  SrcSize,
+  IN      UINT8   *DstBuffer,
+  IN OUT  UINT32  *DstSize,
+  IN      INT32   Threads
+  )
+/*++
+
+Routine Description:
+
+  Compress a buffer with the default LzmaCompress settings.
+
+Arguments:
+
+  SrcBuffer   - The buffer storing the source data
+  SrcSize     - The size of source data
+  DstBuffer   - The buffer to store the compressed data
+  DstSize     - On input, the size of DstBuffer; On output,
+                the size of the actual compressed data.
+  Threads     - Number of encoder threads, 2 enables the
+                multi-threaded match finder
+
+Returns:
+
+  EFI_BUFFER_TOO_SMALL  - The DstBuffer is too small. DstSize contains
+                          a size that is large enough.
+  EFI_SUCCESS           - Compression is successful.
+  EFI_OUT_OF_RESOURCES  - No resource to complete function.
+  EFI_INVALID_PARAMETER - The encoder rejected the data.
+
+--*/
+{
+  CLzmaEncProps  Props;
+  SizeT          OutSize;
+  SizeT          PropsSize;
+  SRes           Res;
+  UINTN          Index;
+
+  if (*DstSize < LZMA_HEADER_SIZE) {
+    *DstSize = SrcSize + SrcSize / 8 + 1024;
+    return EFI_BUFFER_TOO_SMALL;
+  }
+
+  LzmaEncProps_Init (&Props);
+  Props.numThreads = Threads;
+
+  for (Index = 0; Index < 8; Index++) {
+    DstBuffer[LZMA_PROPS_SIZE + Index] = (UINT8) (Index < 4 ? SrcSize >> (8 * Index) : 0);
+  }
+
+  OutSize   = *DstSize - LZMA_HEADER_SIZE;
+  PropsSize = LZMA_PROPS_SIZE;
+  Res = LzmaEncode (
+          DstBuffer + LZMA_HEADER_SIZE,
+          &OutSize,
+          SrcBuffer,
+          SrcSize,
+          &Props,
+          DstBuffer,
+          &PropsSize,
+          0,
+          NULL,
+          &mAlloc,
+          &mAlloc
+          );
+  switch (Res) {
+  case SZ_OK:
+    *DstSize = (UINT32) (OutSize + LZMA_HEADER_SIZE);
+    return EFI_SUCCESS;
+  case SZ_ERROR_OUTPUT_EOF:
+    *DstSize = SrcSize + SrcSize / 8 + 1024;
+    return EFI_BUFFER_TOO_SMALL;
+  case SZ_ERROR_MEM:
+    return EFI_OUT_OF_RESOURCES;
+  default:
+    return EFI_INVALID_PARAMETER;
+  }
+}
+
+EFI_STATUS
+LzmaCodecCompress (
+  IN      UINT8   *SrcBuffer,
+  IN      UINT32  SrcSize,
+  IN      UINT8   *DstBuffer,
+  IN OUT  UINT32  *DstSize
+  )
+/*++
+
+Routine Description:
+
+  LZMA compression with a single thread, what LzmaCompress does by default.
+
+Arguments:
+
+  See LzmaEncodeBuffer().
+
+Returns:
+
+  See LzmaEncodeBuffer().
+
+--*/
+{
+  return LzmaEncodeBuffer (SrcBuffer, SrcSize, DstBuffer, DstSize, 1);
+}
+
+EFI_STATUS
+LzmaCodecMtCompress (
+  IN      UINT8   *SrcBuffer,
+  IN      UINT32  SrcSize,
+  IN      UINT8   *DstBuffer,
+  IN OUT  UINT32  *DstSize
+  )
+/*++
+
+Routine Description:
+
+  LZMA compression with the multi-threaded match finder, what
+  LzmaCompress --threads 2 does.
+
+Arguments:
+
+  See LzmaEncodeBuffer().
+
+Returns:
+
+  See LzmaEncodeBuffer().
+
+--*/
+{
+  return LzmaEncodeBuffer (SrcBuffer, SrcSize, DstBuffer, DstSize, 2);
+}
+
+EFI_STATUS
+LzmaCodecGetInfo (
+  IN      VOID    *Source,
+  IN      UINT32  SrcSize,
+  OUT     UINT32  *DstSize,
+  OUT     UINT32  *ScratchSize
+  )
+/*++
+
+Routine Description:
+
+  Retrieve the size of the decoded data. The decoder allocates its
+  dictionary itself, so no scratch buffer is needed.
+
+Arguments:
+
+  Source      - The source buffer containing the compressed data.
+  SrcSize     - The size of source buffer
+  DstSize     - The size of destination buffer.
+  ScratchSize - The size of scratch buffer.
+
+Returns:
+
+  EFI_SUCCESS           - The size of destination buffer and the size of scratch buffer are successull retrieved.
+  EFI_INVALID_PARAMETER - The source data is corrupted
+
+--*/
+{
+  UINT8   *Src;
+  UINT64  Size;
+  UINTN   Index;
+
+  Src = (UINT8 *) Source;
+  if (SrcSize < LZMA_HEADER_SIZE) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Size = 0;
+  for (Index = 0; Index < 8; Index++) {
+    Size |= (UINT64) Src[LZMA_PROPS_SIZE + Index] << (8 * Index);
+  }
+  if (Size > 0xFFFFFFFF) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  *DstSize      = (UINT32) Size;
+  *ScratchSize  = 1;
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+LzmaCodecDecompress (
+  IN      VOID    *Source,
+  IN      UINT32  SrcSize,
+  IN OUT  VOID    *Destination,
+  IN      UINT32  DstSize,
+  IN OUT  VOID    *Scratch,
+  IN      UINT32  ScratchSize
+  )
+/*++
+
+Routine Description:
+
+  The implementation of LZMA Decompress().
+
+Arguments:
+
+  Source      - The source buffer containing the compressed data.
+  SrcSize     - The size of source buffer
+  Destination - The destination buffer to store the decompressed data
+  DstSize     - The size of destination buffer.
+  Scratch     - Unused.
+  ScratchSize - Unused.
+
+Returns:
+
+  EFI_SUCCESS           - Decompression is successfull
+  EFI_INVALID_PARAMETER - The source data is corrupted
+
+--*/
+{
+  ELzmaStatus  Status;
+  SizeT        OutSize;
+  SizeT        InSize;
+  SRes         Res;
+
+  if (SrcSize < LZMA_HEADER_SIZE) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  OutSize = DstSize;
+  InSize  = SrcSize - LZMA_HEADER_SIZE;
+  Res = LzmaDecode (
+          (UINT8 *) Destination,
+          &OutSize,
+          (UINT8 *) Source + LZMA_HEADER_SIZE,
+          &InSize,
+          (UINT8 *) Source,
+          LZMA_PROPS_SIZE,
+          LZMA_FINISH_END,
+          &Status,
+          &mAlloc
+          );
+  if (Res != SZ_OK || OutSize != DstSize) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  return EFI_SUCCESS;
+}
@@ -0,0 +1,65 @@
+/** @file
+
+Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+This program and the accompanying materials
+are licensed and made available under the terms and conditions of the BSD License
+which accompanies this distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+Module Name:
+
+  LzmaCodec.h
+
+Abstract:
+
+  LZMA encoder and decoder of the LzmaCompress tool behind the
+  COMPRESS_FUNCTION, GETINFO_FUNCTION and DECOMPRESS_FUNCTION interfaces,
+  so the codec benchmark can treat them like the Efi and Tiano routines.
+  The data layout is the one LzmaCompress writes: the encoder properties,
+  the 64-bit decoded size and the compressed stream.
+
+**/
+
+#ifndef _LZMA_CODEC_H
+#define _LZMA_CODEC_H
+
+#include <Common/UefiBaseTypes.h>
+
+EFI_STATUS
+LzmaCodecCompress (
+  IN      UINT8   *SrcBuffer,
+  IN      UINT32  SrcSize,
+  IN      UINT8   *DstBuffer,
+  IN OUT  UINT32  *DstSize
+  );
+
+EFI_STATUS
+LzmaCodecMtCompress (
+  IN      UINT8   *SrcBuffer,
+  IN      UINT32  SrcSize,
+  IN      UINT8   *DstBuffer,
+  IN OUT  UINT32  *DstSize
+  );
+
+EFI_STATUS
+LzmaCodecGetInfo (
+  IN      VOID    *Source,
+  IN      UINT32  SrcSize,
+  OUT     UINT32  *DstSize,
+  OUT     UINT32  *ScratchSize
+  );
+
+EFI_STATUS
+LzmaCodecDecompress (
+  IN      VOID    *Source,
+  IN      UINT32  SrcSize,
+  IN OUT  VOID    *Destination,
+  IN      UINT32  DstSize,
+  IN OUT  VOID    *Scratch,
+  IN      UINT32  ScratchSize
+  );
+
+#endif
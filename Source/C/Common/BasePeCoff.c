@@ -13,6 +13,7 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 
 **/
 
+#include <stdlib.h>
 #include <Common/UefiBaseTypes.h>
 #include <CommonLib.h>
 #include <IndustryStandard/PeImage.h>
@@ -571,76 +572,66 @@ Returns:
   return (UINT8 *) ((UINTN) ImageContext->ImageAddress + Address);
 }
 
-RETURN_STATUS
-EFIAPI
-PeCoffLoaderRelocateImage (
-  IN OUT PE_COFF_LOADER_IMAGE_CONTEXT  *ImageContext
+STATIC
+VOID
+PeCoffLoaderGetRelocationBlocks (
+  IN OUT PE_COFF_LOADER_IMAGE_CONTEXT  *ImageContext,
+  IN     BOOLEAN                       UpdateImageBase,
+  OUT    UINT64                        *Adjust,
+  OUT    UINT16                        *MachineType,
+  OUT    EFI_IMAGE_BASE_RELOCATION     **RelocBase,
+  OUT    EFI_IMAGE_BASE_RELOCATION     **RelocBaseEnd
   )
 /*++
 
 Routine Description:
 
-  Relocates a PE/COFF image in memory
+  Locates the base relocation blocks of a loaded PE/COFF or TE image and
+  computes the adjustment that moves it to ImageContext->DestinationAddress
 
 Arguments:
 
-  This         - Calling context
+  ImageContext    - Contains information on the loaded image
 
-  ImageContext - Contains information on the loaded image to relocate
+  UpdateImageBase - TRUE to also set the image base in the image header to
+                    ImageContext->DestinationAddress
+
+  Adjust          - Receives the value to add to every fixup
+
+  MachineType     - Receives the machine type of the image
+
+  RelocBase       - Receives the first relocation block
+
+  RelocBaseEnd    - Receives the last byte of the relocation blocks, both
+                    are NULL when the image has no relocation directory
 
 Returns:
 
-  RETURN_SUCCESS      if the PE/COFF image was relocated
-  RETURN_LOAD_ERROR   if the image is not a valid PE/COFF image
-  RETURN_UNSUPPORTED  not support
+  None
 
 --*/
 {
-  RETURN_STATUS                         Status;
   EFI_IMAGE_OPTIONAL_HEADER_UNION       *PeHdr;
   EFI_TE_IMAGE_HEADER                   *TeHdr;
   EFI_IMAGE_DATA_DIRECTORY              *RelocDir;
-  UINT64                                Adjust;
-  EFI_IMAGE_BASE_RELOCATION             *RelocBase;
-  EFI_IMAGE_BASE_RELOCATION             *RelocBaseEnd;
-  UINT16                                *Reloc;
-  UINT16                                *RelocEnd;
-  CHAR8                                 *Fixup;
-  CHAR8                                 *FixupBase;
-  UINT16                                *F16;
-  UINT32                                *F32;
-  CHAR8                                 *FixupData;
   PHYSICAL_ADDRESS                      BaseAddress;
-  UINT16                                MachineType;
   EFI_IMAGE_OPTIONAL_HEADER_POINTER     OptionHeader;
 
-  PeHdr = NULL;
-  TeHdr = NULL;
-  //
-  // Assume success
-  //
-  ImageContext->ImageError = IMAGE_ERROR_SUCCESS;
-
-  //
-  // If there are no relocation entries, then we are done
-  //
-  if (ImageContext->RelocationsStripped) {
-    return RETURN_SUCCESS;
-  }
-
   //
   // Use DestinationAddress field of ImageContext as the relocation address even if it is 0.
   //
   BaseAddress = ImageContext->DestinationAddress;
-  
+
   if (!(ImageContext->IsTeImage)) {
     PeHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)((UINTN)ImageContext->ImageAddress + 
                                             ImageContext->PeCoffHeaderOffset);
     OptionHeader.Header = (VOID *) &(PeHdr->Pe32.OptionalHeader);
     if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-      Adjust = (UINT64) BaseAddress - OptionHeader.Optional32->ImageBase;
-      OptionHeader.Optional32->ImageBase = (UINT32) BaseAddress;
-      MachineType = ImageContext->Machine;
+      *Adjust = (UINT64) BaseAddress - OptionHeader.Optional32->ImageBase;
+      if (UpdateImageBase) {
+        OptionHeader.Optional32->ImageBase = (UINT32) BaseAddress;
+      }
+      *MachineType = ImageContext->Machine;
       //
       // Find the relocation block
       //
@@ -650,8 +641,8 @@ Returns:
       //
       if (OptionHeader.Optional32->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC) {
         RelocDir  = &OptionHeader.Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC];
-        RelocBase = PeCoffLoaderImageAddress (ImageContext, RelocDir->VirtualAddress);
-        RelocBaseEnd = PeCoffLoaderImageAddress (
+        *RelocBase = PeCoffLoaderImageAddress (ImageContext, RelocDir->VirtualAddress);
+        *RelocBaseEnd = PeCoffLoaderImageAddress (
                         ImageContext,
                         RelocDir->VirtualAddress + RelocDir->Size - 1
                         );
@@ -659,12 +650,14 @@ Returns:
         //
         // Set base and end to bypass processing below.
         //
-        RelocBase = RelocBaseEnd = 0;
+        *RelocBase = *RelocBaseEnd = 0;
       }
     } else {
-      Adjust = (UINT64) BaseAddress - OptionHeader.Optional64->ImageBase;
-      OptionHeader.Optional64->ImageBase = BaseAddress;
-      MachineType = ImageContext->Machine;
+      *Adjust = (UINT64) BaseAddress - OptionHeader.Optional64->ImageBase;
+      if (UpdateImageBase) {
+        OptionHeader.Optional64->ImageBase = BaseAddress;
+      }
+      *MachineType = ImageContext->Machine;
       //
       // Find the relocation block
       //
@@ -674,8 +667,8 @@ Returns:
       //
       if (OptionHeader.Optional64->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC) {
         RelocDir  = &OptionHeader.Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC];
-        RelocBase = PeCoffLoaderImageAddress (ImageContext, RelocDir->VirtualAddress);
-        RelocBaseEnd = PeCoffLoaderImageAddress (
+        *RelocBase = PeCoffLoaderImageAddress (ImageContext, RelocDir->VirtualAddress);
+        *RelocBaseEnd = PeCoffLoaderImageAddress (
                         ImageContext,
                         RelocDir->VirtualAddress + RelocDir->Size - 1
                         );
@@ -683,28 +676,88 @@ Returns:
         //
         // Set base and end to bypass processing below.
         //
-        RelocBase = RelocBaseEnd = 0;
+        *RelocBase = *RelocBaseEnd = 0;
       }
     }
   } else {
     TeHdr             = (EFI_TE_IMAGE_HEADER *) (UINTN) (ImageContext->ImageAddress);
-    Adjust            = (UINT64) (BaseAddress - TeHdr->ImageBase);
-    TeHdr->ImageBase  = (UINT64) (BaseAddress);
-    MachineType = TeHdr->Machine;
-    
+    *Adjust           = (UINT64) (BaseAddress - TeHdr->ImageBase);
+    if (UpdateImageBase) {
+      TeHdr->ImageBase  = (UINT64) (BaseAddress);
+    }
+    *MachineType = TeHdr->Machine;
+
     //
     // Find the relocation block
     //
     RelocDir = &TeHdr->DataDirectory[0];
-    RelocBase = (EFI_IMAGE_BASE_RELOCATION *)(UINTN)(
+    *RelocBase = (EFI_IMAGE_BASE_RELOCATION *)(UINTN)(
                                     ImageContext->ImageAddress + 
                                     RelocDir->VirtualAddress +
                                     sizeof(EFI_TE_IMAGE_HEADER) - 
                                     TeHdr->StrippedSize
                                     );
-    RelocBaseEnd = (EFI_IMAGE_BASE_RELOCATION *) ((UINTN) RelocBase + (UINTN) RelocDir->Size - 1);
+    *RelocBaseEnd = (EFI_IMAGE_BASE_RELOCATION *) ((UINTN) *RelocBase + (UINTN) RelocDir->Size - 1);
   }
-  
+}
+
+RETURN_STATUS
+EFIAPI
+PeCoffLoaderRelocateImage (
+  IN OUT PE_COFF_LOADER_IMAGE_CONTEXT  *ImageContext
+  )
+/*++
+
+Routine Description:
+
+  Relocates a PE/COFF image in memory
+
+Arguments:
+
+  This         - Calling context
+
+  ImageContext - Contains information on the loaded image to relocate
+
+Returns:
+
+  RETURN_SUCCESS      if the PE/COFF image was relocated
+  RETURN_LOAD_ERROR   if the image is not a valid PE/COFF image
+  RETURN_UNSUPPORTED  not support
+
+--*/
+{
+  RETURN_STATUS                         Status;
+  EFI_TE_IMAGE_HEADER                   *TeHdr;
+  UINT64                                Adjust;
+  EFI_IMAGE_BASE_RELOCATION             *RelocBase;
+  EFI_IMAGE_BASE_RELOCATION             *RelocBaseEnd;
+  UINT16                                *Reloc;
+  UINT16                                *RelocEnd;
+  CHAR8                                 *Fixup;
+  CHAR8                                 *FixupBase;
+  UINT16                                *F16;
+  UINT32                                *F32;
+  CHAR8                                 *FixupData;
+  UINT16                                MachineType;
+
+  TeHdr = NULL;
+  //
+  // Assume success
+  //
+  ImageContext->ImageError = IMAGE_ERROR_SUCCESS;
+
+  //
+  // If there are no relocation entries, then we are done
+  //
+  if (ImageContext->RelocationsStripped) {
+    return RETURN_SUCCESS;
+  }
+
+  PeCoffLoaderGetRelocationBlocks (ImageContext, TRUE, &Adjust, &MachineType, &RelocBase, &RelocBaseEnd);
+  if (ImageContext->IsTeImage) {
+    TeHdr = (EFI_TE_IMAGE_HEADER *) (UINTN) (ImageContext->ImageAddress);
+  }
+
   //
   // Run the relocation information and apply the fixups
   //
@@ -816,6 +869,464 @@ Returns:
   return RETURN_SUCCESS;
 }
 
+//
+// Fixup of a relocation index while PeCoffLoaderSortRelocationIndex sorts it
+//
+typedef struct {
+  UINT32                                Offset;
+  UINT32                                Type;
+} PE_COFF_INDEXED_FIXUP;
+
+STATIC
+UINT32
+PeCoffLoaderIndexedFixupSize (
+  IN UINT32                        Type,
+  IN UINT16                        MachineType
+  )
+/*++
+
+Routine Description:
+
+  Returns the number of bytes a relocation index fixup changes
+
+Arguments:
+
+  Type         - EFI_IMAGE_REL_BASED_* type of the fixup
+
+  MachineType  - Machine type of the image
+
+Returns:
+
+  The size of the fixup, 0 if the index does not handle this type
+
+--*/
+{
+  switch (Type) {
+  case EFI_IMAGE_REL_BASED_HIGH:
+  case EFI_IMAGE_REL_BASED_LOW:
+    return sizeof (UINT16);
+
+  case EFI_IMAGE_REL_BASED_HIGHLOW:
+    return sizeof (UINT32);
+
+  case EFI_IMAGE_REL_BASED_DIR64:
+    //
+    // Only the X64 and IPF handlers of PeCoffLoaderRelocateImage accept it
+    //
+    if (MachineType == EFI_IMAGE_MACHINE_X64 || MachineType == EFI_IMAGE_MACHINE_IA64) {
+      return sizeof (UINT64);
+    }
+    return 0;
+
+  default:
+    return 0;
+  }
+}
+
+STATIC
+int
+PeCoffLoaderCompareIndexedFixups (
+  IN const VOID                    *Left,
+  IN const VOID                    *Right
+  )
+{
+  UINT32  LeftOffset;
+  UINT32  RightOffset;
+
+  LeftOffset  = ((PE_COFF_INDEXED_FIXUP *) Left)->Offset;
+  RightOffset = ((PE_COFF_INDEXED_FIXUP *) Right)->Offset;
+  return LeftOffset < RightOffset ? -1 : (LeftOffset > RightOffset ? 1 : 0);
+}
+
+STATIC
+RETURN_STATUS
+PeCoffLoaderSortRelocationIndex (
+  IN OUT PE_COFF_RELOCATION_INDEX      *Index,
+  IN     UINT16                        MachineType
+  )
+/*++
+
+Routine Description:
+
+  Sorts the fixups of a relocation index whose relocation blocks are not
+  in increasing order and rebuilds its runs. Once sorted, fixups that do
+  not overlap give the same image in any order.
+
+Arguments:
+
+  Index        - The relocation index to sort
+
+  MachineType  - Machine type of the image
+
+Returns:
+
+  RETURN_SUCCESS          the index is sorted
+  RETURN_UNSUPPORTED      two fixups overlap
+  RETURN_OUT_OF_RESOURCES no resource to sort the index
+
+--*/
+{
+  PE_COFF_INDEXED_FIXUP                 *Fixups;
+  UINT32                                RunIndex;
+  UINT32                                Index1;
+  UINT32                                Index2;
+
+  Fixups = (PE_COFF_INDEXED_FIXUP *) malloc ((Index->FixupCount + 1) * sizeof (PE_COFF_INDEXED_FIXUP));
+  if (Fixups == NULL) {
+    return RETURN_OUT_OF_RESOURCES;
+  }
+
+  for (RunIndex = 0, Index1 = 0; RunIndex < Index->RunCount; RunIndex++) {
+    for (Index2 = 0; Index2 < Index->Runs[RunIndex].Count; Index2++, Index1++) {
+      Fixups[Index1].Offset = Index->Offsets[Index1];
+      Fixups[Index1].Type   = Index->Runs[RunIndex].Type;
+    }
+  }
+  qsort (Fixups, Index->FixupCount, sizeof (PE_COFF_INDEXED_FIXUP), PeCoffLoaderCompareIndexedFixups);
+
+  Index->RunCount = 0;
+  for (Index1 = 0; Index1 < Index->FixupCount; Index1++) {
+    if (Index1 > 0 &&
+        Fixups[Index1 - 1].Offset + PeCoffLoaderIndexedFixupSize (Fixups[Index1 - 1].Type, MachineType) > Fixups[Index1].Offset) {
+      free (Fixups);
+      return RETURN_UNSUPPORTED;
+    }
+    if (Index1 == 0 || Fixups[Index1].Type != Fixups[Index1 - 1].Type) {
+      Index->Runs[Index->RunCount].Type  = Fixups[Index1].Type;
+      Index->Runs[Index->RunCount].Count = 0;
+      Index->RunCount++;
+    }
+    Index->Runs[Index->RunCount - 1].Count++;
+    Index->Offsets[Index1] = Fixups[Index1].Offset;
+  }
+
+  free (Fixups);
+  return RETURN_SUCCESS;
+}
+
+VOID
+EFIAPI
+PeCoffLoaderFreeRelocationIndex (
+  IN PE_COFF_RELOCATION_INDEX      *Index
+  )
+/*++
+
+Routine Description:
+
+  Frees a relocation index built by PeCoffLoaderBuildRelocationIndex
+
+Arguments:
+
+  Index        - The index to free, may be NULL
+
+Returns:
+
+  None
+
+--*/
+{
+  if (Index == NULL) {
+    return;
+  }
+  free (Index->Offsets);
+  free (Index->Runs);
+  free (Index);
+}
+
+RETURN_STATUS
+EFIAPI
+PeCoffLoaderBuildRelocationIndex (
+  IN OUT PE_COFF_LOADER_IMAGE_CONTEXT  *ImageContext,
+  OUT    PE_COFF_RELOCATION_INDEX      **Index
+  )
+/*++
+
+Routine Description:
+
+  Walks the base relocations of a loaded PE/COFF or TE image once and
+  records the offset and type of each fixup in a relocation index, so the
+  image can then be relocated any number of times with
+  PeCoffLoaderRelocateImageWithIndex. The image is not changed.
+
+  Only HIGH, LOW, HIGHLOW and DIR64 fixups are indexed. An image with other
+  fixups, with fixups that overlap each other or the relocation blocks, or
+  with relocation blocks PeCoffLoaderRelocateImage would reject is not
+  indexed, it must be relocated with PeCoffLoaderRelocateImage.
+
+Arguments:
+
+  ImageContext - Contains information on the loaded image
+
+  Index        - Receives the relocation index, free it with
+                 PeCoffLoaderFreeRelocationIndex
+
+Returns:
+
+  RETURN_SUCCESS          the relocation index was built
+  RETURN_UNSUPPORTED      the image can not be relocated with an index
+  RETURN_OUT_OF_RESOURCES no resource to hold the index
+
+--*/
+{
+  RETURN_STATUS                         Status;
+  PE_COFF_RELOCATION_INDEX              *NewIndex;
+  PE_COFF_RELOCATION_RUN                *Runs;
+  UINT32                                *Offsets;
+  EFI_TE_IMAGE_HEADER                   *TeHdr;
+  EFI_IMAGE_BASE_RELOCATION             *RelocBase;
+  EFI_IMAGE_BASE_RELOCATION             *RelocBaseEnd;
+  UINT16                                *Reloc;
+  UINT16                                *RelocEnd;
+  UINT8                                 *Image;
+  UINT8                                 *ImageEnd;
+  UINT64                                Adjust;
+  INT64                                 BlockOffset;
+  INT64                                 Offset;
+  UINT64                                RelocStart;
+  UINT64                                RelocLimit;
+  UINT64                                FixupEnd;
+  UINT16                                MachineType;
+  UINT32                                Type;
+  UINT32                                Size;
+  UINT32                                MaxFixups;
+  UINT32                                RunCount;
+  BOOLEAN                               Sorted;
+
+  *Index = NULL;
+  ImageContext->ImageError = IMAGE_ERROR_SUCCESS;
+
+  NewIndex = (PE_COFF_RELOCATION_INDEX *) calloc (1, sizeof (PE_COFF_RELOCATION_INDEX));
+  if (NewIndex == NULL) {
+    return RETURN_OUT_OF_RESOURCES;
+  }
+  NewIndex->ImageSize = ImageContext->ImageSize;
+
+  if (ImageContext->RelocationsStripped) {
+    *Index = NewIndex;
+    return RETURN_SUCCESS;
+  }
+
+  if (ImageContext->ImageSize > 0xFFFFFFFF) {
+    free (NewIndex);
+    return RETURN_UNSUPPORTED;
+  }
+
+  PeCoffLoaderGetRelocationBlocks (ImageContext, FALSE, &Adjust, &MachineType, &RelocBase, &RelocBaseEnd);
+  if (RelocBase == NULL && RelocBaseEnd != NULL) {
+    free (NewIndex);
+    return RETURN_UNSUPPORTED;
+  }
+  if (!(RelocBase < RelocBaseEnd)) {
+    //
+    // PeCoffLoaderRelocateImage only updates the image base
+    //
+    *Index = NewIndex;
+    return RETURN_SUCCESS;
+  }
+
+  Image      = (UINT8 *) (UINTN) ImageContext->ImageAddress;
+  ImageEnd   = Image + (UINTN) ImageContext->ImageSize;
+  TeHdr      = (EFI_TE_IMAGE_HEADER *) Image;
+  if ((UINT8 *) RelocBase < Image || (UINT8 *) RelocBaseEnd >= ImageEnd) {
+    free (NewIndex);
+    return RETURN_UNSUPPORTED;
+  }
+  RelocStart = (UINT8 *) RelocBase - Image;
+  RelocLimit = (UINT8 *) RelocBaseEnd - Image;
+
+  //
+  // Every entry of the blocks is at most one fixup and one run
+  //
+  MaxFixups         = (UINT32) ((RelocLimit - RelocStart + 1) / sizeof (UINT16));
+  NewIndex->Offsets = (UINT32 *) malloc ((MaxFixups + 1) * sizeof (UINT32));
+  NewIndex->Runs    = (PE_COFF_RELOCATION_RUN *) malloc ((MaxFixups + 1) * sizeof (PE_COFF_RELOCATION_RUN));
+  if (NewIndex->Offsets == NULL || NewIndex->Runs == NULL) {
+    PeCoffLoaderFreeRelocationIndex (NewIndex);
+    return RETURN_OUT_OF_RESOURCES;
+  }
+
+  Offsets   = NewIndex->Offsets;
+  Runs      = NewIndex->Runs;
+  RunCount  = 0;
+  FixupEnd  = 0;
+  Sorted    = TRUE;
+  while (RelocBase < RelocBaseEnd) {
+    if ((UINT8 *) RelocBase + sizeof (EFI_IMAGE_BASE_RELOCATION) > ImageEnd ||
+        RelocBase->SizeOfBlock < sizeof (EFI_IMAGE_BASE_RELOCATION) ||
+        (RelocBase->SizeOfBlock & 1) != 0) {
+      goto Unsupported;
+    }
+
+    Reloc     = (UINT16 *) ((CHAR8 *) RelocBase + sizeof (EFI_IMAGE_BASE_RELOCATION));
+    RelocEnd  = (UINT16 *) ((CHAR8 *) RelocBase + RelocBase->SizeOfBlock);
+    if ((UINT8 *) RelocEnd > ImageEnd) {
+      goto Unsupported;
+    }
+
+    //
+    // A page of a TE image may start before the loaded image when the
+    // stripped headers are larger than the TE header, only its fixups must
+    // be in the image.
+    //
+    if (!(ImageContext->IsTeImage)) {
+      if (RelocBase->VirtualAddress >= ImageContext->ImageSize) {
+        goto Unsupported;
+      }
+      BlockOffset = RelocBase->VirtualAddress;
+    } else {
+      BlockOffset = (INT64) RelocBase->VirtualAddress + sizeof (EFI_TE_IMAGE_HEADER) - TeHdr->StrippedSize;
+    }
+
+    for (; Reloc < RelocEnd; Reloc++) {
+      Type = (*Reloc) >> 12;
+      if (Type == EFI_IMAGE_REL_BASED_ABSOLUTE) {
+        continue;
+      }
+      Size   = PeCoffLoaderIndexedFixupSize (Type, MachineType);
+      Offset = BlockOffset + (*Reloc & 0xFFF);
+      if (Size == 0 || Offset < 0 || (UINT64) Offset + Size > ImageContext->ImageSize ||
+          ((UINT64) Offset + Size > RelocStart && (UINT64) Offset <= RelocLimit)) {
+        goto Unsupported;
+      }
+
+      //
+      // While the fixups come in increasing order, check that each one
+      // starts after the end of the previous one
+      //
+      if (Offsets > NewIndex->Offsets && (UINT32) Offset < Offsets[-1]) {
+        Sorted = FALSE;
+      } else if ((UINT64) Offset < FixupEnd) {
+        goto Unsupported;
+      }
+      FixupEnd = (UINT64) Offset + Size;
+
+      if (RunCount == 0 || Runs[RunCount - 1].Type != Type) {
+        Runs[RunCount].Type  = Type;
+        Runs[RunCount].Count = 0;
+        RunCount++;
+      }
+      Runs[RunCount - 1].Count++;
+      *Offsets++ = (UINT32) Offset;
+    }
+
+    RelocBase = (EFI_IMAGE_BASE_RELOCATION *) RelocEnd;
+  }
+
+  NewIndex->FixupCount  = (UINT32) (Offsets - NewIndex->Offsets);
+  NewIndex->RunCount    = RunCount;
+  if (!Sorted) {
+    Status = PeCoffLoaderSortRelocationIndex (NewIndex, MachineType);
+    if (RETURN_ERROR (Status)) {
+      PeCoffLoaderFreeRelocationIndex (NewIndex);
+      return Status;
+    }
+  }
+
+  *Index = NewIndex;
+  return RETURN_SUCCESS;
+
+Unsupported:
+  PeCoffLoaderFreeRelocationIndex (NewIndex);
+  return RETURN_UNSUPPORTED;
+}
+
+RETURN_STATUS
+EFIAPI
+PeCoffLoaderRelocateImageWithIndex (
+  IN OUT PE_COFF_LOADER_IMAGE_CONTEXT  *ImageContext,
+  IN     PE_COFF_RELOCATION_INDEX      *Index
+  )
+/*++
+
+Routine Description:
+
+  Relocates a loaded PE/COFF or TE image in memory with the relocation
+  index built for it, giving the same image as PeCoffLoaderRelocateImage.
+  The fixups are applied by one loop per run of fixups of the same type.
+
+Arguments:
+
+  ImageContext - Contains information on the loaded image to relocate,
+                 FixupData must be NULL
+
+  Index        - Relocation index built for this image, or for another
+                 copy of it loaded the same way
+
+Returns:
+
+  RETURN_SUCCESS            if the PE/COFF image was relocated
+  RETURN_INVALID_PARAMETER  the index is not the index of this image, or
+                            FixupData is not NULL
+
+--*/
+{
+  UINT64                                Adjust;
+  UINT32                                Adjust32;
+  UINT16                                Adjust16;
+  UINT16                                MachineType;
+  EFI_IMAGE_BASE_RELOCATION             *RelocBase;
+  EFI_IMAGE_BASE_RELOCATION             *RelocBaseEnd;
+  UINT8                                 *Image;
+  UINT32                                *Offsets;
+  UINT32                                *OffsetsEnd;
+  UINT32                                RunIndex;
+
+  ImageContext->ImageError = IMAGE_ERROR_SUCCESS;
+
+  if (ImageContext->RelocationsStripped) {
+    return RETURN_SUCCESS;
+  }
+
+  if (Index->ImageSize != ImageContext->ImageSize || ImageContext->FixupData != NULL) {
+    return RETURN_INVALID_PARAMETER;
+  }
+
+  PeCoffLoaderGetRelocationBlocks (ImageContext, TRUE, &Adjust, &MachineType, &RelocBase, &RelocBaseEnd);
+
+  //
+  // The adjustment is the same for all the fixups of a run, the loops only
+  // load the offset and add it.
+  //
+  Image   = (UINT8 *) (UINTN) ImageContext->ImageAddress;
+  Offsets = Index->Offsets;
+  for (RunIndex = 0; RunIndex < Index->RunCount; RunIndex++) {
+    OffsetsEnd = Offsets + Index->Runs[RunIndex].Count;
+    switch (Index->Runs[RunIndex].Type) {
+    case EFI_IMAGE_REL_BASED_HIGH:
+      Adjust16 = (UINT16) ((UINT32) Adjust >> 16);
+      for (; Offsets < OffsetsEnd; Offsets++) {
+        *(UINT16 *) (Image + *Offsets) = (UINT16) (*(UINT16 *) (Image + *Offsets) + Adjust16);
+      }
+      break;
+
+    case EFI_IMAGE_REL_BASED_LOW:
+      Adjust16 = (UINT16) Adjust;
+      for (; Offsets < OffsetsEnd; Offsets++) {
+        *(UINT16 *) (Image + *Offsets) = (UINT16) (*(UINT16 *) (Image + *Offsets) + Adjust16);
+      }
+      break;
+
+    case EFI_IMAGE_REL_BASED_HIGHLOW:
+      Adjust32 = (UINT32) Adjust;
+      for (; Offsets < OffsetsEnd; Offsets++) {
+        *(UINT32 *) (Image + *Offsets) += Adjust32;
+      }
+      break;
+
+    default:
+      //
+      // EFI_IMAGE_REL_BASED_DIR64, the last type an index holds
+      //
+      for (; Offsets < OffsetsEnd; Offsets++) {
+        *(UINT64 *) (Image + *Offsets) += Adjust;
+      }
+      break;
+    }
+  }
+
+  return RETURN_SUCCESS;
+}
+
 RETURN_STATUS
 EFIAPI
 PeCoffLoaderLoadImage (
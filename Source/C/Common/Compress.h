@@ -28,6 +28,28 @@ Abstract:
 
 #include "CommonLib.h"
 #include <Common/UefiBaseTypes.h>
+
+//
+// Opaque encoder state used by the reentrant compression entry points.
+// A context may be reused for any number of compressions, but must not be
+// used by two threads at the same time.
+//
+typedef struct _EFI_COMPRESS_CONTEXT    EFI_COMPRESS_CONTEXT;
+typedef struct _TIANO_COMPRESS_CONTEXT  TIANO_COMPRESS_CONTEXT;
+
+//
+// Match finder effort of the encoders. Every level produces a standard
+// stream for the EFI/Tiano decoders; only speed and ratio differ.
+//
+typedef enum {
+  CompressLevelFast     = 1,  // Hash chains with a bounded search depth
+  CompressLevelDefault  = 2,  // The original suffix tree, bit-exact with older tools
+  CompressLevelMax      = 3,  // Deep hash chain search, two step lazy matching for Tiano,
+                              // the smaller of its output and the suffix tree output
+  CompressLevelOptimal  = 4   // Cost based optimal parse, TianoCompress only,
+                              // the smaller of its output and the suffix tree output
+} COMPRESS_LEVEL;
+
 /*++
 
 Routine Description:
@@ -62,6 +84,106 @@ EfiCompress (
 
 /*++
 
+Routine Description:
+
+  Create and free the per-caller state of the Tiano compressor.
+
+--*/
+EFI_STATUS
+TianoCompressCreateContext (
+  OUT     TIANO_COMPRESS_CONTEXT  **Context
+  )
+;
+
+VOID
+TianoCompressFreeContext (
+  IN      TIANO_COMPRESS_CONTEXT  *Context
+  )
+;
+
+/*++
+
+Routine Description:
+
+  Select the match finder used by TianoCompressEx() on Context.
+
+--*/
+EFI_STATUS
+TianoCompressSetLevel (
+  IN OUT  TIANO_COMPRESS_CONTEXT  *Context,
+  IN      COMPRESS_LEVEL          Level
+  )
+;
+
+/*++
+
+Routine Description:
+
+  Tiano compression routine using a caller owned context.
+
+--*/
+EFI_STATUS
+TianoCompressEx (
+  IN OUT  TIANO_COMPRESS_CONTEXT  *Context,
+  IN      UINT8                   *SrcBuffer,
+  IN      UINT32                  SrcSize,
+  IN      UINT8                   *DstBuffer,
+  IN OUT  UINT32                  *DstSize
+  )
+;
+
+/*++
+
+Routine Description:
+
+  Create and free the per-caller state of the EFI compressor.
+
+--*/
+EFI_STATUS
+EfiCompressCreateContext (
+  OUT     EFI_COMPRESS_CONTEXT    **Context
+  )
+;
+
+VOID
+EfiCompressFreeContext (
+  IN      EFI_COMPRESS_CONTEXT    *Context
+  )
+;
+
+/*++
+
+Routine Description:
+
+  Select the match finder used by EfiCompressEx() on Context.
+
+--*/
+EFI_STATUS
+EfiCompressSetLevel (
+  IN OUT  EFI_COMPRESS_CONTEXT    *Context,
+  IN      COMPRESS_LEVEL          Level
+  )
+;
+
+/*++
+
+Routine Description:
+
+  Efi compression routine using a caller owned context.
+
+--*/
+EFI_STATUS
+EfiCompressEx (
+  IN OUT  EFI_COMPRESS_CONTEXT    *Context,
+  IN      UINT8                   *SrcBuffer,
+  IN      UINT32                  SrcSize,
+  IN      UINT8                   *DstBuffer,
+  IN OUT  UINT32                  *DstSize
+  )
+;
+
+/*++
+
 Routine Description:
 
   The compression routine.
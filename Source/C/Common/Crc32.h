@@ -15,7 +15,7 @@ Module Name:
 
 Abstract:
 
-  Header file for CalcuateCrc32 routine
+  Header file for CalcuateCrc32 routine and the incremental CRC32 interface
   
 **/
 
@@ -24,6 +24,25 @@ Abstract:
 
 #include <Common/UefiBaseTypes.h>
 
+//
+// Implementations of the CRC32 calculation. All engines produce identical
+// results, they only differ in speed and in the processor features needed.
+//
+typedef enum {
+  Crc32EngineAuto = 0,
+  Crc32EngineByte,
+  Crc32EngineSlice8,
+  Crc32EngineClmul,
+  Crc32EngineMax
+} CRC32_ENGINE;
+
+//
+// State of an incremental CRC32 calculation.
+//
+typedef struct {
+  UINT32  Crc;
+} CRC32_CONTEXT;
+
 EFI_STATUS
 CalculateCrc32 (
   IN  UINT8                             *Data,
@@ -51,4 +70,140 @@ Returns:
 --*/
 ;
 
+VOID
+Crc32Init (
+  OUT CRC32_CONTEXT                     *Context
+  )
+/*++
+
+Routine Description:
+
+  Start a new incremental CRC32 calculation.
+
+Arguments:
+
+  Context     - The caller allocated calculation context
+
+Returns:
+
+  None
+
+--*/
+;
+
+VOID
+Crc32Update (
+  IN OUT CRC32_CONTEXT                  *Context,
+  IN CONST VOID                         *Data,
+  IN UINTN                              DataSize
+  )
+/*++
+
+Routine Description:
+
+  Feed the next part of the data into an incremental CRC32 calculation.
+  Splitting the data into several Crc32Update calls yields the same result
+  as processing it in one piece.
+
+Arguments:
+
+  Context     - The context initialized by Crc32Init
+  Data        - The buffer contaning the data to be processed
+  DataSize    - The size of data to be processed, may be zero
+
+Returns:
+
+  None
+
+--*/
+;
+
+UINT32
+Crc32Final (
+  IN CRC32_CONTEXT                      *Context
+  )
+/*++
+
+Routine Description:
+
+  Finish an incremental CRC32 calculation.
+
+Arguments:
+
+  Context     - The context initialized by Crc32Init
+
+Returns:
+
+  The CRC32 checksum of all data passed to Crc32Update.
+
+--*/
+;
+
+EFI_STATUS
+Crc32SelectEngine (
+  IN CRC32_ENGINE                       Engine
+  )
+/*++
+
+Routine Description:
+
+  Select the engine used by CalculateCrc32 and Crc32Update.
+
+Arguments:
+
+  Engine      - The engine to use. Crc32EngineAuto picks the fastest engine
+                supported by the processor.
+
+Returns:
+
+  EFI_SUCCESS               - The engine is selected.
+  EFI_UNSUPPORTED           - The engine is not available on this host.
+  EFI_INVALID_PARAMETER     - Engine is not a known engine.
+
+--*/
+;
+
+CRC32_ENGINE
+Crc32GetEngine (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Return the engine used by CalculateCrc32 and Crc32Update, selecting the
+  fastest supported one if no engine has been chosen yet.
+
+Arguments:
+
+  None
+
+Returns:
+
+  The active engine, never Crc32EngineAuto.
+
+--*/
+;
+
+CONST CHAR8 *
+Crc32GetEngineName (
+  IN CRC32_ENGINE                       Engine
+  )
+/*++
+
+Routine Description:
+
+  Return a printable name for a CRC32 engine.
+
+Arguments:
+
+  Engine      - The engine to name.
+
+Returns:
+
+  The name of the engine.
+
+--*/
+;
+
 #endif
@@ -27,7 +27,6 @@ Abstract:
 //
 // Decompression algorithm begins here
 //
-#define BITBUFSIZ 32
 #define MAXMATCH  256
 #define THRESHOLD 3
 #define CODE_BIT  16
@@ -49,79 +48,177 @@ Abstract:
 #define NPT MAXNP
 #endif
 
+//
+// The bit reservoir holds up to 64 bits, the next bit to read in bit 63.
+// After RefillBits() at least REFILL_BITS of them are valid, enough for a
+// character/length code, a position code and most of its extra bits.
+//
+#define BITBUFSIZ   64
+#define REFILL_BITS 57
+
+//
+// Decoding tables. The first TableBits bits of the input index the primary
+// table. An entry there either holds a symbol and its code length, or, for
+// codes longer than TableBits, links to a secondary table indexed by the
+// next SubBits bits. Secondary entries always hold a symbol.
+//
+#define CTABLEBITS      12
+#define PTTABLEBITS     8
+#define TABLE_LINK      0x8000
+#define TABLE_LEN_SHIFT 10
+#define TABLE_SYM_MASK  ((1U << TABLE_LEN_SHIFT) - 1)
+#define TABLE_ENTRY(Sym, Len) ((UINT16) (((Len) << TABLE_LEN_SHIFT) | (Sym)))
+
+//
+// Each code longer than the primary width adds at most one secondary table
+// of 1 << (CODE_BIT - TableBits) entries.
+//
+#define CTABLESIZE  ((1U << CTABLEBITS) + NC * (1U << (CODE_BIT - CTABLEBITS)))
+#define PTTABLESIZE ((1U << PTTABLEBITS) + NPT * (1U << (CODE_BIT - PTTABLEBITS)))
+
 typedef struct {
   UINT8   *mSrcBase;  // Starting address of compressed data
   UINT8   *mDstBase;  // Starting address of decompressed data
-  UINT32  mOutBuf;
   UINT32  mInBuf;
+  UINT32  mOutBuf;
 
-  UINT16  mBitCount;
-  UINT32  mBitBuf;
-  UINT32  mSubBitBuf;
+  UINT64  mBitBuf;
+  UINT32  mBitCount;
   UINT16  mBlockSize;
   UINT32  mCompSize;
   UINT32  mOrigSize;
 
   UINT16  mBadTableFlag;
+  UINT16  mPbit;
 
-  UINT16  mLeft[2 * NC - 1];
-  UINT16  mRight[2 * NC - 1];
+  UINT16  mCSubBits;
+  UINT16  mPTSubBits;
   UINT8   mCLen[NC];
   UINT8   mPTLen[NPT];
-  UINT16  mCTable[4096];
-  UINT16  mPTTable[256];
+  UINT16  mCTable[CTABLESIZE];
+  UINT16  mPTTable[PTTABLESIZE];
 } SCRATCH_DATA;
 
-STATIC UINT16 mPbit = EFIPBIT;
+STATIC
+UINT64
+ReadBigEndian64 (
+  IN  UINT8         *Src
+  )
+/*++
+
+Routine Description:
+
+  Read eight source bytes as one word, the first byte most significant.
+
+Arguments:
+
+  Src       - The bytes to read
+
+Returns:
+
+  The word read.
+
+--*/
+{
+  return ((UINT64) Src[0] << 56) | ((UINT64) Src[1] << 48) |
+         ((UINT64) Src[2] << 40) | ((UINT64) Src[3] << 32) |
+         ((UINT64) Src[4] << 24) | ((UINT64) Src[5] << 16) |
+         ((UINT64) Src[6] << 8)  | (UINT64) Src[7];
+}
 
 STATIC
 VOID
-FillBuf (
-  IN  SCRATCH_DATA  *Sd,
-  IN  UINT16        NumOfBits
+RefillBits (
+  IN  SCRATCH_DATA  *Sd
   )
 /*++
 
 Routine Description:
 
-  Shift mBitBuf NumOfBits left. Read in NumOfBits of bits from source.
+  Top up the bit reservoir to at least REFILL_BITS valid bits. Away from
+  the end of the source eight bytes are loaded at once; the bits below the
+  valid ones are then already correct and are simply loaded again by the
+  next refill. Past the end of the source zero bits are supplied.
 
 Arguments:
 
   Sd        - The global scratch data
-  NumOfBit  - The number of bits to shift and read.
 
 Returns: (VOID)
 
 --*/
 {
-  Sd->mBitBuf = (UINT32) (Sd->mBitBuf << NumOfBits);
-
-  while (NumOfBits > Sd->mBitCount) {
+  UINT32  Bytes;
 
-    Sd->mBitBuf |= (UINT32) (Sd->mSubBitBuf << (NumOfBits = (UINT16) (NumOfBits - Sd->mBitCount)));
-
-    if (Sd->mCompSize > 0) {
-      //
-      // Get 1 byte into SubBitBuf
-      //
-      Sd->mCompSize--;
-      Sd->mSubBitBuf  = 0;
-      Sd->mSubBitBuf  = Sd->mSrcBase[Sd->mInBuf++];
-      Sd->mBitCount   = 8;
+  if (Sd->mBitCount >= REFILL_BITS) {
+    return;
+  }
 
-    } else {
-      //
-      // No more bits from the source, just pad zero bit.
-      //
-      Sd->mSubBitBuf  = 0;
-      Sd->mBitCount   = 8;
+  if (Sd->mInBuf + 8 <= Sd->mCompSize) {
+    Bytes = (BITBUFSIZ - 1 - Sd->mBitCount) >> 3;
+    Sd->mBitBuf    |= ReadBigEndian64 (Sd->mSrcBase + Sd->mInBuf) >> Sd->mBitCount;
+    Sd->mInBuf     += Bytes;
+    Sd->mBitCount  += Bytes << 3;
+    return;
+  }
 
+  while (Sd->mBitCount <= BITBUFSIZ - 8) {
+    if (Sd->mInBuf < Sd->mCompSize) {
+      Sd->mBitBuf |= (UINT64) Sd->mSrcBase[Sd->mInBuf++] << (BITBUFSIZ - 8 - Sd->mBitCount);
     }
+    Sd->mBitCount += 8;
   }
+}
+
+STATIC
+UINT32
+PeekBits (
+  IN  SCRATCH_DATA  *Sd,
+  IN  UINT16        NumOfBits
+  )
+/*++
+
+Routine Description:
+
+  Return the next NumOfBits (1 to 32) bits without consuming them.
+
+Arguments:
+
+  Sd            - The global scratch data.
+  NumOfBits     - The number of bits to return.
 
-  Sd->mBitCount = (UINT16) (Sd->mBitCount - NumOfBits);
-  Sd->mBitBuf |= Sd->mSubBitBuf >> Sd->mBitCount;
+Returns:
+
+  The bits.
+
+--*/
+{
+  return (UINT32) (Sd->mBitBuf >> (BITBUFSIZ - NumOfBits));
+}
+
+STATIC
+VOID
+SkipBits (
+  IN  SCRATCH_DATA  *Sd,
+  IN  UINT16        NumOfBits
+  )
+/*++
+
+Routine Description:
+
+  Consume NumOfBits bits. The caller has made sure they are valid.
+
+Arguments:
+
+  Sd            - The global scratch data.
+  NumOfBits     - The number of bits to consume.
+
+Returns: (VOID)
+
+--*/
+{
+  Sd->mBitBuf   <<= NumOfBits;
+  Sd->mBitCount -= NumOfBits;
 }
 
 STATIC
@@ -134,9 +231,7 @@ GetBits (
 
 Routine Description:
 
-  Get NumOfBits of bits out from mBitBuf. Fill mBitBuf with subsequent
-  NumOfBits of bits from source. Returns NumOfBits of bits that are
-  popped out.
+  Get NumOfBits (1 to 32) bits out from the source.
 
 Arguments:
 
@@ -151,9 +246,9 @@ Returns:
 {
   UINT32  OutBits;
 
-  OutBits = (UINT32) (Sd->mBitBuf >> (BITBUFSIZ - NumOfBits));
-
-  FillBuf (Sd, NumOfBits);
+  RefillBits (Sd);
+  OutBits = PeekBits (Sd, NumOfBits);
+  SkipBits (Sd, NumOfBits);
 
   return OutBits;
 }
@@ -165,84 +260,78 @@ MakeTable (
   IN  UINT16        NumOfChar,
   IN  UINT8         *BitLen,
   IN  UINT16        TableBits,
-  OUT UINT16        *Table
+  OUT UINT16        *Table,
+  OUT UINT16        *SubBits
   )
 /*++
 
 Routine Description:
 
   Creates Huffman Code mapping table according to code length array.
+  Codes are assigned canonically: shorter codes first, and within one
+  length in symbol order.
 
 Arguments:
 
   Sd        - The global scratch data
   NumOfChar - Number of symbols in the symbol set
   BitLen    - Code length array
-  TableBits - The width of the mapping table
-  Table     - The table
+  TableBits - The width of the primary table
+  Table     - The table, primary part first, then the secondary tables
+  SubBits   - Receives the width of the secondary tables
 
 Returns:
 
   0         - OK.
-  BAD_TABLE - The table is corrupted.
+  BAD_TABLE - The code lengths do not describe a complete code.
 
 --*/
 {
-  UINT16  Count[17];
-  UINT16  Weight[17];
-  UINT16  Start[18];
-  UINT16  *Pointer;
-  UINT16  Index3;
-  UINT16  Index;
-  UINT16  Len;
+  UINT32  Count[17];
+  UINT32  Start[17];
+  UINT32  Total;
+  UINT32  Code;
+  UINT32  Index;
+  UINT32  Last;
+  UINT32  Avail;
+  UINT16  *SubTable;
   UINT16  Char;
-  UINT16  JuBits;
-  UINT16  Avail;
-  UINT16  NextCode;
-  UINT16  Mask;
+  UINT16  Len;
+  UINT16  MaxLen;
 
-  for (Index = 1; Index <= 16; Index++) {
+  for (Index = 0; Index <= 16; Index++) {
     Count[Index] = 0;
   }
 
-  for (Index = 0; Index < NumOfChar; Index++) {
-    Count[BitLen[Index]]++;
+  for (Char = 0; Char < NumOfChar; Char++) {
+    Count[BitLen[Char]]++;
   }
 
-  Start[1] = 0;
-
-  for (Index = 1; Index <= 16; Index++) {
-    Start[Index + 1] = (UINT16) (Start[Index] + (Count[Index] << (16 - Index)));
+  //
+  // Start[Len] is the first code of length Len, left aligned to 16 bits
+  //
+  Total   = 0;
+  MaxLen  = 0;
+  for (Len = 1; Len <= 16; Len++) {
+    Start[Len] = Total;
+    Total += Count[Len] << (16 - Len);
+    if (Count[Len] != 0) {
+      MaxLen = Len;
+    }
   }
 
-  if (Start[17] != 0) {
-    /*(1U << 16)*/
+  if (Total != (1U << 16)) {
     return (UINT16) BAD_TABLE;
   }
 
-  JuBits = (UINT16) (16 - TableBits);
+  *SubBits = (UINT16) (MaxLen > TableBits ? MaxLen - TableBits : 0);
 
-  for (Index = 1; Index <= TableBits; Index++) {
-    Start[Index] >>= JuBits;
-    Weight[Index] = (UINT16) (1U << (TableBits - Index));
-  }
-
-  while (Index <= 16) {
-    Weight[Index] = (UINT16) (1U << (16 - Index));
-    Index++;
-  }
-
-  Index = (UINT16) (Start[TableBits + 1] >> JuBits);
-
-  if (Index != 0) {
-    Index3 = (UINT16) (1U << TableBits);
-    while (Index != Index3) {
-      Table[Index++] = 0;
-    }
-  }
-
-  Avail = NumOfChar;
-  Mask  = (UINT16) (1U << (15 - TableBits));
+  //
+  // Every primary entry is written below; clearing them first tells links
+  // created for this table apart from entries left by the previous one.
+  //
+  memset (Table, 0, (1U << TableBits) * sizeof (UINT16));
+  Avail = 1U << TableBits;
 
   for (Char = 0; Char < NumOfChar; Char++) {
 
@@ -251,41 +340,33 @@ Returns:
       continue;
     }
 
-    NextCode = (UINT16) (Start[Len] + Weight[Len]);
+    Code        = Start[Len];
+    Start[Len] += 1U << (16 - Len);
 
     if (Len <= TableBits) {
 
-      for (Index = Start[Len]; Index < NextCode; Index++) {
-        Table[Index] = Char;
+      Index = Code >> (16 - TableBits);
+      Last  = Index + (1U << (TableBits - Len));
+      while (Index < Last) {
+        Table[Index++] = TABLE_ENTRY (Char, Len);
       }
 
     } else {
 
-      Index3  = Start[Len];
-      Pointer = &Table[Index3 >> JuBits];
-      Index   = (UINT16) (Len - TableBits);
-
-      while (Index != 0) {
-        if (*Pointer == 0) {
-          Sd->mRight[Avail]                     = Sd->mLeft[Avail] = 0;
-          *Pointer = Avail++;
-        }
-
-        if (Index3 & Mask) {
-          Pointer = &Sd->mRight[*Pointer];
-        } else {
-          Pointer = &Sd->mLeft[*Pointer];
-        }
-
-        Index3 <<= 1;
-        Index--;
+      Index = Code >> (16 - TableBits);
+      if ((Table[Index] & TABLE_LINK) == 0) {
+        Table[Index] = (UINT16) (TABLE_LINK | Avail);
+        Avail += 1U << *SubBits;
       }
 
-      *Pointer = Char;
+      SubTable  = &Table[Table[Index] & ~TABLE_LINK];
+      Index     = (Code >> (16 - MaxLen)) & ((1U << *SubBits) - 1);
+      Last      = Index + (1U << (MaxLen - Len));
+      while (Index < Last) {
+        SubTable[Index++] = TABLE_ENTRY (Char, Len);
+      }
 
     }
-
-    Start[Len] = NextCode;
   }
   //
   // Succeeds
@@ -294,57 +375,75 @@ Returns:
 }
 
 STATIC
-UINT32
-DecodeP (
-  IN  SCRATCH_DATA  *Sd
+UINT16
+LookupSymbol (
+  IN  UINT16        *Table,
+  IN  UINT16        TableBits,
+  IN  UINT16        SubBits,
+  IN  UINT64        BitBuf
   )
 /*++
 
 Routine Description:
 
-  Decodes a position value.
+  Find the table entry for the code at the top of BitBuf.
 
 Arguments:
 
-  Sd      - the global scratch data
+  Table     - The decoding table built by MakeTable()
+  TableBits - The width of the primary table
+  SubBits   - The width of the secondary tables
+  BitBuf    - The bit reservoir, at least 16 bits of it valid
 
 Returns:
 
-  The position value decoded.
+  The entry, holding the symbol and the length of its code.
 
 --*/
 {
-  UINT16  Val;
-  UINT32  Mask;
-  UINT32  Pos;
+  UINT16  Entry;
 
-  Val = Sd->mPTTable[Sd->mBitBuf >> (BITBUFSIZ - 8)];
+  Entry = Table[BitBuf >> (BITBUFSIZ - TableBits)];
+  if ((Entry & TABLE_LINK) != 0) {
+    Entry = Table[(Entry & ~TABLE_LINK) + ((BitBuf >> (BITBUFSIZ - TableBits - SubBits)) & ((1U << SubBits) - 1))];
+  }
 
-  if (Val >= MAXNP) {
-    Mask = 1U << (BITBUFSIZ - 1 - 8);
+  return Entry;
+}
 
-    do {
+STATIC
+UINT16
+DecodeSymbol (
+  IN  SCRATCH_DATA  *Sd,
+  IN  UINT16        *Table,
+  IN  UINT16        TableBits,
+  IN  UINT16        SubBits
+  )
+/*++
 
-      if (Sd->mBitBuf & Mask) {
-        Val = Sd->mRight[Val];
-      } else {
-        Val = Sd->mLeft[Val];
-      }
+Routine Description:
 
-      Mask >>= 1;
-    } while (Val >= MAXNP);
-  }
-  //
-  // Advance what we have read
-  //
-  FillBuf (Sd, Sd->mPTLen[Val]);
+  Decode one symbol with a table built by MakeTable() and consume its code.
+  At least 16 valid bits must be in the reservoir.
 
-  Pos = Val;
-  if (Val > 1) {
-    Pos = (UINT32) ((1U << (Val - 1)) + GetBits (Sd, (UINT16) (Val - 1)));
-  }
+Arguments:
+
+  Sd        - The global scratch data
+  Table     - The decoding table
+  TableBits - The width of the primary table
+  SubBits   - The width of the secondary tables
 
-  return Pos;
+Returns:
+
+  The symbol decoded.
+
+--*/
+{
+  UINT16  Entry;
+
+  Entry = LookupSymbol (Table, TableBits, SubBits, Sd->mBitBuf);
+  SkipBits (Sd, (UINT16) (Entry >> TABLE_LEN_SHIFT));
+  return (UINT16) (Entry & TABLE_SYM_MASK);
 }
 
 STATIC
@@ -378,48 +477,60 @@ Returns:
   UINT16  Number;
   UINT16  CharC;
   UINT16  Index;
-  UINT32  Mask;
 
   Number = (UINT16) GetBits (Sd, nbit);
 
   if (Number == 0) {
     CharC = (UINT16) GetBits (Sd, nbit);
 
-    for (Index = 0; Index < 256; Index++) {
-      Sd->mPTTable[Index] = CharC;
+    for (Index = 0; Index < (1U << PTTABLEBITS); Index++) {
+      Sd->mPTTable[Index] = TABLE_ENTRY (CharC, 0);
     }
 
     for (Index = 0; Index < nn; Index++) {
       Sd->mPTLen[Index] = 0;
     }
 
+    Sd->mPTSubBits = 0;
     return 0;
   }
 
+  if (Number > nn) {
+    return (UINT16) BAD_TABLE;
+  }
+
   Index = 0;
 
   while (Index < Number) {
 
-    CharC = (UINT16) (Sd->mBitBuf >> (BITBUFSIZ - 3));
+    RefillBits (Sd);
+    CharC = (UINT16) PeekBits (Sd, 3);
 
     if (CharC == 7) {
-      Mask = 1U << (BITBUFSIZ - 1 - 3);
-      while (Mask & Sd->mBitBuf) {
-        Mask >>= 1;
+      //
+      // Lengths of 7 and more continue in unary
+      //
+      while (CharC <= 16 && (Sd->mBitBuf & (1ULL << (BITBUFSIZ - 1 - CharC + 4))) != 0) {
         CharC += 1;
       }
+
+      if (CharC > 16) {
+        return (UINT16) BAD_TABLE;
+      }
     }
 
-    FillBuf (Sd, (UINT16) ((CharC < 7) ? 3 : CharC - 3));
+    SkipBits (Sd, (UINT16) ((CharC < 7) ? 3 : CharC - 3));
 
     Sd->mPTLen[Index++] = (UINT8) CharC;
 
     if (Index == Special) {
       CharC = (UINT16) GetBits (Sd, 2);
-      CharC--;
-      while ((INT16) (CharC) >= 0) {
+      if (Index + CharC > nn) {
+        return (UINT16) BAD_TABLE;
+      }
+
+      while (CharC-- > 0) {
         Sd->mPTLen[Index++] = 0;
-        CharC--;
       }
     }
   }
@@ -428,11 +539,11 @@ Returns:
     Sd->mPTLen[Index++] = 0;
   }
 
-  return MakeTable (Sd, nn, Sd->mPTLen, 8, Sd->mPTTable);
+  return MakeTable (Sd, nn, Sd->mPTLen, PTTABLEBITS, Sd->mPTTable, &Sd->mPTSubBits);
 }
 
 STATIC
-VOID
+UINT16
 ReadCLen (
   SCRATCH_DATA  *Sd
   )
@@ -446,14 +557,16 @@ Arguments:
 
   Sd    - the global scratch data
 
-Returns: (VOID)
+Returns:
+
+  0         - OK.
+  BAD_TABLE - Table is corrupted.
 
 --*/
 {
   UINT16  Number;
   UINT16  CharC;
   UINT16  Index;
-  UINT32  Mask;
 
   Number = (UINT16) GetBits (Sd, CBIT);
 
@@ -464,36 +577,23 @@ Returns: (VOID)
       Sd->mCLen[Index] = 0;
     }
 
-    for (Index = 0; Index < 4096; Index++) {
-      Sd->mCTable[Index] = CharC;
+    for (Index = 0; Index < (1U << CTABLEBITS); Index++) {
+      Sd->mCTable[Index] = TABLE_ENTRY (CharC, 0);
     }
 
-    return ;
+    Sd->mCSubBits = 0;
+    return 0;
+  }
+
+  if (Number > NC) {
+    return (UINT16) BAD_TABLE;
   }
 
   Index = 0;
   while (Index < Number) {
 
-    CharC = Sd->mPTTable[Sd->mBitBuf >> (BITBUFSIZ - 8)];
-    if (CharC >= NT) {
-      Mask = 1U << (BITBUFSIZ - 1 - 8);
-
-      do {
-
-        if (Mask & Sd->mBitBuf) {
-          CharC = Sd->mRight[CharC];
-        } else {
-          CharC = Sd->mLeft[CharC];
-        }
-
-        Mask >>= 1;
-
-      } while (CharC >= NT);
-    }
-    //
-    // Advance what we have read
-    //
-    FillBuf (Sd, Sd->mPTLen[CharC]);
+    RefillBits (Sd);
+    CharC = DecodeSymbol (Sd, Sd->mPTTable, PTTABLEBITS, Sd->mPTSubBits);
 
     if (CharC <= 2) {
 
@@ -505,14 +605,20 @@ Returns: (VOID)
         CharC = (UINT16) (GetBits (Sd, CBIT) + 20);
       }
 
-      CharC--;
-      while ((INT16) (CharC) >= 0) {
+      if (Index + CharC > NC) {
+        return (UINT16) BAD_TABLE;
+      }
+
+      while (CharC-- > 0) {
         Sd->mCLen[Index++] = 0;
-        CharC--;
       }
 
     } else {
 
+      if (CharC - 2 > 16) {
+        return (UINT16) BAD_TABLE;
+      }
+
       Sd->mCLen[Index++] = (UINT8) (CharC - 2);
 
     }
@@ -522,21 +628,19 @@ Returns: (VOID)
     Sd->mCLen[Index++] = 0;
   }
 
-  MakeTable (Sd, NC, Sd->mCLen, 12, Sd->mCTable);
-
-  return ;
+  return MakeTable (Sd, NC, Sd->mCLen, CTABLEBITS, Sd->mCTable, &Sd->mCSubBits);
 }
 
 STATIC
 UINT16
-DecodeC (
+ReadBlockHeader (
   SCRATCH_DATA  *Sd
   )
 /*++
 
 Routine Description:
 
-  Decode a character/length value.
+  Read the size and the code tables of the next block.
 
 Arguments:
 
@@ -544,53 +648,21 @@ Arguments:
 
 Returns:
 
-  The value decoded.
+  0         - OK.
+  BAD_TABLE - A table is corrupted.
 
 --*/
 {
-  UINT16  Index2;
-  UINT32  Mask;
-
-  if (Sd->mBlockSize == 0) {
-    //
-    // Starting a new block
-    //
-    Sd->mBlockSize    = (UINT16) GetBits (Sd, 16);
-    Sd->mBadTableFlag = ReadPTLen (Sd, NT, TBIT, 3);
-    if (Sd->mBadTableFlag != 0) {
-      return 0;
-    }
-
-    ReadCLen (Sd);
-
-    Sd->mBadTableFlag = ReadPTLen (Sd, MAXNP, mPbit, (UINT16) (-1));
-    if (Sd->mBadTableFlag != 0) {
-      return 0;
-    }
+  Sd->mBlockSize = (UINT16) GetBits (Sd, 16);
+  if (ReadPTLen (Sd, NT, TBIT, 3) != 0) {
+    return (UINT16) BAD_TABLE;
   }
 
-  Sd->mBlockSize--;
-  Index2 = Sd->mCTable[Sd->mBitBuf >> (BITBUFSIZ - 12)];
-
-  if (Index2 >= NC) {
-    Mask = 1U << (BITBUFSIZ - 1 - 12);
-
-    do {
-      if (Sd->mBitBuf & Mask) {
-        Index2 = Sd->mRight[Index2];
-      } else {
-        Index2 = Sd->mLeft[Index2];
-      }
-
-      Mask >>= 1;
-    } while (Index2 >= NC);
+  if (ReadCLen (Sd) != 0) {
+    return (UINT16) BAD_TABLE;
   }
-  //
-  // Advance what we have read
-  //
-  FillBuf (Sd, Sd->mCLen[Index2]);
 
-  return Index2;
+  return ReadPTLen (Sd, MAXNP, Sd->mPbit, (UINT16) (-1));
 }
 
 STATIC
@@ -603,6 +675,9 @@ Decode (
 Routine Description:
 
   Decode the source data and put the resulting data into the destination buffer.
+  The bit reservoir is kept in locals while decoding a block: a byte stored
+  to the destination could alias the scratch data, so working on Sd would
+  reload the reservoir after every output byte.
 
 Arguments:
 
@@ -612,52 +687,172 @@ Returns: (VOID)
 
  --*/
 {
-  UINT16  BytesRemain;
-  UINT32  DataIdx;
+  UINT8   *Src;
+  UINT8   *Dst;
+  UINT8   *Copy;
+  UINT16  *CTable;
+  UINT16  *PTTable;
+  UINT64  BitBuf;
+  UINT64  Word;
+  UINT32  BitCount;
+  UINT32  InBuf;
+  UINT32  Bytes;
+  UINT32  OutBuf;
+  UINT32  OrigSize;
+  UINT32  CompSize;
+  UINT32  Distance;
+  UINT32  BytesRemain;
+  UINT32  Period;
+  UINT16  BlockSize;
+  UINT16  CSubBits;
+  UINT16  PTSubBits;
+  UINT16  Entry;
   UINT16  CharC;
 
-  BytesRemain = (UINT16) (-1);
+  Src       = Sd->mSrcBase;
+  Dst       = Sd->mDstBase;
+  CTable    = Sd->mCTable;
+  PTTable   = Sd->mPTTable;
+  CompSize  = Sd->mCompSize;
+  OrigSize  = Sd->mOrigSize;
+  OutBuf    = 0;
+  BlockSize = 0;
+  CSubBits  = 0;
+  PTSubBits = 0;
+  BitBuf    = Sd->mBitBuf;
+  BitCount  = Sd->mBitCount;
+  InBuf     = Sd->mInBuf;
+
+  while (OutBuf < OrigSize) {
+    if (BlockSize == 0) {
+      //
+      // Starting a new block
+      //
+      Sd->mBitBuf       = BitBuf;
+      Sd->mBitCount     = BitCount;
+      Sd->mInBuf        = InBuf;
+      Sd->mBadTableFlag = ReadBlockHeader (Sd);
+      if (Sd->mBadTableFlag != 0) {
+        break;
+      }
+      BitBuf    = Sd->mBitBuf;
+      BitCount  = Sd->mBitCount;
+      InBuf     = Sd->mInBuf;
+      BlockSize = Sd->mBlockSize;
+      CSubBits  = Sd->mCSubBits;
+      PTSubBits = Sd->mPTSubBits;
+    }
 
-  DataIdx     = 0;
+    BlockSize--;
 
-  for (;;) {
-    CharC = DecodeC (Sd);
-    if (Sd->mBadTableFlag != 0) {
-      return ;
+    //
+    // One refill covers a character/length code, a position code and the
+    // extra bits of the position
+    //
+    if (BitCount < REFILL_BITS) {
+      if (InBuf + 8 <= CompSize) {
+        Bytes     = (BITBUFSIZ - 1 - BitCount) >> 3;
+        BitBuf   |= ReadBigEndian64 (Src + InBuf) >> BitCount;
+        InBuf    += Bytes;
+        BitCount += Bytes << 3;
+      } else {
+        Sd->mBitBuf   = BitBuf;
+        Sd->mBitCount = BitCount;
+        Sd->mInBuf    = InBuf;
+        RefillBits (Sd);
+        BitBuf        = Sd->mBitBuf;
+        BitCount      = Sd->mBitCount;
+        InBuf         = Sd->mInBuf;
+      }
     }
 
+    Entry     = LookupSymbol (CTable, CTABLEBITS, CSubBits, BitBuf);
+    BitBuf  <<= Entry >> TABLE_LEN_SHIFT;
+    BitCount -= Entry >> TABLE_LEN_SHIFT;
+    CharC     = (UINT16) (Entry & TABLE_SYM_MASK);
+
     if (CharC < 256) {
       //
       // Process an Original character
       //
-      Sd->mDstBase[Sd->mOutBuf++] = (UINT8) CharC;
-      if (Sd->mOutBuf >= Sd->mOrigSize) {
-        return ;
-      }
+      Dst[OutBuf++] = (UINT8) CharC;
+      continue;
+    }
 
-    } else {
+    //
+    // Process a Pointer
+    //
+    BytesRemain = (UINT32) (CharC - (UINT8_MAX + 1 - THRESHOLD));
+
+    Entry     = LookupSymbol (PTTable, PTTABLEBITS, PTSubBits, BitBuf);
+    BitBuf  <<= Entry >> TABLE_LEN_SHIFT;
+    BitCount -= Entry >> TABLE_LEN_SHIFT;
+    CharC     = (UINT16) (Entry & TABLE_SYM_MASK);
+
+    Distance = CharC + 1U;
+    if (CharC > 1) {
       //
-      // Process a Pointer
+      // Only a corrupted table has positions too long for the reservoir
       //
-      CharC       = (UINT16) (CharC - (UINT8_MAX + 1 - THRESHOLD));
+      if ((UINT32) (CharC - 1) > BitCount) {
+        Sd->mBadTableFlag = (UINT16) BAD_TABLE;
+        break;
+      }
+      Distance  = (1U << (CharC - 1)) + (UINT32) (BitBuf >> (BITBUFSIZ - (CharC - 1))) + 1;
+      BitBuf  <<= CharC - 1;
+      BitCount -= CharC - 1;
+    }
+
+    if (Distance > OutBuf) {
+      Sd->mBadTableFlag = (UINT16) BAD_TABLE;
+      break;
+    }
+
+    if (BytesRemain > OrigSize - OutBuf) {
+      BytesRemain = OrigSize - OutBuf;
+    }
 
-      BytesRemain = CharC;
+    Copy    = &Dst[OutBuf - Distance];
+    OutBuf += BytesRemain;
 
-      DataIdx     = Sd->mOutBuf - DecodeP (Sd) - 1;
+    //
+    // Whole words can be moved once the source is at least a word behind
+    // the destination. A nearer source repeats a short pattern: once a
+    // word's worth of whole periods has been written byte by byte, the
+    // copy continues from that many bytes back.
+    //
+    if (Distance < sizeof (Word) && BytesRemain >= 2 * sizeof (Word)) {
+      Period = Distance;
+      while (Period < sizeof (Word)) {
+        Period += Distance;
+      }
 
-      BytesRemain--;
-      while ((INT16) (BytesRemain) >= 0) {
-        Sd->mDstBase[Sd->mOutBuf++] = Sd->mDstBase[DataIdx++];
-        if (Sd->mOutBuf >= Sd->mOrigSize) {
-          return ;
-        }
+      for (Bytes = Distance; Bytes < Period; Bytes++) {
+        Copy[Distance] = *Copy;
+        Copy++;
+      }
+
+      BytesRemain -= Period - Distance;
+      Copy        -= Period - Distance;
+      Distance     = Period;
+    }
 
-        BytesRemain--;
+    if (Distance >= sizeof (Word)) {
+      while (BytesRemain >= sizeof (Word)) {
+        memcpy (&Word, Copy, sizeof (Word));
+        memcpy (Copy + Distance, &Word, sizeof (Word));
+        Copy        += sizeof (Word);
+        BytesRemain -= sizeof (Word);
       }
     }
+
+    while (BytesRemain-- > 0) {
+      Copy[Distance] = *Copy;
+      Copy++;
+    }
   }
 
-  return ;
+  Sd->mOutBuf = OutBuf;
 }
 
 EFI_STATUS
@@ -707,7 +902,8 @@ Decompress (
   IN OUT  VOID    *Destination,
   IN      UINT32  DstSize,
   IN OUT  VOID    *Scratch,
-  IN      UINT32  ScratchSize
+  IN      UINT32  ScratchSize,
+  IN      UINT16  Pbit
   )
 /*++
 
@@ -723,6 +919,7 @@ Arguments:
   DstSize     - The size of destination buffer.
   Scratch     - The buffer used internally by the decompress routine. This  buffer is needed to store intermediate data.
   ScratchSize - The size of scratch buffer.
+  Pbit        - Width of the position set size, EFIPBIT or MAXPBIT
 
 Returns:
 
@@ -731,7 +928,6 @@ Returns:
 
 --*/
 {
-  UINT32        Index;
   UINT32        CompSize;
   UINT32        OrigSize;
   EFI_STATUS    Status;
@@ -766,19 +962,21 @@ Returns:
 
   Src = Src + 8;
 
-  for (Index = 0; Index < sizeof (SCRATCH_DATA); Index++) {
-    ((UINT8 *) Sd)[Index] = 0;
-  }
-
-  Sd->mSrcBase  = Src;
-  Sd->mDstBase  = Dst;
-  Sd->mCompSize = CompSize;
-  Sd->mOrigSize = OrigSize;
-
   //
-  // Fill the first BITBUFSIZ bits
+  // The code tables are rebuilt for every block, so only the decoder
+  // state needs a reset
   //
-  FillBuf (Sd, BITBUFSIZ);
+  Sd->mSrcBase      = Src;
+  Sd->mDstBase      = Dst;
+  Sd->mOutBuf       = 0;
+  Sd->mInBuf        = 0;
+  Sd->mBitCount     = 0;
+  Sd->mBitBuf       = 0;
+  Sd->mBlockSize    = 0;
+  Sd->mCompSize     = CompSize;
+  Sd->mOrigSize     = OrigSize;
+  Sd->mBadTableFlag = 0;
+  Sd->mPbit         = Pbit;
 
   //
   // Decompress it
@@ -886,8 +1084,7 @@ Returns:
 
 --*/
 {
-  mPbit = EFIPBIT;
-  return Decompress (Source, SrcSize, Destination, DstSize, Scratch, ScratchSize);
+  return Decompress (Source, SrcSize, Destination, DstSize, Scratch, ScratchSize, EFIPBIT);
 }
 
 EFI_STATUS
@@ -921,8 +1118,7 @@ Returns:
 
 --*/
 {
-  mPbit = MAXPBIT;
-  return Decompress (Source, SrcSize, Destination, DstSize, Scratch, ScratchSize);
+  return Decompress (Source, SrcSize, Destination, DstSize, Scratch, ScratchSize, MAXPBIT);
 }
 
 EFI_STATUS
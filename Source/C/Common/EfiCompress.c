@@ -44,8 +44,20 @@ typedef INT16             NODE;
 #define NIL               0
 #define MAX_HASH_VAL      (3 * WNDSIZ + (WNDSIZ / 512 + 1) * UINT8_MAX)
 #define HASH(p, c)        ((p) + ((c) << (WNDBIT - 9)) + WNDSIZ * 2)
+
+//
+// Hash chain match finder used by CompressLevelFast and CompressLevelMax.
+// Chains link earlier positions whose next three bytes hash alike.
+//
+#define HC_HASH_BITS  15
+#define HC_HASH_SIZE  (1U << HC_HASH_BITS)
+#define HC_HASH(t, p) \
+  (((((UINT32) (t)[p] << 16) | ((UINT32) (t)[(p) + 1] << 8) | (t)[(p) + 2]) * 2654435761U) >> (32 - HC_HASH_BITS))
+#define HC_FAST_DEPTH 8
+#define HC_FAST_NICE  32
+#define HC_MAX_DEPTH  1024
 #define CRCPOLY           0xA001
-#define UPDATE_CRC(c)     mCrc = mCrcTable[(mCrc ^ (c)) & 0xFF] ^ (mCrc >> UINT8_BIT)
+#define UPDATE_CRC(Cd, c)     (Cd)->mCrc = (Cd)->mCrcTable[((Cd)->mCrc ^ (c)) & 0xFF] ^ ((Cd)->mCrc >> UINT8_BIT)
 
 //
 // C: the Char&Len Set; P: the Position Set; T: the exTra Set
@@ -69,28 +81,33 @@ typedef INT16             NODE;
 
 STATIC
 VOID 
-PutDword(
+PutDword (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN UINT32 Data
   );
 
 STATIC
 EFI_STATUS 
 AllocateMemory (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 FreeMemory (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC 
 VOID 
 InitSlide (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC 
 NODE 
 Child (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN NODE q, 
   IN UINT8 c
   );
@@ -98,6 +115,7 @@ Child (
 STATIC 
 VOID 
 MakeChild (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN NODE q, 
   IN UINT8 c, 
   IN NODE r
@@ -106,37 +124,77 @@ MakeChild (
 STATIC 
 VOID 
 Split (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN NODE Old
   );
 
 STATIC 
 VOID 
 InsertNode (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
   
 STATIC 
 VOID 
 DeleteNode (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC 
 VOID 
 GetNextMatch (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  );
+
+STATIC
+VOID
+SkipMatch (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  );
+
+STATIC
+VOID
+AdvancePosition (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  );
+
+STATIC
+VOID
+HcInsertNode (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
+  IN BOOLEAN Search
+  );
+
+STATIC
+INT32
+HcFindMatch (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
+  IN  NODE  Pos,
+  OUT NODE  *MatchPos
+  );
+
+STATIC
+VOID
+HcSlide (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
   
 STATIC 
 EFI_STATUS 
 Encode (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC 
 VOID 
 CountTFreq (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC 
 VOID 
 WritePTLen (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN INT32 n, 
   IN INT32 nbit, 
   IN INT32 Special
@@ -145,28 +203,33 @@ WritePTLen (
 STATIC 
 VOID 
 WriteCLen (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
   
 STATIC 
 VOID 
 EncodeC (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN INT32 c
   );
 
 STATIC 
 VOID 
 EncodeP (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN UINT32 p
   );
 
 STATIC 
 VOID 
 SendBlock (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
   
 STATIC 
 VOID 
 Output (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN UINT32 c, 
   IN UINT32 p
   );
@@ -174,21 +237,25 @@ Output (
 STATIC 
 VOID 
 HufEncodeStart (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
   
 STATIC 
 VOID 
 HufEncodeEnd (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
   
 STATIC 
 VOID 
 MakeCrcTable (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
   
 STATIC 
 VOID 
 PutBits (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN INT32 n, 
   IN UINT32 x
   );
@@ -196,6 +263,7 @@ PutBits (
 STATIC 
 INT32 
 FreadCrc (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   OUT UINT8 *p, 
   IN  INT32 n
   );
@@ -203,29 +271,34 @@ FreadCrc (
 STATIC 
 VOID 
 InitPutBits (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
   );
   
 STATIC 
 VOID 
 CountLen (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN INT32 i
   );
 
 STATIC 
 VOID 
 MakeLen (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN INT32 Root
   );
   
 STATIC 
 VOID 
 DownHeap (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN INT32 i
   );
 
 STATIC 
 VOID 
 MakeCode (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN  INT32 n, 
   IN  UINT8 Len[], 
   OUT UINT16 Code[]
@@ -234,6 +307,7 @@ MakeCode (
 STATIC 
 INT32 
 MakeTree (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN  INT32   NParm, 
   IN  UINT16  FreqParm[], 
   OUT UINT8   LenParm[], 
@@ -242,30 +316,213 @@ MakeTree (
 
 
 //
-//  Global Variables
+// Encoder state. Every compression runs on its own context so that several
+// threads can compress independently as long as they don't share a context.
 //
+struct _EFI_COMPRESS_CONTEXT {
+  UINT8   *mSrc;
+  UINT8   *mDst;
+  UINT8   *mSrcUpperLimit;
+  UINT8   *mDstUpperLimit;
+
+  UINT8   *mLevel;
+  UINT8   *mText;
+  UINT8   *mChildCount;
+  UINT8   *mBuf;
+  UINT8   mCLen[NC];
+  UINT8   mPTLen[NPT];
+  UINT8   *mLen;
+  INT16   mHeap[NC + 1];
+  INT32   mRemainder;
+  INT32   mMatchLen;
+  INT32   mBitCount;
+  INT32   mHeapSize;
+  INT32   mN;
+  INT32   mDepth;
+  UINT32  mBufSiz;
+  UINT32  mOutputPos;
+  UINT32  mOutputMask;
+  UINT32  mCPos;
+  UINT32  mSubBitBuf;
+  UINT32  mCrc;
+  UINT32  mCompSize;
+  UINT32  mOrigSize;
+
+  UINT16  *mFreq;
+  UINT16  *mSortPtr;
+  UINT16  mLenCnt[17];
+  UINT16  mLeft[2 * NC - 1];
+  UINT16  mRight[2 * NC - 1];
+  UINT16  mCrcTable[UINT8_MAX + 1];
+  UINT16  mCFreq[2 * NC - 1];
+  UINT16  mCCode[NC];
+  UINT16  mPFreq[2 * NP - 1];
+  UINT16  mPTCode[NPT];
+  UINT16  mTFreq[2 * NT - 1];
+
+  NODE    mPos;
+  NODE    mMatchPos;
+  NODE    mAvail;
+  NODE    *mPosition;
+  NODE    *mParent;
+  NODE    *mPrev;
+  NODE    *mNext;
+
+  COMPRESS_LEVEL  mCompressLevel;
+  UINT32  mHcDepth;
+  INT32   mHcNiceLen;
+  NODE    *mHcHead;
+  NODE    *mHcPrev;
+};
 
-STATIC UINT8  *mSrc, *mDst, *mSrcUpperLimit, *mDstUpperLimit;
+//
+// functions
+//
 
-STATIC UINT8  *mLevel, *mText, *mChildCount, *mBuf, mCLen[NC], mPTLen[NPT], *mLen;
-STATIC INT16  mHeap[NC + 1];
-STATIC INT32  mRemainder, mMatchLen, mBitCount, mHeapSize, mN;
-STATIC UINT32 mBufSiz = 0, mOutputPos, mOutputMask, mSubBitBuf, mCrc;
-STATIC UINT32 mCompSize, mOrigSize;
+EFI_STATUS
+EfiCompressCreateContext (
+  OUT EFI_COMPRESS_CONTEXT  **Context
+  )
+/*++
 
-STATIC UINT16 *mFreq, *mSortPtr, mLenCnt[17], mLeft[2 * NC - 1], mRight[2 * NC - 1],
-              mCrcTable[UINT8_MAX + 1], mCFreq[2 * NC - 1],mCCode[NC],
-              mPFreq[2 * NP - 1], mPTCode[NPT], mTFreq[2 * NT - 1];
+Routine Description:
 
-STATIC NODE   mPos, mMatchPos, mAvail, *mPosition, *mParent, *mPrev, *mNext = NULL;
+  Allocate an encoder context for EfiCompressEx(). The context owns the
+  sliding dictionary and search tree, so it can be reused for any number
+  of compressions without reallocating them.
 
+Arguments:
 
-//
-// functions
-//
+  Context     - Receives the new context
+
+Returns:
+
+  EFI_SUCCESS           - The context is created.
+  EFI_OUT_OF_RESOURCES  - No resource to complete function.
+  EFI_INVALID_PARAMETER - Context is NULL.
+
+--*/
+{
+  EFI_COMPRESS_CONTEXT  *Cd;
+  EFI_STATUS            Status;
+
+  if (Context == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  *Context = NULL;
+  Cd = (EFI_COMPRESS_CONTEXT *) calloc (1, sizeof (EFI_COMPRESS_CONTEXT));
+  if (Cd == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = AllocateMemory (Cd);
+  if (EFI_ERROR (Status)) {
+    FreeMemory (Cd);
+    free (Cd);
+    return Status;
+  }
+
+  MakeCrcTable (Cd);
+  Cd->mCompressLevel = CompressLevelDefault;
+
+  *Context = Cd;
+  return EFI_SUCCESS;
+}
+
+VOID
+EfiCompressFreeContext (
+  IN EFI_COMPRESS_CONTEXT  *Context
+  )
+/*++
+
+Routine Description:
+
+  Free a context created by EfiCompressCreateContext().
+
+Arguments:
+
+  Context     - The context to free, may be NULL
+
+Returns: (VOID)
+
+--*/
+{
+  if (Context != NULL) {
+    FreeMemory (Context);
+    free (Context);
+  }
+}
 
 EFI_STATUS
-EfiCompress (
+EfiCompressSetLevel (
+  IN OUT EFI_COMPRESS_CONTEXT  *Context,
+  IN     COMPRESS_LEVEL  Level
+  )
+/*++
+
+Routine Description:
+
+  Select the match finder used by later EfiCompressEx() calls on Context.
+
+Arguments:
+
+  Context     - A context created by EfiCompressCreateContext()
+  Level       - CompressLevelFast searches bounded hash chains,
+                CompressLevelDefault uses the suffix tree and gives the
+                same output as EfiCompress(), CompressLevelMax walks
+                much deeper hash chains. The 8 KB window leaves too few
+                long matches for a second lazy step to pay off, so unlike
+                TianoCompressSetLevel() it does not look further ahead.
+                CompressLevelMax also runs the suffix tree and keeps the
+                smaller output, so it costs the time of both searches
+
+Returns:
+
+  EFI_SUCCESS           - The level is selected.
+  EFI_OUT_OF_RESOURCES  - The hash chain tables could not be allocated.
+  EFI_UNSUPPORTED       - CompressLevelOptimal is only implemented by
+                          TianoCompressSetLevel().
+  EFI_INVALID_PARAMETER - Parameter supplied is wrong.
+
+--*/
+{
+  if (Level == CompressLevelOptimal) {
+    return EFI_UNSUPPORTED;
+  }
+
+  if (Context == NULL || Level < CompressLevelFast || Level > CompressLevelMax) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (Level != CompressLevelDefault && Context->mHcHead == NULL) {
+    Context->mHcHead = malloc (HC_HASH_SIZE * sizeof (*Context->mHcHead));
+    Context->mHcPrev = malloc (WNDSIZ * sizeof (*Context->mHcPrev));
+    if (Context->mHcHead == NULL || Context->mHcPrev == NULL) {
+      free (Context->mHcHead);
+      free (Context->mHcPrev);
+      Context->mHcHead = NULL;
+      Context->mHcPrev = NULL;
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  if (Level == CompressLevelFast) {
+    Context->mHcDepth   = HC_FAST_DEPTH;
+    Context->mHcNiceLen = HC_FAST_NICE;
+  } else {
+    Context->mHcDepth   = HC_MAX_DEPTH;
+    Context->mHcNiceLen = MAXMATCH;
+  }
+
+  Context->mCompressLevel = Level;
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+EfiCompressPass (
+  IN OUT  EFI_COMPRESS_CONTEXT  *Context,
   IN      UINT8   *SrcBuffer,
   IN      UINT32  SrcSize,
   IN      UINT8   *DstBuffer,
@@ -275,10 +532,11 @@ EfiCompress (
 
 Routine Description:
 
-  The main compression routine.
+  Compress SrcBuffer once with the match finder selected in Context.
 
 Arguments:
 
+  Context     - The encoder context
   SrcBuffer   - The buffer storing the source data
   SrcSize     - The size of source data
   DstBuffer   - The buffer to store the compressed data
@@ -290,43 +548,38 @@ Returns:
   EFI_BUFFER_TOO_SMALL  - The DstBuffer is too small. In this case,
                 DstSize contains the size needed.
   EFI_SUCCESS           - Compression is successful.
+  EFI_OUT_OF_RESOURCES  - No resource to complete function.
 
 --*/
 {
-  EFI_STATUS Status = EFI_SUCCESS;
-  
+  EFI_COMPRESS_CONTEXT  *Cd;
+  EFI_STATUS            Status;
+
   //
   // Initializations
   //
-  mBufSiz = 0;
-  mBuf = NULL;
-  mText       = NULL;
-  mLevel      = NULL;
-  mChildCount = NULL;
-  mPosition   = NULL;
-  mParent     = NULL;
-  mPrev       = NULL;
-  mNext       = NULL;
+  Cd                  = Context;
+  Cd->mSrc            = SrcBuffer;
+  Cd->mSrcUpperLimit  = Cd->mSrc + SrcSize;
+  Cd->mDst            = DstBuffer;
+  Cd->mDstUpperLimit  = Cd->mDst + *DstSize;
 
-  
-  mSrc = SrcBuffer;
-  mSrcUpperLimit = mSrc + SrcSize;
-  mDst = DstBuffer;
-  mDstUpperLimit = mDst + *DstSize;
+  memset (Cd->mText, 0, WNDSIZ * 2 + MAXMATCH);
+  Cd->mBuf[0]         = 0;
+  Cd->mDepth          = 0;
+  Cd->mCPos           = 0;
 
-  PutDword(0L);
-  PutDword(0L);
-  
-  MakeCrcTable ();
+  PutDword (Cd, 0L);
+  PutDword (Cd, 0L);
 
-  mOrigSize = mCompSize = 0;
-  mCrc = INIT_CRC;
+  Cd->mOrigSize = Cd->mCompSize = 0;
+  Cd->mCrc = INIT_CRC;
   
   //
   // Compress it
   //
   
-  Status = Encode();
+  Status = Encode (Cd);
   if (EFI_ERROR (Status)) {
     return EFI_OUT_OF_RESOURCES;
   }
@@ -334,34 +587,167 @@ Returns:
   //
   // Null terminate the compressed data
   //
-  if (mDst < mDstUpperLimit) {
-    *mDst++ = 0;
+  if (Cd->mDst < Cd->mDstUpperLimit) {
+    *Cd->mDst++ = 0;
   }
   
   //
   // Fill in compressed size and original size
   //
-  mDst = DstBuffer;
-  PutDword(mCompSize+1);
-  PutDword(mOrigSize);
+  Cd->mDst = DstBuffer;
+  PutDword (Cd, Cd->mCompSize+1);
+  PutDword (Cd, Cd->mOrigSize);
 
   //
   // Return
   //
   
-  if (mCompSize + 1 + 8 > *DstSize) {
-    *DstSize = mCompSize + 1 + 8;
+  if (Cd->mCompSize + 1 + 8 > *DstSize) {
+    *DstSize = Cd->mCompSize + 1 + 8;
     return EFI_BUFFER_TOO_SMALL;
   } else {
-    *DstSize = mCompSize + 1 + 8;
+    *DstSize = Cd->mCompSize + 1 + 8;
     return EFI_SUCCESS;
   }
 
 }
 
+EFI_STATUS
+EfiCompressEx (
+  IN OUT  EFI_COMPRESS_CONTEXT  *Context,
+  IN      UINT8                 *SrcBuffer,
+  IN      UINT32                SrcSize,
+  IN      UINT8                 *DstBuffer,
+  IN OUT  UINT32                *DstSize
+  )
+/*++
+
+Routine Description:
+
+  EFI compress SrcBuffer using the state held in Context. The output is
+  identical to EfiCompress().
+
+Arguments:
+
+  Context     - A context created by EfiCompressCreateContext(), which
+                must not be used by another thread at the same time
+  SrcBuffer   - The buffer storing the source data
+  SrcSize     - The size of source data
+  DstBuffer   - The buffer to store the compressed data
+  DstSize     - On input, the size of DstBuffer; On output,
+                the size of the actual compressed data.
+
+Returns:
+
+  EFI_BUFFER_TOO_SMALL  - The DstBuffer is too small. In this case,
+                DstSize contains the size needed.
+  EFI_SUCCESS           - Compression is successful.
+  EFI_INVALID_PARAMETER - Parameter supplied is wrong.
+
+--*/
+{
+  EFI_STATUS            Status;
+  EFI_STATUS            ChainStatus;
+  UINT8                 *ChainBuffer;
+  UINT32                TreeSize;
+  UINT32                ChainSize;
+
+  if (Context == NULL || DstSize == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (Context->mCompressLevel != CompressLevelMax) {
+    return EfiCompressPass (Context, SrcBuffer, SrcSize, DstBuffer, DstSize);
+  }
+
+  //
+  // The deep hash chain search usually beats the suffix tree, but not on
+  // every input. Compress with both and keep the smaller stream, so the
+  // maximum level never loses to the default one.
+  //
+  TreeSize                = *DstSize;
+  Context->mCompressLevel = CompressLevelDefault;
+  Status                  = EfiCompressPass (Context, SrcBuffer, SrcSize, DstBuffer, &TreeSize);
+  Context->mCompressLevel = CompressLevelMax;
+  if (EFI_ERROR (Status) && Status != EFI_BUFFER_TOO_SMALL) {
+    return Status;
+  }
+
+  ChainBuffer = malloc (TreeSize);
+  if (ChainBuffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  ChainSize   = TreeSize;
+  ChainStatus = EfiCompressPass (Context, SrcBuffer, SrcSize, ChainBuffer, &ChainSize);
+  if (EFI_ERROR (ChainStatus) && ChainStatus != EFI_BUFFER_TOO_SMALL) {
+    free (ChainBuffer);
+    return ChainStatus;
+  }
+
+  if (ChainSize < TreeSize) {
+    if (ChainSize <= *DstSize) {
+      memcpy (DstBuffer, ChainBuffer, ChainSize);
+      Status = EFI_SUCCESS;
+    } else {
+      Status = EFI_BUFFER_TOO_SMALL;
+    }
+    TreeSize = ChainSize;
+  }
+
+  free (ChainBuffer);
+  *DstSize = TreeSize;
+  return Status;
+}
+
+EFI_STATUS
+EfiCompress (
+  IN      UINT8   *SrcBuffer,
+  IN      UINT32  SrcSize,
+  IN      UINT8   *DstBuffer,
+  IN OUT  UINT32  *DstSize
+  )
+/*++
+
+Routine Description:
+
+  The main compression routine.
+
+Arguments:
+
+  SrcBuffer   - The buffer storing the source data
+  SrcSize     - The size of source data
+  DstBuffer   - The buffer to store the compressed data
+  DstSize     - On input, the size of DstBuffer; On output,
+                the size of the actual compressed data.
+
+Returns:
+
+  EFI_BUFFER_TOO_SMALL  - The DstBuffer is too small. In this case,
+                DstSize contains the size needed.
+  EFI_SUCCESS           - Compression is successful.
+  EFI_OUT_OF_RESOURCES  - No resource to complete function.
+
+--*/
+{
+  EFI_COMPRESS_CONTEXT  *Context;
+  EFI_STATUS            Status;
+
+  Status = EfiCompressCreateContext (&Context);
+  if (EFI_ERROR (Status)) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = EfiCompressEx (Context, SrcBuffer, SrcSize, DstBuffer, DstSize);
+
+  EfiCompressFreeContext (Context);
+  return Status;
+}
+
 STATIC 
 VOID 
-PutDword(
+PutDword (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN UINT32 Data
   )
 /*++
@@ -378,26 +764,28 @@ Returns: (VOID)
   
 --*/
 {
-  if (mDst < mDstUpperLimit) {
-    *mDst++ = (UINT8)(((UINT8)(Data        )) & 0xff);
+  if (Cd->mDst < Cd->mDstUpperLimit) {
+    *Cd->mDst++ = (UINT8)(((UINT8)(Data        )) & 0xff);
   }
 
-  if (mDst < mDstUpperLimit) {
-    *mDst++ = (UINT8)(((UINT8)(Data >> 0x08)) & 0xff);
+  if (Cd->mDst < Cd->mDstUpperLimit) {
+    *Cd->mDst++ = (UINT8)(((UINT8)(Data >> 0x08)) & 0xff);
   }
 
-  if (mDst < mDstUpperLimit) {
-    *mDst++ = (UINT8)(((UINT8)(Data >> 0x10)) & 0xff);
+  if (Cd->mDst < Cd->mDstUpperLimit) {
+    *Cd->mDst++ = (UINT8)(((UINT8)(Data >> 0x10)) & 0xff);
   }
 
-  if (mDst < mDstUpperLimit) {
-    *mDst++ = (UINT8)(((UINT8)(Data >> 0x18)) & 0xff);
+  if (Cd->mDst < Cd->mDstUpperLimit) {
+    *Cd->mDst++ = (UINT8)(((UINT8)(Data >> 0x18)) & 0xff);
   }
 }
 
 STATIC
 EFI_STATUS
-AllocateMemory ()
+AllocateMemory (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 /*++
 
 Routine Description:
@@ -413,34 +801,36 @@ Returns:
 
 --*/
 {
-  UINT32      i;
-  
-  mText       = malloc (WNDSIZ * 2 + MAXMATCH);
-  for (i = 0 ; i < WNDSIZ * 2 + MAXMATCH; i ++) {
-    mText[i] = 0;
+  Cd->mText       = malloc (WNDSIZ * 2 + MAXMATCH);
+
+  Cd->mLevel      = malloc ((WNDSIZ + UINT8_MAX + 1) * sizeof(*Cd->mLevel));
+  Cd->mChildCount = malloc ((WNDSIZ + UINT8_MAX + 1) * sizeof(*Cd->mChildCount));
+  Cd->mPosition   = malloc ((WNDSIZ + UINT8_MAX + 1) * sizeof(*Cd->mPosition));
+  Cd->mParent     = malloc (WNDSIZ * 2 * sizeof(*Cd->mParent));
+  Cd->mPrev       = malloc (WNDSIZ * 2 * sizeof(*Cd->mPrev));
+  Cd->mNext       = malloc ((MAX_HASH_VAL + 1) * sizeof(*Cd->mNext));
+  if (Cd->mText == NULL || Cd->mLevel == NULL || Cd->mChildCount == NULL ||
+      Cd->mPosition == NULL || Cd->mParent == NULL || Cd->mPrev == NULL ||
+      Cd->mNext == NULL) {
+    return EFI_OUT_OF_RESOURCES;
   }
-
-  mLevel      = malloc ((WNDSIZ + UINT8_MAX + 1) * sizeof(*mLevel));
-  mChildCount = malloc ((WNDSIZ + UINT8_MAX + 1) * sizeof(*mChildCount));
-  mPosition   = malloc ((WNDSIZ + UINT8_MAX + 1) * sizeof(*mPosition));
-  mParent     = malloc (WNDSIZ * 2 * sizeof(*mParent));
-  mPrev       = malloc (WNDSIZ * 2 * sizeof(*mPrev));
-  mNext       = malloc ((MAX_HASH_VAL + 1) * sizeof(*mNext));
   
-  mBufSiz = 16 * 1024U;
-  while ((mBuf = malloc(mBufSiz)) == NULL) {
-    mBufSiz = (mBufSiz / 10U) * 9U;
-    if (mBufSiz < 4 * 1024U) {
+  Cd->mBufSiz = 16 * 1024U;
+  while ((Cd->mBuf = malloc(Cd->mBufSiz)) == NULL) {
+    Cd->mBufSiz = (Cd->mBufSiz / 10U) * 9U;
+    if (Cd->mBufSiz < 4 * 1024U) {
       return EFI_OUT_OF_RESOURCES;
     }
   }
-  mBuf[0] = 0;
+  Cd->mBuf[0] = 0;
   
   return EFI_SUCCESS;
 }
 
 VOID
-FreeMemory ()
+FreeMemory (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 /*++
 
 Routine Description:
@@ -453,37 +843,45 @@ Returns: (VOID)
 
 --*/
 {
-  if (mText) {
-    free (mText);
+  if (Cd->mText) {
+    free (Cd->mText);
   }
   
-  if (mLevel) {
-    free (mLevel);
+  if (Cd->mLevel) {
+    free (Cd->mLevel);
   }
   
-  if (mChildCount) {
-    free (mChildCount);
+  if (Cd->mChildCount) {
+    free (Cd->mChildCount);
   }
   
-  if (mPosition) {
-    free (mPosition);
+  if (Cd->mPosition) {
+    free (Cd->mPosition);
   }
   
-  if (mParent) {
-    free (mParent);
+  if (Cd->mParent) {
+    free (Cd->mParent);
   }
   
-  if (mPrev) {
-    free (mPrev);
+  if (Cd->mPrev) {
+    free (Cd->mPrev);
   }
   
-  if (mNext) {
-    free (mNext);
+  if (Cd->mNext) {
+    free (Cd->mNext);
   }
   
-  if (mBuf) {
-    free (mBuf);
-  }  
+  if (Cd->mBuf) {
+    free (Cd->mBuf);
+  }
+
+  if (Cd->mHcHead != NULL) {
+    free (Cd->mHcHead);
+  }
+
+  if (Cd->mHcPrev != NULL) {
+    free (Cd->mHcPrev);
+  }
 
   return;
 }
@@ -491,7 +889,9 @@ Returns: (VOID)
 
 STATIC 
 VOID 
-InitSlide ()
+InitSlide (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 /*++
 
 Routine Description:
@@ -506,21 +906,29 @@ Returns: (VOID)
 {
   NODE i;
 
+  if (Cd->mCompressLevel != CompressLevelDefault) {
+    //
+    // NIL is 0, so clearing the heads empties every chain
+    //
+    memset (Cd->mHcHead, 0, HC_HASH_SIZE * sizeof (*Cd->mHcHead));
+    return;
+  }
+
   for (i = WNDSIZ; i <= WNDSIZ + UINT8_MAX; i++) {
-    mLevel[i] = 1;
-    mPosition[i] = NIL;  /* sentinel */
+    Cd->mLevel[i] = 1;
+    Cd->mPosition[i] = NIL;  /* sentinel */
   }
   for (i = WNDSIZ; i < WNDSIZ * 2; i++) {
-    mParent[i] = NIL;
+    Cd->mParent[i] = NIL;
   }  
-  mAvail = 1;
+  Cd->mAvail = 1;
   for (i = 1; i < WNDSIZ - 1; i++) {
-    mNext[i] = (NODE)(i + 1);
+    Cd->mNext[i] = (NODE)(i + 1);
   }
   
-  mNext[WNDSIZ - 1] = NIL;
+  Cd->mNext[WNDSIZ - 1] = NIL;
   for (i = WNDSIZ * 2; i <= MAX_HASH_VAL; i++) {
-    mNext[i] = NIL;
+    Cd->mNext[i] = NIL;
   }  
 }
 
@@ -528,6 +936,7 @@ Returns: (VOID)
 STATIC 
 NODE 
 Child (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN NODE q, 
   IN UINT8 c
   )
@@ -550,10 +959,10 @@ Returns:
 {
   NODE r;
   
-  r = mNext[HASH(q, c)];
-  mParent[NIL] = q;  /* sentinel */
-  while (mParent[r] != q) {
-    r = mNext[r];
+  r = Cd->mNext[HASH(q, c)];
+  Cd->mParent[NIL] = q;  /* sentinel */
+  while (Cd->mParent[r] != q) {
+    r = Cd->mNext[r];
   }
   
   return r;
@@ -562,6 +971,7 @@ Returns:
 STATIC 
 VOID 
 MakeChild (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN NODE q, 
   IN UINT8 c, 
   IN NODE r
@@ -585,18 +995,19 @@ Returns: (VOID)
   NODE h, t;
   
   h = (NODE)HASH(q, c);
-  t = mNext[h];
-  mNext[h] = r;
-  mNext[r] = t;
-  mPrev[t] = r;
-  mPrev[r] = h;
-  mParent[r] = q;
-  mChildCount[q]++;
+  t = Cd->mNext[h];
+  Cd->mNext[h] = r;
+  Cd->mNext[r] = t;
+  Cd->mPrev[t] = r;
+  Cd->mPrev[r] = h;
+  Cd->mParent[r] = q;
+  Cd->mChildCount[q]++;
 }
 
 STATIC 
 VOID 
 Split (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   NODE Old
   )
 /*++
@@ -615,25 +1026,27 @@ Returns: (VOID)
 {
   NODE New, t;
 
-  New = mAvail;
-  mAvail = mNext[New];
-  mChildCount[New] = 0;
-  t = mPrev[Old];
-  mPrev[New] = t;
-  mNext[t] = New;
-  t = mNext[Old];
-  mNext[New] = t;
-  mPrev[t] = New;
-  mParent[New] = mParent[Old];
-  mLevel[New] = (UINT8)mMatchLen;
-  mPosition[New] = mPos;
-  MakeChild(New, mText[mMatchPos + mMatchLen], Old);
-  MakeChild(New, mText[mPos + mMatchLen], mPos);
+  New = Cd->mAvail;
+  Cd->mAvail = Cd->mNext[New];
+  Cd->mChildCount[New] = 0;
+  t = Cd->mPrev[Old];
+  Cd->mPrev[New] = t;
+  Cd->mNext[t] = New;
+  t = Cd->mNext[Old];
+  Cd->mNext[New] = t;
+  Cd->mPrev[t] = New;
+  Cd->mParent[New] = Cd->mParent[Old];
+  Cd->mLevel[New] = (UINT8)Cd->mMatchLen;
+  Cd->mPosition[New] = Cd->mPos;
+  MakeChild (Cd, New, Cd->mText[Cd->mMatchPos + Cd->mMatchLen], Old);
+  MakeChild (Cd, New, Cd->mText[Cd->mPos + Cd->mMatchLen], Cd->mPos);
 }
 
 STATIC 
 VOID 
-InsertNode ()
+InsertNode (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 /*++
 
 Routine Description:
@@ -649,31 +1062,31 @@ Returns: (VOID)
   NODE q, r, j, t;
   UINT8 c, *t1, *t2;
 
-  if (mMatchLen >= 4) {
+  if (Cd->mMatchLen >= 4) {
     
     //
     // We have just got a long match, the target tree
     // can be located by MatchPos + 1. Travese the tree
     // from bottom up to get to a proper starting point.
     // The usage of PERC_FLAG ensures proper node deletion
-    // in DeleteNode() later.
+    // in DeleteNode (Cd) later.
     //
     
-    mMatchLen--;
-    r = (INT16)((mMatchPos + 1) | WNDSIZ);
-    while ((q = mParent[r]) == NIL) {
-      r = mNext[r];
+    Cd->mMatchLen--;
+    r = (INT16)((Cd->mMatchPos + 1) | WNDSIZ);
+    while ((q = Cd->mParent[r]) == NIL) {
+      r = Cd->mNext[r];
     }
-    while (mLevel[q] >= mMatchLen) {
-      r = q;  q = mParent[q];
+    while (Cd->mLevel[q] >= Cd->mMatchLen) {
+      r = q;  q = Cd->mParent[q];
     }
     t = q;
-    while (mPosition[t] < 0) {
-      mPosition[t] = mPos;
-      t = mParent[t];
+    while (Cd->mPosition[t] < 0) {
+      Cd->mPosition[t] = Cd->mPos;
+      t = Cd->mParent[t];
     }
     if (t < WNDSIZ) {
-      mPosition[t] = (NODE)(mPos | PERC_FLAG);
+      Cd->mPosition[t] = (NODE)(Cd->mPos | PERC_FLAG);
     }    
   } else {
     
@@ -681,14 +1094,14 @@ Returns: (VOID)
     // Locate the target tree
     //
     
-    q = (INT16)(mText[mPos] + WNDSIZ);
-    c = mText[mPos + 1];
-    if ((r = Child(q, c)) == NIL) {
-      MakeChild(q, c, mPos);
-      mMatchLen = 1;
+    q = (INT16)(Cd->mText[Cd->mPos] + WNDSIZ);
+    c = Cd->mText[Cd->mPos + 1];
+    if ((r = Child (Cd, q, c)) == NIL) {
+      MakeChild (Cd, q, c, Cd->mPos);
+      Cd->mMatchLen = 1;
       return;
     }
-    mMatchLen = 2;
+    Cd->mMatchLen = 2;
   }
   
   //
@@ -700,55 +1113,57 @@ Returns: (VOID)
   for ( ; ; ) {
     if (r >= WNDSIZ) {
       j = MAXMATCH;
-      mMatchPos = r;
+      Cd->mMatchPos = r;
     } else {
-      j = mLevel[r];
-      mMatchPos = (NODE)(mPosition[r] & ~PERC_FLAG);
+      j = Cd->mLevel[r];
+      Cd->mMatchPos = (NODE)(Cd->mPosition[r] & ~PERC_FLAG);
     }
-    if (mMatchPos >= mPos) {
-      mMatchPos -= WNDSIZ;
+    if (Cd->mMatchPos >= Cd->mPos) {
+      Cd->mMatchPos -= WNDSIZ;
     }    
-    t1 = &mText[mPos + mMatchLen];
-    t2 = &mText[mMatchPos + mMatchLen];
-    while (mMatchLen < j) {
+    t1 = &Cd->mText[Cd->mPos + Cd->mMatchLen];
+    t2 = &Cd->mText[Cd->mMatchPos + Cd->mMatchLen];
+    while (Cd->mMatchLen < j) {
       if (*t1 != *t2) {
-        Split(r);
+        Split (Cd, r);
         return;
       }
-      mMatchLen++;
+      Cd->mMatchLen++;
       t1++;
       t2++;
     }
-    if (mMatchLen >= MAXMATCH) {
+    if (Cd->mMatchLen >= MAXMATCH) {
       break;
     }
-    mPosition[r] = mPos;
+    Cd->mPosition[r] = Cd->mPos;
     q = r;
-    if ((r = Child(q, *t1)) == NIL) {
-      MakeChild(q, *t1, mPos);
+    if ((r = Child (Cd, q, *t1)) == NIL) {
+      MakeChild (Cd, q, *t1, Cd->mPos);
       return;
     }
-    mMatchLen++;
+    Cd->mMatchLen++;
   }
-  t = mPrev[r];
-  mPrev[mPos] = t;
-  mNext[t] = mPos;
-  t = mNext[r];
-  mNext[mPos] = t;
-  mPrev[t] = mPos;
-  mParent[mPos] = q;
-  mParent[r] = NIL;
+  t = Cd->mPrev[r];
+  Cd->mPrev[Cd->mPos] = t;
+  Cd->mNext[t] = Cd->mPos;
+  t = Cd->mNext[r];
+  Cd->mNext[Cd->mPos] = t;
+  Cd->mPrev[t] = Cd->mPos;
+  Cd->mParent[Cd->mPos] = q;
+  Cd->mParent[r] = NIL;
   
   //
   // Special usage of 'next'
   //
-  mNext[r] = mPos;
+  Cd->mNext[r] = Cd->mPos;
   
 }
 
 STATIC 
 VOID 
-DeleteNode ()
+DeleteNode (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 /*++
 
 Routine Description:
@@ -764,65 +1179,99 @@ Returns: (VOID)
 {
   NODE q, r, s, t, u;
 
-  if (mParent[mPos] == NIL) {
+  if (Cd->mParent[Cd->mPos] == NIL) {
     return;
   }
   
-  r = mPrev[mPos];
-  s = mNext[mPos];
-  mNext[r] = s;
-  mPrev[s] = r;
-  r = mParent[mPos];
-  mParent[mPos] = NIL;
-  if (r >= WNDSIZ || --mChildCount[r] > 1) {
+  r = Cd->mPrev[Cd->mPos];
+  s = Cd->mNext[Cd->mPos];
+  Cd->mNext[r] = s;
+  Cd->mPrev[s] = r;
+  r = Cd->mParent[Cd->mPos];
+  Cd->mParent[Cd->mPos] = NIL;
+  if (r >= WNDSIZ || --Cd->mChildCount[r] > 1) {
     return;
   }
-  t = (NODE)(mPosition[r] & ~PERC_FLAG);
-  if (t >= mPos) {
+  t = (NODE)(Cd->mPosition[r] & ~PERC_FLAG);
+  if (t >= Cd->mPos) {
     t -= WNDSIZ;
   }
   s = t;
-  q = mParent[r];
-  while ((u = mPosition[q]) & PERC_FLAG) {
+  q = Cd->mParent[r];
+  while ((u = Cd->mPosition[q]) & PERC_FLAG) {
     u &= ~PERC_FLAG;
-    if (u >= mPos) {
+    if (u >= Cd->mPos) {
       u -= WNDSIZ;
     }
     if (u > s) {
       s = u;
     }
-    mPosition[q] = (INT16)(s | WNDSIZ);
-    q = mParent[q];
+    Cd->mPosition[q] = (INT16)(s | WNDSIZ);
+    q = Cd->mParent[q];
   }
   if (q < WNDSIZ) {
-    if (u >= mPos) {
+    if (u >= Cd->mPos) {
       u -= WNDSIZ;
     }
     if (u > s) {
       s = u;
     }
-    mPosition[q] = (INT16)(s | WNDSIZ | PERC_FLAG);
-  }
-  s = Child(r, mText[t + mLevel[r]]);
-  t = mPrev[s];
-  u = mNext[s];
-  mNext[t] = u;
-  mPrev[u] = t;
-  t = mPrev[r];
-  mNext[t] = s;
-  mPrev[s] = t;
-  t = mNext[r];
-  mPrev[t] = s;
-  mNext[s] = t;
-  mParent[s] = mParent[r];
-  mParent[r] = NIL;
-  mNext[r] = mAvail;
-  mAvail = r;
+    Cd->mPosition[q] = (INT16)(s | WNDSIZ | PERC_FLAG);
+  }
+  s = Child (Cd, r, Cd->mText[t + Cd->mLevel[r]]);
+  t = Cd->mPrev[s];
+  u = Cd->mNext[s];
+  Cd->mNext[t] = u;
+  Cd->mPrev[u] = t;
+  t = Cd->mPrev[r];
+  Cd->mNext[t] = s;
+  Cd->mPrev[s] = t;
+  t = Cd->mNext[r];
+  Cd->mPrev[t] = s;
+  Cd->mNext[s] = t;
+  Cd->mParent[s] = Cd->mParent[r];
+  Cd->mParent[r] = NIL;
+  Cd->mNext[r] = Cd->mAvail;
+  Cd->mAvail = r;
 }
 
-STATIC 
-VOID 
-GetNextMatch ()
+STATIC
+VOID
+AdvancePosition (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
+/*++
+
+Routine Description:
+
+  Advance the current position, sliding the window and reading in new
+  data when the end of the text buffer is reached.
+
+Arguments: (VOID)
+
+Returns: (VOID)
+
+--*/
+{
+  INT32 n;
+
+  Cd->mRemainder--;
+  if (++Cd->mPos == WNDSIZ * 2) {
+    memmove(&Cd->mText[0], &Cd->mText[WNDSIZ], WNDSIZ + MAXMATCH);
+    n = FreadCrc (Cd, &Cd->mText[WNDSIZ + MAXMATCH], WNDSIZ);
+    Cd->mRemainder += n;
+    Cd->mPos = WNDSIZ;
+    if (Cd->mCompressLevel != CompressLevelDefault) {
+      HcSlide (Cd);
+    }
+  }
+}
+
+STATIC
+VOID
+GetNextMatch (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 /*++
 
 Routine Description:
@@ -836,22 +1285,175 @@ Returns: (VOID)
 
 --*/
 {
-  INT32 n;
+  AdvancePosition (Cd);
+  if (Cd->mCompressLevel == CompressLevelDefault) {
+    DeleteNode (Cd);
+    InsertNode (Cd);
+  } else {
+    HcInsertNode (Cd, TRUE);
+  }
+}
+
+STATIC
+VOID
+SkipMatch (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
+/*++
+
+Routine Description:
+
+  Advance over a position covered by the pointer just output. The tree
+  has to search to stay consistent, the hash chains only record it.
+
+Arguments: (VOID)
 
-  mRemainder--;
-  if (++mPos == WNDSIZ * 2) {
-    memmove(&mText[0], &mText[WNDSIZ], WNDSIZ + MAXMATCH);
-    n = FreadCrc(&mText[WNDSIZ + MAXMATCH], WNDSIZ);
-    mRemainder += n;
-    mPos = WNDSIZ;
+Returns: (VOID)
+
+--*/
+{
+  if (Cd->mCompressLevel == CompressLevelDefault) {
+    GetNextMatch (Cd);
+  } else {
+    AdvancePosition (Cd);
+    HcInsertNode (Cd, FALSE);
+  }
+}
+
+STATIC
+INT32
+HcFindMatch (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
+  IN  NODE  Pos,
+  OUT NODE  *MatchPos
+  )
+/*++
+
+Routine Description:
+
+  Walk the hash chain of Pos looking for the longest earlier string in
+  the window. Among equally long strings the closest one wins.
+
+Arguments:
+
+  Pos         - The position to find a match for
+  MatchPos    - Receives the position of the match
+
+Returns:
+
+  The match length, or 0 if no match of at least THRESHOLD bytes exists.
+
+--*/
+{
+  NODE    Candidate;
+  INT32   Limit;
+  INT32   BestLen;
+  INT32   Len;
+  UINT32  Depth;
+  UINT8   *Scan;
+  UINT8   *Match;
+
+  //
+  // Positions at or before Limit are outside the window. NIL is always
+  // among them, which terminates the chain.
+  //
+  Limit     = (INT32) Pos - (INT32) WNDSIZ;
+  BestLen   = THRESHOLD - 1;
+  Scan      = &Cd->mText[Pos];
+  Depth     = Cd->mHcDepth;
+  Candidate = Cd->mHcHead[HC_HASH (Cd->mText, Pos)];
+
+  while (Candidate > Limit && Depth-- > 0) {
+    Match = &Cd->mText[Candidate];
+    if (Match[BestLen] == Scan[BestLen] && Match[0] == Scan[0] && Match[1] == Scan[1]) {
+      Len = 2;
+      while (Len < MAXMATCH && Match[Len] == Scan[Len]) {
+        Len++;
+      }
+
+      if (Len > BestLen) {
+        BestLen   = Len;
+        *MatchPos = Candidate;
+        if (Len >= Cd->mHcNiceLen) {
+          break;
+        }
+      }
+    }
+
+    Candidate = Cd->mHcPrev[Candidate & (WNDSIZ - 1)];
+  }
+
+  return BestLen >= THRESHOLD ? BestLen : 0;
+}
+
+STATIC
+VOID
+HcInsertNode (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
+  IN BOOLEAN Search
+  )
+/*++
+
+Routine Description:
+
+  Hash chain counterpart of InsertNode(): optionally find a match for the
+  current position, then link the position into its chain.
+
+Arguments:
+
+  Search      - FALSE to only record the position
+
+Returns: (VOID)
+
+--*/
+{
+  UINT32  Hash;
+
+  if (Search) {
+    Cd->mMatchLen = HcFindMatch (Cd, Cd->mPos, &Cd->mMatchPos);
+  }
+
+  Hash                                  = HC_HASH (Cd->mText, Cd->mPos);
+  Cd->mHcPrev[Cd->mPos & (WNDSIZ - 1)]  = Cd->mHcHead[Hash];
+  Cd->mHcHead[Hash]                     = Cd->mPos;
+}
+
+STATIC
+VOID
+HcSlide (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
+/*++
+
+Routine Description:
+
+  Rebase the hash chains after the text buffer moved down by WNDSIZ.
+
+Arguments: (VOID)
+
+Returns: (VOID)
+
+--*/
+{
+  UINT32  Index;
+  NODE    Node;
+
+  for (Index = 0; Index < HC_HASH_SIZE; Index++) {
+    Node                = Cd->mHcHead[Index];
+    Cd->mHcHead[Index]  = (NODE) (Node >= (NODE) WNDSIZ ? Node - WNDSIZ : NIL);
+  }
+
+  for (Index = 0; Index < WNDSIZ; Index++) {
+    Node                = Cd->mHcPrev[Index];
+    Cd->mHcPrev[Index]  = (NODE) (Node >= (NODE) WNDSIZ ? Node - WNDSIZ : NIL);
   }
-  DeleteNode();
-  InsertNode();
 }
 
 STATIC
 EFI_STATUS
-Encode ()
+Encode (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 /*++
 
 Routine Description:
@@ -863,73 +1465,71 @@ Arguments: (VOID)
 Returns:
   
   EFI_SUCCESS           - The compression is successful
-  EFI_OUT_0F_RESOURCES  - Not enough memory for compression process
 
 --*/
 {
-  EFI_STATUS  Status;
   INT32       LastMatchLen;
   NODE        LastMatchPos;
 
-  Status = AllocateMemory();
-  if (EFI_ERROR(Status)) {
-    FreeMemory();
-    return Status;
-  }
-
-  InitSlide();
+  InitSlide (Cd);
   
-  HufEncodeStart();
+  HufEncodeStart (Cd);
 
-  mRemainder = FreadCrc(&mText[WNDSIZ], WNDSIZ + MAXMATCH);
+  Cd->mRemainder = FreadCrc (Cd, &Cd->mText[WNDSIZ], WNDSIZ + MAXMATCH);
   
-  mMatchLen = 0;
-  mPos = WNDSIZ;
-  InsertNode();
-  if (mMatchLen > mRemainder) {
-    mMatchLen = mRemainder;
+  Cd->mMatchLen = 0;
+  Cd->mPos = WNDSIZ;
+  if (Cd->mCompressLevel == CompressLevelDefault) {
+    InsertNode (Cd);
+  } else {
+    HcInsertNode (Cd, TRUE);
+  }
+  if (Cd->mMatchLen > Cd->mRemainder) {
+    Cd->mMatchLen = Cd->mRemainder;
   }
-  while (mRemainder > 0) {
-    LastMatchLen = mMatchLen;
-    LastMatchPos = mMatchPos;
-    GetNextMatch();
-    if (mMatchLen > mRemainder) {
-      mMatchLen = mRemainder;
+  while (Cd->mRemainder > 0) {
+    LastMatchLen = Cd->mMatchLen;
+    LastMatchPos = Cd->mMatchPos;
+    GetNextMatch (Cd);
+    if (Cd->mMatchLen > Cd->mRemainder) {
+      Cd->mMatchLen = Cd->mRemainder;
     }
     
-    if (mMatchLen > LastMatchLen || LastMatchLen < THRESHOLD) {
+    if (Cd->mMatchLen > LastMatchLen || LastMatchLen < THRESHOLD) {
       
       //
       // Not enough benefits are gained by outputting a pointer,
       // so just output the original character
       //
       
-      Output(mText[mPos - 1], 0);
+      Output (Cd, Cd->mText[Cd->mPos - 1], 0);
     } else {
       
       //
       // Outputting a pointer is beneficial enough, do it.
       //
       
-      Output(LastMatchLen + (UINT8_MAX + 1 - THRESHOLD),
-             (mPos - LastMatchPos - 2) & (WNDSIZ - 1));
-      while (--LastMatchLen > 0) {
-        GetNextMatch();
+      Output (Cd, LastMatchLen + (UINT8_MAX + 1 - THRESHOLD),
+             (Cd->mPos - LastMatchPos - 2) & (WNDSIZ - 1));
+      while (--LastMatchLen > 1) {
+        SkipMatch (Cd);
       }
-      if (mMatchLen > mRemainder) {
-        mMatchLen = mRemainder;
+      GetNextMatch (Cd);
+      if (Cd->mMatchLen > Cd->mRemainder) {
+        Cd->mMatchLen = Cd->mRemainder;
       }
     }
   }
   
-  HufEncodeEnd();
-  FreeMemory();
+  HufEncodeEnd (Cd);
   return EFI_SUCCESS;
 }
 
 STATIC 
 VOID 
-CountTFreq ()
+CountTFreq (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 /*++
 
 Routine Description:
@@ -945,33 +1545,33 @@ Returns: (VOID)
   INT32 i, k, n, Count;
 
   for (i = 0; i < NT; i++) {
-    mTFreq[i] = 0;
+    Cd->mTFreq[i] = 0;
   }
   n = NC;
-  while (n > 0 && mCLen[n - 1] == 0) {
+  while (n > 0 && Cd->mCLen[n - 1] == 0) {
     n--;
   }
   i = 0;
   while (i < n) {
-    k = mCLen[i++];
+    k = Cd->mCLen[i++];
     if (k == 0) {
       Count = 1;
-      while (i < n && mCLen[i] == 0) {
+      while (i < n && Cd->mCLen[i] == 0) {
         i++;
         Count++;
       }
       if (Count <= 2) {
-        mTFreq[0] = (UINT16)(mTFreq[0] + Count);
+        Cd->mTFreq[0] = (UINT16)(Cd->mTFreq[0] + Count);
       } else if (Count <= 18) {
-        mTFreq[1]++;
+        Cd->mTFreq[1]++;
       } else if (Count == 19) {
-        mTFreq[0]++;
-        mTFreq[1]++;
+        Cd->mTFreq[0]++;
+        Cd->mTFreq[1]++;
       } else {
-        mTFreq[2]++;
+        Cd->mTFreq[2]++;
       }
     } else {
-      mTFreq[k + 2]++;
+      Cd->mTFreq[k + 2]++;
     }
   }
 }
@@ -979,6 +1579,7 @@ Returns: (VOID)
 STATIC 
 VOID 
 WritePTLen (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN INT32 n, 
   IN INT32 nbit, 
   IN INT32 Special
@@ -1001,30 +1602,32 @@ Returns: (VOID)
 {
   INT32 i, k;
 
-  while (n > 0 && mPTLen[n - 1] == 0) {
+  while (n > 0 && Cd->mPTLen[n - 1] == 0) {
     n--;
   }
-  PutBits(nbit, n);
+  PutBits (Cd, nbit, n);
   i = 0;
   while (i < n) {
-    k = mPTLen[i++];
+    k = Cd->mPTLen[i++];
     if (k <= 6) {
-      PutBits(3, k);
+      PutBits (Cd, 3, k);
     } else {
-      PutBits(k - 3, (1U << (k - 3)) - 2);
+      PutBits (Cd, k - 3, (1U << (k - 3)) - 2);
     }
     if (i == Special) {
-      while (i < 6 && mPTLen[i] == 0) {
+      while (i < 6 && Cd->mPTLen[i] == 0) {
         i++;
       }
-      PutBits(2, (i - 3) & 3);
+      PutBits (Cd, 2, (i - 3) & 3);
     }
   }
 }
 
 STATIC 
 VOID 
-WriteCLen ()
+WriteCLen (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 /*++
 
 Routine Description:
@@ -1040,36 +1643,36 @@ Returns: (VOID)
   INT32 i, k, n, Count;
 
   n = NC;
-  while (n > 0 && mCLen[n - 1] == 0) {
+  while (n > 0 && Cd->mCLen[n - 1] == 0) {
     n--;
   }
-  PutBits(CBIT, n);
+  PutBits (Cd, CBIT, n);
   i = 0;
   while (i < n) {
-    k = mCLen[i++];
+    k = Cd->mCLen[i++];
     if (k == 0) {
       Count = 1;
-      while (i < n && mCLen[i] == 0) {
+      while (i < n && Cd->mCLen[i] == 0) {
         i++;
         Count++;
       }
       if (Count <= 2) {
         for (k = 0; k < Count; k++) {
-          PutBits(mPTLen[0], mPTCode[0]);
+          PutBits (Cd, Cd->mPTLen[0], Cd->mPTCode[0]);
         }
       } else if (Count <= 18) {
-        PutBits(mPTLen[1], mPTCode[1]);
-        PutBits(4, Count - 3);
+        PutBits (Cd, Cd->mPTLen[1], Cd->mPTCode[1]);
+        PutBits (Cd, 4, Count - 3);
       } else if (Count == 19) {
-        PutBits(mPTLen[0], mPTCode[0]);
-        PutBits(mPTLen[1], mPTCode[1]);
-        PutBits(4, 15);
+        PutBits (Cd, Cd->mPTLen[0], Cd->mPTCode[0]);
+        PutBits (Cd, Cd->mPTLen[1], Cd->mPTCode[1]);
+        PutBits (Cd, 4, 15);
       } else {
-        PutBits(mPTLen[2], mPTCode[2]);
-        PutBits(CBIT, Count - 20);
+        PutBits (Cd, Cd->mPTLen[2], Cd->mPTCode[2]);
+        PutBits (Cd, CBIT, Count - 20);
       }
     } else {
-      PutBits(mPTLen[k + 2], mPTCode[k + 2]);
+      PutBits (Cd, Cd->mPTLen[k + 2], Cd->mPTCode[k + 2]);
     }
   }
 }
@@ -1077,15 +1680,17 @@ Returns: (VOID)
 STATIC 
 VOID 
 EncodeC (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN INT32 c
   )
 {
-  PutBits(mCLen[c], mCCode[c]);
+  PutBits (Cd, Cd->mCLen[c], Cd->mCCode[c]);
 }
 
 STATIC 
 VOID 
 EncodeP (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN UINT32 p
   )
 {
@@ -1097,15 +1702,17 @@ EncodeP (
     q >>= 1;
     c++;
   }
-  PutBits(mPTLen[c], mPTCode[c]);
+  PutBits (Cd, Cd->mPTLen[c], Cd->mPTCode[c]);
   if (c > 1) {
-    PutBits(c - 1, p & (0xFFFFU >> (17 - c)));
+    PutBits (Cd, c - 1, p & (0xFFFFU >> (17 - c)));
   }
 }
 
 STATIC 
 VOID 
-SendBlock ()
+SendBlock (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 /*++
 
 Routine Description:
@@ -1121,53 +1728,53 @@ Returns: (VOID)
   UINT32 i, k, Flags, Root, Pos, Size;
   Flags = 0;
 
-  Root = MakeTree(NC, mCFreq, mCLen, mCCode);
-  Size = mCFreq[Root];
-  PutBits(16, Size);
+  Root = MakeTree (Cd, NC, Cd->mCFreq, Cd->mCLen, Cd->mCCode);
+  Size = Cd->mCFreq[Root];
+  PutBits (Cd, 16, Size);
   if (Root >= NC) {
-    CountTFreq();
-    Root = MakeTree(NT, mTFreq, mPTLen, mPTCode);
+    CountTFreq (Cd);
+    Root = MakeTree (Cd, NT, Cd->mTFreq, Cd->mPTLen, Cd->mPTCode);
     if (Root >= NT) {
-      WritePTLen(NT, TBIT, 3);
+      WritePTLen (Cd, NT, TBIT, 3);
     } else {
-      PutBits(TBIT, 0);
-      PutBits(TBIT, Root);
+      PutBits (Cd, TBIT, 0);
+      PutBits (Cd, TBIT, Root);
     }
-    WriteCLen();
+    WriteCLen (Cd);
   } else {
-    PutBits(TBIT, 0);
-    PutBits(TBIT, 0);
-    PutBits(CBIT, 0);
-    PutBits(CBIT, Root);
+    PutBits (Cd, TBIT, 0);
+    PutBits (Cd, TBIT, 0);
+    PutBits (Cd, CBIT, 0);
+    PutBits (Cd, CBIT, Root);
   }
-  Root = MakeTree(NP, mPFreq, mPTLen, mPTCode);
+  Root = MakeTree (Cd, NP, Cd->mPFreq, Cd->mPTLen, Cd->mPTCode);
   if (Root >= NP) {
-    WritePTLen(NP, PBIT, -1);
+    WritePTLen (Cd, NP, PBIT, -1);
   } else {
-    PutBits(PBIT, 0);
-    PutBits(PBIT, Root);
+    PutBits (Cd, PBIT, 0);
+    PutBits (Cd, PBIT, Root);
   }
   Pos = 0;
   for (i = 0; i < Size; i++) {
     if (i % UINT8_BIT == 0) {
-      Flags = mBuf[Pos++];
+      Flags = Cd->mBuf[Pos++];
     } else {
       Flags <<= 1;
     }
     if (Flags & (1U << (UINT8_BIT - 1))) {
-      EncodeC(mBuf[Pos++] + (1U << UINT8_BIT));
-      k = mBuf[Pos++] << UINT8_BIT;
-      k += mBuf[Pos++];
-      EncodeP(k);
+      EncodeC (Cd, Cd->mBuf[Pos++] + (1U << UINT8_BIT));
+      k = Cd->mBuf[Pos++] << UINT8_BIT;
+      k += Cd->mBuf[Pos++];
+      EncodeP (Cd, k);
     } else {
-      EncodeC(mBuf[Pos++]);
+      EncodeC (Cd, Cd->mBuf[Pos++]);
     }
   }
   for (i = 0; i < NC; i++) {
-    mCFreq[i] = 0;
+    Cd->mCFreq[i] = 0;
   }
   for (i = 0; i < NP; i++) {
-    mPFreq[i] = 0;
+    Cd->mPFreq[i] = 0;
   }
 }
 
@@ -1175,6 +1782,7 @@ Returns: (VOID)
 STATIC 
 VOID 
 Output (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN UINT32 c, 
   IN UINT32 p
   )
@@ -1193,59 +1801,61 @@ Returns: (VOID)
 
 --*/
 {
-  STATIC UINT32 CPos;
-
-  if ((mOutputMask >>= 1) == 0) {
-    mOutputMask = 1U << (UINT8_BIT - 1);
-    if (mOutputPos >= mBufSiz - 3 * UINT8_BIT) {
-      SendBlock();
-      mOutputPos = 0;
+  if ((Cd->mOutputMask >>= 1) == 0) {
+    Cd->mOutputMask = 1U << (UINT8_BIT - 1);
+    if (Cd->mOutputPos >= Cd->mBufSiz - 3 * UINT8_BIT) {
+      SendBlock (Cd);
+      Cd->mOutputPos = 0;
     }
-    CPos = mOutputPos++;  
-    mBuf[CPos] = 0;
+    Cd->mCPos = Cd->mOutputPos++;  
+    Cd->mBuf[Cd->mCPos] = 0;
   }
-  mBuf[mOutputPos++] = (UINT8) c;
-  mCFreq[c]++;
+  Cd->mBuf[Cd->mOutputPos++] = (UINT8) c;
+  Cd->mCFreq[c]++;
   if (c >= (1U << UINT8_BIT)) {
-    mBuf[CPos] |= mOutputMask;
-    mBuf[mOutputPos++] = (UINT8)(p >> UINT8_BIT);
-    mBuf[mOutputPos++] = (UINT8) p;
+    Cd->mBuf[Cd->mCPos] |= Cd->mOutputMask;
+    Cd->mBuf[Cd->mOutputPos++] = (UINT8)(p >> UINT8_BIT);
+    Cd->mBuf[Cd->mOutputPos++] = (UINT8) p;
     c = 0;
     while (p) {
       p >>= 1;
       c++;
     }
-    mPFreq[c]++;
+    Cd->mPFreq[c]++;
   }
 }
 
 STATIC
 VOID
-HufEncodeStart ()
+HufEncodeStart (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 {
   INT32 i;
 
   for (i = 0; i < NC; i++) {
-    mCFreq[i] = 0;
+    Cd->mCFreq[i] = 0;
   }
   for (i = 0; i < NP; i++) {
-    mPFreq[i] = 0;
+    Cd->mPFreq[i] = 0;
   }
-  mOutputPos = mOutputMask = 0;
-  InitPutBits();
+  Cd->mOutputPos = Cd->mOutputMask = 0;
+  InitPutBits (Cd);
   return;
 }
 
 STATIC 
 VOID 
-HufEncodeEnd ()
+HufEncodeEnd (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 {
-  SendBlock();
+  SendBlock (Cd);
   
   //
   // Flush remaining bits
   //
-  PutBits(UINT8_BIT - 1, 0);
+  PutBits (Cd, UINT8_BIT - 1, 0);
   
   return;
 }
@@ -1253,7 +1863,9 @@ HufEncodeEnd ()
 
 STATIC 
 VOID 
-MakeCrcTable ()
+MakeCrcTable (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 {
   UINT32 i, j, r;
 
@@ -1266,13 +1878,14 @@ MakeCrcTable ()
         r >>= 1;
       }
     }
-    mCrcTable[i] = (UINT16)r;    
+    Cd->mCrcTable[i] = (UINT16)r;    
   }
 }
 
 STATIC 
 VOID 
 PutBits (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN INT32 n, 
   IN UINT32 x
   )
@@ -1293,27 +1906,27 @@ Returns: (VOID)
 {
   UINT8 Temp;  
   
-  if (n < mBitCount) {
-    mSubBitBuf |= x << (mBitCount -= n);
+  if (n < Cd->mBitCount) {
+    Cd->mSubBitBuf |= x << (Cd->mBitCount -= n);
   } else {
       
-    Temp = (UINT8)(mSubBitBuf | (x >> (n -= mBitCount)));
-    if (mDst < mDstUpperLimit) {
-      *mDst++ = Temp;
+    Temp = (UINT8)(Cd->mSubBitBuf | (x >> (n -= Cd->mBitCount)));
+    if (Cd->mDst < Cd->mDstUpperLimit) {
+      *Cd->mDst++ = Temp;
     }
-    mCompSize++;
+    Cd->mCompSize++;
 
     if (n < UINT8_BIT) {
-      mSubBitBuf = x << (mBitCount = UINT8_BIT - n);
+      Cd->mSubBitBuf = x << (Cd->mBitCount = UINT8_BIT - n);
     } else {
         
       Temp = (UINT8)(x >> (n - UINT8_BIT));
-      if (mDst < mDstUpperLimit) {
-        *mDst++ = Temp;
+      if (Cd->mDst < Cd->mDstUpperLimit) {
+        *Cd->mDst++ = Temp;
       }
-      mCompSize++;
+      Cd->mCompSize++;
       
-      mSubBitBuf = x << (mBitCount = 2 * UINT8_BIT - n);
+      Cd->mSubBitBuf = x << (Cd->mBitCount = 2 * UINT8_BIT - n);
     }
   }
 }
@@ -1321,6 +1934,7 @@ Returns: (VOID)
 STATIC 
 INT32 
 FreadCrc (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   OUT UINT8 *p, 
   IN  INT32 n
   )
@@ -1343,15 +1957,15 @@ Returns:
 {
   INT32 i;
 
-  for (i = 0; mSrc < mSrcUpperLimit && i < n; i++) {
-    *p++ = *mSrc++;
+  for (i = 0; Cd->mSrc < Cd->mSrcUpperLimit && i < n; i++) {
+    *p++ = *Cd->mSrc++;
   }
   n = i;
 
   p -= n;
-  mOrigSize += n;
+  Cd->mOrigSize += n;
   while (--i >= 0) {
-    UPDATE_CRC(*p++);
+    UPDATE_CRC (Cd, *p++);
   }
   return n;
 }
@@ -1359,15 +1973,18 @@ Returns:
 
 STATIC 
 VOID 
-InitPutBits ()
+InitPutBits (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd
+  )
 {
-  mBitCount = UINT8_BIT;  
-  mSubBitBuf = 0;
+  Cd->mBitCount = UINT8_BIT;  
+  Cd->mSubBitBuf = 0;
 }
 
 STATIC 
 VOID 
 CountLen (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN INT32 i
   )
 /*++
@@ -1384,21 +2001,20 @@ Returns: (VOID)
 
 --*/
 {
-  STATIC INT32 Depth = 0;
-
-  if (i < mN) {
-    mLenCnt[(Depth < 16) ? Depth : 16]++;
+  if (i < Cd->mN) {
+    Cd->mLenCnt[(Cd->mDepth < 16) ? Cd->mDepth : 16]++;
   } else {
-    Depth++;
-    CountLen(mLeft [i]);
-    CountLen(mRight[i]);
-    Depth--;
+    Cd->mDepth++;
+    CountLen (Cd, Cd->mLeft [i]);
+    CountLen (Cd, Cd->mRight[i]);
+    Cd->mDepth--;
   }
 }
 
 STATIC 
 VOID 
 MakeLen (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN INT32 Root
   )
 /*++
@@ -1417,9 +2033,9 @@ Arguments:
   UINT32 Cum;
 
   for (i = 0; i <= 16; i++) {
-    mLenCnt[i] = 0;
+    Cd->mLenCnt[i] = 0;
   }
-  CountLen(Root);
+  CountLen (Cd, Root);
   
   //
   // Adjust the length count array so that
@@ -1428,23 +2044,23 @@ Arguments:
   
   Cum = 0;
   for (i = 16; i > 0; i--) {
-    Cum += mLenCnt[i] << (16 - i);
+    Cum += Cd->mLenCnt[i] << (16 - i);
   }
   while (Cum != (1U << 16)) {
-    mLenCnt[16]--;
+    Cd->mLenCnt[16]--;
     for (i = 15; i > 0; i--) {
-      if (mLenCnt[i] != 0) {
-        mLenCnt[i]--;
-        mLenCnt[i+1] += 2;
+      if (Cd->mLenCnt[i] != 0) {
+        Cd->mLenCnt[i]--;
+        Cd->mLenCnt[i+1] += 2;
         break;
       }
     }
     Cum--;
   }
   for (i = 16; i > 0; i--) {
-    k = mLenCnt[i];
+    k = Cd->mLenCnt[i];
     while (--k >= 0) {
-      mLen[*mSortPtr++] = (UINT8)i;
+      Cd->mLen[*Cd->mSortPtr++] = (UINT8)i;
     }
   }
 }
@@ -1452,6 +2068,7 @@ Arguments:
 STATIC 
 VOID 
 DownHeap (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN INT32 i
   )
 {
@@ -1461,23 +2078,24 @@ DownHeap (
   // priority queue: send i-th entry down heap
   //
   
-  k = mHeap[i];
-  while ((j = 2 * i) <= mHeapSize) {
-    if (j < mHeapSize && mFreq[mHeap[j]] > mFreq[mHeap[j + 1]]) {
+  k = Cd->mHeap[i];
+  while ((j = 2 * i) <= Cd->mHeapSize) {
+    if (j < Cd->mHeapSize && Cd->mFreq[Cd->mHeap[j]] > Cd->mFreq[Cd->mHeap[j + 1]]) {
       j++;
     }
-    if (mFreq[k] <= mFreq[mHeap[j]]) {
+    if (Cd->mFreq[k] <= Cd->mFreq[Cd->mHeap[j]]) {
       break;
     }
-    mHeap[i] = mHeap[j];
+    Cd->mHeap[i] = Cd->mHeap[j];
     i = j;
   }
-  mHeap[i] = (INT16)k;
+  Cd->mHeap[i] = (INT16)k;
 }
 
 STATIC 
 VOID 
 MakeCode (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN  INT32 n, 
   IN  UINT8 Len[], 
   OUT UINT16 Code[]
@@ -1503,7 +2121,7 @@ Returns: (VOID)
 
   Start[1] = 0;
   for (i = 1; i <= 16; i++) {
-    Start[i + 1] = (UINT16)((Start[i] + mLenCnt[i]) << 1);
+    Start[i + 1] = (UINT16)((Start[i] + Cd->mLenCnt[i]) << 1);
   }
   for (i = 0; i < n; i++) {
     Code[i] = Start[Len[i]]++;
@@ -1513,6 +2131,7 @@ Returns: (VOID)
 STATIC 
 INT32 
 MakeTree (
+  IN OUT EFI_COMPRESS_CONTEXT  *Cd,
   IN  INT32   NParm, 
   IN  UINT16  FreqParm[], 
   OUT UINT8   LenParm[], 
@@ -1543,52 +2162,52 @@ Returns:
   // make tree, calculate len[], return root
   //
 
-  mN = NParm;
-  mFreq = FreqParm;
-  mLen = LenParm;
-  Avail = mN;
-  mHeapSize = 0;
-  mHeap[1] = 0;
-  for (i = 0; i < mN; i++) {
-    mLen[i] = 0;
-    if (mFreq[i]) {
-      mHeap[++mHeapSize] = (INT16)i;
+  Cd->mN = NParm;
+  Cd->mFreq = FreqParm;
+  Cd->mLen = LenParm;
+  Avail = Cd->mN;
+  Cd->mHeapSize = 0;
+  Cd->mHeap[1] = 0;
+  for (i = 0; i < Cd->mN; i++) {
+    Cd->mLen[i] = 0;
+    if (Cd->mFreq[i]) {
+      Cd->mHeap[++Cd->mHeapSize] = (INT16)i;
     }    
   }
-  if (mHeapSize < 2) {
-    CodeParm[mHeap[1]] = 0;
-    return mHeap[1];
+  if (Cd->mHeapSize < 2) {
+    CodeParm[Cd->mHeap[1]] = 0;
+    return Cd->mHeap[1];
   }
-  for (i = mHeapSize / 2; i >= 1; i--) {
+  for (i = Cd->mHeapSize / 2; i >= 1; i--) {
     
     //
     // make priority queue 
     //
-    DownHeap(i);
+    DownHeap (Cd, i);
   }
-  mSortPtr = CodeParm;
+  Cd->mSortPtr = CodeParm;
   do {
-    i = mHeap[1];
-    if (i < mN) {
-      *mSortPtr++ = (UINT16)i;
+    i = Cd->mHeap[1];
+    if (i < Cd->mN) {
+      *Cd->mSortPtr++ = (UINT16)i;
     }
-    mHeap[1] = mHeap[mHeapSize--];
-    DownHeap(1);
-    j = mHeap[1];
-    if (j < mN) {
-      *mSortPtr++ = (UINT16)j;
+    Cd->mHeap[1] = Cd->mHeap[Cd->mHeapSize--];
+    DownHeap (Cd, 1);
+    j = Cd->mHeap[1];
+    if (j < Cd->mN) {
+      *Cd->mSortPtr++ = (UINT16)j;
     }
     k = Avail++;
-    mFreq[k] = (UINT16)(mFreq[i] + mFreq[j]);
-    mHeap[1] = (INT16)k;
-    DownHeap(1);
-    mLeft[k] = (UINT16)i;
-    mRight[k] = (UINT16)j;
-  } while (mHeapSize > 1);
-  
-  mSortPtr = CodeParm;
-  MakeLen(k);
-  MakeCode(NParm, LenParm, CodeParm);
+    Cd->mFreq[k] = (UINT16)(Cd->mFreq[i] + Cd->mFreq[j]);
+    Cd->mHeap[1] = (INT16)k;
+    DownHeap (Cd, 1);
+    Cd->mLeft[k] = (UINT16)i;
+    Cd->mRight[k] = (UINT16)j;
+  } while (Cd->mHeapSize > 1);
+  
+  Cd->mSortPtr = CodeParm;
+  MakeLen (Cd, k);
+  MakeCode (Cd, NParm, LenParm, CodeParm);
   
   //
   // return root
@@ -28,11 +28,18 @@ Abstract:
 
 #include "EfiUtilityMsgs.h"
 
+#ifdef _MSC_VER
+#define MSGS_THREAD_LOCAL  __declspec(thread)
+#else
+#define MSGS_THREAD_LOCAL  __thread
+#endif
+
 //
 // Declare module globals for keeping track of the the utility's
 // name and other settings.
 //
 STATIC STATUS mStatus                 = STATUS_SUCCESS;
+STATIC MSGS_THREAD_LOCAL STATUS mThreadStatus = STATUS_SUCCESS;
 STATIC CHAR8  mUtilityName[50]        = { 0 };
 STATIC UINT64 mPrintLogLevel          = INFO_LOG_LEVEL;
 STATIC CHAR8  *mSourceFileName        = NULL;
@@ -500,6 +507,9 @@ Notes:
       if (mStatus < STATUS_ERROR) {
         mStatus = STATUS_ERROR;
       }
+      if (mThreadStatus < STATUS_ERROR) {
+        mThreadStatus = STATUS_ERROR;
+      }
     }
   }
 
@@ -648,6 +658,49 @@ Returns:
   return mStatus;
 }
 
+STATUS
+GetThreadUtilityStatus (
+  VOID
+  )
+/*++
+
+Routine Description:
+  Like GetUtilityStatus(), but only for the messages printed by the calling
+  thread since it last called ResetThreadUtilityStatus(). A tool running
+  several jobs at the same time uses it to tell which of them failed.
+
+Arguments:
+  None.
+
+Returns:
+  Worst-case status reported by the calling thread.
+
+--*/
+{
+  return mThreadStatus;
+}
+
+VOID
+ResetThreadUtilityStatus (
+  VOID
+  )
+/*++
+
+Routine Description:
+  Forget the messages printed so far by the calling thread, before it starts
+  a new job. The status of the whole utility is not changed.
+
+Arguments:
+  None.
+
+Returns:
+  None.
+
+--*/
+{
+  mThreadStatus = STATUS_SUCCESS;
+}
+
 VOID
 SetPrintLevel (
   UINT64  LogLevel
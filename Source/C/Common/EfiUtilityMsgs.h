@@ -59,6 +59,21 @@ GetUtilityStatus (
   VOID
   );
 
+//
+// Tools that run several jobs at the same time, each job on one thread, get
+// the status of a job with GetThreadUtilityStatus(). It is the worst case
+// reported by the calling thread since it called ResetThreadUtilityStatus().
+//
+STATUS
+GetThreadUtilityStatus (
+  VOID
+  );
+
+VOID
+ResetThreadUtilityStatus (
+  VOID
+  );
+
 //
 // If someone prints an error message and didn't specify a source file name,
 // then we print the utility name instead. However they must tell us the
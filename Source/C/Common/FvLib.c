@@ -26,11 +26,18 @@ Abstract:
 #include "CommonLib.h"
 #include "EfiUtilityMsgs.h"
 
+#ifdef _MSC_VER
+#define FVLIB_THREAD_LOCAL  __declspec(thread)
+#else
+#define FVLIB_THREAD_LOCAL  __thread
+#endif
+
 //
-// Module global variables
+// Module global variables. The FV set by InitializeFvLib is per thread, so
+// threads that build different FVs at the same time don't see each other's.
 //
-EFI_FIRMWARE_VOLUME_HEADER  *mFvHeader  = NULL;
-UINT32                      mFvLength   = 0;
+STATIC FVLIB_THREAD_LOCAL EFI_FIRMWARE_VOLUME_HEADER  *mFvHeader  = NULL;
+STATIC FVLIB_THREAD_LOCAL UINT32                      mFvLength   = 0;
 
 //
 // External function implementations
@@ -45,7 +52,7 @@ InitializeFvLib (
 Routine Description:
 
   This initializes the FV lib with a pointer to the FV and length.  It does not
-  verify the FV in any way.
+  verify the FV in any way. The FV is only used by the calling thread.
 
 Arguments:
 
@@ -0,0 +1,318 @@
+/** @file
+
+Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+This program and the accompanying materials
+are licensed and made available under the terms and conditions of the BSD License
+which accompanies this distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+Module Name:
+
+  ParallelJobs.c
+
+Abstract:
+
+  Worker pool and lock on top of the thread layer of the LZMA SDK.
+
+**/
+
+#include <stdlib.h>
+
+#include "../LzmaCompress/Sdk/C/Threads.h"
+#include "ParallelJobs.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+typedef struct {
+  PARALLEL_JOB_FUNCTION   Function;
+  VOID                    *Context;
+  UINTN                   JobCount;
+  UINTN                   NextJob;
+  CCriticalSection        Lock;
+} PARALLEL_POOL;
+
+struct _PARALLEL_LOCK {
+  CCriticalSection        Section;
+};
+
+typedef struct {
+  PARALLEL_POOL           *Pool;
+  UINTN                   WorkerIndex;
+  CThread                 Thread;
+} PARALLEL_WORKER;
+
+UINTN
+GetProcessorCount (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Returns the number of processors available to the process.
+
+Arguments:
+
+  None
+
+Returns:
+
+  The processor count, at least 1.
+
+--*/
+{
+#ifdef _WIN32
+  SYSTEM_INFO   SystemInfo;
+
+  GetSystemInfo (&SystemInfo);
+  return SystemInfo.dwNumberOfProcessors > 0 ? SystemInfo.dwNumberOfProcessors : 1;
+#elif defined (_SC_NPROCESSORS_ONLN)
+  long          Count;
+
+  Count = sysconf (_SC_NPROCESSORS_ONLN);
+  return Count > 0 ? (UINTN) Count : 1;
+#else
+  return 1;
+#endif
+}
+
+STATIC
+VOID
+RunWorker (
+  IN PARALLEL_WORKER  *Worker
+  )
+/*++
+
+Routine Description:
+
+  Takes jobs from the pool until none is left.
+
+Arguments:
+
+  Worker         The worker.
+
+Returns:
+
+  None
+
+--*/
+{
+  PARALLEL_POOL   *Pool;
+  UINTN           JobIndex;
+
+  Pool = Worker->Pool;
+  for (;;) {
+    CriticalSection_Enter (&Pool->Lock);
+    JobIndex = Pool->NextJob;
+    if (JobIndex < Pool->JobCount) {
+      Pool->NextJob++;
+    }
+    CriticalSection_Leave (&Pool->Lock);
+
+    if (JobIndex >= Pool->JobCount) {
+      break;
+    }
+    Pool->Function (Pool->Context, JobIndex, Worker->WorkerIndex);
+  }
+}
+
+STATIC
+THREAD_FUNC_DECL
+WorkerThread (
+  IN VOID   *Parameter
+  )
+{
+  RunWorker ((PARALLEL_WORKER *) Parameter);
+  return 0;
+}
+
+VOID
+RunParallelJobs (
+  IN PARALLEL_JOB_FUNCTION  Function,
+  IN VOID                   *Context,
+  IN UINTN                  JobCount,
+  IN UINTN                  WorkerCount
+  )
+/*++
+
+Routine Description:
+
+  Runs JobCount jobs on up to WorkerCount workers and returns when all of
+  them are done. Worker 0 is the calling thread. If a thread cannot be
+  created, the remaining workers take over its share of the jobs.
+
+Arguments:
+
+  Function       Callback that runs one job.
+  Context        Caller data passed to every call of Function.
+  JobCount       Number of jobs.
+  WorkerCount    Number of workers, 0 or 1 runs all jobs on the calling
+                 thread, values above MAX_PARALLEL_WORKERS are reduced.
+
+Returns:
+
+  None
+
+--*/
+{
+  PARALLEL_POOL     Pool;
+  PARALLEL_WORKER   Workers[MAX_PARALLEL_WORKERS];
+  UINTN             Index;
+
+  if (WorkerCount > MAX_PARALLEL_WORKERS) {
+    WorkerCount = MAX_PARALLEL_WORKERS;
+  }
+  if (WorkerCount > JobCount) {
+    WorkerCount = JobCount;
+  }
+
+  Pool.Function = Function;
+  Pool.Context  = Context;
+  Pool.JobCount = JobCount;
+  Pool.NextJob  = 0;
+
+  if (WorkerCount <= 1 || CriticalSection_Init (&Pool.Lock) != 0) {
+    for (Index = 0; Index < JobCount; Index++) {
+      Function (Context, Index, 0);
+    }
+    return;
+  }
+
+  for (Index = 0; Index < WorkerCount; Index++) {
+    Workers[Index].Pool        = &Pool;
+    Workers[Index].WorkerIndex = Index;
+    Thread_Construct (&Workers[Index].Thread);
+  }
+
+  for (Index = 1; Index < WorkerCount; Index++) {
+    if (Thread_Create (&Workers[Index].Thread, WorkerThread, &Workers[Index]) != 0) {
+      Thread_Construct (&Workers[Index].Thread);
+    }
+  }
+
+  RunWorker (&Workers[0]);
+
+  for (Index = 1; Index < WorkerCount; Index++) {
+    if (Thread_WasCreated (&Workers[Index].Thread)) {
+      Thread_Wait (&Workers[Index].Thread);
+      Thread_Close (&Workers[Index].Thread);
+    }
+  }
+
+  CriticalSection_Delete (&Pool.Lock);
+}
+
+PARALLEL_LOCK *
+CreateParallelLock (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Creates a lock that jobs of one or several pools take around the data
+  they share.
+
+Arguments:
+
+  None
+
+Returns:
+
+  The lock, NULL if no resource is left to create it.
+
+--*/
+{
+  PARALLEL_LOCK   *Lock;
+
+  Lock = (PARALLEL_LOCK *) malloc (sizeof (PARALLEL_LOCK));
+  if (Lock == NULL) {
+    return NULL;
+  }
+  if (CriticalSection_Init (&Lock->Section) != 0) {
+    free (Lock);
+    return NULL;
+  }
+  return Lock;
+}
+
+VOID
+AcquireParallelLock (
+  IN PARALLEL_LOCK          *Lock
+  )
+/*++
+
+Routine Description:
+
+  Waits until the calling thread owns the lock.
+
+Arguments:
+
+  Lock           The lock, NULL does nothing.
+
+Returns:
+
+  None
+
+--*/
+{
+  if (Lock != NULL) {
+    CriticalSection_Enter (&Lock->Section);
+  }
+}
+
+VOID
+ReleaseParallelLock (
+  IN PARALLEL_LOCK          *Lock
+  )
+/*++
+
+Routine Description:
+
+  Releases a lock owned by the calling thread.
+
+Arguments:
+
+  Lock           The lock, NULL does nothing.
+
+Returns:
+
+  None
+
+--*/
+{
+  if (Lock != NULL) {
+    CriticalSection_Leave (&Lock->Section);
+  }
+}
+
+VOID
+FreeParallelLock (
+  IN PARALLEL_LOCK          *Lock
+  )
+/*++
+
+Routine Description:
+
+  Frees a lock that no thread owns.
+
+Arguments:
+
+  Lock           The lock, NULL does nothing.
+
+Returns:
+
+  None
+
+--*/
+{
+  if (Lock != NULL) {
+    CriticalSection_Delete (&Lock->Section);
+    free (Lock);
+  }
+}
@@ -0,0 +1,188 @@
+/** @file
+
+Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+This program and the accompanying materials
+are licensed and made available under the terms and conditions of the BSD License
+which accompanies this distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+Module Name:
+
+  ParallelJobs.h
+
+Abstract:
+
+  Small worker pool used by GenFv to run independent jobs, such as the
+  rebase of the images of a FV, on several threads, and a lock for the
+  data the jobs share.
+
+**/
+
+#ifndef _PARALLEL_JOBS_H
+#define _PARALLEL_JOBS_H
+
+#include <Common/UefiBaseTypes.h>
+
+//
+// Upper limit of the number of workers of a pool.
+//
+#define MAX_PARALLEL_WORKERS  64
+
+//
+// Job callback. Jobs are numbered from 0, WorkerIndex identifies the
+// worker running the job and is below the worker count of the pool, so
+// callers can keep per worker state without locking.
+//
+typedef
+VOID
+(*PARALLEL_JOB_FUNCTION) (
+  IN VOID   *Context,
+  IN UINTN  JobIndex,
+  IN UINTN  WorkerIndex
+  );
+
+//
+// Lock for the data that jobs share, see CreateParallelLock.
+//
+typedef struct _PARALLEL_LOCK  PARALLEL_LOCK;
+
+UINTN
+GetProcessorCount (
+  VOID
+  )
+;
+/**
+
+Routine Description:
+
+  Returns the number of processors available to the process.
+
+Arguments:
+
+  None
+
+Returns:
+
+  The processor count, at least 1.
+
+**/
+
+VOID
+RunParallelJobs (
+  IN PARALLEL_JOB_FUNCTION  Function,
+  IN VOID                   *Context,
+  IN UINTN                  JobCount,
+  IN UINTN                  WorkerCount
+  )
+;
+/**
+
+Routine Description:
+
+  Runs JobCount jobs on up to WorkerCount workers and returns when all of
+  them are done. Worker 0 is the calling thread. If a thread cannot be
+  created, the remaining workers take over its share of the jobs.
+
+Arguments:
+
+  Function       Callback that runs one job.
+  Context        Caller data passed to every call of Function.
+  JobCount       Number of jobs.
+  WorkerCount    Number of workers, 0 or 1 runs all jobs on the calling
+                 thread, values above MAX_PARALLEL_WORKERS are reduced.
+
+Returns:
+
+  None
+
+**/
+
+PARALLEL_LOCK *
+CreateParallelLock (
+  VOID
+  )
+;
+/**
+
+Routine Description:
+
+  Creates a lock that jobs of one or several pools take around the data
+  they share.
+
+Arguments:
+
+  None
+
+Returns:
+
+  The lock, NULL if no resource is left to create it.
+
+**/
+
+VOID
+AcquireParallelLock (
+  IN PARALLEL_LOCK          *Lock
+  )
+;
+/**
+
+Routine Description:
+
+  Waits until the calling thread owns the lock. The lock is not recursive.
+
+Arguments:
+
+  Lock           The lock, NULL does nothing.
+
+Returns:
+
+  None
+
+**/
+
+VOID
+ReleaseParallelLock (
+  IN PARALLEL_LOCK          *Lock
+  )
+;
+/**
+
+Routine Description:
+
+  Releases a lock owned by the calling thread.
+
+Arguments:
+
+  Lock           The lock, NULL does nothing.
+
+Returns:
+
+  None
+
+**/
+
+VOID
+FreeParallelLock (
+  IN PARALLEL_LOCK          *Lock
+  )
+;
+/**
+
+Routine Description:
+
+  Frees a lock that no thread owns.
+
+Arguments:
+
+  Lock           The lock, NULL does nothing.
+
+Returns:
+
+  None
+
+**/
+
+#endif
@@ -26,6 +26,14 @@ Abstract:
 #include "EfiUtilityMsgs.h"
 #include "ParseInf.h"
 
+//
+// InfIndexCreate() may run on several threads at once, it splits the lines
+// with the reentrant strtok.
+//
+#ifdef _MSC_VER
+#define strtok_r  strtok_s
+#endif
+
 CHAR8 *
 ReadLine (
   IN MEMORY_FILE    *InputFile,
@@ -353,6 +361,392 @@ Returns:
   return EFI_NOT_FOUND;
 }
 
+//
+// One line of an INF file as ReadLine() returns it, with the token and
+// value FindToken() would take from it.
+//
+typedef struct {
+  CHAR8   *Text;
+  CHAR8   *Token;   // First word, NULL for blank and comment lines
+  CHAR8   *Value;   // First word after the '=', NULL if there is none
+} INF_LINE;
+
+typedef struct {
+  CHAR8   *Token;
+  UINTN   Line;
+} INF_KEY;
+
+//
+// A section located by InfIndexFindToken(). Keys holds the lines of the
+// section sorted by token and then by line, so the instances of a token
+// are adjacent and in file order.
+//
+typedef struct _INF_SECTION {
+  struct _INF_SECTION  *Next;
+  CHAR8                *Name;
+  BOOLEAN              Found;
+  BOOLEAN              AtEof;
+  INF_KEY              *Keys;
+  UINTN                KeyCount;
+} INF_SECTION;
+
+struct _INF_INDEX {
+  INF_LINE     *Lines;
+  UINTN        LineCount;
+  INF_SECTION  *Sections;
+};
+
+STATIC
+int
+CompareInfKeys (
+  IN CONST VOID  *Key1,
+  IN CONST VOID  *Key2
+  )
+/*++
+
+Routine Description:
+
+  qsort() callback ordering INF_KEY entries by token, then by line.
+
+Arguments:
+
+  Key1      First key.
+  Key2      Second key.
+
+Returns:
+
+  <0, 0 or >0 as Key1 is before, equal to or after Key2.
+
+--*/
+{
+  CONST INF_KEY  *Left;
+  CONST INF_KEY  *Right;
+  int            Result;
+
+  Left    = (CONST INF_KEY *) Key1;
+  Right   = (CONST INF_KEY *) Key2;
+  Result  = strcmp (Left->Token, Right->Token);
+  if (Result != 0) {
+    return Result;
+  }
+  return Left->Line < Right->Line ? -1 : (Left->Line > Right->Line ? 1 : 0);
+}
+
+EFI_STATUS
+InfIndexCreate (
+  IN  MEMORY_FILE   *InputFile,
+  OUT INF_INDEX     **Index
+  )
+/*++
+
+Routine Description:
+
+  Reads every line of an INF file once and records the token and value of
+  each, so that InfIndexFindToken() does not rescan the file.
+
+Arguments:
+
+  InputFile   Memory file image.
+  Index       Receives the index, free it with InfIndexFree().
+
+Returns:
+
+  EFI_SUCCESS             The index was created.
+  EFI_INVALID_PARAMETER   Input argument was null.
+  EFI_OUT_OF_RESOURCES    No resource to complete function.
+
+--*/
+{
+  INF_INDEX   *NewIndex;
+  INF_LINE    *Lines;
+  INF_LINE    *Line;
+  UINTN       LineMax;
+  UINTN       TextLength;
+  CHAR8       InputBuffer[_MAX_PATH];
+  CHAR8       *SavedFilePointer;
+  CHAR8       *CurrentToken;
+  CHAR8       *NextToken;
+  EFI_STATUS  Status;
+
+  if (InputFile == NULL ||
+      InputFile->FileImage == NULL ||
+      InputFile->Eof == NULL ||
+      InputFile->CurrentFilePointer == NULL ||
+      Index == NULL
+      ) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  NewIndex = (INF_INDEX *) calloc (1, sizeof (INF_INDEX));
+  if (NewIndex == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  SavedFilePointer              = InputFile->CurrentFilePointer;
+  InputFile->CurrentFilePointer = InputFile->FileImage;
+  LineMax                       = 0;
+  Status                        = EFI_SUCCESS;
+  while (InputFile->CurrentFilePointer < InputFile->Eof) {
+    ReadLine (InputFile, InputBuffer, _MAX_PATH);
+
+    if (NewIndex->LineCount == LineMax) {
+      LineMax = LineMax == 0 ? 64 : LineMax * 2;
+      Lines   = (INF_LINE *) realloc (NewIndex->Lines, LineMax * sizeof (INF_LINE));
+      if (Lines == NULL) {
+        Status = EFI_OUT_OF_RESOURCES;
+        break;
+      }
+      NewIndex->Lines = Lines;
+    }
+
+    //
+    // Keep the text for the section search, then split the line the way
+    // FindToken() does. Token and value are copied behind the text.
+    //
+    Line        = &NewIndex->Lines[NewIndex->LineCount];
+    TextLength  = strlen (InputBuffer) + 1;
+    Line->Text  = (CHAR8 *) malloc (TextLength * 2);
+    if (Line->Text == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      break;
+    }
+    NewIndex->LineCount++;
+    memcpy (Line->Text, InputBuffer, TextLength);
+    Line->Token = NULL;
+    Line->Value = NULL;
+
+    CurrentToken = strtok_r (InputBuffer, " \t\n", &NextToken);
+    if (CurrentToken != NULL) {
+      Line->Token = Line->Text + TextLength;
+      strcpy (Line->Token, CurrentToken);
+      CurrentToken = strtok_r (NULL, "= \t\n", &NextToken);
+      if (CurrentToken != NULL) {
+        Line->Value = Line->Token + strlen (Line->Token) + 1;
+        strcpy (Line->Value, CurrentToken);
+      }
+    }
+  }
+
+  InputFile->CurrentFilePointer = SavedFilePointer;
+  if (EFI_ERROR (Status)) {
+    InfIndexFree (NewIndex);
+    return Status;
+  }
+
+  *Index = NewIndex;
+  return EFI_SUCCESS;
+}
+
+VOID
+InfIndexFree (
+  IN INF_INDEX      *Index
+  )
+/*++
+
+Routine Description:
+
+  Frees an index created by InfIndexCreate().
+
+Arguments:
+
+  Index     The index to free, may be NULL.
+
+Returns:
+
+  None
+
+--*/
+{
+  INF_SECTION *Section;
+  UINTN       LineIndex;
+
+  if (Index == NULL) {
+    return;
+  }
+
+  while (Index->Sections != NULL) {
+    Section         = Index->Sections;
+    Index->Sections = Section->Next;
+    free (Section->Keys);
+    free (Section);
+  }
+
+  for (LineIndex = 0; LineIndex < Index->LineCount; LineIndex++) {
+    free (Index->Lines[LineIndex].Text);
+  }
+  free (Index->Lines);
+  free (Index);
+}
+
+STATIC
+INF_SECTION *
+InfIndexGetSection (
+  IN INF_INDEX      *Index,
+  IN CHAR8          *Name
+  )
+/*++
+
+Routine Description:
+
+  Returns the section the FindSection() search for Name would stop at,
+  collecting its keys the first time the section is asked for.
+
+Arguments:
+
+  Index     The index of the INF file.
+  Name      Section to search for.
+
+Returns:
+
+  The section, or NULL if no memory is available.
+
+--*/
+{
+  INF_SECTION *Section;
+  UINTN       LineIndex;
+  UINTN       First;
+
+  for (Section = Index->Sections; Section != NULL; Section = Section->Next) {
+    if (strcmp (Section->Name, Name) == 0) {
+      return Section;
+    }
+  }
+
+  Section = (INF_SECTION *) calloc (1, sizeof (INF_SECTION) + strlen (Name) + 1);
+  if (Section == NULL) {
+    return NULL;
+  }
+  Section->Name = (CHAR8 *) (Section + 1);
+  strcpy (Section->Name, Name);
+
+  //
+  // The section string may be anywhere within a line, as for FindSection().
+  //
+  for (First = 0; First < Index->LineCount; First++) {
+    if (strstr (Index->Lines[First].Text, Name) != NULL) {
+      break;
+    }
+  }
+
+  if (First < Index->LineCount) {
+    Section->Found  = TRUE;
+    Section->AtEof  = (BOOLEAN) (First + 1 == Index->LineCount);
+    Section->Keys   = (INF_KEY *) malloc ((Index->LineCount - First) * sizeof (INF_KEY));
+    if (Section->Keys == NULL) {
+      free (Section);
+      return NULL;
+    }
+
+    for (LineIndex = First + 1; LineIndex < Index->LineCount; LineIndex++) {
+      if (Index->Lines[LineIndex].Token == NULL) {
+        continue;
+      }
+      if (Index->Lines[LineIndex].Token[0] == '[') {
+        break;
+      }
+      Section->Keys[Section->KeyCount].Token  = Index->Lines[LineIndex].Token;
+      Section->Keys[Section->KeyCount].Line   = LineIndex;
+      Section->KeyCount++;
+    }
+    qsort (Section->Keys, Section->KeyCount, sizeof (INF_KEY), CompareInfKeys);
+  }
+
+  Section->Next   = Index->Sections;
+  Index->Sections = Section;
+  return Section;
+}
+
+EFI_STATUS
+InfIndexFindToken (
+  IN INF_INDEX      *Index,
+  IN CHAR8          *Section,
+  IN CHAR8          *Token,
+  IN UINTN          Instance,
+  OUT CHAR8         *Value
+  )
+/*++
+
+Routine Description:
+
+  Finds a token value given the section and token to search for. Returns
+  the same results as FindToken() on the file the index was created from.
+
+Arguments:
+
+  Index     The index of the INF file.
+  Section   The section to search for, a string within [].
+  Token     The token to search for, e.g. EFI_PEIM_RECOVERY, followed by an = in the INF file.
+  Instance  The instance of the token to search for.  Zero is the first instance.
+  Value     The string that holds the value following the =.  Must be _MAX_PATH in size.
+
+Returns:
+
+  EFI_SUCCESS             Value found.
+  EFI_ABORTED             Format error detected in INF file.
+  EFI_INVALID_PARAMETER   Input argument was null.
+  EFI_LOAD_ERROR          Error reading from the file.
+  EFI_NOT_FOUND           Section/Token/Value not found.
+  EFI_OUT_OF_RESOURCES    No resource to complete function.
+
+--*/
+{
+  INF_SECTION *InfSection;
+  INF_LINE    *Line;
+  UINTN       Low;
+  UINTN       High;
+  UINTN       Middle;
+
+  if (Index == NULL ||
+      Section == NULL ||
+      strlen (Section) == 0 ||
+      Token == NULL ||
+      strlen (Token) == 0 ||
+      Value == NULL
+      ) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  InfSection = InfIndexGetSection (Index, Section);
+  if (InfSection == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+  if (!InfSection->Found) {
+    return EFI_NOT_FOUND;
+  }
+  if (InfSection->AtEof) {
+    //
+    // FindToken() fails to read the line after the section header.
+    //
+    return EFI_LOAD_ERROR;
+  }
+
+  //
+  // Find the first key of the token.
+  //
+  Low   = 0;
+  High  = InfSection->KeyCount;
+  while (Low < High) {
+    Middle = (Low + High) / 2;
+    if (strcmp (InfSection->Keys[Middle].Token, Token) < 0) {
+      Low = Middle + 1;
+    } else {
+      High = Middle;
+    }
+  }
+
+  if (Instance >= InfSection->KeyCount - Low ||
+      strcmp (InfSection->Keys[Low + Instance].Token, Token) != 0) {
+    return EFI_NOT_FOUND;
+  }
+
+  Line = &Index->Lines[InfSection->Keys[Low + Instance].Line];
+  if (Line->Value == NULL) {
+    return EFI_ABORTED;
+  }
+  strcpy (Value, Line->Value);
+  return EFI_SUCCESS;
+}
+
 EFI_STATUS
 StringToGuid (
   IN CHAR8      *AsciiGuidBuffer,
@@ -125,6 +125,96 @@ Returns:
   EFI_LOAD_ERROR          Error reading from the file.
   EFI_NOT_FOUND           Section/Token/Value not found.
 
+--*/
+//
+// Index of the sections, tokens and values of an INF file, built in one
+// pass. Use it instead of FindToken() to look up many tokens.
+//
+typedef struct _INF_INDEX INF_INDEX;
+
+EFI_STATUS
+InfIndexCreate (
+  IN  MEMORY_FILE   *InputFile,
+  OUT INF_INDEX     **Index
+  )
+;
+
+/*++
+
+Routine Description:
+
+  Reads every line of an INF file once and records the token and value of
+  each, so that InfIndexFindToken() does not rescan the file.
+
+Arguments:
+
+  InputFile   Memory file image.
+  Index       Receives the index, free it with InfIndexFree().
+
+Returns:
+
+  EFI_SUCCESS             The index was created.
+  EFI_INVALID_PARAMETER   Input argument was null.
+  EFI_OUT_OF_RESOURCES    No resource to complete function.
+
+--*/
+VOID
+InfIndexFree (
+  IN INF_INDEX      *Index
+  )
+;
+
+/*++
+
+Routine Description:
+
+  Frees an index created by InfIndexCreate().
+
+Arguments:
+
+  Index     The index to free, may be NULL.
+
+Returns:
+
+  None
+
+--*/
+EFI_STATUS
+InfIndexFindToken (
+  IN INF_INDEX      *Index,
+  IN CHAR8          *Section,
+  IN CHAR8          *Token,
+  IN UINTN          Instance,
+  OUT CHAR8         *Value
+  )
+;
+
+/*++
+
+Routine Description:
+
+  Finds a token value given the section and token to search for. Returns
+  the same results as FindToken() on the file the index was created from.
+  The first lookup of a section scans the index once, later lookups are
+  a binary search.
+
+Arguments:
+
+  Index     The index of the INF file.
+  Section   The section to search for, a string within [].
+  Token     The token to search for, e.g. EFI_PEIM_RECOVERY, followed by an = in the INF file.
+  Instance  The instance of the token to search for.  Zero is the first instance.
+  Value     The string that holds the value following the =.  Must be _MAX_PATH in size.
+
+Returns:
+
+  EFI_SUCCESS             Value found.
+  EFI_ABORTED             Format error detected in INF file.
+  EFI_INVALID_PARAMETER   Input argument was null.
+  EFI_LOAD_ERROR          Error reading from the file.
+  EFI_NOT_FOUND           Section/Token/Value not found.
+  EFI_OUT_OF_RESOURCES    No resource to complete function.
+
 --*/
 EFI_STATUS
 StringToGuid (
@@ -73,6 +73,26 @@ typedef struct {
   BOOLEAN                           IsTeImage;
 } PE_COFF_LOADER_IMAGE_CONTEXT;
 
+//
+// Relocation index of a loaded PE/COFF or TE image. Offsets holds the
+// offset of every fixup from the start of the loaded image, in increasing
+// order, and Runs splits it into runs of fixups of the same
+// EFI_IMAGE_REL_BASED_* type. The index is built once per image and can
+// then relocate copies of the image to any base address.
+//
+typedef struct {
+  UINT32                            Type;
+  UINT32                            Count;
+} PE_COFF_RELOCATION_RUN;
+
+typedef struct {
+  UINT64                            ImageSize;
+  UINT32                            FixupCount;
+  UINT32                            *Offsets;
+  UINT32                            RunCount;
+  PE_COFF_RELOCATION_RUN            *Runs;
+} PE_COFF_RELOCATION_INDEX;
+
 
 /**
 	Retrieves information on a PE/COFF image
@@ -110,6 +130,62 @@ PeCoffLoaderRelocateImage (
   )
 ;
 
+/**
+	Builds the relocation index of a loaded PE/COFF or TE image. Only HIGH,
+	LOW, HIGHLOW and DIR64 fixups that do not overlap each other nor the
+	relocation blocks are indexed, other images must be relocated with
+	PeCoffLoaderRelocateImage.
+
+	@param	ImageContext Contains information on the loaded image
+	@param	Index        Receives the index, free it with
+	                     PeCoffLoaderFreeRelocationIndex
+
+	@retval EFI_SUCCESS          if the index was built
+	@retval EFI_UNSUPPORTED      if the image can not be relocated with an index
+	@retval EFI_OUT_OF_RESOURCES if the index could not be allocated
+
+**/
+RETURN_STATUS
+EFIAPI
+PeCoffLoaderBuildRelocationIndex (
+  IN OUT PE_COFF_LOADER_IMAGE_CONTEXT  *ImageContext,
+  OUT    PE_COFF_RELOCATION_INDEX      **Index
+  )
+;
+
+/**
+	Relocates a PE/COFF image in memory with its relocation index, with the
+	same result as PeCoffLoaderRelocateImage
+
+	@param	ImageContext Contains information on the loaded image to relocate,
+	                     FixupData must be NULL
+	@param	Index        Relocation index built for a copy of the image
+
+	@retval EFI_SUCCESS           if the PE/COFF image was relocated
+	@retval EFI_INVALID_PARAMETER if the index does not match the image
+
+**/
+RETURN_STATUS
+EFIAPI
+PeCoffLoaderRelocateImageWithIndex (
+  IN OUT PE_COFF_LOADER_IMAGE_CONTEXT  *ImageContext,
+  IN     PE_COFF_RELOCATION_INDEX      *Index
+  )
+;
+
+/**
+	Frees a relocation index
+
+	@param	Index        The index to free, may be NULL
+
+**/
+VOID
+EFIAPI
+PeCoffLoaderFreeRelocationIndex (
+  IN PE_COFF_RELOCATION_INDEX      *Index
+  )
+;
+
 /**
 	Loads a PE/COFF image into memory
 
@@ -0,0 +1,250 @@
+/** @file
+
+Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+This program and the accompanying materials
+are licensed and made available under the terms and conditions of the BSD License
+which accompanies this distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+Module Name:
+
+  Sha256.c
+
+Abstract:
+
+  SHA-256 as specified by FIPS 180-4, with the incremental
+  Sha256Init/Sha256Update/Sha256Final interface.
+
+**/
+
+#include <string.h>
+#include "Sha256.h"
+
+#define SHA256_ROR(Value, Count)  (((Value) >> (Count)) | ((Value) << (32 - (Count))))
+
+//
+// One round of the compression function. The callers rotate the names of
+// the working variables instead of moving their values.
+//
+#define SHA256_ROUND(A, B, C, D, E, F, G, H, Index) \
+  do { \
+    T1  = (H) + (SHA256_ROR (E, 6) ^ SHA256_ROR (E, 11) ^ SHA256_ROR (E, 25)) + (((E) & (F)) ^ (~(E) & (G))) + mSha256K[Index] + W[Index]; \
+    (D) += T1; \
+    (H)  = T1 + (SHA256_ROR (A, 2) ^ SHA256_ROR (A, 13) ^ SHA256_ROR (A, 22)) + (((A) & (B)) ^ ((A) & (C)) ^ ((B) & (C))); \
+  } while (0)
+
+STATIC CONST UINT32 mSha256K[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+STATIC
+VOID
+Sha256Block (
+  IN OUT UINT32       *State,
+  IN CONST UINT8      *Block
+  )
+/*++
+
+Routine Description:
+
+  Process one 64 byte block of data.
+
+Arguments:
+
+  State       - The hash state to update
+  Block       - The block
+
+Returns:
+
+  None
+
+--*/
+{
+  UINT32  W[64];
+  UINT32  A, B, C, D, E, F, G, H;
+  UINT32  T1, T2;
+  UINTN   Index;
+
+  for (Index = 0; Index < 16; Index++) {
+    W[Index] = ((UINT32) Block[Index * 4] << 24) | ((UINT32) Block[Index * 4 + 1] << 16) |
+               ((UINT32) Block[Index * 4 + 2] << 8) | (UINT32) Block[Index * 4 + 3];
+  }
+  for (; Index < 64; Index++) {
+    T1 = W[Index - 2];
+    T2 = W[Index - 15];
+    W[Index] = (SHA256_ROR (T1, 17) ^ SHA256_ROR (T1, 19) ^ (T1 >> 10)) + W[Index - 7] +
+               (SHA256_ROR (T2, 7) ^ SHA256_ROR (T2, 18) ^ (T2 >> 3)) + W[Index - 16];
+  }
+
+  A = State[0];
+  B = State[1];
+  C = State[2];
+  D = State[3];
+  E = State[4];
+  F = State[5];
+  G = State[6];
+  H = State[7];
+  for (Index = 0; Index < 64; Index += 8) {
+    SHA256_ROUND (A, B, C, D, E, F, G, H, Index);
+    SHA256_ROUND (H, A, B, C, D, E, F, G, Index + 1);
+    SHA256_ROUND (G, H, A, B, C, D, E, F, Index + 2);
+    SHA256_ROUND (F, G, H, A, B, C, D, E, Index + 3);
+    SHA256_ROUND (E, F, G, H, A, B, C, D, Index + 4);
+    SHA256_ROUND (D, E, F, G, H, A, B, C, Index + 5);
+    SHA256_ROUND (C, D, E, F, G, H, A, B, Index + 6);
+    SHA256_ROUND (B, C, D, E, F, G, H, A, Index + 7);
+  }
+  State[0] += A;
+  State[1] += B;
+  State[2] += C;
+  State[3] += D;
+  State[4] += E;
+  State[5] += F;
+  State[6] += G;
+  State[7] += H;
+}
+
+VOID
+Sha256Init (
+  OUT SHA256_CONTEXT                    *Context
+  )
+/*++
+
+Routine Description:
+
+  Start a new incremental SHA-256 calculation.
+
+Arguments:
+
+  Context     - The caller allocated calculation context
+
+Returns:
+
+  None
+
+--*/
+{
+  Context->State[0]  = 0x6a09e667;
+  Context->State[1]  = 0xbb67ae85;
+  Context->State[2]  = 0x3c6ef372;
+  Context->State[3]  = 0xa54ff53a;
+  Context->State[4]  = 0x510e527f;
+  Context->State[5]  = 0x9b05688c;
+  Context->State[6]  = 0x1f83d9ab;
+  Context->State[7]  = 0x5be0cd19;
+  Context->Length    = 0;
+  Context->BlockSize = 0;
+}
+
+VOID
+Sha256Update (
+  IN OUT SHA256_CONTEXT                 *Context,
+  IN CONST VOID                         *Data,
+  IN UINTN                              DataSize
+  )
+/*++
+
+Routine Description:
+
+  Feed the next part of the data into an incremental SHA-256 calculation.
+
+Arguments:
+
+  Context     - The context initialized by Sha256Init
+  Data        - The buffer contaning the data to be processed
+  DataSize    - The size of data to be processed, may be zero
+
+Returns:
+
+  None
+
+--*/
+{
+  CONST UINT8   *Bytes;
+  UINTN         Size;
+
+  Bytes            = (CONST UINT8 *) Data;
+  Context->Length += DataSize;
+
+  if (Context->BlockSize > 0) {
+    Size = SHA256_BLOCK_SIZE - Context->BlockSize;
+    if (Size > DataSize) {
+      Size = DataSize;
+    }
+    memcpy (Context->Block + Context->BlockSize, Bytes, Size);
+    Context->BlockSize += Size;
+    Bytes              += Size;
+    DataSize           -= Size;
+    if (Context->BlockSize < SHA256_BLOCK_SIZE) {
+      return;
+    }
+    Sha256Block (Context->State, Context->Block);
+    Context->BlockSize = 0;
+  }
+
+  for (; DataSize >= SHA256_BLOCK_SIZE; Bytes += SHA256_BLOCK_SIZE, DataSize -= SHA256_BLOCK_SIZE) {
+    Sha256Block (Context->State, Bytes);
+  }
+
+  memcpy (Context->Block, Bytes, DataSize);
+  Context->BlockSize = DataSize;
+}
+
+VOID
+Sha256Final (
+  IN OUT SHA256_CONTEXT                 *Context,
+  OUT UINT8                             *Digest
+  )
+/*++
+
+Routine Description:
+
+  Finish an incremental SHA-256 calculation.
+
+Arguments:
+
+  Context     - The context initialized by Sha256Init
+  Digest      - Receives the SHA256_DIGEST_SIZE bytes of the digest
+
+Returns:
+
+  None
+
+--*/
+{
+  UINT64  BitLength;
+  UINTN   Index;
+
+  //
+  // Pad with a one bit, zeros and the message length in bits, big endian.
+  //
+  BitLength = Context->Length * 8;
+  Context->Block[Context->BlockSize++] = 0x80;
+  if (Context->BlockSize > SHA256_BLOCK_SIZE - 8) {
+    memset (Context->Block + Context->BlockSize, 0, SHA256_BLOCK_SIZE - Context->BlockSize);
+    Sha256Block (Context->State, Context->Block);
+    Context->BlockSize = 0;
+  }
+  memset (Context->Block + Context->BlockSize, 0, SHA256_BLOCK_SIZE - 8 - Context->BlockSize);
+  for (Index = 0; Index < 8; Index++) {
+    Context->Block[SHA256_BLOCK_SIZE - 1 - Index] = (UINT8) (BitLength >> (Index * 8));
+  }
+  Sha256Block (Context->State, Context->Block);
+
+  for (Index = 0; Index < 8; Index++) {
+    Digest[Index * 4]     = (UINT8) (Context->State[Index] >> 24);
+    Digest[Index * 4 + 1] = (UINT8) (Context->State[Index] >> 16);
+    Digest[Index * 4 + 2] = (UINT8) (Context->State[Index] >> 8);
+    Digest[Index * 4 + 3] = (UINT8) Context->State[Index];
+  }
+}
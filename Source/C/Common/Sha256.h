@@ -0,0 +1,113 @@
+/** @file
+
+Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+This program and the accompanying materials
+are licensed and made available under the terms and conditions of the BSD License
+which accompanies this distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+Module Name:
+
+  Sha256.h
+
+Abstract:
+
+  Incremental SHA-256 interface, used where a tool decides from a digest
+  that data is unchanged and a CRC32 is too weak a key.
+
+**/
+
+#ifndef _SHA256_H
+#define _SHA256_H
+
+#include <Common/UefiBaseTypes.h>
+
+#define SHA256_DIGEST_SIZE    32
+#define SHA256_BLOCK_SIZE     64
+
+//
+// State of an incremental SHA-256 calculation.
+//
+typedef struct {
+  UINT32  State[8];
+  UINT64  Length;
+  UINT8   Block[SHA256_BLOCK_SIZE];
+  UINTN   BlockSize;
+} SHA256_CONTEXT;
+
+VOID
+Sha256Init (
+  OUT SHA256_CONTEXT                    *Context
+  )
+/*++
+
+Routine Description:
+
+  Start a new incremental SHA-256 calculation.
+
+Arguments:
+
+  Context     - The caller allocated calculation context
+
+Returns:
+
+  None
+
+--*/
+;
+
+VOID
+Sha256Update (
+  IN OUT SHA256_CONTEXT                 *Context,
+  IN CONST VOID                         *Data,
+  IN UINTN                              DataSize
+  )
+/*++
+
+Routine Description:
+
+  Feed the next part of the data into an incremental SHA-256 calculation.
+  Splitting the data into several Sha256Update calls yields the same result
+  as processing it in one piece.
+
+Arguments:
+
+  Context     - The context initialized by Sha256Init
+  Data        - The buffer contaning the data to be processed
+  DataSize    - The size of data to be processed, may be zero
+
+Returns:
+
+  None
+
+--*/
+;
+
+VOID
+Sha256Final (
+  IN OUT SHA256_CONTEXT                 *Context,
+  OUT UINT8                             *Digest
+  )
+/*++
+
+Routine Description:
+
+  Finish an incremental SHA-256 calculation. The context must be
+  initialized again before it is reused.
+
+Arguments:
+
+  Context     - The context initialized by Sha256Init
+  Digest      - Receives the SHA256_DIGEST_SIZE bytes of the digest
+
+Returns:
+
+  None
+
+--*/
+;
+
+#endif
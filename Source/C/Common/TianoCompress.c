@@ -43,8 +43,33 @@ typedef INT32 NODE;
 #define NIL           0
 #define MAX_HASH_VAL  (3 * WNDSIZ + (WNDSIZ / 512 + 1) * UINT8_MAX)
 #define HASH(p, c)    ((p) + ((c) << (WNDBIT - 9)) + WNDSIZ * 2)
+
+//
+// Hash chain match finder used by CompressLevelFast and CompressLevelMax.
+// Chains link earlier positions whose next three bytes hash alike.
+//
+#define HC_HASH_BITS  15
+#define HC_HASH_SIZE  (1U << HC_HASH_BITS)
+#define HC_HASH(t, p) \
+  (((((UINT32) (t)[p] << 16) | ((UINT32) (t)[(p) + 1] << 8) | (t)[(p) + 2]) * 2654435761U) >> (32 - HC_HASH_BITS))
+#define HC_FAST_DEPTH 8
+#define HC_FAST_NICE  32
+#define HC_MAX_DEPTH  1024
+
+//
+// Optimal parse used by CompressLevelOptimal. The input is parsed in
+// segments of OPT_SEGMENT bytes; each segment is parsed OPT_PASSES times,
+// every pass pricing symbols with Huffman code lengths built from the
+// symbol statistics of the pass before.
+//
+#define OPT_SEGMENT     4096
+#define OPT_MAX_MATCHES 16
+#define OPT_PASSES      2
+#define OPT_MAX_DEPTH   256
+#define OPT_NICE_LEN    64
+#define OPT_INFINITY    0xFFFFFFFFU
 #define CRCPOLY       0xA001
-#define UPDATE_CRC(c) mCrc = mCrcTable[(mCrc ^ (c)) & 0xFF] ^ (mCrc >> UINT8_BIT)
+#define UPDATE_CRC(Cd, c) (Cd)->mCrc = (Cd)->mCrcTable[((Cd)->mCrc ^ (c)) & 0xFF] ^ ((Cd)->mCrc >> UINT8_BIT)
 
 //
 // C: the Char&Len Set; P: the Position Set; T: the exTra Set
@@ -60,37 +85,61 @@ typedef INT32 NODE;
 #else
 #define NPT NP
 #endif
+
+//
+// A match candidate of the optimal parse: the longest string found at one
+// distance. Candidates of a position are sorted by increasing length.
+//
+typedef struct {
+  UINT16  Len;
+  UINT32  Dist;
+} OPT_MATCH;
+
+//
+// Cheapest known way to reach a position of the segment. Len and Dist
+// describe the last step (Len == 1 for an original character); Next links
+// the chosen path forward once the segment has been parsed.
+//
+typedef struct {
+  UINT32  Price;
+  UINT32  Dist;
+  UINT16  Len;
+  UINT16  Next;
+} OPT_NODE;
+
 //
 // Function Prototypes
 //
 
 STATIC
 VOID
-PutDword(
+PutDword (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN UINT32 Data
   );
 
 STATIC
 EFI_STATUS
 AllocateMemory (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 FreeMemory (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 InitSlide (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 NODE
 Child (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN NODE   NodeQ,
   IN UINT8  CharC
   );
@@ -98,6 +147,7 @@ Child (
 STATIC
 VOID
 MakeChild (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN NODE  NodeQ,
   IN UINT8 CharC,
   IN NODE  NodeR
@@ -106,42 +156,111 @@ MakeChild (
 STATIC
 VOID
 Split (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN NODE Old
   );
 
 STATIC
 VOID
 InsertNode (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 DeleteNode (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 GetNextMatch (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
+  );
+
+STATIC
+VOID
+SkipMatch (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
+  );
+
+STATIC
+VOID
+AdvancePosition (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
+  );
+
+STATIC
+VOID
+HcInsertNode (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
+  IN BOOLEAN Search
+  );
+
+STATIC
+INT32
+HcFindMatch (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
+  IN  NODE  Pos,
+  OUT NODE  *MatchPos
+  );
+
+STATIC
+VOID
+HcSlide (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
+  );
+
+STATIC
+UINT32
+HcFindMatches (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
+  IN  NODE      Pos,
+  IN  INT32     MaxLen,
+  OUT OPT_MATCH *Matches
+  );
+
+STATIC
+VOID
+OptMakeCosts (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
+  );
+
+STATIC
+UINT32
+OptPosBits (
+  IN UINT32  Dist
+  );
+
+STATIC
+VOID
+OptParse (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
+  IN     UINT32                  Size
+  );
+
+STATIC
+EFI_STATUS
+EncodeOptimal (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 EFI_STATUS
 Encode (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 CountTFreq (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 WritePTLen (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN INT32 Number,
   IN INT32 nbit,
   IN INT32 Special
@@ -150,30 +269,33 @@ WritePTLen (
 STATIC
 VOID
 WriteCLen (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 EncodeC (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN INT32 Value
   );
 
 STATIC
 VOID
 EncodeP (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN UINT32 Value
   );
 
 STATIC
 VOID
 SendBlock (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 Output (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN UINT32 c,
   IN UINT32 p
   );
@@ -181,24 +303,25 @@ Output (
 STATIC
 VOID
 HufEncodeStart (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 HufEncodeEnd (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 MakeCrcTable (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 PutBits (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN INT32  Number,
   IN UINT32 Value
   );
@@ -206,6 +329,7 @@ PutBits (
 STATIC
 INT32
 FreadCrc (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   OUT UINT8 *Pointer,
   IN  INT32 Number
   );
@@ -213,30 +337,34 @@ FreadCrc (
 STATIC
 VOID
 InitPutBits (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   );
 
 STATIC
 VOID
 CountLen (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN INT32 Index
   );
 
 STATIC
 VOID
 MakeLen (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN INT32 Root
   );
 
 STATIC
 VOID
 DownHeap (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN INT32 Index
   );
 
 STATIC
 VOID
 MakeCode (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN  INT32       Number,
   IN  UINT8 Len[  ],
   OUT UINT16 Code[]
@@ -245,6 +373,7 @@ MakeCode (
 STATIC
 INT32
 MakeTree (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN  INT32            NParm,
   IN  UINT16  FreqParm[],
   OUT UINT8   LenParm[ ],
@@ -252,26 +381,243 @@ MakeTree (
   );
 
 //
-//  Global Variables
+// Encoder state. Every compression runs on its own context so that several
+// threads can compress independently as long as they don't share a context.
 //
-STATIC UINT8  *mSrc, *mDst, *mSrcUpperLimit, *mDstUpperLimit;
-
-STATIC UINT8  *mLevel, *mText, *mChildCount, *mBuf, mCLen[NC], mPTLen[NPT], *mLen;
-STATIC INT16  mHeap[NC + 1];
-STATIC INT32  mRemainder, mMatchLen, mBitCount, mHeapSize, mN;
-STATIC UINT32 mBufSiz = 0, mOutputPos, mOutputMask, mSubBitBuf, mCrc;
-STATIC UINT32 mCompSize, mOrigSize;
-
-STATIC UINT16 *mFreq, *mSortPtr, mLenCnt[17], mLeft[2 * NC - 1], mRight[2 * NC - 1], mCrcTable[UINT8_MAX + 1],
-  mCFreq[2 * NC - 1], mCCode[NC], mPFreq[2 * NP - 1], mPTCode[NPT], mTFreq[2 * NT - 1];
-
-STATIC NODE   mPos, mMatchPos, mAvail, *mPosition, *mParent, *mPrev, *mNext = NULL;
+struct _TIANO_COMPRESS_CONTEXT {
+  UINT8   *mSrc;
+  UINT8   *mDst;
+  UINT8   *mSrcUpperLimit;
+  UINT8   *mDstUpperLimit;
+
+  UINT8   *mLevel;
+  UINT8   *mText;
+  UINT8   *mChildCount;
+  UINT8   *mBuf;
+  UINT8   mCLen[NC];
+  UINT8   mPTLen[NPT];
+  UINT8   *mLen;
+  INT16   mHeap[NC + 1];
+  INT32   mRemainder;
+  INT32   mMatchLen;
+  INT32   mBitCount;
+  INT32   mHeapSize;
+  INT32   mN;
+  INT32   mDepth;
+  UINT32  mBufSiz;
+  UINT32  mOutputPos;
+  UINT32  mOutputMask;
+  UINT32  mCPos;
+  UINT32  mSubBitBuf;
+  UINT32  mCrc;
+  UINT32  mCompSize;
+  UINT32  mOrigSize;
+
+  UINT16  *mFreq;
+  UINT16  *mSortPtr;
+  UINT16  mLenCnt[17];
+  UINT16  mLeft[2 * NC - 1];
+  UINT16  mRight[2 * NC - 1];
+  UINT16  mCrcTable[UINT8_MAX + 1];
+  UINT16  mCFreq[2 * NC - 1];
+  UINT16  mCCode[NC];
+  UINT16  mPFreq[2 * NP - 1];
+  UINT16  mPTCode[NPT];
+  UINT16  mTFreq[2 * NT - 1];
+
+  NODE    mPos;
+  NODE    mMatchPos;
+  NODE    mAvail;
+  NODE    *mPosition;
+  NODE    *mParent;
+  NODE    *mPrev;
+  NODE    *mNext;
+
+  COMPRESS_LEVEL  mCompressLevel;
+  UINT32  mHcDepth;
+  INT32   mHcNiceLen;
+  NODE    *mHcHead;
+  NODE    *mHcPrev;
+
+  UINT8     *mOptText;
+  UINT8     *mOptMatchCount;
+  OPT_MATCH *mOptMatches;
+  OPT_NODE  *mOptNodes;
+  UINT16    mOptCFreq[2 * NC - 1];
+  UINT16    mOptPFreq[2 * NP - 1];
+  UINT16    mOptCode[NC];
+  UINT8     mOptCLen[NC];
+  UINT8     mOptPLen[NP];
+  UINT32    mOptPCost[NP];
+};
 
 //
 // functions
 //
 EFI_STATUS
-TianoCompress (
+TianoCompressCreateContext (
+  OUT TIANO_COMPRESS_CONTEXT  **Context
+  )
+/*++
+
+Routine Description:
+
+  Allocate an encoder context for TianoCompressEx(). The context owns the
+  sliding dictionary and search tree, so it can be reused for any number
+  of compressions without reallocating them.
+
+Arguments:
+
+  Context     - Receives the new context
+
+Returns:
+
+  EFI_SUCCESS           - The context is created.
+  EFI_OUT_OF_RESOURCES  - No resource to complete function.
+  EFI_INVALID_PARAMETER - Context is NULL.
+
+--*/
+{
+  TIANO_COMPRESS_CONTEXT  *Cd;
+  EFI_STATUS              Status;
+
+  if (Context == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  *Context = NULL;
+  Cd = (TIANO_COMPRESS_CONTEXT *) calloc (1, sizeof (TIANO_COMPRESS_CONTEXT));
+  if (Cd == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = AllocateMemory (Cd);
+  if (EFI_ERROR (Status)) {
+    FreeMemory (Cd);
+    free (Cd);
+    return Status;
+  }
+
+  MakeCrcTable (Cd);
+  Cd->mCompressLevel = CompressLevelDefault;
+
+  *Context = Cd;
+  return EFI_SUCCESS;
+}
+
+VOID
+TianoCompressFreeContext (
+  IN TIANO_COMPRESS_CONTEXT  *Context
+  )
+/*++
+
+Routine Description:
+
+  Free a context created by TianoCompressCreateContext().
+
+Arguments:
+
+  Context     - The context to free, may be NULL
+
+Returns: (VOID)
+
+--*/
+{
+  if (Context != NULL) {
+    FreeMemory (Context);
+    free (Context);
+  }
+}
+
+EFI_STATUS
+TianoCompressSetLevel (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Context,
+  IN     COMPRESS_LEVEL  Level
+  )
+/*++
+
+Routine Description:
+
+  Select the match finder used by later TianoCompressEx() calls on Context.
+
+Arguments:
+
+  Context     - A context created by TianoCompressCreateContext()
+  Level       - CompressLevelFast searches bounded hash chains,
+                CompressLevelDefault uses the suffix tree and gives the
+                same output as TianoCompress(), CompressLevelMax walks
+                much deeper hash chains and looks one more position ahead
+                before committing to a match, CompressLevelOptimal
+                chooses characters and pointers by their estimated Huffman
+                cost. Both of these levels also run the suffix tree and
+                keep the smaller output
+
+Returns:
+
+  EFI_SUCCESS           - The level is selected.
+  EFI_OUT_OF_RESOURCES  - The hash chain tables could not be allocated.
+  EFI_INVALID_PARAMETER - Parameter supplied is wrong.
+
+--*/
+{
+  if (Context == NULL || Level < CompressLevelFast || Level > CompressLevelOptimal) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (Level == CompressLevelOptimal && Context->mOptNodes == NULL) {
+    Context->mOptText       = malloc (OPT_SEGMENT);
+    Context->mOptMatchCount = malloc (OPT_SEGMENT);
+    Context->mOptMatches    = malloc (OPT_SEGMENT * OPT_MAX_MATCHES * sizeof (OPT_MATCH));
+    Context->mOptNodes      = malloc ((OPT_SEGMENT + 1) * sizeof (OPT_NODE));
+    if (Context->mOptText == NULL || Context->mOptMatchCount == NULL ||
+        Context->mOptMatches == NULL || Context->mOptNodes == NULL) {
+      free (Context->mOptText);
+      free (Context->mOptMatchCount);
+      free (Context->mOptMatches);
+      free (Context->mOptNodes);
+      Context->mOptText       = NULL;
+      Context->mOptMatchCount = NULL;
+      Context->mOptMatches    = NULL;
+      Context->mOptNodes      = NULL;
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  if (Level != CompressLevelDefault && Context->mHcHead == NULL) {
+    Context->mHcHead = malloc (HC_HASH_SIZE * sizeof (*Context->mHcHead));
+    Context->mHcPrev = malloc (WNDSIZ * sizeof (*Context->mHcPrev));
+    if (Context->mHcHead == NULL || Context->mHcPrev == NULL) {
+      free (Context->mHcHead);
+      free (Context->mHcPrev);
+      Context->mHcHead = NULL;
+      Context->mHcPrev = NULL;
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  if (Level == CompressLevelFast) {
+    Context->mHcDepth   = HC_FAST_DEPTH;
+    Context->mHcNiceLen = HC_FAST_NICE;
+  } else if (Level == CompressLevelOptimal) {
+    //
+    // Every position is searched, so a shorter chain walk keeps the time
+    // reasonable; the parse makes up for the occasional missed match.
+    //
+    Context->mHcDepth   = OPT_MAX_DEPTH;
+    Context->mHcNiceLen = MAXMATCH;
+  } else {
+    Context->mHcDepth   = HC_MAX_DEPTH;
+    Context->mHcNiceLen = MAXMATCH;
+  }
+
+  Context->mCompressLevel = Level;
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+TianoCompressPass (
+  IN OUT  TIANO_COMPRESS_CONTEXT  *Context,
   IN      UINT8   *SrcBuffer,
   IN      UINT32  SrcSize,
   IN      UINT8   *DstBuffer,
@@ -281,18 +627,16 @@ TianoCompress (
 
 Routine Description:
 
-  The internal implementation of [Efi/Tiano]Compress().
+  Compress SrcBuffer once with the match finder selected in Context.
 
 Arguments:
 
+  Context     - The encoder context
   SrcBuffer   - The buffer storing the source data
   SrcSize     - The size of source data
   DstBuffer   - The buffer to store the compressed data
   DstSize     - On input, the size of DstBuffer; On output,
                 the size of the actual compressed data.
-  Version     - The version of de/compression algorithm.
-                Version 1 for UEFI 2.0 de/compression algorithm.
-                Version 2 for Tiano de/compression algorithm.
 
 Returns:
 
@@ -300,74 +644,210 @@ Returns:
                 DstSize contains the size needed.
   EFI_SUCCESS           - Compression is successful.
   EFI_OUT_OF_RESOURCES  - No resource to complete function.
-  EFI_INVALID_PARAMETER - Parameter supplied is wrong.
 
 --*/
 {
-  EFI_STATUS  Status;
+  TIANO_COMPRESS_CONTEXT  *Cd;
+  EFI_STATUS              Status;
 
   //
   // Initializations
   //
-  mBufSiz         = 0;
-  mBuf            = NULL;
-  mText           = NULL;
-  mLevel          = NULL;
-  mChildCount     = NULL;
-  mPosition       = NULL;
-  mParent         = NULL;
-  mPrev           = NULL;
-  mNext           = NULL;
+  Cd                  = Context;
+  Cd->mSrc            = SrcBuffer;
+  Cd->mSrcUpperLimit  = Cd->mSrc + SrcSize;
+  Cd->mDst            = DstBuffer;
+  Cd->mDstUpperLimit  = Cd->mDst +*DstSize;
 
-  mSrc            = SrcBuffer;
-  mSrcUpperLimit  = mSrc + SrcSize;
-  mDst            = DstBuffer;
-  mDstUpperLimit  = mDst +*DstSize;
+  memset (Cd->mText, 0, WNDSIZ * 2 + MAXMATCH);
+  Cd->mBuf[0]         = 0;
+  Cd->mDepth          = 0;
+  Cd->mCPos           = 0;
 
-  PutDword (0L);
-  PutDword (0L);
+  PutDword (Cd, 0L);
+  PutDword (Cd, 0L);
 
-  MakeCrcTable ();
-
-  mOrigSize             = mCompSize = 0;
-  mCrc                  = INIT_CRC;
+  Cd->mOrigSize             = Cd->mCompSize = 0;
+  Cd->mCrc                  = INIT_CRC;
 
   //
   // Compress it
   //
-  Status = Encode ();
+  if (Cd->mCompressLevel == CompressLevelOptimal) {
+    Status = EncodeOptimal (Cd);
+  } else {
+    Status = Encode (Cd);
+  }
   if (EFI_ERROR (Status)) {
-    return EFI_OUT_OF_RESOURCES;
+    return Status;
   }
+
   //
   // Null terminate the compressed data
   //
-  if (mDst < mDstUpperLimit) {
-    *mDst++ = 0;
+  if (Cd->mDst < Cd->mDstUpperLimit) {
+    *Cd->mDst++ = 0;
   }
   //
   // Fill in compressed size and original size
   //
-  mDst = DstBuffer;
-  PutDword (mCompSize + 1);
-  PutDword (mOrigSize);
+  Cd->mDst = DstBuffer;
+  PutDword (Cd, Cd->mCompSize + 1);
+  PutDword (Cd, Cd->mOrigSize);
 
   //
   // Return
   //
-  if (mCompSize + 1 + 8 > *DstSize) {
-    *DstSize = mCompSize + 1 + 8;
+  if (Cd->mCompSize + 1 + 8 > *DstSize) {
+    *DstSize = Cd->mCompSize + 1 + 8;
     return EFI_BUFFER_TOO_SMALL;
   } else {
-    *DstSize = mCompSize + 1 + 8;
+    *DstSize = Cd->mCompSize + 1 + 8;
     return EFI_SUCCESS;
   }
 
 }
 
+EFI_STATUS
+TianoCompressEx (
+  IN OUT  TIANO_COMPRESS_CONTEXT  *Context,
+  IN      UINT8                   *SrcBuffer,
+  IN      UINT32                  SrcSize,
+  IN      UINT8                   *DstBuffer,
+  IN OUT  UINT32                  *DstSize
+  )
+/*++
+
+Routine Description:
+
+  Tiano compress SrcBuffer using the state held in Context. The output is
+  identical to TianoCompress().
+
+Arguments:
+
+  Context     - A context created by TianoCompressCreateContext(), which
+                must not be used by another thread at the same time
+  SrcBuffer   - The buffer storing the source data
+  SrcSize     - The size of source data
+  DstBuffer   - The buffer to store the compressed data
+  DstSize     - On input, the size of DstBuffer; On output,
+                the size of the actual compressed data.
+
+Returns:
+
+  EFI_BUFFER_TOO_SMALL  - The DstBuffer is too small. In this case,
+                DstSize contains the size needed.
+  EFI_SUCCESS           - Compression is successful.
+  EFI_INVALID_PARAMETER - Parameter supplied is wrong.
+
+--*/
+{
+  EFI_STATUS              Status;
+  EFI_STATUS              LevelStatus;
+  UINT8                   *LevelBuffer;
+  UINT32                  TreeSize;
+  UINT32                  LevelSize;
+  COMPRESS_LEVEL          Level;
+
+  if (Context == NULL || DstSize == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Level = Context->mCompressLevel;
+  if (Level != CompressLevelMax && Level != CompressLevelOptimal) {
+    return TianoCompressPass (Context, SrcBuffer, SrcSize, DstBuffer, DstSize);
+  }
+
+  //
+  // The deep hash chain search and the optimal parse usually beat the
+  // suffix tree, but not on every input, long runs of a single byte among
+  // them. Compress with both and keep the smaller stream, so neither level
+  // ever loses to the default one.
+  //
+  TreeSize                = *DstSize;
+  Context->mCompressLevel = CompressLevelDefault;
+  Status                  = TianoCompressPass (Context, SrcBuffer, SrcSize, DstBuffer, &TreeSize);
+  Context->mCompressLevel = Level;
+  if (EFI_ERROR (Status) && Status != EFI_BUFFER_TOO_SMALL) {
+    return Status;
+  }
+
+  LevelBuffer = malloc (TreeSize);
+  if (LevelBuffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  LevelSize   = TreeSize;
+  LevelStatus = TianoCompressPass (Context, SrcBuffer, SrcSize, LevelBuffer, &LevelSize);
+  if (EFI_ERROR (LevelStatus) && LevelStatus != EFI_BUFFER_TOO_SMALL) {
+    free (LevelBuffer);
+    return LevelStatus;
+  }
+
+  if (LevelSize < TreeSize) {
+    if (LevelSize <= *DstSize) {
+      memcpy (DstBuffer, LevelBuffer, LevelSize);
+      Status = EFI_SUCCESS;
+    } else {
+      Status = EFI_BUFFER_TOO_SMALL;
+    }
+    TreeSize = LevelSize;
+  }
+
+  free (LevelBuffer);
+  *DstSize = TreeSize;
+  return Status;
+}
+
+EFI_STATUS
+TianoCompress (
+  IN      UINT8   *SrcBuffer,
+  IN      UINT32  SrcSize,
+  IN      UINT8   *DstBuffer,
+  IN OUT  UINT32  *DstSize
+  )
+/*++
+
+Routine Description:
+
+  The internal implementation of [Efi/Tiano]Compress().
+
+Arguments:
+
+  SrcBuffer   - The buffer storing the source data
+  SrcSize     - The size of source data
+  DstBuffer   - The buffer to store the compressed data
+  DstSize     - On input, the size of DstBuffer; On output,
+                the size of the actual compressed data.
+
+Returns:
+
+  EFI_BUFFER_TOO_SMALL  - The DstBuffer is too small. In this case,
+                DstSize contains the size needed.
+  EFI_SUCCESS           - Compression is successful.
+  EFI_OUT_OF_RESOURCES  - No resource to complete function.
+  EFI_INVALID_PARAMETER - Parameter supplied is wrong.
+
+--*/
+{
+  TIANO_COMPRESS_CONTEXT  *Context;
+  EFI_STATUS              Status;
+
+  Status = TianoCompressCreateContext (&Context);
+  if (EFI_ERROR (Status)) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = TianoCompressEx (Context, SrcBuffer, SrcSize, DstBuffer, DstSize);
+
+  TianoCompressFreeContext (Context);
+  return Status;
+}
+
 STATIC
 VOID
 PutDword (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN UINT32 Data
   )
 /*++
@@ -384,27 +864,27 @@ Returns: (VOID)
   
 --*/
 {
-  if (mDst < mDstUpperLimit) {
-    *mDst++ = (UINT8) (((UINT8) (Data)) & 0xff);
+  if (Cd->mDst < Cd->mDstUpperLimit) {
+    *Cd->mDst++ = (UINT8) (((UINT8) (Data)) & 0xff);
   }
 
-  if (mDst < mDstUpperLimit) {
-    *mDst++ = (UINT8) (((UINT8) (Data >> 0x08)) & 0xff);
+  if (Cd->mDst < Cd->mDstUpperLimit) {
+    *Cd->mDst++ = (UINT8) (((UINT8) (Data >> 0x08)) & 0xff);
   }
 
-  if (mDst < mDstUpperLimit) {
-    *mDst++ = (UINT8) (((UINT8) (Data >> 0x10)) & 0xff);
+  if (Cd->mDst < Cd->mDstUpperLimit) {
+    *Cd->mDst++ = (UINT8) (((UINT8) (Data >> 0x10)) & 0xff);
   }
 
-  if (mDst < mDstUpperLimit) {
-    *mDst++ = (UINT8) (((UINT8) (Data >> 0x18)) & 0xff);
+  if (Cd->mDst < Cd->mDstUpperLimit) {
+    *Cd->mDst++ = (UINT8) (((UINT8) (Data >> 0x18)) & 0xff);
   }
 }
 
 STATIC
 EFI_STATUS
 AllocateMemory (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 /*++
 
@@ -422,39 +902,35 @@ Returns:
 
 --*/
 {
-  UINT32  Index;
-
-  mText = malloc (WNDSIZ * 2 + MAXMATCH);
-  for (Index = 0; Index < WNDSIZ * 2 + MAXMATCH; Index++) {
-    mText[Index] = 0;
+  Cd->mText       = malloc (WNDSIZ * 2 + MAXMATCH);
+  Cd->mLevel      = malloc ((WNDSIZ + UINT8_MAX + 1) * sizeof (*Cd->mLevel));
+  Cd->mChildCount = malloc ((WNDSIZ + UINT8_MAX + 1) * sizeof (*Cd->mChildCount));
+  Cd->mPosition   = malloc ((WNDSIZ + UINT8_MAX + 1) * sizeof (*Cd->mPosition));
+  Cd->mParent     = malloc (WNDSIZ * 2 * sizeof (*Cd->mParent));
+  Cd->mPrev       = malloc (WNDSIZ * 2 * sizeof (*Cd->mPrev));
+  Cd->mNext       = malloc ((MAX_HASH_VAL + 1) * sizeof (*Cd->mNext));
+  if (Cd->mText == NULL || Cd->mLevel == NULL || Cd->mChildCount == NULL ||
+      Cd->mPosition == NULL || Cd->mParent == NULL || Cd->mPrev == NULL || Cd->mNext == NULL) {
+    return EFI_OUT_OF_RESOURCES;
   }
 
-  mLevel      = malloc ((WNDSIZ + UINT8_MAX + 1) * sizeof (*mLevel));
-  mChildCount = malloc ((WNDSIZ + UINT8_MAX + 1) * sizeof (*mChildCount));
-  mPosition   = malloc ((WNDSIZ + UINT8_MAX + 1) * sizeof (*mPosition));
-  mParent     = malloc (WNDSIZ * 2 * sizeof (*mParent));
-  mPrev       = malloc (WNDSIZ * 2 * sizeof (*mPrev));
-  mNext       = malloc ((MAX_HASH_VAL + 1) * sizeof (*mNext));
-
-  mBufSiz     = BLKSIZ;
-  mBuf        = malloc (mBufSiz);
-  while (mBuf == NULL) {
-    mBufSiz = (mBufSiz / 10U) * 9U;
-    if (mBufSiz < 4 * 1024U) {
+  Cd->mBufSiz     = BLKSIZ;
+  Cd->mBuf        = malloc (Cd->mBufSiz);
+  while (Cd->mBuf == NULL) {
+    Cd->mBufSiz = (Cd->mBufSiz / 10U) * 9U;
+    if (Cd->mBufSiz < 4 * 1024U) {
       return EFI_OUT_OF_RESOURCES;
     }
 
-    mBuf = malloc (mBufSiz);
+    Cd->mBuf = malloc (Cd->mBufSiz);
   }
 
-  mBuf[0] = 0;
-
   return EFI_SUCCESS;
 }
 
 VOID
 FreeMemory (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 /*++
 
@@ -468,45 +944,69 @@ Returns: (VOID)
 
 --*/
 {
-  if (mText != NULL) {
-    free (mText);
+  if (Cd->mText != NULL) {
+    free (Cd->mText);
   }
 
-  if (mLevel != NULL) {
-    free (mLevel);
+  if (Cd->mLevel != NULL) {
+    free (Cd->mLevel);
   }
 
-  if (mChildCount != NULL) {
-    free (mChildCount);
+  if (Cd->mChildCount != NULL) {
+    free (Cd->mChildCount);
   }
 
-  if (mPosition != NULL) {
-    free (mPosition);
+  if (Cd->mPosition != NULL) {
+    free (Cd->mPosition);
   }
 
-  if (mParent != NULL) {
-    free (mParent);
+  if (Cd->mParent != NULL) {
+    free (Cd->mParent);
   }
 
-  if (mPrev != NULL) {
-    free (mPrev);
+  if (Cd->mPrev != NULL) {
+    free (Cd->mPrev);
   }
 
-  if (mNext != NULL) {
-    free (mNext);
+  if (Cd->mNext != NULL) {
+    free (Cd->mNext);
   }
 
-  if (mBuf != NULL) {
-    free (mBuf);
+  if (Cd->mBuf != NULL) {
+    free (Cd->mBuf);
   }
 
-  return ;
-}
+  if (Cd->mHcHead != NULL) {
+    free (Cd->mHcHead);
+  }
 
-STATIC
-VOID
-InitSlide (
-  VOID
+  if (Cd->mHcPrev != NULL) {
+    free (Cd->mHcPrev);
+  }
+
+  if (Cd->mOptText != NULL) {
+    free (Cd->mOptText);
+  }
+
+  if (Cd->mOptMatchCount != NULL) {
+    free (Cd->mOptMatchCount);
+  }
+
+  if (Cd->mOptMatches != NULL) {
+    free (Cd->mOptMatches);
+  }
+
+  if (Cd->mOptNodes != NULL) {
+    free (Cd->mOptNodes);
+  }
+
+  return ;
+}
+
+STATIC
+VOID
+InitSlide (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 /*++
 
@@ -522,29 +1022,38 @@ Returns: (VOID)
 {
   NODE  Index;
 
+  if (Cd->mCompressLevel != CompressLevelDefault) {
+    //
+    // NIL is 0, so clearing the heads empties every chain
+    //
+    memset (Cd->mHcHead, 0, HC_HASH_SIZE * sizeof (*Cd->mHcHead));
+    return ;
+  }
+
   for (Index = WNDSIZ; Index <= WNDSIZ + UINT8_MAX; Index++) {
-    mLevel[Index]     = 1;
-    mPosition[Index]  = NIL;  /* sentinel */
+    Cd->mLevel[Index]     = 1;
+    Cd->mPosition[Index]  = NIL;  /* sentinel */
   }
 
   for (Index = WNDSIZ; Index < WNDSIZ * 2; Index++) {
-    mParent[Index] = NIL;
+    Cd->mParent[Index] = NIL;
   }
 
-  mAvail = 1;
+  Cd->mAvail = 1;
   for (Index = 1; Index < WNDSIZ - 1; Index++) {
-    mNext[Index] = (NODE) (Index + 1);
+    Cd->mNext[Index] = (NODE) (Index + 1);
   }
 
-  mNext[WNDSIZ - 1] = NIL;
+  Cd->mNext[WNDSIZ - 1] = NIL;
   for (Index = WNDSIZ * 2; Index <= MAX_HASH_VAL; Index++) {
-    mNext[Index] = NIL;
+    Cd->mNext[Index] = NIL;
   }
 }
 
 STATIC
 NODE
 Child (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN NODE  NodeQ,
   IN UINT8 CharC
   )
@@ -567,13 +1076,13 @@ Returns:
 {
   NODE  NodeR;
 
-  NodeR = mNext[HASH (NodeQ, CharC)];
+  NodeR = Cd->mNext[HASH (NodeQ, CharC)];
   //
   // sentinel
   //
-  mParent[NIL] = NodeQ;
-  while (mParent[NodeR] != NodeQ) {
-    NodeR = mNext[NodeR];
+  Cd->mParent[NIL] = NodeQ;
+  while (Cd->mParent[NodeR] != NodeQ) {
+    NodeR = Cd->mNext[NodeR];
   }
 
   return NodeR;
@@ -582,6 +1091,7 @@ Returns:
 STATIC
 VOID
 MakeChild (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN NODE  Parent,
   IN UINT8 CharC,
   IN NODE  Child
@@ -606,407 +1116,934 @@ Returns: (VOID)
   NODE  Node2;
 
   Node1           = (NODE) HASH (Parent, CharC);
-  Node2           = mNext[Node1];
-  mNext[Node1]    = Child;
-  mNext[Child]    = Node2;
-  mPrev[Node2]    = Child;
-  mPrev[Child]    = Node1;
-  mParent[Child]  = Parent;
-  mChildCount[Parent]++;
+  Node2           = Cd->mNext[Node1];
+  Cd->mNext[Node1]    = Child;
+  Cd->mNext[Child]    = Node2;
+  Cd->mPrev[Node2]    = Child;
+  Cd->mPrev[Child]    = Node1;
+  Cd->mParent[Child]  = Parent;
+  Cd->mChildCount[Parent]++;
 }
 
 STATIC
 VOID
 Split (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   NODE Old
   )
 /*++
 
 Routine Description:
 
-  Split a node.
-  
-Arguments:
+  Split a node.
+  
+Arguments:
+
+  Old     - the node to split
+  
+Returns: (VOID)
+
+--*/
+{
+  NODE  New;
+  NODE  TempNode;
+
+  New               = Cd->mAvail;
+  Cd->mAvail            = Cd->mNext[New];
+  Cd->mChildCount[New]  = 0;
+  TempNode          = Cd->mPrev[Old];
+  Cd->mPrev[New]        = TempNode;
+  Cd->mNext[TempNode]   = New;
+  TempNode          = Cd->mNext[Old];
+  Cd->mNext[New]        = TempNode;
+  Cd->mPrev[TempNode]   = New;
+  Cd->mParent[New]      = Cd->mParent[Old];
+  Cd->mLevel[New]       = (UINT8) Cd->mMatchLen;
+  Cd->mPosition[New]    = Cd->mPos;
+  MakeChild (Cd, New, Cd->mText[Cd->mMatchPos + Cd->mMatchLen], Old);
+  MakeChild (Cd, New, Cd->mText[Cd->mPos + Cd->mMatchLen], Cd->mPos);
+}
+
+STATIC
+VOID
+InsertNode (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
+  )
+/*++
+
+Routine Description:
+
+  Insert string info for current position into the String Info Log
+  
+Arguments: (VOID)
+
+Returns: (VOID)
+
+--*/
+{
+  NODE  NodeQ;
+  NODE  NodeR;
+  NODE  Index2;
+  NODE  NodeT;
+  UINT8 CharC;
+  UINT8 *t1;
+  UINT8 *t2;
+
+  if (Cd->mMatchLen >= 4) {
+    //
+    // We have just got a long match, the target tree
+    // can be located by MatchPos + 1. Travese the tree
+    // from bottom up to get to a proper starting point.
+    // The usage of PERC_FLAG ensures proper node deletion
+    // in DeleteNode (Cd) later.
+    //
+    Cd->mMatchLen--;
+    NodeR = (NODE) ((Cd->mMatchPos + 1) | WNDSIZ);
+    NodeQ = Cd->mParent[NodeR];
+    while (NodeQ == NIL) {
+      NodeR = Cd->mNext[NodeR];
+      NodeQ = Cd->mParent[NodeR];
+    }
+
+    while (Cd->mLevel[NodeQ] >= Cd->mMatchLen) {
+      NodeR = NodeQ;
+      NodeQ = Cd->mParent[NodeQ];
+    }
+
+    NodeT = NodeQ;
+    while (Cd->mPosition[NodeT] < 0) {
+      Cd->mPosition[NodeT]  = Cd->mPos;
+      NodeT             = Cd->mParent[NodeT];
+    }
+
+    if (NodeT < WNDSIZ) {
+      Cd->mPosition[NodeT] = (NODE) (Cd->mPos | (UINT32) PERC_FLAG);
+    }
+  } else {
+    //
+    // Locate the target tree
+    //
+    NodeQ = (NODE) (Cd->mText[Cd->mPos] + WNDSIZ);
+    CharC = Cd->mText[Cd->mPos + 1];
+    NodeR = Child (Cd, NodeQ, CharC);
+    if (NodeR == NIL) {
+      MakeChild (Cd, NodeQ, CharC, Cd->mPos);
+      Cd->mMatchLen = 1;
+      return ;
+    }
+
+    Cd->mMatchLen = 2;
+  }
+  //
+  // Traverse down the tree to find a match.
+  // Update Position value along the route.
+  // Node split or creation is involved.
+  //
+  for (;;) {
+    if (NodeR >= WNDSIZ) {
+      Index2    = MAXMATCH;
+      Cd->mMatchPos = NodeR;
+    } else {
+      Index2    = Cd->mLevel[NodeR];
+      Cd->mMatchPos = (NODE) (Cd->mPosition[NodeR] & (UINT32)~PERC_FLAG);
+    }
+
+    if (Cd->mMatchPos >= Cd->mPos) {
+      Cd->mMatchPos -= WNDSIZ;
+    }
+
+    t1  = &Cd->mText[Cd->mPos + Cd->mMatchLen];
+    t2  = &Cd->mText[Cd->mMatchPos + Cd->mMatchLen];
+    while (Cd->mMatchLen < Index2) {
+      if (*t1 != *t2) {
+        Split (Cd, NodeR);
+        return ;
+      }
+
+      Cd->mMatchLen++;
+      t1++;
+      t2++;
+    }
+
+    if (Cd->mMatchLen >= MAXMATCH) {
+      break;
+    }
+
+    Cd->mPosition[NodeR]  = Cd->mPos;
+    NodeQ             = NodeR;
+    NodeR             = Child (Cd, NodeQ, *t1);
+    if (NodeR == NIL) {
+      MakeChild (Cd, NodeQ, *t1, Cd->mPos);
+      return ;
+    }
+
+    Cd->mMatchLen++;
+  }
+
+  NodeT           = Cd->mPrev[NodeR];
+  Cd->mPrev[Cd->mPos]     = NodeT;
+  Cd->mNext[NodeT]    = Cd->mPos;
+  NodeT           = Cd->mNext[NodeR];
+  Cd->mNext[Cd->mPos]     = NodeT;
+  Cd->mPrev[NodeT]    = Cd->mPos;
+  Cd->mParent[Cd->mPos]   = NodeQ;
+  Cd->mParent[NodeR]  = NIL;
+
+  //
+  // Special usage of 'next'
+  //
+  Cd->mNext[NodeR] = Cd->mPos;
+
+}
+
+STATIC
+VOID
+DeleteNode (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
+  )
+/*++
+
+Routine Description:
+
+  Delete outdated string info. (The Usage of PERC_FLAG
+  ensures a clean deletion)
+  
+Arguments: (VOID)
+
+Returns: (VOID)
+
+--*/
+{
+  NODE  NodeQ;
+  NODE  NodeR;
+  NODE  NodeS;
+  NODE  NodeT;
+  NODE  NodeU;
+
+  if (Cd->mParent[Cd->mPos] == NIL) {
+    return ;
+  }
+
+  NodeR         = Cd->mPrev[Cd->mPos];
+  NodeS         = Cd->mNext[Cd->mPos];
+  Cd->mNext[NodeR]  = NodeS;
+  Cd->mPrev[NodeS]  = NodeR;
+  NodeR         = Cd->mParent[Cd->mPos];
+  Cd->mParent[Cd->mPos] = NIL;
+  if (NodeR >= WNDSIZ) {
+    return ;
+  }
+
+  Cd->mChildCount[NodeR]--;
+  if (Cd->mChildCount[NodeR] > 1) {
+    return ;
+  }
+
+  NodeT = (NODE) (Cd->mPosition[NodeR] & (UINT32)~PERC_FLAG);
+  if (NodeT >= Cd->mPos) {
+    NodeT -= WNDSIZ;
+  }
+
+  NodeS = NodeT;
+  NodeQ = Cd->mParent[NodeR];
+  NodeU = Cd->mPosition[NodeQ];
+  while (NodeU & (UINT32) PERC_FLAG) {
+    NodeU &= (UINT32)~PERC_FLAG;
+    if (NodeU >= Cd->mPos) {
+      NodeU -= WNDSIZ;
+    }
+
+    if (NodeU > NodeS) {
+      NodeS = NodeU;
+    }
+
+    Cd->mPosition[NodeQ]  = (NODE) (NodeS | WNDSIZ);
+    NodeQ             = Cd->mParent[NodeQ];
+    NodeU             = Cd->mPosition[NodeQ];
+  }
+
+  if (NodeQ < WNDSIZ) {
+    if (NodeU >= Cd->mPos) {
+      NodeU -= WNDSIZ;
+    }
+
+    if (NodeU > NodeS) {
+      NodeS = NodeU;
+    }
+
+    Cd->mPosition[NodeQ] = (NODE) (NodeS | WNDSIZ | (UINT32) PERC_FLAG);
+  }
+
+  NodeS           = Child (Cd, NodeR, Cd->mText[NodeT + Cd->mLevel[NodeR]]);
+  NodeT           = Cd->mPrev[NodeS];
+  NodeU           = Cd->mNext[NodeS];
+  Cd->mNext[NodeT]    = NodeU;
+  Cd->mPrev[NodeU]    = NodeT;
+  NodeT           = Cd->mPrev[NodeR];
+  Cd->mNext[NodeT]    = NodeS;
+  Cd->mPrev[NodeS]    = NodeT;
+  NodeT           = Cd->mNext[NodeR];
+  Cd->mPrev[NodeT]    = NodeS;
+  Cd->mNext[NodeS]    = NodeT;
+  Cd->mParent[NodeS]  = Cd->mParent[NodeR];
+  Cd->mParent[NodeR]  = NIL;
+  Cd->mNext[NodeR]    = Cd->mAvail;
+  Cd->mAvail          = NodeR;
+}
+
+STATIC
+VOID
+AdvancePosition (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
+  )
+/*++
+
+Routine Description:
+
+  Advance the current position, sliding the window and reading in new
+  data when the end of the text buffer is reached.
+
+Arguments: (VOID)
+
+Returns: (VOID)
+
+--*/
+{
+  INT32 Number;
+
+  Cd->mRemainder--;
+  Cd->mPos++;
+  if (Cd->mPos == WNDSIZ * 2) {
+    memmove (&Cd->mText[0], &Cd->mText[WNDSIZ], WNDSIZ + MAXMATCH);
+    Number = FreadCrc (Cd, &Cd->mText[WNDSIZ + MAXMATCH], WNDSIZ);
+    Cd->mRemainder += Number;
+    Cd->mPos = WNDSIZ;
+    if (Cd->mCompressLevel != CompressLevelDefault) {
+      HcSlide (Cd);
+    }
+  }
+}
+
+STATIC
+VOID
+GetNextMatch (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
+  )
+/*++
+
+Routine Description:
+
+  Advance the current position (read in new data if needed).
+  Delete outdated string info. Find a match string for current position.
+
+Arguments: (VOID)
+
+Returns: (VOID)
+
+--*/
+{
+  AdvancePosition (Cd);
+  if (Cd->mCompressLevel == CompressLevelDefault) {
+    DeleteNode (Cd);
+    InsertNode (Cd);
+  } else {
+    HcInsertNode (Cd, TRUE);
+  }
+}
+
+STATIC
+VOID
+SkipMatch (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
+  )
+/*++
+
+Routine Description:
+
+  Advance over a position covered by the pointer just output. The tree
+  has to search to stay consistent, the hash chains only record it.
+
+Arguments: (VOID)
+
+Returns: (VOID)
+
+--*/
+{
+  if (Cd->mCompressLevel == CompressLevelDefault) {
+    GetNextMatch (Cd);
+  } else {
+    AdvancePosition (Cd);
+    HcInsertNode (Cd, FALSE);
+  }
+}
+
+STATIC
+INT32
+HcFindMatch (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
+  IN  NODE  Pos,
+  OUT NODE  *MatchPos
+  )
+/*++
+
+Routine Description:
+
+  Walk the hash chain of Pos looking for the longest earlier string in
+  the window. Among equally long strings the closest one wins.
+
+Arguments:
+
+  Pos         - The position to find a match for
+  MatchPos    - Receives the position of the match
+
+Returns:
+
+  The match length, or 0 if no match of at least THRESHOLD bytes exists.
+
+--*/
+{
+  NODE    Candidate;
+  INT32   Limit;
+  INT32   BestLen;
+  INT32   Len;
+  UINT32  Depth;
+  UINT8   *Scan;
+  UINT8   *Match;
+
+  //
+  // Positions at or before Limit are outside the window. NIL is always
+  // among them, which terminates the chain.
+  //
+  Limit     = (INT32) Pos - (INT32) WNDSIZ;
+  BestLen   = THRESHOLD - 1;
+  Scan      = &Cd->mText[Pos];
+  Depth     = Cd->mHcDepth;
+  Candidate = Cd->mHcHead[HC_HASH (Cd->mText, Pos)];
+
+  while (Candidate > Limit && Depth-- > 0) {
+    Match = &Cd->mText[Candidate];
+    if (Match[BestLen] == Scan[BestLen] && Match[0] == Scan[0] && Match[1] == Scan[1]) {
+      Len = 2;
+      while (Len < MAXMATCH && Match[Len] == Scan[Len]) {
+        Len++;
+      }
+
+      if (Len > BestLen) {
+        BestLen   = Len;
+        *MatchPos = Candidate;
+        if (Len >= Cd->mHcNiceLen) {
+          break;
+        }
+      }
+    }
+
+    Candidate = Cd->mHcPrev[Candidate & (WNDSIZ - 1)];
+  }
+
+  return BestLen >= THRESHOLD ? BestLen : 0;
+}
+
+STATIC
+VOID
+HcInsertNode (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
+  IN BOOLEAN Search
+  )
+/*++
+
+Routine Description:
+
+  Hash chain counterpart of InsertNode(): optionally find a match for the
+  current position, then link the position into its chain.
+
+Arguments:
+
+  Search      - FALSE to only record the position
+
+Returns: (VOID)
+
+--*/
+{
+  UINT32  Hash;
+
+  if (Search) {
+    Cd->mMatchLen = HcFindMatch (Cd, Cd->mPos, &Cd->mMatchPos);
+  }
+
+  Hash                                  = HC_HASH (Cd->mText, Cd->mPos);
+  Cd->mHcPrev[Cd->mPos & (WNDSIZ - 1)]  = Cd->mHcHead[Hash];
+  Cd->mHcHead[Hash]                     = Cd->mPos;
+}
+
+STATIC
+VOID
+HcSlide (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
+  )
+/*++
+
+Routine Description:
+
+  Rebase the hash chains after the text buffer moved down by WNDSIZ.
+
+Arguments: (VOID)
 
-  Old     - the node to split
-  
 Returns: (VOID)
 
 --*/
 {
-  NODE  New;
-  NODE  TempNode;
+  UINT32  Index;
+  NODE    Node;
+
+  for (Index = 0; Index < HC_HASH_SIZE; Index++) {
+    Node                = Cd->mHcHead[Index];
+    Cd->mHcHead[Index]  = (NODE) (Node >= (NODE) WNDSIZ ? Node - WNDSIZ : NIL);
+  }
 
-  New               = mAvail;
-  mAvail            = mNext[New];
-  mChildCount[New]  = 0;
-  TempNode          = mPrev[Old];
-  mPrev[New]        = TempNode;
-  mNext[TempNode]   = New;
-  TempNode          = mNext[Old];
-  mNext[New]        = TempNode;
-  mPrev[TempNode]   = New;
-  mParent[New]      = mParent[Old];
-  mLevel[New]       = (UINT8) mMatchLen;
-  mPosition[New]    = mPos;
-  MakeChild (New, mText[mMatchPos + mMatchLen], Old);
-  MakeChild (New, mText[mPos + mMatchLen], mPos);
+  for (Index = 0; Index < WNDSIZ; Index++) {
+    Node                = Cd->mHcPrev[Index];
+    Cd->mHcPrev[Index]  = (NODE) (Node >= (NODE) WNDSIZ ? Node - WNDSIZ : NIL);
+  }
 }
 
 STATIC
-VOID
-InsertNode (
-  VOID
+EFI_STATUS
+Encode (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 /*++
 
 Routine Description:
 
-  Insert string info for current position into the String Info Log
-  
+  The main controlling routine for compression process.
+
 Arguments: (VOID)
 
-Returns: (VOID)
+Returns:
+  
+  EFI_SUCCESS           - The compression is successful
 
 --*/
 {
-  NODE  NodeQ;
-  NODE  NodeR;
-  NODE  Index2;
-  NODE  NodeT;
-  UINT8 CharC;
-  UINT8 *t1;
-  UINT8 *t2;
+  INT32       LastMatchLen;
+  NODE        LastMatchPos;
+  INT32       NextMatchLen;
+  NODE        NextMatchPos;
 
-  if (mMatchLen >= 4) {
-    //
-    // We have just got a long match, the target tree
-    // can be located by MatchPos + 1. Travese the tree
-    // from bottom up to get to a proper starting point.
-    // The usage of PERC_FLAG ensures proper node deletion
-    // in DeleteNode() later.
-    //
-    mMatchLen--;
-    NodeR = (NODE) ((mMatchPos + 1) | WNDSIZ);
-    NodeQ = mParent[NodeR];
-    while (NodeQ == NIL) {
-      NodeR = mNext[NodeR];
-      NodeQ = mParent[NodeR];
-    }
+  InitSlide (Cd);
 
-    while (mLevel[NodeQ] >= mMatchLen) {
-      NodeR = NodeQ;
-      NodeQ = mParent[NodeQ];
-    }
+  HufEncodeStart (Cd);
 
-    NodeT = NodeQ;
-    while (mPosition[NodeT] < 0) {
-      mPosition[NodeT]  = mPos;
-      NodeT             = mParent[NodeT];
-    }
+  Cd->mRemainder  = FreadCrc (Cd, &Cd->mText[WNDSIZ], WNDSIZ + MAXMATCH);
 
-    if (NodeT < WNDSIZ) {
-      mPosition[NodeT] = (NODE) (mPos | (UINT32) PERC_FLAG);
-    }
+  Cd->mMatchLen   = 0;
+  Cd->mPos        = WNDSIZ;
+  if (Cd->mCompressLevel == CompressLevelDefault) {
+    InsertNode (Cd);
   } else {
-    //
-    // Locate the target tree
-    //
-    NodeQ = (NODE) (mText[mPos] + WNDSIZ);
-    CharC = mText[mPos + 1];
-    NodeR = Child (NodeQ, CharC);
-    if (NodeR == NIL) {
-      MakeChild (NodeQ, CharC, mPos);
-      mMatchLen = 1;
-      return ;
+    HcInsertNode (Cd, TRUE);
+  }
+  if (Cd->mMatchLen > Cd->mRemainder) {
+    Cd->mMatchLen = Cd->mRemainder;
+  }
+
+  while (Cd->mRemainder > 0) {
+    LastMatchLen  = Cd->mMatchLen;
+    LastMatchPos  = Cd->mMatchPos;
+    GetNextMatch (Cd);
+    if (Cd->mMatchLen > Cd->mRemainder) {
+      Cd->mMatchLen = Cd->mRemainder;
     }
 
-    mMatchLen = 2;
-  }
-  //
-  // Traverse down the tree to find a match.
-  // Update Position value along the route.
-  // Node split or creation is involved.
-  //
-  for (;;) {
-    if (NodeR >= WNDSIZ) {
-      Index2    = MAXMATCH;
-      mMatchPos = NodeR;
+    if (Cd->mMatchLen > LastMatchLen || LastMatchLen < THRESHOLD) {
+      //
+      // Not enough benefits are gained by outputting a pointer,
+      // so just output the original character
+      //
+      Output (Cd, Cd->mText[Cd->mPos - 1], 0);
+
     } else {
-      Index2    = mLevel[NodeR];
-      mMatchPos = (NODE) (mPosition[NodeR] & (UINT32)~PERC_FLAG);
-    }
 
-    if (mMatchPos >= mPos) {
-      mMatchPos -= WNDSIZ;
-    }
+      if (LastMatchLen == THRESHOLD) {
+        if (((Cd->mPos - LastMatchPos - 2) & (WNDSIZ - 1)) > (1U << 11)) {
+          Output (Cd, Cd->mText[Cd->mPos - 1], 0);
+          continue;
+        }
+      }
 
-    t1  = &mText[mPos + mMatchLen];
-    t2  = &mText[mMatchPos + mMatchLen];
-    while (mMatchLen < Index2) {
-      if (*t1 != *t2) {
-        Split (NodeR);
-        return ;
+      if (Cd->mCompressLevel == CompressLevelMax && Cd->mRemainder > 1) {
+        //
+        // Look one more position ahead. If a clearly longer match starts
+        // there, output characters until the normal lazy step takes it.
+        //
+        NextMatchLen = HcFindMatch (Cd, Cd->mPos + 1, &NextMatchPos);
+        if (NextMatchLen > Cd->mRemainder - 1) {
+          NextMatchLen = Cd->mRemainder - 1;
+        }
+
+        if (NextMatchLen > LastMatchLen + 2) {
+          Output (Cd, Cd->mText[Cd->mPos - 1], 0);
+          continue;
+        }
+      }
+      //
+      // Outputting a pointer is beneficial enough, do it.
+      //
+      Output (
+        Cd,
+        LastMatchLen + (UINT8_MAX + 1 - THRESHOLD),
+        (Cd->mPos - LastMatchPos - 2) & (WNDSIZ - 1)
+        );
+      LastMatchLen--;
+      while (LastMatchLen > 1) {
+        SkipMatch (Cd);
+        LastMatchLen--;
       }
 
-      mMatchLen++;
-      t1++;
-      t2++;
-    }
+      GetNextMatch (Cd);
 
-    if (mMatchLen >= MAXMATCH) {
-      break;
+      if (Cd->mMatchLen > Cd->mRemainder) {
+        Cd->mMatchLen = Cd->mRemainder;
+      }
     }
+  }
 
-    mPosition[NodeR]  = mPos;
-    NodeQ             = NodeR;
-    NodeR             = Child (NodeQ, *t1);
-    if (NodeR == NIL) {
-      MakeChild (NodeQ, *t1, mPos);
-      return ;
-    }
+  HufEncodeEnd (Cd);
+  return EFI_SUCCESS;
+}
 
-    mMatchLen++;
-  }
+STATIC
+UINT32
+HcFindMatches (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
+  IN  NODE      Pos,
+  IN  INT32     MaxLen,
+  OUT OPT_MATCH *Matches
+  )
+/*++
 
-  NodeT           = mPrev[NodeR];
-  mPrev[mPos]     = NodeT;
-  mNext[NodeT]    = mPos;
-  NodeT           = mNext[NodeR];
-  mNext[mPos]     = NodeT;
-  mPrev[NodeT]    = mPos;
-  mParent[mPos]   = NodeQ;
-  mParent[NodeR]  = NIL;
+Routine Description:
 
-  //
-  // Special usage of 'next'
-  //
-  mNext[NodeR] = mPos;
+  Walk the hash chain of Pos collecting every earlier string that is
+  longer than all closer ones. Each candidate is the cheapest pointer for
+  its length range, so together they cover all useful pointers at Pos.
+
+Arguments:
+
+  Pos         - The position to find matches for
+  MaxLen      - The longest match allowed
+  Matches     - Receives up to OPT_MAX_MATCHES candidates sorted by
+                increasing length and distance
+
+Returns:
+
+  The number of candidates found.
+
+--*/
+{
+  NODE    Candidate;
+  INT32   Limit;
+  INT32   BestLen;
+  INT32   Len;
+  UINT32  Depth;
+  UINT32  Count;
+  UINT8   *Scan;
+  UINT8   *Match;
+
+  if (MaxLen < THRESHOLD) {
+    return 0;
+  }
+
+  Limit     = (INT32) Pos - (INT32) WNDSIZ;
+  BestLen   = THRESHOLD - 1;
+  Count     = 0;
+  Scan      = &Cd->mText[Pos];
+  Depth     = Cd->mHcDepth;
+  Candidate = Cd->mHcHead[HC_HASH (Cd->mText, Pos)];
+
+  while (Candidate > Limit && Depth-- > 0) {
+    Match = &Cd->mText[Candidate];
+    if (Match[BestLen] == Scan[BestLen] && Match[0] == Scan[0] && Match[1] == Scan[1]) {
+      Len = 2;
+      while (Len < MaxLen && Match[Len] == Scan[Len]) {
+        Len++;
+      }
+
+      if (Len > BestLen) {
+        BestLen = Len;
+        //
+        // When the list is full, the longest match replaces the last one.
+        //
+        if (Count == OPT_MAX_MATCHES) {
+          Count--;
+        }
+
+        Matches[Count].Len  = (UINT16) Len;
+        Matches[Count].Dist = (UINT32) (Pos - Candidate - 1);
+        Count++;
+        if (Len >= MaxLen) {
+          break;
+        }
+      }
+    }
+
+    Candidate = Cd->mHcPrev[Candidate & (WNDSIZ - 1)];
+  }
 
+  return Count;
 }
 
 STATIC
 VOID
-DeleteNode (
-  VOID
+OptMakeCosts (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 /*++
 
 Routine Description:
 
-  Delete outdated string info. (The Usage of PERC_FLAG
-  ensures a clean deletion)
-  
+  Turn the symbol statistics in mOptCFreq and mOptPFreq into bit costs.
+  Every symbol is counted once more than it was seen, so that symbols the
+  statistics have not met yet still get a finite price.
+
 Arguments: (VOID)
 
 Returns: (VOID)
 
 --*/
 {
-  NODE  NodeQ;
-  NODE  NodeR;
-  NODE  NodeS;
-  NODE  NodeT;
-  NODE  NodeU;
+  INT32 Index;
 
-  if (mParent[mPos] == NIL) {
-    return ;
+  for (Index = 0; Index < NC; Index++) {
+    Cd->mOptCFreq[Index]++;
   }
 
-  NodeR         = mPrev[mPos];
-  NodeS         = mNext[mPos];
-  mNext[NodeR]  = NodeS;
-  mPrev[NodeS]  = NodeR;
-  NodeR         = mParent[mPos];
-  mParent[mPos] = NIL;
-  if (NodeR >= WNDSIZ) {
-    return ;
+  for (Index = 0; Index < NP; Index++) {
+    Cd->mOptPFreq[Index]++;
   }
 
-  mChildCount[NodeR]--;
-  if (mChildCount[NodeR] > 1) {
-    return ;
-  }
+  MakeTree (Cd, NC, Cd->mOptCFreq, Cd->mOptCLen, Cd->mOptCode);
+  MakeTree (Cd, NP, Cd->mOptPFreq, Cd->mOptPLen, Cd->mOptCode);
 
-  NodeT = (NODE) (mPosition[NodeR] & (UINT32)~PERC_FLAG);
-  if (NodeT >= mPos) {
-    NodeT -= WNDSIZ;
+  //
+  // A pointer position of bit length c costs its code plus c - 1 extra bits
+  //
+  for (Index = 0; Index < NP; Index++) {
+    Cd->mOptPCost[Index] = Cd->mOptPLen[Index] + (Index > 1 ? Index - 1 : 0);
   }
+}
 
-  NodeS = NodeT;
-  NodeQ = mParent[NodeR];
-  NodeU = mPosition[NodeQ];
-  while (NodeU & (UINT32) PERC_FLAG) {
-    NodeU &= (UINT32)~PERC_FLAG;
-    if (NodeU >= mPos) {
-      NodeU -= WNDSIZ;
-    }
+STATIC
+UINT32
+OptPosBits (
+  IN UINT32  Dist
+  )
+/*++
 
-    if (NodeU > NodeS) {
-      NodeS = NodeU;
-    }
+Routine Description:
 
-    mPosition[NodeQ]  = (NODE) (NodeS | WNDSIZ);
-    NodeQ             = mParent[NodeQ];
-    NodeU             = mPosition[NodeQ];
-  }
+  Return the bit length of a pointer position, the symbol EncodeP() codes.
 
-  if (NodeQ < WNDSIZ) {
-    if (NodeU >= mPos) {
-      NodeU -= WNDSIZ;
-    }
+Arguments:
 
-    if (NodeU > NodeS) {
-      NodeS = NodeU;
-    }
+  Dist        - The pointer position
+
+Returns:
+
+  The number of significant bits in Dist.
+
+--*/
+{
+  UINT32  Bits;
+
+  Bits = 0;
+  while (Dist != 0) {
+    Dist >>= 1;
+    Bits++;
+  }
 
-    mPosition[NodeQ] = (NODE) (NodeS | WNDSIZ | (UINT32) PERC_FLAG);
-  }
-
-  NodeS           = Child (NodeR, mText[NodeT + mLevel[NodeR]]);
-  NodeT           = mPrev[NodeS];
-  NodeU           = mNext[NodeS];
-  mNext[NodeT]    = NodeU;
-  mPrev[NodeU]    = NodeT;
-  NodeT           = mPrev[NodeR];
-  mNext[NodeT]    = NodeS;
-  mPrev[NodeS]    = NodeT;
-  NodeT           = mNext[NodeR];
-  mPrev[NodeT]    = NodeS;
-  mNext[NodeS]    = NodeT;
-  mParent[NodeS]  = mParent[NodeR];
-  mParent[NodeR]  = NIL;
-  mNext[NodeR]    = mAvail;
-  mAvail          = NodeR;
+  return Bits;
 }
 
 STATIC
 VOID
-GetNextMatch (
-  VOID
+OptParse (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
+  IN     UINT32                  Size
   )
 /*++
 
 Routine Description:
 
-  Advance the current position (read in new data if needed).
-  Delete outdated string info. Find a match string for current position.
+  Find the cheapest sequence of characters and pointers for the segment
+  under the current costs, then gather its symbol statistics.
 
-Arguments: (VOID)
+Arguments:
+
+  Size        - Number of bytes in the segment
 
 Returns: (VOID)
 
 --*/
 {
-  INT32 Number;
+  OPT_NODE  *Nodes;
+  OPT_MATCH *Match;
+  UINT32    Index;
+  UINT32    Price;
+  UINT32    Cost;
+  UINT32    PosCost;
+  UINT32    Count;
+  UINT32    Len;
+  UINT32    MatchLen;
+  UINT32    Prev;
+
+  Nodes = Cd->mOptNodes;
+  Nodes[0].Price = 0;
+  for (Index = 1; Index <= Size; Index++) {
+    Nodes[Index].Price = OPT_INFINITY;
+  }
 
-  mRemainder--;
-  mPos++;
-  if (mPos == WNDSIZ * 2) {
-    memmove (&mText[0], &mText[WNDSIZ], WNDSIZ + MAXMATCH);
-    Number = FreadCrc (&mText[WNDSIZ + MAXMATCH], WNDSIZ);
-    mRemainder += Number;
-    mPos = WNDSIZ;
+  for (Index = 0; Index < Size; Index++) {
+    Price = Nodes[Index].Price;
+
+    Cost = Price + Cd->mOptCLen[Cd->mOptText[Index]];
+    if (Cost < Nodes[Index + 1].Price) {
+      Nodes[Index + 1].Price  = Cost;
+      Nodes[Index + 1].Len    = 1;
+      Nodes[Index + 1].Dist   = 0;
+    }
+
+    Len   = THRESHOLD;
+    Match = &Cd->mOptMatches[Index * OPT_MAX_MATCHES];
+    for (Count = Cd->mOptMatchCount[Index]; Count > 0; Count--, Match++) {
+      PosCost   = Cd->mOptPCost[OptPosBits (Match->Dist)];
+      MatchLen  = Match->Len;
+      //
+      // Pricing every length of a long match costs more time than it
+      // saves bits, so lengths beyond OPT_NICE_LEN are only tried whole.
+      //
+      for (; Len <= MatchLen; Len++) {
+        //
+        // Pricing every length of a long match costs more time than it
+        // saves bits, so beyond OPT_NICE_LEN only the whole match is tried.
+        //
+        if (Len > OPT_NICE_LEN && Len < MatchLen) {
+          Len = MatchLen;
+        }
+
+        Cost = Price + Cd->mOptCLen[Len + (UINT8_MAX + 1 - THRESHOLD)] + PosCost;
+        if (Cost < Nodes[Index + Len].Price) {
+          Nodes[Index + Len].Price  = Cost;
+          Nodes[Index + Len].Len    = (UINT16) Len;
+          Nodes[Index + Len].Dist   = Match->Dist;
+        }
+      }
+    }
   }
 
-  DeleteNode ();
-  InsertNode ();
+  //
+  // Link the cheapest path forward and count its symbols
+  //
+  memset (Cd->mOptCFreq, 0, sizeof (Cd->mOptCFreq));
+  memset (Cd->mOptPFreq, 0, sizeof (Cd->mOptPFreq));
+  for (Index = Size; Index > 0; Index = Prev) {
+    Len   = Nodes[Index].Len;
+    Prev  = Index - Len;
+    Nodes[Prev].Next = (UINT16) Index;
+    if (Len == 1) {
+      Cd->mOptCFreq[Cd->mOptText[Prev]]++;
+    } else {
+      Cd->mOptCFreq[Len + (UINT8_MAX + 1 - THRESHOLD)]++;
+      Cd->mOptPFreq[OptPosBits (Nodes[Index].Dist)]++;
+    }
+  }
 }
 
 STATIC
 EFI_STATUS
-Encode (
-  VOID
+EncodeOptimal (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 /*++
 
 Routine Description:
 
-  The main controlling routine for compression process.
+  The controlling routine for CompressLevelOptimal. The input is split in
+  segments; all match candidates of a segment are collected first, then
+  the segment is parsed OPT_PASSES times, each pass pricing symbols with
+  the code lengths the previous pass (or segment) would have produced.
 
 Arguments: (VOID)
 
 Returns:
-  
+
   EFI_SUCCESS           - The compression is successful
-  EFI_OUT_0F_RESOURCES  - Not enough memory for compression process
 
 --*/
 {
-  EFI_STATUS  Status;
-  INT32       LastMatchLen;
-  NODE        LastMatchPos;
-
-  Status = AllocateMemory ();
-  if (EFI_ERROR (Status)) {
-    FreeMemory ();
-    return Status;
-  }
-
-  InitSlide ();
+  UINT32  Size;
+  UINT32  Index;
+  UINT32  Next;
+  UINT32  Pass;
+  INT32   MaxLen;
 
-  HufEncodeStart ();
+  InitSlide (Cd);
 
-  mRemainder  = FreadCrc (&mText[WNDSIZ], WNDSIZ + MAXMATCH);
+  HufEncodeStart (Cd);
 
-  mMatchLen   = 0;
-  mPos        = WNDSIZ;
-  InsertNode ();
-  if (mMatchLen > mRemainder) {
-    mMatchLen = mRemainder;
-  }
+  Cd->mRemainder  = FreadCrc (Cd, &Cd->mText[WNDSIZ], WNDSIZ + MAXMATCH);
+  Cd->mPos        = WNDSIZ;
 
-  while (mRemainder > 0) {
-    LastMatchLen  = mMatchLen;
-    LastMatchPos  = mMatchPos;
-    GetNextMatch ();
-    if (mMatchLen > mRemainder) {
-      mMatchLen = mRemainder;
+  //
+  // Nothing is known before the first segment, start from flat costs
+  //
+  memset (Cd->mOptCFreq, 0, sizeof (Cd->mOptCFreq));
+  memset (Cd->mOptPFreq, 0, sizeof (Cd->mOptPFreq));
+  OptMakeCosts (Cd);
+
+  while (Cd->mRemainder > 0) {
+    Size = Cd->mRemainder < OPT_SEGMENT ? Cd->mRemainder : OPT_SEGMENT;
+
+    for (Index = 0; Index < Size; Index++) {
+      MaxLen = Size - Index < MAXMATCH ? Size - Index : MAXMATCH;
+      Cd->mOptText[Index]       = Cd->mText[Cd->mPos];
+      Cd->mOptMatchCount[Index] = (UINT8) HcFindMatches (
+                                            Cd,
+                                            Cd->mPos,
+                                            MaxLen,
+                                            &Cd->mOptMatches[Index * OPT_MAX_MATCHES]
+                                            );
+      HcInsertNode (Cd, FALSE);
+      AdvancePosition (Cd);
     }
 
-    if (mMatchLen > LastMatchLen || LastMatchLen < THRESHOLD) {
-      //
-      // Not enough benefits are gained by outputting a pointer,
-      // so just output the original character
-      //
-      Output (mText[mPos - 1], 0);
-
-    } else {
-
-      if (LastMatchLen == THRESHOLD) {
-        if (((mPos - LastMatchPos - 2) & (WNDSIZ - 1)) > (1U << 11)) {
-          Output (mText[mPos - 1], 0);
-          continue;
-        }
-      }
-      //
-      // Outputting a pointer is beneficial enough, do it.
-      //
-      Output (
-        LastMatchLen + (UINT8_MAX + 1 - THRESHOLD),
-        (mPos - LastMatchPos - 2) & (WNDSIZ - 1)
-        );
-      LastMatchLen--;
-      while (LastMatchLen > 0) {
-        GetNextMatch ();
-        LastMatchLen--;
-      }
+    for (Pass = 0; Pass < OPT_PASSES; Pass++) {
+      OptParse (Cd, Size);
+      OptMakeCosts (Cd);
+    }
 
-      if (mMatchLen > mRemainder) {
-        mMatchLen = mRemainder;
+    for (Index = 0; Index < Size; Index = Next) {
+      Next = Cd->mOptNodes[Index].Next;
+      if (Next - Index == 1) {
+        Output (Cd, Cd->mOptText[Index], 0);
+      } else {
+        Output (
+          Cd,
+          Next - Index + (UINT8_MAX + 1 - THRESHOLD),
+          Cd->mOptNodes[Next].Dist
+          );
       }
     }
   }
 
-  HufEncodeEnd ();
-  FreeMemory ();
+  HufEncodeEnd (Cd);
   return EFI_SUCCESS;
 }
 
 STATIC
 VOID
 CountTFreq (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 /*++
 
@@ -1026,36 +2063,36 @@ Returns: (VOID)
   INT32 Count;
 
   for (Index = 0; Index < NT; Index++) {
-    mTFreq[Index] = 0;
+    Cd->mTFreq[Index] = 0;
   }
 
   Number = NC;
-  while (Number > 0 && mCLen[Number - 1] == 0) {
+  while (Number > 0 && Cd->mCLen[Number - 1] == 0) {
     Number--;
   }
 
   Index = 0;
   while (Index < Number) {
-    Index3 = mCLen[Index++];
+    Index3 = Cd->mCLen[Index++];
     if (Index3 == 0) {
       Count = 1;
-      while (Index < Number && mCLen[Index] == 0) {
+      while (Index < Number && Cd->mCLen[Index] == 0) {
         Index++;
         Count++;
       }
 
       if (Count <= 2) {
-        mTFreq[0] = (UINT16) (mTFreq[0] + Count);
+        Cd->mTFreq[0] = (UINT16) (Cd->mTFreq[0] + Count);
       } else if (Count <= 18) {
-        mTFreq[1]++;
+        Cd->mTFreq[1]++;
       } else if (Count == 19) {
-        mTFreq[0]++;
-        mTFreq[1]++;
+        Cd->mTFreq[0]++;
+        Cd->mTFreq[1]++;
       } else {
-        mTFreq[2]++;
+        Cd->mTFreq[2]++;
       }
     } else {
-      mTFreq[Index3 + 2]++;
+      Cd->mTFreq[Index3 + 2]++;
     }
   }
 }
@@ -1063,6 +2100,7 @@ Returns: (VOID)
 STATIC
 VOID
 WritePTLen (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN INT32 Number,
   IN INT32 nbit,
   IN INT32 Special
@@ -1086,26 +2124,26 @@ Returns: (VOID)
   INT32 Index;
   INT32 Index3;
 
-  while (Number > 0 && mPTLen[Number - 1] == 0) {
+  while (Number > 0 && Cd->mPTLen[Number - 1] == 0) {
     Number--;
   }
 
-  PutBits (nbit, Number);
+  PutBits (Cd, nbit, Number);
   Index = 0;
   while (Index < Number) {
-    Index3 = mPTLen[Index++];
+    Index3 = Cd->mPTLen[Index++];
     if (Index3 <= 6) {
-      PutBits (3, Index3);
+      PutBits (Cd, 3, Index3);
     } else {
-      PutBits (Index3 - 3, (1U << (Index3 - 3)) - 2);
+      PutBits (Cd, Index3 - 3, (1U << (Index3 - 3)) - 2);
     }
 
     if (Index == Special) {
-      while (Index < 6 && mPTLen[Index] == 0) {
+      while (Index < 6 && Cd->mPTLen[Index] == 0) {
         Index++;
       }
 
-      PutBits (2, (Index - 3) & 3);
+      PutBits (Cd, 2, (Index - 3) & 3);
     }
   }
 }
@@ -1113,7 +2151,7 @@ Returns: (VOID)
 STATIC
 VOID
 WriteCLen (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 /*++
 
@@ -1133,38 +2171,38 @@ Returns: (VOID)
   INT32 Count;
 
   Number = NC;
-  while (Number > 0 && mCLen[Number - 1] == 0) {
+  while (Number > 0 && Cd->mCLen[Number - 1] == 0) {
     Number--;
   }
 
-  PutBits (CBIT, Number);
+  PutBits (Cd, CBIT, Number);
   Index = 0;
   while (Index < Number) {
-    Index3 = mCLen[Index++];
+    Index3 = Cd->mCLen[Index++];
     if (Index3 == 0) {
       Count = 1;
-      while (Index < Number && mCLen[Index] == 0) {
+      while (Index < Number && Cd->mCLen[Index] == 0) {
         Index++;
         Count++;
       }
 
       if (Count <= 2) {
         for (Index3 = 0; Index3 < Count; Index3++) {
-          PutBits (mPTLen[0], mPTCode[0]);
+          PutBits (Cd, Cd->mPTLen[0], Cd->mPTCode[0]);
         }
       } else if (Count <= 18) {
-        PutBits (mPTLen[1], mPTCode[1]);
-        PutBits (4, Count - 3);
+        PutBits (Cd, Cd->mPTLen[1], Cd->mPTCode[1]);
+        PutBits (Cd, 4, Count - 3);
       } else if (Count == 19) {
-        PutBits (mPTLen[0], mPTCode[0]);
-        PutBits (mPTLen[1], mPTCode[1]);
-        PutBits (4, 15);
+        PutBits (Cd, Cd->mPTLen[0], Cd->mPTCode[0]);
+        PutBits (Cd, Cd->mPTLen[1], Cd->mPTCode[1]);
+        PutBits (Cd, 4, 15);
       } else {
-        PutBits (mPTLen[2], mPTCode[2]);
-        PutBits (CBIT, Count - 20);
+        PutBits (Cd, Cd->mPTLen[2], Cd->mPTCode[2]);
+        PutBits (Cd, CBIT, Count - 20);
       }
     } else {
-      PutBits (mPTLen[Index3 + 2], mPTCode[Index3 + 2]);
+      PutBits (Cd, Cd->mPTLen[Index3 + 2], Cd->mPTCode[Index3 + 2]);
     }
   }
 }
@@ -1172,15 +2210,17 @@ Returns: (VOID)
 STATIC
 VOID
 EncodeC (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN INT32 Value
   )
 {
-  PutBits (mCLen[Value], mCCode[Value]);
+  PutBits (Cd, Cd->mCLen[Value], Cd->mCCode[Value]);
 }
 
 STATIC
 VOID
 EncodeP (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN UINT32 Value
   )
 {
@@ -1194,16 +2234,16 @@ EncodeP (
     Index++;
   }
 
-  PutBits (mPTLen[Index], mPTCode[Index]);
+  PutBits (Cd, Cd->mPTLen[Index], Cd->mPTCode[Index]);
   if (Index > 1) {
-    PutBits (Index - 1, Value & (0xFFFFFFFFU >> (32 - Index + 1)));
+    PutBits (Cd, Index - 1, Value & (0xFFFFFFFFU >> (32 - Index + 1)));
   }
 }
 
 STATIC
 VOID
 SendBlock (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 /*++
 
@@ -1228,69 +2268,70 @@ Returns:
   UINT32  Size;
   Flags = 0;
 
-  Root  = MakeTree (NC, mCFreq, mCLen, mCCode);
-  Size  = mCFreq[Root];
-  PutBits (16, Size);
+  Root  = MakeTree (Cd, NC, Cd->mCFreq, Cd->mCLen, Cd->mCCode);
+  Size  = Cd->mCFreq[Root];
+  PutBits (Cd, 16, Size);
   if (Root >= NC) {
-    CountTFreq ();
-    Root = MakeTree (NT, mTFreq, mPTLen, mPTCode);
+    CountTFreq (Cd);
+    Root = MakeTree (Cd, NT, Cd->mTFreq, Cd->mPTLen, Cd->mPTCode);
     if (Root >= NT) {
-      WritePTLen (NT, TBIT, 3);
+      WritePTLen (Cd, NT, TBIT, 3);
     } else {
-      PutBits (TBIT, 0);
-      PutBits (TBIT, Root);
+      PutBits (Cd, TBIT, 0);
+      PutBits (Cd, TBIT, Root);
     }
 
-    WriteCLen ();
+    WriteCLen (Cd);
   } else {
-    PutBits (TBIT, 0);
-    PutBits (TBIT, 0);
-    PutBits (CBIT, 0);
-    PutBits (CBIT, Root);
+    PutBits (Cd, TBIT, 0);
+    PutBits (Cd, TBIT, 0);
+    PutBits (Cd, CBIT, 0);
+    PutBits (Cd, CBIT, Root);
   }
 
-  Root = MakeTree (NP, mPFreq, mPTLen, mPTCode);
+  Root = MakeTree (Cd, NP, Cd->mPFreq, Cd->mPTLen, Cd->mPTCode);
   if (Root >= NP) {
-    WritePTLen (NP, PBIT, -1);
+    WritePTLen (Cd, NP, PBIT, -1);
   } else {
-    PutBits (PBIT, 0);
-    PutBits (PBIT, Root);
+    PutBits (Cd, PBIT, 0);
+    PutBits (Cd, PBIT, Root);
   }
 
   Pos = 0;
   for (Index = 0; Index < Size; Index++) {
     if (Index % UINT8_BIT == 0) {
-      Flags = mBuf[Pos++];
+      Flags = Cd->mBuf[Pos++];
     } else {
       Flags <<= 1;
     }
 
     if (Flags & (1U << (UINT8_BIT - 1))) {
-      EncodeC (mBuf[Pos++] + (1U << UINT8_BIT));
-      Index3 = mBuf[Pos++];
+      EncodeC (Cd, Cd->mBuf[Pos++] + (1U << UINT8_BIT));
+      Index3 = Cd->mBuf[Pos++];
       for (Index2 = 0; Index2 < 3; Index2++) {
         Index3 <<= UINT8_BIT;
-        Index3 += mBuf[Pos++];
+        Index3 += Cd->mBuf[Pos++];
       }
 
-      EncodeP (Index3);
+      EncodeP (Cd, Index3);
     } else {
-      EncodeC (mBuf[Pos++]);
+      EncodeC (Cd, Cd->mBuf[Pos++]);
     }
   }
 
   for (Index = 0; Index < NC; Index++) {
-    mCFreq[Index] = 0;
+    Cd->mCFreq[Index] = 0;
   }
 
   for (Index = 0; Index < NP; Index++) {
-    mPFreq[Index] = 0;
+    Cd->mPFreq[Index] = 0;
   }
 }
 
 STATIC
 VOID
 Output (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN UINT32 CharC,
   IN UINT32 Pos
   )
@@ -1309,75 +2350,73 @@ Returns: (VOID)
 
 --*/
 {
-  STATIC UINT32 CPos;
-
-  if ((mOutputMask >>= 1) == 0) {
-    mOutputMask = 1U << (UINT8_BIT - 1);
+  if ((Cd->mOutputMask >>= 1) == 0) {
+    Cd->mOutputMask = 1U << (UINT8_BIT - 1);
     //
     // Check the buffer overflow per outputing UINT8_BIT symbols
     // which is an Original Character or a Pointer. The biggest
     // symbol is a Pointer which occupies 5 bytes.
     //
-    if (mOutputPos >= mBufSiz - 5 * UINT8_BIT) {
-      SendBlock ();
-      mOutputPos = 0;
+    if (Cd->mOutputPos >= Cd->mBufSiz - 5 * UINT8_BIT) {
+      SendBlock (Cd);
+      Cd->mOutputPos = 0;
     }
 
-    CPos        = mOutputPos++;
-    mBuf[CPos]  = 0;
+    Cd->mCPos           = Cd->mOutputPos++;
+    Cd->mBuf[Cd->mCPos] = 0;
   }
 
-  mBuf[mOutputPos++] = (UINT8) CharC;
-  mCFreq[CharC]++;
+  Cd->mBuf[Cd->mOutputPos++] = (UINT8) CharC;
+  Cd->mCFreq[CharC]++;
   if (CharC >= (1U << UINT8_BIT)) {
-    mBuf[CPos] |= mOutputMask;
-    mBuf[mOutputPos++]  = (UINT8) (Pos >> 24);
-    mBuf[mOutputPos++]  = (UINT8) (Pos >> 16);
-    mBuf[mOutputPos++]  = (UINT8) (Pos >> (UINT8_BIT));
-    mBuf[mOutputPos++]  = (UINT8) Pos;
+    Cd->mBuf[Cd->mCPos] |= Cd->mOutputMask;
+    Cd->mBuf[Cd->mOutputPos++]  = (UINT8) (Pos >> 24);
+    Cd->mBuf[Cd->mOutputPos++]  = (UINT8) (Pos >> 16);
+    Cd->mBuf[Cd->mOutputPos++]  = (UINT8) (Pos >> (UINT8_BIT));
+    Cd->mBuf[Cd->mOutputPos++]  = (UINT8) Pos;
     CharC               = 0;
     while (Pos) {
       Pos >>= 1;
       CharC++;
     }
 
-    mPFreq[CharC]++;
+    Cd->mPFreq[CharC]++;
   }
 }
 
 STATIC
 VOID
 HufEncodeStart (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 {
   INT32 Index;
 
   for (Index = 0; Index < NC; Index++) {
-    mCFreq[Index] = 0;
+    Cd->mCFreq[Index] = 0;
   }
 
   for (Index = 0; Index < NP; Index++) {
-    mPFreq[Index] = 0;
+    Cd->mPFreq[Index] = 0;
   }
 
-  mOutputPos = mOutputMask = 0;
-  InitPutBits ();
+  Cd->mOutputPos = Cd->mOutputMask = 0;
+  InitPutBits (Cd);
   return ;
 }
 
 STATIC
 VOID
 HufEncodeEnd (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 {
-  SendBlock ();
+  SendBlock (Cd);
 
   //
   // Flush remaining bits
   //
-  PutBits (UINT8_BIT - 1, 0);
+  PutBits (Cd, UINT8_BIT - 1, 0);
 
   return ;
 }
@@ -1385,7 +2424,7 @@ HufEncodeEnd (
 STATIC
 VOID
 MakeCrcTable (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 {
   UINT32  Index;
@@ -1402,13 +2441,14 @@ MakeCrcTable (
       }
     }
 
-    mCrcTable[Index] = (UINT16) Temp;
+    Cd->mCrcTable[Index] = (UINT16) Temp;
   }
 }
 
 STATIC
 VOID
 PutBits (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN INT32  Number,
   IN UINT32 Value
   )
@@ -1429,26 +2469,27 @@ Returns: (VOID)
 {
   UINT8 Temp;
 
-  while (Number >= mBitCount) {
+  while (Number >= Cd->mBitCount) {
     //
-    // Number -= mBitCount should never equal to 32
+    // Number -= Cd->mBitCount should never equal to 32
     //
-    Temp = (UINT8) (mSubBitBuf | (Value >> (Number -= mBitCount)));
-    if (mDst < mDstUpperLimit) {
-      *mDst++ = Temp;
+    Temp = (UINT8) (Cd->mSubBitBuf | (Value >> (Number -= Cd->mBitCount)));
+    if (Cd->mDst < Cd->mDstUpperLimit) {
+      *Cd->mDst++ = Temp;
     }
 
-    mCompSize++;
-    mSubBitBuf  = 0;
-    mBitCount   = UINT8_BIT;
+    Cd->mCompSize++;
+    Cd->mSubBitBuf  = 0;
+    Cd->mBitCount   = UINT8_BIT;
   }
 
-  mSubBitBuf |= Value << (mBitCount -= Number);
+  Cd->mSubBitBuf |= Value << (Cd->mBitCount -= Number);
 }
 
 STATIC
 INT32
 FreadCrc (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   OUT UINT8 *Pointer,
   IN  INT32 Number
   )
@@ -1471,17 +2512,17 @@ Returns:
 {
   INT32 Index;
 
-  for (Index = 0; mSrc < mSrcUpperLimit && Index < Number; Index++) {
-    *Pointer++ = *mSrc++;
+  for (Index = 0; Cd->mSrc < Cd->mSrcUpperLimit && Index < Number; Index++) {
+    *Pointer++ = *Cd->mSrc++;
   }
 
   Number = Index;
 
   Pointer -= Number;
-  mOrigSize += Number;
+  Cd->mOrigSize += Number;
   Index--;
   while (Index >= 0) {
-    UPDATE_CRC (*Pointer++);
+    UPDATE_CRC (Cd, *Pointer++);
     Index--;
   }
 
@@ -1491,16 +2532,17 @@ Returns:
 STATIC
 VOID
 InitPutBits (
-  VOID
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd
   )
 {
-  mBitCount   = UINT8_BIT;
-  mSubBitBuf  = 0;
+  Cd->mBitCount   = UINT8_BIT;
+  Cd->mSubBitBuf  = 0;
 }
 
 STATIC
 VOID
 CountLen (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN INT32 Index
   )
 /*++
@@ -1517,21 +2559,20 @@ Returns: (VOID)
 
 --*/
 {
-  STATIC INT32  Depth = 0;
-
-  if (Index < mN) {
-    mLenCnt[(Depth < 16) ? Depth : 16]++;
+  if (Index < Cd->mN) {
+    Cd->mLenCnt[(Cd->mDepth < 16) ? Cd->mDepth : 16]++;
   } else {
-    Depth++;
-    CountLen (mLeft[Index]);
-    CountLen (mRight[Index]);
-    Depth--;
+    Cd->mDepth++;
+    CountLen (Cd, Cd->mLeft[Index]);
+    CountLen (Cd, Cd->mRight[Index]);
+    Cd->mDepth--;
   }
 }
 
 STATIC
 VOID
 MakeLen (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN INT32 Root
   )
 /*++
@@ -1555,10 +2596,10 @@ Returns:
   UINT32  Cum;
 
   for (Index = 0; Index <= 16; Index++) {
-    mLenCnt[Index] = 0;
+    Cd->mLenCnt[Index] = 0;
   }
 
-  CountLen (Root);
+  CountLen (Cd, Root);
 
   //
   // Adjust the length count array so that
@@ -1566,15 +2607,15 @@ Returns:
   //
   Cum = 0;
   for (Index = 16; Index > 0; Index--) {
-    Cum += mLenCnt[Index] << (16 - Index);
+    Cum += Cd->mLenCnt[Index] << (16 - Index);
   }
 
   while (Cum != (1U << 16)) {
-    mLenCnt[16]--;
+    Cd->mLenCnt[16]--;
     for (Index = 15; Index > 0; Index--) {
-      if (mLenCnt[Index] != 0) {
-        mLenCnt[Index]--;
-        mLenCnt[Index + 1] += 2;
+      if (Cd->mLenCnt[Index] != 0) {
+        Cd->mLenCnt[Index]--;
+        Cd->mLenCnt[Index + 1] += 2;
         break;
       }
     }
@@ -1583,10 +2624,10 @@ Returns:
   }
 
   for (Index = 16; Index > 0; Index--) {
-    Index3 = mLenCnt[Index];
+    Index3 = Cd->mLenCnt[Index];
     Index3--;
     while (Index3 >= 0) {
-      mLen[*mSortPtr++] = (UINT8) Index;
+      Cd->mLen[*Cd->mSortPtr++] = (UINT8) Index;
       Index3--;
     }
   }
@@ -1595,6 +2636,7 @@ Returns:
 STATIC
 VOID
 DownHeap (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN INT32 Index
   )
 {
@@ -1604,28 +2646,29 @@ DownHeap (
   //
   // priority queue: send Index-th entry down heap
   //
-  Index3  = mHeap[Index];
+  Index3  = Cd->mHeap[Index];
   Index2  = 2 * Index;
-  while (Index2 <= mHeapSize) {
-    if (Index2 < mHeapSize && mFreq[mHeap[Index2]] > mFreq[mHeap[Index2 + 1]]) {
+  while (Index2 <= Cd->mHeapSize) {
+    if (Index2 < Cd->mHeapSize && Cd->mFreq[Cd->mHeap[Index2]] > Cd->mFreq[Cd->mHeap[Index2 + 1]]) {
       Index2++;
     }
 
-    if (mFreq[Index3] <= mFreq[mHeap[Index2]]) {
+    if (Cd->mFreq[Index3] <= Cd->mFreq[Cd->mHeap[Index2]]) {
       break;
     }
 
-    mHeap[Index]  = mHeap[Index2];
+    Cd->mHeap[Index]  = Cd->mHeap[Index2];
     Index         = Index2;
     Index2        = 2 * Index;
   }
 
-  mHeap[Index] = (INT16) Index3;
+  Cd->mHeap[Index] = (INT16) Index3;
 }
 
 STATIC
 VOID
 MakeCode (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN  INT32       Number,
   IN  UINT8 Len[  ],
   OUT UINT16 Code[]
@@ -1651,7 +2694,7 @@ Returns: (VOID)
 
   Start[1] = 0;
   for (Index = 1; Index <= 16; Index++) {
-    Start[Index + 1] = (UINT16) ((Start[Index] + mLenCnt[Index]) << 1);
+    Start[Index + 1] = (UINT16) ((Start[Index] + Cd->mLenCnt[Index]) << 1);
   }
 
   for (Index = 0; Index < Number; Index++) {
@@ -1662,6 +2705,7 @@ Returns: (VOID)
 STATIC
 INT32
 MakeTree (
+  IN OUT TIANO_COMPRESS_CONTEXT  *Cd,
   IN  INT32            NParm,
   IN  UINT16  FreqParm[],
   OUT UINT8   LenParm[ ],
@@ -1694,57 +2738,57 @@ Returns:
   //
   // make tree, calculate len[], return root
   //
-  mN        = NParm;
-  mFreq     = FreqParm;
-  mLen      = LenParm;
-  Avail     = mN;
-  mHeapSize = 0;
-  mHeap[1]  = 0;
-  for (Index = 0; Index < mN; Index++) {
-    mLen[Index] = 0;
-    if (mFreq[Index]) {
-      mHeapSize++;
-      mHeap[mHeapSize] = (INT16) Index;
+  Cd->mN        = NParm;
+  Cd->mFreq     = FreqParm;
+  Cd->mLen      = LenParm;
+  Avail     = Cd->mN;
+  Cd->mHeapSize = 0;
+  Cd->mHeap[1]  = 0;
+  for (Index = 0; Index < Cd->mN; Index++) {
+    Cd->mLen[Index] = 0;
+    if (Cd->mFreq[Index]) {
+      Cd->mHeapSize++;
+      Cd->mHeap[Cd->mHeapSize] = (INT16) Index;
     }
   }
 
-  if (mHeapSize < 2) {
-    CodeParm[mHeap[1]] = 0;
-    return mHeap[1];
+  if (Cd->mHeapSize < 2) {
+    CodeParm[Cd->mHeap[1]] = 0;
+    return Cd->mHeap[1];
   }
 
-  for (Index = mHeapSize / 2; Index >= 1; Index--) {
+  for (Index = Cd->mHeapSize / 2; Index >= 1; Index--) {
     //
     // make priority queue
     //
-    DownHeap (Index);
+    DownHeap (Cd, Index);
   }
 
-  mSortPtr = CodeParm;
+  Cd->mSortPtr = CodeParm;
   do {
-    Index = mHeap[1];
-    if (Index < mN) {
-      *mSortPtr++ = (UINT16) Index;
+    Index = Cd->mHeap[1];
+    if (Index < Cd->mN) {
+      *Cd->mSortPtr++ = (UINT16) Index;
     }
 
-    mHeap[1] = mHeap[mHeapSize--];
-    DownHeap (1);
-    Index2 = mHeap[1];
-    if (Index2 < mN) {
-      *mSortPtr++ = (UINT16) Index2;
+    Cd->mHeap[1] = Cd->mHeap[Cd->mHeapSize--];
+    DownHeap (Cd, 1);
+    Index2 = Cd->mHeap[1];
+    if (Index2 < Cd->mN) {
+      *Cd->mSortPtr++ = (UINT16) Index2;
     }
 
     Index3        = Avail++;
-    mFreq[Index3] = (UINT16) (mFreq[Index] + mFreq[Index2]);
-    mHeap[1]      = (INT16) Index3;
-    DownHeap (1);
-    mLeft[Index3]   = (UINT16) Index;
-    mRight[Index3]  = (UINT16) Index2;
-  } while (mHeapSize > 1);
-
-  mSortPtr = CodeParm;
-  MakeLen (Index3);
-  MakeCode (NParm, LenParm, CodeParm);
+    Cd->mFreq[Index3] = (UINT16) (Cd->mFreq[Index] + Cd->mFreq[Index2]);
+    Cd->mHeap[1]      = (INT16) Index3;
+    DownHeap (Cd, 1);
+    Cd->mLeft[Index3]   = (UINT16) Index;
+    Cd->mRight[Index3]  = (UINT16) Index2;
+  } while (Cd->mHeapSize > 1);
+
+  Cd->mSortPtr = CodeParm;
+  MakeLen (Cd, Index3);
+  MakeCode (Cd, NParm, LenParm, CodeParm);
 
   //
   // return root
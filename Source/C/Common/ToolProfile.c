@@ -0,0 +1,733 @@
+/** @file
+
+Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+This program and the accompanying materials
+are licensed and made available under the terms and conditions of the BSD License
+which accompanies this distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+Module Name:
+
+  ToolProfile.c
+
+Abstract:
+
+  Phase level profile of a tool run, written as JSON. See ToolProfile.h for
+  the format.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <time.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+#include "ToolProfile.h"
+
+#ifdef _MSC_VER
+#define PROFILE_THREAD_LOCAL  __declspec(thread)
+#else
+#define PROFILE_THREAD_LOCAL  __thread
+#endif
+
+#define PROFILE_INITIAL_RECORDS   256
+
+typedef struct {
+  CHAR8     *Name;
+  CHAR8     *Item;
+  UINTN     Parent;
+  UINTN     Previous;
+  BOOLEAN   Ended;
+  UINT64    StartUs;
+  UINT64    WallUs;
+  UINT64    ThreadCpuUs;
+  UINT64    ProcessCpuUs;
+  UINT64    BytesRead;
+  UINT64    BytesWritten;
+  UINT64    StartPeakKb;
+  UINT64    PeakKb;
+} PROFILE_RECORD;
+
+STATIC BOOLEAN          mProfileEnabled = FALSE;
+STATIC CHAR8            *mProfileToolName = NULL;
+STATIC CHAR8            *mProfileFileName = NULL;
+STATIC UINT64           mProfileStartUs;
+STATIC UINT64           mProfileStartCpuUs;
+STATIC PROFILE_RECORD   *mProfileRecords = NULL;
+STATIC UINTN            mProfileRecordNumber = 0;
+STATIC UINTN            mProfileMaxRecordNumber = 0;
+STATIC UINT64           mProfileOtherBytesRead;
+STATIC UINT64           mProfileOtherBytesWritten;
+
+//
+// The records are shared by all the threads, the current record is per
+// thread.
+//
+STATIC PROFILE_THREAD_LOCAL UINTN  mProfileCurrent = PROFILE_NO_RECORD;
+
+#ifdef _WIN32
+STATIC CRITICAL_SECTION  mProfileLock;
+#define PROFILE_LOCK()    EnterCriticalSection (&mProfileLock)
+#define PROFILE_UNLOCK()  LeaveCriticalSection (&mProfileLock)
+#else
+STATIC pthread_mutex_t   mProfileLock = PTHREAD_MUTEX_INITIALIZER;
+#define PROFILE_LOCK()    pthread_mutex_lock (&mProfileLock)
+#define PROFILE_UNLOCK()  pthread_mutex_unlock (&mProfileLock)
+#endif
+
+STATIC
+UINT64
+ProfileGetWallTime (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Read a monotonic clock.
+
+Arguments:
+
+  None
+
+Returns:
+
+  The current time in microseconds from an arbitrary origin.
+
+--*/
+{
+#ifdef _WIN32
+  LARGE_INTEGER  Counter;
+  LARGE_INTEGER  Frequency;
+
+  QueryPerformanceCounter (&Counter);
+  QueryPerformanceFrequency (&Frequency);
+  return (UINT64) (Counter.QuadPart / (Frequency.QuadPart / 1000000));
+#else
+  struct timespec  Time;
+
+  clock_gettime (CLOCK_MONOTONIC, &Time);
+  return (UINT64) Time.tv_sec * 1000000 + (UINT64) Time.tv_nsec / 1000;
+#endif
+}
+
+STATIC
+UINT64
+ProfileGetCpuTime (
+  IN BOOLEAN    Thread
+  )
+/*++
+
+Routine Description:
+
+  Read the CPU time used by the calling thread or by the whole process.
+  Hosts without a per thread clock report the process time for both.
+
+Arguments:
+
+  Thread      - TRUE for the calling thread, FALSE for the process.
+
+Returns:
+
+  The user and system CPU time in microseconds.
+
+--*/
+{
+#ifdef _WIN32
+  FILETIME  Creation;
+  FILETIME  Exit;
+  FILETIME  Kernel;
+  FILETIME  User;
+  BOOL      Result;
+
+  if (Thread) {
+    Result = GetThreadTimes (GetCurrentThread (), &Creation, &Exit, &Kernel, &User);
+  } else {
+    Result = GetProcessTimes (GetCurrentProcess (), &Creation, &Exit, &Kernel, &User);
+  }
+  if (!Result) {
+    return 0;
+  }
+  return ((((UINT64) Kernel.dwHighDateTime << 32) | Kernel.dwLowDateTime) +
+          (((UINT64) User.dwHighDateTime << 32) | User.dwLowDateTime)) / 10;
+#else
+  struct timespec  Time;
+  clockid_t        Clock;
+
+  Clock = CLOCK_PROCESS_CPUTIME_ID;
+#ifdef CLOCK_THREAD_CPUTIME_ID
+  if (Thread) {
+    Clock = CLOCK_THREAD_CPUTIME_ID;
+  }
+#endif
+  if (clock_gettime (Clock, &Time) != 0) {
+    return 0;
+  }
+  return (UINT64) Time.tv_sec * 1000000 + (UINT64) Time.tv_nsec / 1000;
+#endif
+}
+
+STATIC
+UINT64
+ProfileGetPeakMemoryKb (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Read the peak resident memory of this process.
+
+Arguments:
+
+  None
+
+Returns:
+
+  The peak resident memory in KB, 0 if the host does not report it.
+
+--*/
+{
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS  Counters;
+
+  if (!GetProcessMemoryInfo (GetCurrentProcess (), &Counters, sizeof (Counters))) {
+    return 0;
+  }
+  return (UINT64) Counters.PeakWorkingSetSize / 1024;
+#else
+  struct rusage  Usage;
+
+  if (getrusage (RUSAGE_SELF, &Usage) != 0) {
+    return 0;
+  }
+#ifdef __APPLE__
+  return (UINT64) Usage.ru_maxrss / 1024;
+#else
+  return (UINT64) Usage.ru_maxrss;
+#endif
+#endif
+}
+
+STATIC
+CHAR8 *
+ProfileCopyString (
+  IN CHAR8          *String
+  )
+/*++
+
+Routine Description:
+
+  Duplicate a string, the records outlive the strings passed by the tool.
+
+Arguments:
+
+  String      - The string, or NULL.
+
+Returns:
+
+  The copy, NULL if String is NULL or no memory is left.
+
+--*/
+{
+  CHAR8   *Copy;
+
+  if (String == NULL) {
+    return NULL;
+  }
+  Copy = (CHAR8 *) malloc (strlen (String) + 1);
+  if (Copy != NULL) {
+    strcpy (Copy, String);
+  }
+  return Copy;
+}
+
+STATIC
+VOID
+ProfileStopRecord (
+  IN PROFILE_RECORD   *Record,
+  IN UINT64           ThreadCpuUs
+  )
+/*++
+
+Routine Description:
+
+  Complete the measures of a record. Called with the lock held.
+
+Arguments:
+
+  Record        - The record.
+  ThreadCpuUs   - CPU time of the thread that ran the record.
+
+Returns:
+
+  None
+
+--*/
+{
+  Record->WallUs        = ProfileGetWallTime () - mProfileStartUs - Record->StartUs;
+  Record->ThreadCpuUs   = ThreadCpuUs - Record->ThreadCpuUs;
+  Record->ProcessCpuUs  = ProfileGetCpuTime (FALSE) - Record->ProcessCpuUs;
+  Record->PeakKb        = ProfileGetPeakMemoryKb ();
+  Record->Ended         = TRUE;
+}
+
+STATIC
+VOID
+ProfileWriteString (
+  IN FILE           *File,
+  IN CHAR8          *String
+  )
+/*++
+
+Routine Description:
+
+  Write a string as a JSON string value.
+
+Arguments:
+
+  File        - The profile file.
+  String      - The string, NULL is written as null.
+
+Returns:
+
+  None
+
+--*/
+{
+  if (String == NULL) {
+    fputs ("null", File);
+    return;
+  }
+  fputc ('"', File);
+  for (; *String != '\0'; String++) {
+    if (*String == '"' || *String == '\\') {
+      fputc ('\\', File);
+      fputc (*String, File);
+    } else if ((UINT8) *String < 0x20) {
+      fprintf (File, "\\u%04x", (unsigned) (UINT8) *String);
+    } else {
+      fputc (*String, File);
+    }
+  }
+  fputc ('"', File);
+}
+
+EFI_STATUS
+ProfileOpen (
+  IN CHAR8          *ToolName,
+  IN CHAR8          *FileName
+  )
+/*++
+
+Routine Description:
+
+  Start profiling the tool. Records are kept in memory until ProfileClose.
+  Must be called before the tool starts any thread.
+
+Arguments:
+
+  ToolName    - Name of the tool, recorded in the profile.
+  FileName    - Name of the JSON file written by ProfileClose.
+
+Returns:
+
+  EFI_SUCCESS               - Profiling is enabled.
+  EFI_OUT_OF_RESOURCES      - No resource to keep the profile.
+
+--*/
+{
+  if (mProfileEnabled) {
+    return EFI_SUCCESS;
+  }
+
+  mProfileToolName        = ProfileCopyString (ToolName);
+  mProfileFileName        = ProfileCopyString (FileName);
+  mProfileRecords         = (PROFILE_RECORD *) malloc (PROFILE_INITIAL_RECORDS * sizeof (PROFILE_RECORD));
+  if (mProfileToolName == NULL || mProfileFileName == NULL || mProfileRecords == NULL) {
+    free (mProfileToolName);
+    free (mProfileFileName);
+    free (mProfileRecords);
+    mProfileToolName = NULL;
+    mProfileFileName = NULL;
+    mProfileRecords  = NULL;
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+#ifdef _WIN32
+  InitializeCriticalSection (&mProfileLock);
+#endif
+  mProfileRecordNumber      = 0;
+  mProfileMaxRecordNumber   = PROFILE_INITIAL_RECORDS;
+  mProfileOtherBytesRead    = 0;
+  mProfileOtherBytesWritten = 0;
+  mProfileCurrent           = PROFILE_NO_RECORD;
+  mProfileStartCpuUs        = ProfileGetCpuTime (FALSE);
+  mProfileStartUs           = ProfileGetWallTime ();
+  mProfileEnabled           = TRUE;
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+ProfileClose (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Write the profile file and stop profiling. Records that were not ended
+  are written with the time measured so far. Must be called once all the
+  threads of the tool are done.
+
+Arguments:
+
+  None
+
+Returns:
+
+  EFI_SUCCESS               - The profile was written, or none is open.
+  EFI_ABORTED               - The profile file could not be written.
+
+--*/
+{
+  FILE            *File;
+  PROFILE_RECORD  *Record;
+  UINTN           Index;
+  UINT64          WallUs;
+  UINT64          CpuUs;
+  UINT64          BytesRead;
+  UINT64          BytesWritten;
+  EFI_STATUS      Status;
+
+  if (!mProfileEnabled) {
+    return EFI_SUCCESS;
+  }
+
+  WallUs       = ProfileGetWallTime () - mProfileStartUs;
+  CpuUs        = ProfileGetCpuTime (FALSE) - mProfileStartCpuUs;
+  BytesRead    = mProfileOtherBytesRead;
+  BytesWritten = mProfileOtherBytesWritten;
+  for (Index = 0; Index < mProfileRecordNumber; Index++) {
+    Record = &mProfileRecords[Index];
+    if (!Record->Ended) {
+      ProfileStopRecord (Record, ProfileGetCpuTime (TRUE));
+    }
+    if (Record->Parent == PROFILE_NO_RECORD) {
+      BytesRead    += Record->BytesRead;
+      BytesWritten += Record->BytesWritten;
+    }
+  }
+
+  Status = EFI_SUCCESS;
+  File   = fopen (mProfileFileName, "w");
+  if (File == NULL) {
+    Status = EFI_ABORTED;
+  } else {
+    fputs ("{\n  \"tool\": ", File);
+    ProfileWriteString (File, mProfileToolName);
+    fprintf (File, ", \"format\": %u,\n", (unsigned) PROFILE_FORMAT_VERSION);
+    fprintf (
+      File,
+      "  \"wall_us\": %llu, \"cpu_us\": %llu, \"peak_rss_kb\": %llu,\n",
+      (unsigned long long) WallUs,
+      (unsigned long long) CpuUs,
+      (unsigned long long) ProfileGetPeakMemoryKb ()
+      );
+    fprintf (
+      File,
+      "  \"bytes_read\": %llu, \"bytes_written\": %llu,\n",
+      (unsigned long long) BytesRead,
+      (unsigned long long) BytesWritten
+      );
+    fputs ("  \"records\": [", File);
+    for (Index = 0; Index < mProfileRecordNumber; Index++) {
+      Record = &mProfileRecords[Index];
+      fprintf (File, "%s\n    {\"id\": %u, \"parent\": ", Index == 0 ? "" : ",", (unsigned) Index);
+      if (Record->Parent == PROFILE_NO_RECORD) {
+        fputs ("null", File);
+      } else {
+        fprintf (File, "%u", (unsigned) Record->Parent);
+      }
+      fputs (", \"name\": ", File);
+      ProfileWriteString (File, Record->Name);
+      fputs (", \"item\": ", File);
+      ProfileWriteString (File, Record->Item);
+      fprintf (
+        File,
+        ", \"start_us\": %llu, \"wall_us\": %llu, \"cpu_us\": %llu, \"process_cpu_us\": %llu"
+        ", \"bytes_read\": %llu, \"bytes_written\": %llu, \"peak_rss_kb\": %llu, \"peak_rss_growth_kb\": %llu}",
+        (unsigned long long) Record->StartUs,
+        (unsigned long long) Record->WallUs,
+        (unsigned long long) Record->ThreadCpuUs,
+        (unsigned long long) Record->ProcessCpuUs,
+        (unsigned long long) Record->BytesRead,
+        (unsigned long long) Record->BytesWritten,
+        (unsigned long long) Record->PeakKb,
+        (unsigned long long) (Record->PeakKb - Record->StartPeakKb)
+        );
+    }
+    fputs ("\n  ]\n}\n", File);
+    if (fclose (File) != 0) {
+      Status = EFI_ABORTED;
+    }
+  }
+
+  for (Index = 0; Index < mProfileRecordNumber; Index++) {
+    free (mProfileRecords[Index].Name);
+    free (mProfileRecords[Index].Item);
+  }
+  free (mProfileRecords);
+  free (mProfileToolName);
+  free (mProfileFileName);
+  mProfileRecords         = NULL;
+  mProfileToolName        = NULL;
+  mProfileFileName        = NULL;
+  mProfileRecordNumber    = 0;
+  mProfileMaxRecordNumber = 0;
+  mProfileCurrent         = PROFILE_NO_RECORD;
+  mProfileEnabled         = FALSE;
+#ifdef _WIN32
+  DeleteCriticalSection (&mProfileLock);
+#endif
+  return Status;
+}
+
+BOOLEAN
+ProfileEnabled (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Return whether a profile is open.
+
+Arguments:
+
+  None
+
+Returns:
+
+  TRUE if ProfileOpen succeeded and ProfileClose was not called yet.
+
+--*/
+{
+  return mProfileEnabled;
+}
+
+UINTN
+ProfileBegin (
+  IN CHAR8          *Name,
+  IN CHAR8          *Item
+  )
+/*++
+
+Routine Description:
+
+  Start a record nested in the current record of the calling thread. The
+  new record becomes the current record of the thread until it ends.
+
+Arguments:
+
+  Name        - Name of the phase, such as the name of the function it runs.
+  Item        - The file or other object the phase works on, or NULL.
+
+Returns:
+
+  The handle of the record, PROFILE_NO_RECORD if no profile is open.
+
+--*/
+{
+  if (!mProfileEnabled) {
+    return PROFILE_NO_RECORD;
+  }
+  return ProfileBeginIn (mProfileCurrent, Name, Item);
+}
+
+UINTN
+ProfileBeginIn (
+  IN UINTN          Parent,
+  IN CHAR8          *Name,
+  IN CHAR8          *Item
+  )
+/*++
+
+Routine Description:
+
+  Start a record nested in a given record, typically a job that runs on a
+  worker thread for a phase started by the main thread. The new record
+  becomes the current record of the calling thread until it ends.
+
+Arguments:
+
+  Parent      - The enclosing record, or PROFILE_NO_RECORD.
+  Name        - Name of the phase.
+  Item        - The file or other object the phase works on, or NULL.
+
+Returns:
+
+  The handle of the record, PROFILE_NO_RECORD if no profile is open.
+
+--*/
+{
+  PROFILE_RECORD  *Records;
+  PROFILE_RECORD  *Record;
+  UINTN           Handle;
+  CHAR8           *NameCopy;
+  CHAR8           *ItemCopy;
+  UINT64          ThreadCpuUs;
+
+  if (!mProfileEnabled) {
+    return PROFILE_NO_RECORD;
+  }
+
+  NameCopy    = ProfileCopyString (Name);
+  ItemCopy    = ProfileCopyString (Item);
+  ThreadCpuUs = ProfileGetCpuTime (TRUE);
+
+  PROFILE_LOCK ();
+  if (mProfileRecordNumber == mProfileMaxRecordNumber) {
+    Records = (PROFILE_RECORD *) realloc (mProfileRecords, mProfileMaxRecordNumber * 2 * sizeof (PROFILE_RECORD));
+    if (Records == NULL) {
+      PROFILE_UNLOCK ();
+      free (NameCopy);
+      free (ItemCopy);
+      return PROFILE_NO_RECORD;
+    }
+    mProfileRecords          = Records;
+    mProfileMaxRecordNumber *= 2;
+  }
+  Handle = mProfileRecordNumber++;
+  Record = &mProfileRecords[Handle];
+  memset (Record, 0, sizeof (PROFILE_RECORD));
+  Record->Name          = NameCopy;
+  Record->Item          = ItemCopy;
+  Record->Parent        = Parent;
+  Record->Previous      = mProfileCurrent;
+  Record->ThreadCpuUs   = ThreadCpuUs;
+  Record->ProcessCpuUs  = ProfileGetCpuTime (FALSE);
+  Record->StartPeakKb   = ProfileGetPeakMemoryKb ();
+  Record->StartUs       = ProfileGetWallTime () - mProfileStartUs;
+  PROFILE_UNLOCK ();
+
+  mProfileCurrent = Handle;
+  return Handle;
+}
+
+VOID
+ProfileEnd (
+  IN UINTN          Record
+  )
+/*++
+
+Routine Description:
+
+  End a record started by the calling thread. Records of a thread must end
+  in the reverse order they began.
+
+Arguments:
+
+  Record      - The record, PROFILE_NO_RECORD is ignored.
+
+Returns:
+
+  None
+
+--*/
+{
+  PROFILE_RECORD  *Ended;
+  UINT64          ThreadCpuUs;
+
+  if (!mProfileEnabled || Record == PROFILE_NO_RECORD) {
+    return;
+  }
+
+  ThreadCpuUs = ProfileGetCpuTime (TRUE);
+
+  PROFILE_LOCK ();
+  Ended = &mProfileRecords[Record];
+  ProfileStopRecord (Ended, ThreadCpuUs);
+  if (Ended->Parent != PROFILE_NO_RECORD) {
+    mProfileRecords[Ended->Parent].BytesRead    += Ended->BytesRead;
+    mProfileRecords[Ended->Parent].BytesWritten += Ended->BytesWritten;
+  }
+  mProfileCurrent = Ended->Previous;
+  PROFILE_UNLOCK ();
+}
+
+UINTN
+ProfileCurrent (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Return the current record of the calling thread, to pass it as the parent
+  of the records of jobs run by other threads.
+
+Arguments:
+
+  None
+
+Returns:
+
+  The current record, PROFILE_NO_RECORD if there is none.
+
+--*/
+{
+  if (!mProfileEnabled) {
+    return PROFILE_NO_RECORD;
+  }
+  return mProfileCurrent;
+}
+
+VOID
+ProfileAddBytes (
+  IN UINT64         BytesRead,
+  IN UINT64         BytesWritten
+  )
+/*++
+
+Routine Description:
+
+  Account file data read or written by the calling thread to its current
+  record.
+
+Arguments:
+
+  BytesRead     - Number of bytes read.
+  BytesWritten  - Number of bytes written.
+
+Returns:
+
+  None
+
+--*/
+{
+  if (!mProfileEnabled) {
+    return;
+  }
+
+  PROFILE_LOCK ();
+  if (mProfileCurrent == PROFILE_NO_RECORD) {
+    mProfileOtherBytesRead    += BytesRead;
+    mProfileOtherBytesWritten += BytesWritten;
+  } else {
+    mProfileRecords[mProfileCurrent].BytesRead    += BytesRead;
+    mProfileRecords[mProfileCurrent].BytesWritten += BytesWritten;
+  }
+  PROFILE_UNLOCK ();
+}
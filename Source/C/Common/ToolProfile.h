@@ -0,0 +1,251 @@
+/** @file
+
+Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+This program and the accompanying materials
+are licensed and made available under the terms and conditions of the BSD License
+which accompanies this distribution.  The full text of the license may be found at
+http://opensource.org/licenses/bsd-license.php
+
+THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+Module Name:
+
+  ToolProfile.h
+
+Abstract:
+
+  Phase level profile of a tool run. A tool opens the profile when its
+  --profile option is given, brackets each phase and each file it handles
+  with ProfileBegin and ProfileEnd, and reports the bytes it reads and
+  writes. ProfileClose writes all the records to a JSON file:
+
+  {
+    "tool": "GenFv", "format": 1,
+    "wall_us": ..., "cpu_us": ..., "peak_rss_kb": ...,
+    "bytes_read": ..., "bytes_written": ...,
+    "records": [
+      { "id": 0, "parent": null, "name": "GenerateFvImage", "item": "FVMAIN.Fv",
+        "start_us": ..., "wall_us": ..., "cpu_us": ..., "process_cpu_us": ...,
+        "bytes_read": ..., "bytes_written": ..., "peak_rss_kb": ..., "peak_rss_growth_kb": ... },
+      ...
+    ]
+  }
+
+  start_us is relative to ProfileOpen. cpu_us is the CPU time of the thread
+  that ran the record, process_cpu_us the CPU time of all the threads of the
+  process meanwhile. The bytes of a record include those of its children.
+  peak_rss_kb is the peak resident size of the process when the record ends
+  and peak_rss_growth_kb how much it grew while the record ran.
+
+  When no profile is open every function returns at once, so the calls can
+  stay in the tools unconditionally.
+
+**/
+
+#ifndef _TOOL_PROFILE_H
+#define _TOOL_PROFILE_H
+
+#include <Common/UefiBaseTypes.h>
+
+//
+// Record handle returned when no profile is open, and parent of the records
+// at the top level.
+//
+#define PROFILE_NO_RECORD   ((UINTN) -1)
+
+//
+// Version of the JSON format written by ProfileClose.
+//
+#define PROFILE_FORMAT_VERSION  1
+
+EFI_STATUS
+ProfileOpen (
+  IN CHAR8          *ToolName,
+  IN CHAR8          *FileName
+  )
+/*++
+
+Routine Description:
+
+  Start profiling the tool. Records are kept in memory until ProfileClose.
+  Must be called before the tool starts any thread.
+
+Arguments:
+
+  ToolName    - Name of the tool, recorded in the profile.
+  FileName    - Name of the JSON file written by ProfileClose.
+
+Returns:
+
+  EFI_SUCCESS               - Profiling is enabled.
+  EFI_OUT_OF_RESOURCES      - No resource to keep the profile.
+
+--*/
+;
+
+EFI_STATUS
+ProfileClose (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Write the profile file and stop profiling. Records that were not ended
+  are written with the time measured so far. Must be called once all the
+  threads of the tool are done.
+
+Arguments:
+
+  None
+
+Returns:
+
+  EFI_SUCCESS               - The profile was written, or none is open.
+  EFI_ABORTED               - The profile file could not be written.
+
+--*/
+;
+
+BOOLEAN
+ProfileEnabled (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Return whether a profile is open.
+
+Arguments:
+
+  None
+
+Returns:
+
+  TRUE if ProfileOpen succeeded and ProfileClose was not called yet.
+
+--*/
+;
+
+UINTN
+ProfileBegin (
+  IN CHAR8          *Name,
+  IN CHAR8          *Item
+  )
+/*++
+
+Routine Description:
+
+  Start a record nested in the current record of the calling thread. The
+  new record becomes the current record of the thread until it ends.
+
+Arguments:
+
+  Name        - Name of the phase, such as the name of the function it runs.
+  Item        - The file or other object the phase works on, or NULL.
+
+Returns:
+
+  The handle of the record, PROFILE_NO_RECORD if no profile is open.
+
+--*/
+;
+
+UINTN
+ProfileBeginIn (
+  IN UINTN          Parent,
+  IN CHAR8          *Name,
+  IN CHAR8          *Item
+  )
+/*++
+
+Routine Description:
+
+  Start a record nested in a given record, typically a job that runs on a
+  worker thread for a phase started by the main thread. The new record
+  becomes the current record of the calling thread until it ends.
+
+Arguments:
+
+  Parent      - The enclosing record, or PROFILE_NO_RECORD.
+  Name        - Name of the phase.
+  Item        - The file or other object the phase works on, or NULL.
+
+Returns:
+
+  The handle of the record, PROFILE_NO_RECORD if no profile is open.
+
+--*/
+;
+
+VOID
+ProfileEnd (
+  IN UINTN          Record
+  )
+/*++
+
+Routine Description:
+
+  End a record started by the calling thread. Records of a thread must end
+  in the reverse order they began.
+
+Arguments:
+
+  Record      - The record, PROFILE_NO_RECORD is ignored.
+
+Returns:
+
+  None
+
+--*/
+;
+
+UINTN
+ProfileCurrent (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Return the current record of the calling thread, to pass it as the parent
+  of the records of jobs run by other threads.
+
+Arguments:
+
+  None
+
+Returns:
+
+  The current record, PROFILE_NO_RECORD if there is none.
+
+--*/
+;
+
+VOID
+ProfileAddBytes (
+  IN UINT64         BytesRead,
+  IN UINT64         BytesWritten
+  )
+/*++
+
+Routine Description:
+
+  Account file data read or written by the calling thread to its current
+  record.
+
+Arguments:
+
+  BytesRead     - Number of bytes read.
+  BytesWritten  - Number of bytes written.
+
+Returns:
+
+  None
+
+--*/
+;
+
+#endif
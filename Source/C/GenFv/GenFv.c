@@ -28,13 +28,68 @@ Abstract:
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
 #include "GenFvInternalLib.h"
+#include "ParallelJobs.h"
+#include "ToolProfile.h"
 
 //
 // Utility Name
 //
 #define UTILITY_NAME  "GenFv"
 
+//
+// Tokens of the batch manifest. The [options] section lists the FVs with
+// EFI_FV, each FV is then described by the section named after it.
+//
+#define FV_BATCH_FV_STRING              "EFI_FV"
+#define FV_BATCH_INF_FILE_STRING        "EFI_FV_INF_FILE"
+#define FV_BATCH_OUTPUT_FILE_STRING     "EFI_FV_OUTPUT_FILE"
+#define FV_BATCH_MAP_FILE_STRING        "EFI_FV_MAP_FILE"
+#define FV_BATCH_ADDRESS_FILE_STRING    "EFI_FV_ADDRESS_FILE"
+#define FV_BATCH_FORCE_REBASE_STRING    "EFI_FORCE_REBASE"
+#define FV_BATCH_PACK_FILES_STRING      "EFI_PACK_FILES"
+#define FV_BATCH_DEPENDS_STRING         "EFI_FV_DEPENDS"
+
+//
+// One FV of the batch manifest, the status and the statistics of its
+// generation.
+//
+typedef struct {
+  CHAR8                   Name[_MAX_PATH];
+  CHAR8                   InfFileName[_MAX_PATH];
+  CHAR8                   OutFileName[_MAX_PATH];
+  CHAR8                   MapFileName[_MAX_PATH];
+  CHAR8                   AddrFileName[_MAX_PATH];
+  BOOLEAN                 BaseAddressSet;
+  EFI_PHYSICAL_ADDRESS    BaseAddress;
+  INT8                    ForceRebase;
+  BOOLEAN                 PackFiles;
+  UINTN                   *Depends;
+  UINTN                   DependNumber;
+  BOOLEAN                 Done;
+  EFI_STATUS              Status;
+  UINTN                   FileNumber;
+  UINT32                  TotalSize;
+  UINT32                  TakenSize;
+  UINT64                  Time;
+} FV_BATCH_JOB;
+
+//
+// FVs of the batch that are ready to be generated at the same time. Each
+// FV rebases its images on RebaseThreads threads.
+//
+typedef struct {
+  FV_BATCH_JOB            **Ready;
+  UINT32                  RebaseThreads;
+  BOOLEAN                 Incremental;
+  UINTN                   ProfileRecord;
+} FV_BATCH_WAVE;
+
 //
 // Utility version information
 //
@@ -134,7 +189,9 @@ Returns:
                         FV base address when current FV base address is set.\n");
   fprintf (stdout, "  -m logfile, --map logfile\n\
                         Logfile is the output fv map file name. if it is not\n\
-                        given, the FvName.map will be the default map file name\n"); 
+                        given, the FvName.map will be the default map file name.\n\
+                        The symbols read from the Module.map file of each\n\
+                        driver are cached in Module.symcache next to it.\n"); 
   fprintf (stdout, "  -g Guid, --guid Guid\n\
                         GuidValue is one specific capsule guid value\n\
                         or fv file system guid value.\n\
@@ -146,6 +203,25 @@ Returns:
   fprintf (stdout, "  --capheadsize HeadSize\n\
                         HeadSize is one HEX or DEC format value\n\
                         HeadSize is required by Capsule Image.\n");                        
+  fprintf (stdout, "  --threads Number      Number of threads that rebase the images of the FV,\n\
+                        or that generate the FVs of a batch, from 1 to %u.\n\
+                        The default is one per processor.\n", (unsigned) MAX_PARALLEL_WORKERS);
+  fprintf (stdout, "  --pack-files          Reorder the FFS files to reduce the pad files needed\n\
+                        for their alignment. The VTF and apriori files keep\n\
+                        their place. The saved size is recorded as\n\
+                        EFI_FV_PAD_SAVED_SIZE in the FvName.txt report file.\n");
+  fprintf (stdout, "  --incremental         Record the layout of the FV in FvName.layout and, if\n\
+                        the layout of the previous FV is found, take the\n\
+                        unchanged files from it instead of rebasing them\n\
+                        and only write the changed parts of the FV file.\n");
+  fprintf (stdout, "  --batch Manifest      Manifest lists several FVs with their INF file, output\n\
+                        file and the FVs they depend on. All of them are\n\
+                        generated by this process, the FVs whose dependencies\n\
+                        are done at the same time, and the time spent on\n\
+                        each FV is reported.\n");
+  fprintf (stdout, "  --profile FileName    Record the wall and CPU time, the bytes read and\n\
+                        written and the peak memory of each phase and of\n\
+                        each FFS file in FileName, in JSON format.\n");
   fprintf (stdout, "  -c, --capsule         Create Capsule Image.\n");
   fprintf (stdout, "  -p, --dump            Dump Capsule Image header.\n");
   fprintf (stdout, "  -v, --verbose         Turn on verbose output with informational messages.\n");
@@ -155,8 +231,511 @@ Returns:
   fprintf (stdout, "  -h, --help            Show this help message and exit.\n");
 }
 
-UINT32 mFvTotalSize;
-UINT32 mFvTakenSize;
+STATIC
+UINT64
+GetTimeInMicroseconds (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Read a monotonic clock.
+
+Arguments:
+
+  None
+
+Returns:
+
+  The current time in microseconds from an arbitrary origin.
+
+--*/
+{
+#ifdef _WIN32
+  LARGE_INTEGER  Counter;
+  LARGE_INTEGER  Frequency;
+
+  QueryPerformanceCounter (&Counter);
+  QueryPerformanceFrequency (&Frequency);
+  return (UINT64) (Counter.QuadPart / (Frequency.QuadPart / 1000000));
+#else
+  struct timespec  Time;
+
+  clock_gettime (CLOCK_MONOTONIC, &Time);
+  return (UINT64) Time.tv_sec * 1000000 + (UINT64) Time.tv_nsec / 1000;
+#endif
+}
+
+STATIC
+EFI_STATUS
+WriteAddressFile (
+  IN FV_INFO  *FvInfo,
+  IN CHAR8    *AddrFileName
+  )
+/*++
+
+Routine Description:
+
+  Records the child FV base addresses found in a generated FV.
+
+Arguments:
+
+  FvInfo          The generated FV.
+  AddrFileName    Name of the address file.
+
+Returns:
+
+  EFI_SUCCESS     The file was written.
+  EFI_ABORTED     The file could not be created.
+
+--*/
+{
+  FILE    *FpFile;
+  UINTN   Index;
+
+  FpFile = fopen (AddrFileName, "w");
+  if (FpFile == NULL) {
+    Error (NULL, 0, 0001, "Error opening file", AddrFileName);
+    return EFI_ABORTED;
+  }
+  fprintf (FpFile, FV_BASE_ADDRESS_STRING);
+  fprintf (FpFile, "\n");
+  for (Index = 0; Index < FvInfo->ChildFvBaseAddressNumber; Index ++) {
+    fprintf (
+      FpFile,
+      "0x%llx\n",
+      (unsigned long long)FvInfo->ChildFvBaseAddress[Index]
+      );
+  }
+  fflush (FpFile);
+  fclose (FpFile);
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+ReadBatchManifest (
+  IN  INF_INDEX       *Index,
+  OUT FV_BATCH_JOB    **Jobs,
+  OUT UINTN           *JobNumber
+  )
+/*++
+
+Routine Description:
+
+  Reads the FVs of a batch manifest and resolves their dependencies.
+
+Arguments:
+
+  Index           Index of the manifest file.
+  Jobs            Receives the FV list, in manifest order.
+  JobNumber       Receives the number of FVs.
+
+Returns:
+
+  EFI_SUCCESS             The manifest was read.
+  EFI_ABORTED             The manifest is not valid.
+  EFI_OUT_OF_RESOURCES    No resource to hold the FV list.
+
+--*/
+{
+  FV_BATCH_JOB    *Job;
+  UINTN           MaxNumber;
+  UINTN           Number;
+  UINTN           Instance;
+  UINTN           Index1;
+  CHAR8           Section[_MAX_PATH + 2];
+  CHAR8           Value[_MAX_PATH];
+  UINT64          TempNumber;
+  VOID            *NewBuffer;
+
+  *Jobs      = NULL;
+  *JobNumber = 0;
+  MaxNumber  = 0;
+
+  //
+  // The FV names
+  //
+  for (Number = 0; InfIndexFindToken (Index, OPTIONS_SECTION_STRING, FV_BATCH_FV_STRING, Number, Value) == EFI_SUCCESS; Number++) {
+    for (Index1 = 0; Index1 < Number; Index1++) {
+      if (stricmp ((*Jobs)[Index1].Name, Value) == 0) {
+        Error (NULL, 0, 2000, "Invalid parameter", "FV %s is listed twice in the batch manifest.", Value);
+        return EFI_ABORTED;
+      }
+    }
+    if (Number == MaxNumber) {
+      MaxNumber = MaxNumber == 0 ? 16 : MaxNumber * 2;
+      NewBuffer = realloc (*Jobs, MaxNumber * sizeof (FV_BATCH_JOB));
+      if (NewBuffer == NULL) {
+        Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+        return EFI_OUT_OF_RESOURCES;
+      }
+      *Jobs = (FV_BATCH_JOB *) NewBuffer;
+    }
+    memset (&(*Jobs)[Number], 0, sizeof (FV_BATCH_JOB));
+    strcpy ((*Jobs)[Number].Name, Value);
+    *JobNumber = Number + 1;
+  }
+
+  if (Number == 0) {
+    Error (NULL, 0, 1001, "Missing required argument", "%s in the %s section of the batch manifest.", FV_BATCH_FV_STRING, OPTIONS_SECTION_STRING);
+    return EFI_ABORTED;
+  }
+
+  //
+  // The description of each FV
+  //
+  for (Number = 0; Number < *JobNumber; Number++) {
+    Job = &(*Jobs)[Number];
+    sprintf (Section, "[%s]", Job->Name);
+
+    if (InfIndexFindToken (Index, Section, FV_BATCH_INF_FILE_STRING, 0, Job->InfFileName) != EFI_SUCCESS) {
+      Error (NULL, 0, 1001, "Missing required argument", "%s of FV %s", FV_BATCH_INF_FILE_STRING, Job->Name);
+      return EFI_ABORTED;
+    }
+    if (InfIndexFindToken (Index, Section, FV_BATCH_OUTPUT_FILE_STRING, 0, Job->OutFileName) != EFI_SUCCESS) {
+      Error (NULL, 0, 1001, "Missing required argument", "%s of FV %s", FV_BATCH_OUTPUT_FILE_STRING, Job->Name);
+      return EFI_ABORTED;
+    }
+    InfIndexFindToken (Index, Section, FV_BATCH_MAP_FILE_STRING, 0, Job->MapFileName);
+    InfIndexFindToken (Index, Section, FV_BATCH_ADDRESS_FILE_STRING, 0, Job->AddrFileName);
+
+    if (InfIndexFindToken (Index, Section, EFI_FV_BASE_ADDRESS_STRING, 0, Value) == EFI_SUCCESS) {
+      if (EFI_ERROR (AsciiStringToUint64 (Value, FALSE, &TempNumber))) {
+        Error (NULL, 0, 2000, "Invalid parameter", "%s = %s of FV %s", EFI_FV_BASE_ADDRESS_STRING, Value, Job->Name);
+        return EFI_ABORTED;
+      }
+      Job->BaseAddress    = TempNumber;
+      Job->BaseAddressSet = TRUE;
+    }
+
+    Job->ForceRebase = -1;
+    if (InfIndexFindToken (Index, Section, FV_BATCH_FORCE_REBASE_STRING, 0, Value) == EFI_SUCCESS) {
+      if (stricmp (Value, "TRUE") == 0) {
+        Job->ForceRebase = 1;
+      } else if (stricmp (Value, "FALSE") == 0) {
+        Job->ForceRebase = 0;
+      } else {
+        Error (NULL, 0, 2000, "Invalid parameter", "%s = %s of FV %s, it must be \"TRUE\" or \"FALSE\"", FV_BATCH_FORCE_REBASE_STRING, Value, Job->Name);
+        return EFI_ABORTED;
+      }
+    }
+
+    if (InfIndexFindToken (Index, Section, FV_BATCH_PACK_FILES_STRING, 0, Value) == EFI_SUCCESS) {
+      if (stricmp (Value, "TRUE") == 0) {
+        Job->PackFiles = TRUE;
+      } else if (stricmp (Value, "FALSE") != 0) {
+        Error (NULL, 0, 2000, "Invalid parameter", "%s = %s of FV %s, it must be \"TRUE\" or \"FALSE\"", FV_BATCH_PACK_FILES_STRING, Value, Job->Name);
+        return EFI_ABORTED;
+      }
+    }
+
+    for (Instance = 0; InfIndexFindToken (Index, Section, FV_BATCH_DEPENDS_STRING, Instance, Value) == EFI_SUCCESS; Instance++) {
+      for (Index1 = 0; Index1 < *JobNumber; Index1++) {
+        if (stricmp ((*Jobs)[Index1].Name, Value) == 0) {
+          break;
+        }
+      }
+      if (Index1 == *JobNumber || Index1 == Number) {
+        Error (NULL, 0, 2000, "Invalid parameter", "FV %s depends on %s, which is not another FV of the batch manifest.", Job->Name, Value);
+        return EFI_ABORTED;
+      }
+      NewBuffer = realloc (Job->Depends, (Job->DependNumber + 1) * sizeof (UINTN));
+      if (NewBuffer == NULL) {
+        Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+        return EFI_OUT_OF_RESOURCES;
+      }
+      Job->Depends = (UINTN *) NewBuffer;
+      Job->Depends[Job->DependNumber++] = Index1;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+GenerateBatchFv (
+  IN OUT FV_BATCH_JOB   *Job,
+  IN     UINT32         RebaseThreads,
+  IN     BOOLEAN        Incremental,
+  IN     UINTN          ProfileRecord
+  )
+/*++
+
+Routine Description:
+
+  Generates one FV of a batch, as a GenFv run with the options of the
+  manifest would. The FV has its own FV_INFO, so the FVs of a batch can
+  be generated at the same time.
+
+Arguments:
+
+  Job             The FV, receives the statistics of its generation.
+  RebaseThreads   Number of threads that rebase the images, 0 for default.
+  Incremental     TRUE to generate the FV incrementally.
+  ProfileRecord   Profile record the FV is recorded in.
+
+Returns:
+
+  EFI_SUCCESS     The FV was generated.
+  Others          The FV could not be generated.
+
+--*/
+{
+  EFI_STATUS    Status;
+  FV_INFO       FvInfo;
+  CHAR8         *InfFileImage;
+  UINT32        InfFileSize;
+  UINT64        StartTime;
+
+  StartTime = GetTimeInMicroseconds ();
+  VerboseMsg ("Create Fv image %s from %s", Job->OutFileName, Job->InfFileName);
+
+  memset (&FvInfo, 0, sizeof (FV_INFO));
+  memcpy (&FvInfo.FvFileSystemGuid, &mEfiFirmwareFileSystem2Guid, sizeof (EFI_GUID));
+  FvInfo.BaseAddress    = Job->BaseAddress;
+  FvInfo.BaseAddressSet = Job->BaseAddressSet;
+  FvInfo.ForceRebase    = Job->ForceRebase;
+  FvInfo.RebaseThreads  = RebaseThreads;
+  FvInfo.Incremental    = Incremental;
+  FvInfo.PackFiles      = Job->PackFiles;
+
+  Status = GetFileImage (Job->InfFileName, &InfFileImage, &InfFileSize);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  ProfileRecord = ProfileBeginIn (ProfileRecord, "GenerateFvImage", Job->OutFileName);
+  Status = GenerateFvImage (
+            &FvInfo,
+            InfFileImage,
+            InfFileSize,
+            Job->OutFileName,
+            Job->MapFileName[0] != '\0' ? Job->MapFileName : NULL
+            );
+  ProfileEnd (ProfileRecord);
+  free (InfFileImage);
+
+  if (Status == EFI_SUCCESS && Job->AddrFileName[0] != '\0' && FvInfo.ChildFvBaseAddressNumber > 0) {
+    Status = WriteAddressFile (&FvInfo, Job->AddrFileName);
+  }
+
+  Job->FileNumber = FvInfo.FvFileNumber;
+  Job->TotalSize  = FvInfo.TotalSize;
+  Job->TakenSize  = FvInfo.TakenSize;
+  FreeFvInfo (&FvInfo);
+  Job->Time       = GetTimeInMicroseconds () - StartTime;
+
+  return Status;
+}
+
+STATIC
+VOID
+GenerateBatchFvJob (
+  IN VOID     *Context,
+  IN UINTN    JobIndex,
+  IN UINTN    WorkerIndex
+  )
+/*++
+
+Routine Description:
+
+  Generates one of the FVs of a wave, on a worker thread.
+
+Arguments:
+
+  Context         The FV_BATCH_WAVE.
+  JobIndex        Index of the FV in the wave.
+  WorkerIndex     Index of the worker, unused.
+
+Returns:
+
+  None
+
+--*/
+{
+  FV_BATCH_WAVE   *Wave;
+
+  Wave = (FV_BATCH_WAVE *) Context;
+  Wave->Ready[JobIndex]->Status = GenerateBatchFv (
+                                    Wave->Ready[JobIndex],
+                                    Wave->RebaseThreads,
+                                    Wave->Incremental,
+                                    Wave->ProfileRecord
+                                    );
+}
+
+STATIC
+EFI_STATUS
+GenerateFvBatch (
+  IN CHAR8    *ManifestFileName,
+  IN UINT32   RebaseThreads,
+  IN BOOLEAN  Incremental
+  )
+/*++
+
+Routine Description:
+
+  Generates all the FVs of a batch manifest. An FV is generated once the
+  FVs it depends on are done. The FVs are generated in waves: all the FVs
+  whose dependencies are done are generated at the same time, they share
+  the threads, and they are reported in manifest order once the wave is
+  done. The content of the FFS files is cached, so a file placed in
+  several FVs is read once.
+
+Arguments:
+
+  ManifestFileName    Name of the batch manifest.
+  RebaseThreads       Number of threads shared by the FVs of a wave and
+                      their rebase, 0 for one per processor.
+  Incremental         TRUE to generate the FVs incrementally.
+
+Returns:
+
+  EFI_SUCCESS     All the FVs were generated.
+  Others          The manifest is not valid or an FV could not be generated.
+
+--*/
+{
+  EFI_STATUS      Status;
+  CHAR8           *ManifestImage;
+  UINT32          ManifestSize;
+  MEMORY_FILE     ManifestFile;
+  INF_INDEX       *Index;
+  FV_BATCH_JOB    *Jobs;
+  FV_BATCH_JOB    *Job;
+  FV_BATCH_JOB    **Ready;
+  FV_BATCH_WAVE   Wave;
+  UINTN           JobNumber;
+  UINTN           DoneNumber;
+  UINTN           ReadyNumber;
+  UINTN           Number;
+  UINTN           Index1;
+  UINTN           ThreadCount;
+  UINTN           WorkerCount;
+  UINT64          StartTime;
+
+  Index     = NULL;
+  Jobs      = NULL;
+  Ready     = NULL;
+  JobNumber = 0;
+  StartTime = GetTimeInMicroseconds ();
+
+  Status = GetFileImage (ManifestFileName, &ManifestImage, &ManifestSize);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  ManifestFile.FileImage          = ManifestImage;
+  ManifestFile.CurrentFilePointer = ManifestImage;
+  ManifestFile.Eof                = ManifestImage + ManifestSize;
+
+  Status = InfIndexCreate (&ManifestFile, &Index);
+  if (EFI_ERROR (Status)) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    goto Finish;
+  }
+  Status = ReadBatchManifest (Index, &Jobs, &JobNumber);
+  if (EFI_ERROR (Status)) {
+    Error (NULL, 0, 0003, "Error parsing file", "the batch manifest %s.", ManifestFileName);
+    goto Finish;
+  }
+
+  Ready = (FV_BATCH_JOB **) malloc (JobNumber * sizeof (FV_BATCH_JOB *));
+  if (Ready == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Finish;
+  }
+
+  Status = EnableFvFileCache ();
+  if (EFI_ERROR (Status)) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    goto Finish;
+  }
+
+  ThreadCount = RebaseThreads != 0 ? RebaseThreads : GetProcessorCount ();
+  for (DoneNumber = 0; DoneNumber < JobNumber; DoneNumber += ReadyNumber) {
+    //
+    // Take the FVs whose dependencies are done
+    //
+    ReadyNumber = 0;
+    for (Number = 0; Number < JobNumber; Number++) {
+      if (Jobs[Number].Done) {
+        continue;
+      }
+      for (Index1 = 0; Index1 < Jobs[Number].DependNumber; Index1++) {
+        if (!Jobs[Jobs[Number].Depends[Index1]].Done) {
+          break;
+        }
+      }
+      if (Index1 == Jobs[Number].DependNumber) {
+        Ready[ReadyNumber++] = &Jobs[Number];
+      }
+    }
+    if (ReadyNumber == 0) {
+      Error (NULL, 0, 2000, "Invalid parameter", "the FVs of the batch manifest %s have circular dependencies.", ManifestFileName);
+      Status = EFI_ABORTED;
+      goto Finish;
+    }
+
+    //
+    // One worker per FV, the threads left are given to the rebase of each FV.
+    //
+    WorkerCount = ReadyNumber < ThreadCount ? ReadyNumber : ThreadCount;
+    if (WorkerCount > MAX_PARALLEL_WORKERS) {
+      WorkerCount = MAX_PARALLEL_WORKERS;
+    }
+    Wave.Ready         = Ready;
+    Wave.RebaseThreads = (UINT32) (ThreadCount / WorkerCount);
+    Wave.Incremental   = Incremental;
+    Wave.ProfileRecord = ProfileCurrent ();
+    VerboseMsg ("Generate %u FVs on %u threads", (unsigned) ReadyNumber, (unsigned) WorkerCount);
+    RunParallelJobs (GenerateBatchFvJob, &Wave, ReadyNumber, WorkerCount);
+
+    for (Number = 0; Number < ReadyNumber; Number++) {
+      Job = Ready[Number];
+      if (EFI_ERROR (Job->Status)) {
+        Error (NULL, 0, 3000, "Invalid", "Could not generate FV %s.", Job->Name);
+        Status = Job->Status;
+        continue;
+      }
+      Job->Done = TRUE;
+      KeyMsg (
+        "%s: %u files, size 0x%x, used 0x%x, %u.%03u ms",
+        Job->Name,
+        (unsigned) Job->FileNumber,
+        (unsigned) Job->TotalSize,
+        (unsigned) Job->TakenSize,
+        (unsigned) (Job->Time / 1000),
+        (unsigned) (Job->Time % 1000)
+        );
+    }
+    if (EFI_ERROR (Status)) {
+      goto Finish;
+    }
+  }
+
+  StartTime = GetTimeInMicroseconds () - StartTime;
+  KeyMsg (
+    "%u FVs generated in %u.%03u ms",
+    (unsigned) JobNumber,
+    (unsigned) (StartTime / 1000),
+    (unsigned) (StartTime % 1000)
+    );
+
+Finish:
+  FreeFvFileCache ();
+  for (Number = 0; Number < JobNumber; Number++) {
+    free (Jobs[Number].Depends);
+  }
+  free (Ready);
+  free (Jobs);
+  InfIndexFree (Index);
+  free (ManifestImage);
+  return Status;
+}
 
 int
 main (
@@ -195,17 +774,22 @@ Returns:
   CHAR8                 *InfFileImage;
   UINT32                InfFileSize;
   CHAR8                 *OutFileName;
+  CHAR8                 *BatchFileName;
+  CHAR8                 *ProfileFileName;
   BOOLEAN               CapsuleFlag;
   BOOLEAN               DumpCapsule;
   FILE                  *FpFile;
   EFI_CAPSULE_HEADER    *CapsuleHeader;
   UINT64                LogLevel, TempNumber;
   UINT32                Index;
+  UINTN                 ProfileRecord;
 
   InfFileName   = NULL;
   AddrFileName  = NULL;
   InfFileImage  = NULL;
   OutFileName   = NULL;
+  BatchFileName = NULL;
+  ProfileFileName = NULL;
   MapFileName   = NULL;
   InfFileSize   = 0;
   CapsuleFlag   = FALSE;
@@ -215,8 +799,6 @@ Returns:
   LogLevel      = 0;
   TempNumber    = 0;
   Index         = 0;
-  mFvTotalSize  = 0;
-  mFvTakenSize  = 0;
   Status        = EFI_SUCCESS;
 
   SetUtilityName (UTILITY_NAME);
@@ -312,6 +894,10 @@ Returns:
         Error (NULL, 0, 1003, "Invalid option value", "Fv block size can't be be set to zero");
         return STATUS_ERROR;        
       }
+      if (EFI_ERROR (ReserveFvBlocks (&mFvDataInfo, 0))) {
+        Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+        return STATUS_ERROR;
+      }
       mFvDataInfo.FvBlocks[0].Length = (UINT32) TempNumber;
       DebugMsg (NULL, 0, 9, "FV Block Size", "%s = 0x%llx", EFI_BLOCK_SIZE_STRING, (unsigned long long) TempNumber);
       argc -= 2;
@@ -329,6 +915,10 @@ Returns:
         Error (NULL, 0, 1003, "Invalid option value", "Fv block number can't be set to zero");
         return STATUS_ERROR;        
       }
+      if (EFI_ERROR (ReserveFvBlocks (&mFvDataInfo, 0))) {
+        Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+        return STATUS_ERROR;
+      }
       mFvDataInfo.FvBlocks[0].NumBlocks = (UINT32) TempNumber;
       DebugMsg (NULL, 0, 9, "FV Number Block", "%s = 0x%llx", EFI_NUM_BLOCKS_STRING, (unsigned long long) TempNumber);
       argc -= 2;
@@ -341,7 +931,10 @@ Returns:
         Error (NULL, 0, 1003, "Invalid option value", "Input Ffsfile can't be null");
         return STATUS_ERROR;
       }
-      strcpy (mFvDataInfo.FvFiles[Index], argv[1]);
+      if (EFI_ERROR (AddFvFile (&mFvDataInfo, argv[1], 0))) {
+        Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+        return STATUS_ERROR;
+      }
       DebugMsg (NULL, 0, 9, "FV component file", "the %uth name is %s", (unsigned) Index + 1, argv[1]);
       argc -= 2;
       argv += 2;
@@ -488,6 +1081,55 @@ Returns:
       continue; 
     }
 
+    if (stricmp (argv[0], "--threads") == 0) {
+      Status = AsciiStringToUint64 (argv[1], FALSE, &TempNumber);
+      if (EFI_ERROR (Status) || TempNumber == 0 || TempNumber > MAX_PARALLEL_WORKERS) {
+        Error (NULL, 0, 1003, "Invalid option value", "%s = %s, it must be between 1 and %u", argv[0], argv[1], (unsigned) MAX_PARALLEL_WORKERS);
+        return STATUS_ERROR;
+      }
+      mFvDataInfo.RebaseThreads = (UINT32) TempNumber;
+      DebugMsg (NULL, 0, 9, "Rebase threads", "%s = %s", argv[0], argv[1]);
+      argc -= 2;
+      argv += 2;
+      continue; 
+    }
+
+    if (stricmp (argv[0], "--pack-files") == 0) {
+      mFvDataInfo.PackFiles = TRUE;
+      argc --;
+      argv ++;
+      continue; 
+    }
+
+    if (stricmp (argv[0], "--incremental") == 0) {
+      mFvDataInfo.Incremental = TRUE;
+      argc --;
+      argv ++;
+      continue; 
+    }
+
+    if (stricmp (argv[0], "--batch") == 0) {
+      BatchFileName = argv[1];
+      if (BatchFileName == NULL) {
+        Error (NULL, 0, 1003, "Invalid option value", "Batch manifest can't be null");
+        return STATUS_ERROR;
+      }
+      argc -= 2;
+      argv += 2;
+      continue; 
+    }
+
+    if (stricmp (argv[0], "--profile") == 0) {
+      ProfileFileName = argv[1];
+      if (ProfileFileName == NULL) {
+        Error (NULL, 0, 1003, "Invalid option value", "Profile file can't be null");
+        return STATUS_ERROR;
+      }
+      argc -= 2;
+      argv += 2;
+      continue; 
+    }
+
     if ((stricmp (argv[0], "-p") == 0) || (stricmp (argv[0], "--dump") == 0)) {
       DumpCapsule = TRUE;
       argc --;
@@ -547,18 +1189,49 @@ Returns:
   }
 
   VerboseMsg ("%s tool start.", UTILITY_NAME);
+
+  if (ProfileFileName != NULL) {
+    if (EFI_ERROR (ProfileOpen (UTILITY_NAME, ProfileFileName))) {
+      Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+      return STATUS_ERROR;
+    }
+    VerboseMsg ("the profile file name is %s", ProfileFileName);
+  }
+
+  if (BatchFileName != NULL) {
+    //
+    // Every FV of the batch is described by the manifest
+    //
+    if (InfFileName != NULL || OutFileName != NULL || AddrFileName != NULL || MapFileName != NULL ||
+        CapsuleFlag || DumpCapsule || mFvDataInfo.BaseAddressSet || mFvDataInfo.ForceRebase != -1 ||
+        mFvDataInfo.FvBlocks != NULL || mFvDataInfo.FvFileNumber > 0 || mFvDataInfo.PackFiles) {
+      Error (NULL, 0, 1000, "Invalid option", "--batch can only be combined with --threads, --incremental, --profile and the message options.");
+      FreeFvInfo (&mFvDataInfo);
+      ProfileClose ();
+      return STATUS_ERROR;
+    }
+    VerboseMsg ("the batch manifest is %s", BatchFileName);
+    GenerateFvBatch (BatchFileName, mFvDataInfo.RebaseThreads, mFvDataInfo.Incremental);
+    if (EFI_ERROR (ProfileClose ())) {
+      Error (NULL, 0, 0002, "Error writing file", ProfileFileName);
+    }
+    VerboseMsg ("%s tool done with return code is 0x%x.", UTILITY_NAME, GetUtilityStatus ());
+    return GetUtilityStatus ();
+  }
   
   //
   // check input parameter, InfFileName can be NULL
   //
   if (InfFileName == NULL && DumpCapsule) {
     Error (NULL, 0, 1001, "Missing option", "Input Capsule Image");
+    ProfileClose ();
     return STATUS_ERROR;
   }
   VerboseMsg ("the input FvInf or CapInf file name is %s", InfFileName);
 
   if (!DumpCapsule && OutFileName == NULL) {
     Error (NULL, 0, 1001, "Missing option", "Output File");
+    ProfileClose ();
     return STATUS_ERROR;
   }
   if (OutFileName != NULL) {
@@ -571,6 +1244,7 @@ Returns:
   if (InfFileName != NULL) {
     Status = GetFileImage (InfFileName, &InfFileImage, &InfFileSize);
     if (EFI_ERROR (Status)) {
+      ProfileClose ();
       return STATUS_ERROR;
     }
   }
@@ -587,6 +1261,7 @@ Returns:
       FpFile = fopen (OutFileName, "w");
       if (FpFile == NULL) {
         Error (NULL, 0, 0001, "Error opening file", OutFileName);
+        ProfileClose ();
         return STATUS_ERROR;
       }
     }
@@ -612,15 +1287,21 @@ Returns:
     //
     // Call the GenerateCapImage to generate Capsule Image
     //
-    for (Index = 0; mFvDataInfo.FvFiles[Index][0] != '\0'; Index ++) {
-      strcpy (mCapDataInfo.CapFiles[Index], mFvDataInfo.FvFiles[Index]);
+    for (Index = 0; Index < mFvDataInfo.FvFileNumber; Index ++) {
+      if (EFI_ERROR (AddCapFile (&mCapDataInfo, mFvDataInfo.FvFiles[Index]))) {
+        Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+        ProfileClose ();
+        return STATUS_ERROR;
+      }
     }
 
+    ProfileRecord = ProfileBegin ("GenerateCapImage", OutFileName);
     Status = GenerateCapImage (
               InfFileImage, 
               InfFileSize,
               OutFileName
               );
+    ProfileEnd (ProfileRecord);
   } else {
     VerboseMsg ("Create Fv image and its map file");
     //
@@ -634,12 +1315,15 @@ Returns:
     //
     // Call the GenerateFvImage to generate Fv Image
     //
+    ProfileRecord = ProfileBegin ("GenerateFvImage", OutFileName);
     Status = GenerateFvImage (
+              &mFvDataInfo,
               InfFileImage,
               InfFileSize,
               OutFileName,
               MapFileName
               );
+    ProfileEnd (ProfileRecord);
   }
 
   //
@@ -652,29 +1336,24 @@ Returns:
   //
   //  update boot driver address and runtime driver address in address file
   //
-  if (Status == EFI_SUCCESS && AddrFileName != NULL && mFvBaseAddressNumber > 0) {
-    FpFile = fopen (AddrFileName, "w");
-    if (FpFile == NULL) {
-      Error (NULL, 0, 0001, "Error opening file", AddrFileName);
+  if (Status == EFI_SUCCESS && AddrFileName != NULL && mFvDataInfo.ChildFvBaseAddressNumber > 0) {
+    if (EFI_ERROR (WriteAddressFile (&mFvDataInfo, AddrFileName))) {
+      ProfileClose ();
       return STATUS_ERROR;
     }
-    fprintf (FpFile, FV_BASE_ADDRESS_STRING);
-    fprintf (FpFile, "\n");
-    for (Index = 0; Index < mFvBaseAddressNumber; Index ++) {
-      fprintf (
-        FpFile,
-        "0x%llx\n",
-        (unsigned long long)mFvBaseAddress[Index]
-        );
-    }
-    fflush (FpFile);
-    fclose (FpFile);
+  }
+
+  FreeFvInfo (&mFvDataInfo);
+  FreeCapInfo (&mCapDataInfo);
+
+  if (EFI_ERROR (ProfileClose ())) {
+    Error (NULL, 0, 0002, "Error writing file", ProfileFileName);
   }
   
   if (Status == EFI_SUCCESS) {
-    DebugMsg (NULL, 0, 9, "The Total Fv Size", "%s = 0x%x", EFI_FV_TOTAL_SIZE_STRING, (unsigned) mFvTotalSize);
-    DebugMsg (NULL, 0, 9, "The used Fv Size", "%s = 0x%x", EFI_FV_TAKEN_SIZE_STRING, (unsigned) mFvTakenSize);
-    DebugMsg (NULL, 0, 9, "The space Fv size", "%s = 0x%x", EFI_FV_SPACE_SIZE_STRING, (unsigned) (mFvTotalSize - mFvTakenSize));
+    DebugMsg (NULL, 0, 9, "The Total Fv Size", "%s = 0x%x", EFI_FV_TOTAL_SIZE_STRING, (unsigned) mFvDataInfo.TotalSize);
+    DebugMsg (NULL, 0, 9, "The used Fv Size", "%s = 0x%x", EFI_FV_TAKEN_SIZE_STRING, (unsigned) mFvDataInfo.TakenSize);
+    DebugMsg (NULL, 0, 9, "The space Fv size", "%s = 0x%x", EFI_FV_SPACE_SIZE_STRING, (unsigned) (mFvDataInfo.TotalSize - mFvDataInfo.TakenSize));
   }
 
   VerboseMsg ("%s tool done with return code is 0x%x.", UTILITY_NAME, GetUtilityStatus ());
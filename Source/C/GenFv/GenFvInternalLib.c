@@ -24,24 +24,34 @@ Abstract:
 //
 #ifdef __GNUC__
 #include <uuid/uuid.h>
+#include <unistd.h>
+#endif
+#include <sys/types.h>
 #include <sys/stat.h>
+#ifdef __linux__
+#include <errno.h>
+#include <sys/sendfile.h>
 #endif
 #include <string.h>
+#include <ctype.h>
 #ifndef __GNUC__
 #include <io.h>
+#include <process.h>
+#define getpid _getpid
 #endif
 #include <assert.h>
 
 #include "GenFvInternalLib.h"
 #include "FvLib.h"
 #include "PeCoffLib.h"
+#include "Crc32.h"
 #include "WinNtInclude.h"
-
-BOOLEAN mArm = FALSE;
-STATIC UINT32   MaxFfsAlignment = 0;
+#include "ParallelJobs.h"
+#include "ToolProfile.h"
 
 EFI_GUID  mEfiFirmwareVolumeTopFileGuid = EFI_FFS_VOLUME_TOP_FILE_GUID;
-EFI_GUID  mFileGuidArray [MAX_NUMBER_OF_FILES_IN_FV];
+EFI_GUID  mPeiAprioriFileNameGuid   = {0x1B45CC0A, 0x156A, 0x428A, { 0xAF, 0x62, 0x49, 0x86, 0x4D, 0xA0, 0xE6, 0xE6 }};
+EFI_GUID  mDxeAprioriFileNameGuid   = {0xFC510EE7, 0xFFDC, 0x11D4, { 0xBD, 0x41, 0x00, 0x80, 0xC7, 0x3C, 0x88, 0x81 }};
 EFI_GUID  mZeroGuid                 = {0x0, 0x0, 0x0, {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}};
 EFI_GUID  mDefaultCapsuleGuid       = {0x3B6686BD, 0x0D76, 0x4030, { 0xB7, 0x0E, 0xB5, 0x51, 0x9E, 0x2F, 0xC5, 0xA0 }};
 
@@ -159,23 +169,370 @@ UINT8                                   m64kRecoveryStartupApDataArray[SIZEOF_ST
 FV_INFO                     mFvDataInfo;
 CAP_INFO                    mCapDataInfo;
 
-EFI_PHYSICAL_ADDRESS mFvBaseAddress[0x10];
-UINT32               mFvBaseAddressNumber = 0;
+STATIC
+EFI_STATUS
+GrowTable (
+  IN OUT VOID     **Table,
+  IN OUT UINTN    *MaxNumber,
+  IN     UINTN    Number,
+  IN     UINTN    EntrySize
+  )
+/*++
+
+Routine Description:
+
+  This function makes sure a table has room for more than Number entries.
+  A table that is too small doubles until it is large enough, the new
+  entries are zeroed.
+
+Arguments:
+
+  Table           Pointer to the table, updated if the table moves.
+  MaxNumber       Number of entries allocated, updated if the table grows.
+  Number          Index of the entry that must fit.
+  EntrySize       Size of one entry in bytes.
+
+Returns:
+
+  EFI_SUCCESS           The table is large enough.
+  EFI_OUT_OF_RESOURCES  No resource to grow the table, it is left unchanged.
+
+--*/
+{
+  UINTN   NewMaxNumber;
+  UINT8   *NewTable;
+
+  if (Number < *MaxNumber) {
+    return EFI_SUCCESS;
+  }
+
+  NewMaxNumber = (*MaxNumber == 0) ? FV_INFO_INITIAL_ENTRIES : *MaxNumber;
+  while (NewMaxNumber <= Number) {
+    NewMaxNumber *= 2;
+  }
+
+  NewTable = (UINT8 *) realloc (*Table, NewMaxNumber * EntrySize);
+  if (NewTable == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+  memset (NewTable + *MaxNumber * EntrySize, 0, (NewMaxNumber - *MaxNumber) * EntrySize);
+
+  *Table     = NewTable;
+  *MaxNumber = NewMaxNumber;
+  return EFI_SUCCESS;
+}
+
+STATIC
+CHAR8 *
+AddPoolName (
+  IN OUT NAME_POOL  **Pool,
+  IN     CHAR8      *Name
+  )
+/*++
+
+Routine Description:
+
+  This function copies a file name into a name pool. Names are packed into
+  chunks of FV_INFO_NAME_POOL_SIZE bytes, so a file list costs one small
+  allocation per chunk instead of one _MAX_PATH buffer per file.
+
+Arguments:
+
+  Pool            Name pool, updated when a new chunk is added.
+  Name            File name to copy.
+
+Returns:
+
+  The copy of the name, or NULL if no resource is available.
+
+--*/
+{
+  NAME_POOL   *Chunk;
+  UINTN       Length;
+  UINTN       Size;
+  CHAR8       *Copy;
+
+  Length = strlen (Name) + 1;
+  Chunk  = *Pool;
+  if (Chunk == NULL || Chunk->Size - Chunk->Used < Length) {
+    Size = FV_INFO_NAME_POOL_SIZE;
+    if (Size < Length) {
+      Size = Length;
+    }
+    Chunk = (NAME_POOL *) malloc (sizeof (NAME_POOL) + Size);
+    if (Chunk == NULL) {
+      return NULL;
+    }
+    Chunk->Next = *Pool;
+    Chunk->Size = Size;
+    Chunk->Used = 0;
+    *Pool       = Chunk;
+  }
+
+  Copy = (CHAR8 *) (Chunk + 1) + Chunk->Used;
+  memcpy (Copy, Name, Length);
+  Chunk->Used += Length;
+  return Copy;
+}
+
+STATIC
+VOID
+FreeNamePool (
+  IN NAME_POOL  *Pool
+  )
+/*++
+
+Routine Description:
+
+  This function frees all chunks of a name pool.
+
+Arguments:
+
+  Pool            Name pool to free.
+
+Returns:
+
+  None
+
+--*/
+{
+  NAME_POOL   *Next;
+
+  while (Pool != NULL) {
+    Next = Pool->Next;
+    free (Pool);
+    Pool = Next;
+  }
+}
 
 EFI_STATUS
-ParseFvInf (
-  IN  MEMORY_FILE  *InfFile,
+ReserveFvBlocks (
+  IN OUT FV_INFO   *FvInfo,
+  IN     UINTN     Number
+  )
+/*++
+
+Routine Description:
+
+  This function makes sure the block map of a FV_INFO can hold Number + 1
+  entries, plus the zero entry that terminates it.
+
+Arguments:
+
+  FvInfo          FV information to update.
+  Number          Index of the block map entry that must fit.
+
+Returns:
+
+  EFI_SUCCESS           The block map is large enough.
+  EFI_OUT_OF_RESOURCES  No resource to grow the block map.
+
+--*/
+{
+  return GrowTable ((VOID **) &FvInfo->FvBlocks, &FvInfo->FvBlockMaxNumber, Number + 1, sizeof (EFI_FV_BLOCK_MAP_ENTRY));
+}
+
+EFI_STATUS
+AddFvFile (
+  IN OUT FV_INFO   *FvInfo,
+  IN     CHAR8     *FileName,
+  IN     UINT32    SizeofFile
+  )
+/*++
+
+Routine Description:
+
+  This function appends a FFS file to the file list of a FV_INFO.
+
+Arguments:
+
+  FvInfo          FV information to update.
+  FileName        Name of the FFS file.
+  SizeofFile      Size the file takes in the FV, or 0 to use its real size.
+
+Returns:
+
+  EFI_SUCCESS           The file was added.
+  EFI_OUT_OF_RESOURCES  No resource to grow the file list.
+
+--*/
+{
+  UINTN       MaxNumber;
+  CHAR8       *Name;
+
+  MaxNumber = FvInfo->FvFileMaxNumber;
+  if (EFI_ERROR (GrowTable ((VOID **) &FvInfo->SizeofFvFiles, &MaxNumber, FvInfo->FvFileNumber, sizeof (UINT32))) ||
+      EFI_ERROR (GrowTable ((VOID **) &FvInfo->FvFiles, &FvInfo->FvFileMaxNumber, FvInfo->FvFileNumber, sizeof (CHAR8 *)))) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Name = AddPoolName (&FvInfo->NamePool, FileName);
+  if (Name == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  FvInfo->FvFiles[FvInfo->FvFileNumber]       = Name;
+  FvInfo->SizeofFvFiles[FvInfo->FvFileNumber] = SizeofFile;
+  FvInfo->FvFileNumber++;
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+AddCapFile (
+  IN OUT CAP_INFO  *CapInfo,
+  IN     CHAR8     *FileName
+  )
+/*++
+
+Routine Description:
+
+  This function appends a file to the file list of a CAP_INFO.
+
+Arguments:
+
+  CapInfo         Capsule information to update.
+  FileName        Name of the capsule component file.
+
+Returns:
+
+  EFI_SUCCESS           The file was added.
+  EFI_OUT_OF_RESOURCES  No resource to grow the file list.
+
+--*/
+{
+  CHAR8       *Name;
+
+  if (EFI_ERROR (GrowTable ((VOID **) &CapInfo->CapFiles, &CapInfo->CapFileMaxNumber, CapInfo->CapFileNumber, sizeof (CHAR8 *)))) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Name = AddPoolName (&CapInfo->NamePool, FileName);
+  if (Name == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  CapInfo->CapFiles[CapInfo->CapFileNumber++] = Name;
+  return EFI_SUCCESS;
+}
+
+STATIC
+VOID
+FreeFvFileImages (
+  IN OUT FV_INFO   *FvInfo
+  )
+/*++
+
+Routine Description:
+
+  This function frees the files read by LoadFvFiles.
+
+Arguments:
+
+  FvInfo          FV information to clean up.
+
+Returns:
+
+  None
+
+--*/
+{
+  UINTN   Index;
+
+  if (FvInfo->FvFileImages == NULL) {
+    return;
+  }
+
+  for (Index = 0; Index < FvInfo->FvFileNumber; Index++) {
+    free (FvInfo->FvFileImages[Index].Buffer);
+  }
+  free (FvInfo->FvFileImages);
+  FvInfo->FvFileImages = NULL;
+}
+
+VOID
+FreeFvInfo (
+  IN OUT FV_INFO   *FvInfo
+  )
+/*++
+
+Routine Description:
+
+  This function frees the block map, the file list and the child FV base
+  addresses of a FV_INFO.
+
+Arguments:
+
+  FvInfo          FV information to clean up.
+
+Returns:
+
+  None
+
+--*/
+{
+  FreeFvFileImages (FvInfo);
+  free (FvInfo->FvBlocks);
+  free (FvInfo->FvFiles);
+  free (FvInfo->SizeofFvFiles);
+  free (FvInfo->ChildFvBaseAddress);
+  FreeNamePool (FvInfo->NamePool);
+
+  FvInfo->FvBlocks                    = NULL;
+  FvInfo->FvBlockMaxNumber            = 0;
+  FvInfo->FvFiles                     = NULL;
+  FvInfo->SizeofFvFiles               = NULL;
+  FvInfo->FvFileNumber                = 0;
+  FvInfo->FvFileMaxNumber             = 0;
+  FvInfo->NamePool                    = NULL;
+  FvInfo->ChildFvBaseAddress          = NULL;
+  FvInfo->ChildFvBaseAddressNumber    = 0;
+  FvInfo->ChildFvBaseAddressMaxNumber = 0;
+}
+
+VOID
+FreeCapInfo (
+  IN OUT CAP_INFO  *CapInfo
+  )
+/*++
+
+Routine Description:
+
+  This function frees the file list of a CAP_INFO.
+
+Arguments:
+
+  CapInfo         Capsule information to clean up.
+
+Returns:
+
+  None
+
+--*/
+{
+  free (CapInfo->CapFiles);
+  FreeNamePool (CapInfo->NamePool);
+
+  CapInfo->CapFiles         = NULL;
+  CapInfo->CapFileNumber    = 0;
+  CapInfo->CapFileMaxNumber = 0;
+  CapInfo->NamePool         = NULL;
+}
+
+STATIC
+EFI_STATUS
+ReadFvInfo (
+  IN  INF_INDEX    *InfIndex,
   OUT FV_INFO      *FvInfo
   )
 /*++
 
 Routine Description:
 
-  This function parses a FV.INF file and copies info into a FV_INFO structure.
+  This function copies the info of an indexed FV.INF file into a FV_INFO structure.
 
 Arguments:
 
-  InfFile         Memory file image.
+  InfIndex        Index of the INF file.
   FvInfo          Information read from INF file.
 
 Returns:
@@ -195,8 +552,8 @@ Returns:
   //
   // Read the FV base address
   //
-  if (!mFvDataInfo.BaseAddressSet) {
-    Status = FindToken (InfFile, OPTIONS_SECTION_STRING, EFI_FV_BASE_ADDRESS_STRING, 0, Value);
+  if (!FvInfo->BaseAddressSet) {
+    Status = InfIndexFindToken (InfIndex, OPTIONS_SECTION_STRING, EFI_FV_BASE_ADDRESS_STRING, 0, Value);
     if (Status == EFI_SUCCESS) {
       //
       // Get the base address
@@ -217,7 +574,7 @@ Returns:
   // Read the FV File System Guid
   //
   if (!FvInfo->FvFileSystemGuidSet) {
-    Status = FindToken (InfFile, OPTIONS_SECTION_STRING, EFI_FV_FILESYSTEMGUID_STRING, 0, Value);
+    Status = InfIndexFindToken (InfIndex, OPTIONS_SECTION_STRING, EFI_FV_FILESYSTEMGUID_STRING, 0, Value);
     if (Status == EFI_SUCCESS) {
       //
       // Get the guid value
@@ -235,7 +592,7 @@ Returns:
   //
   // Read the FV Extension Header File Name
   //
-  Status = FindToken (InfFile, ATTRIBUTES_SECTION_STRING, EFI_FV_EXT_HEADER_FILE_NAME, 0, Value);
+  Status = InfIndexFindToken (InfIndex, ATTRIBUTES_SECTION_STRING, EFI_FV_EXT_HEADER_FILE_NAME, 0, Value);
   if (Status == EFI_SUCCESS) {
     strcpy (FvInfo->FvExtHeaderFile, Value);
   }
@@ -243,7 +600,7 @@ Returns:
   //
   // Read the FV file name
   //
-  Status = FindToken (InfFile, OPTIONS_SECTION_STRING, EFI_FV_FILE_NAME_STRING, 0, Value);
+  Status = InfIndexFindToken (InfIndex, OPTIONS_SECTION_STRING, EFI_FV_FILE_NAME_STRING, 0, Value);
   if (Status == EFI_SUCCESS) {
     //
     // copy the file name
@@ -256,7 +613,7 @@ Returns:
   //
   for (Index = 0; Index < sizeof (mFvbAttributeName)/sizeof (CHAR8 *); Index ++) {
     if ((mFvbAttributeName [Index] != NULL) && \
-        (FindToken (InfFile, ATTRIBUTES_SECTION_STRING, mFvbAttributeName [Index], 0, Value) == EFI_SUCCESS)) {
+        (InfIndexFindToken (InfIndex, ATTRIBUTES_SECTION_STRING, mFvbAttributeName [Index], 0, Value) == EFI_SUCCESS)) {
       if ((strcmp (Value, TRUE_STRING) == 0) || (strcmp (Value, ONE_STRING) == 0)) {
         FvInfo->FvAttributes |= 1 << Index;
       } else if ((strcmp (Value, FALSE_STRING) != 0) && (strcmp (Value, ZERO_STRING) != 0)) {
@@ -270,7 +627,7 @@ Returns:
   // Read Fv Alignment
   //
   for (Index = 0; Index < sizeof (mFvbAlignmentName)/sizeof (CHAR8 *); Index ++) {
-    if (FindToken (InfFile, ATTRIBUTES_SECTION_STRING, mFvbAlignmentName [Index], 0, Value) == EFI_SUCCESS) {
+    if (InfIndexFindToken (InfIndex, ATTRIBUTES_SECTION_STRING, mFvbAlignmentName [Index], 0, Value) == EFI_SUCCESS) {
       if (strcmp (Value, TRUE_STRING) == 0) {
         FvInfo->FvAttributes |= Index << 16;
         DebugMsg (NULL, 0, 9, "FV file alignment", "Align = %s", mFvbAlignmentName [Index]);
@@ -282,12 +639,16 @@ Returns:
   //
   // Read block maps
   //
-  for (Index = 0; Index < MAX_NUMBER_OF_FV_BLOCKS; Index++) {
+  for (Index = 0;; Index++) {
+    if (EFI_ERROR (ReserveFvBlocks (FvInfo, Index))) {
+      Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+      return EFI_OUT_OF_RESOURCES;
+    }
     if (FvInfo->FvBlocks[Index].Length == 0) {
       //
       // Read block size
       //
-      Status = FindToken (InfFile, OPTIONS_SECTION_STRING, EFI_BLOCK_SIZE_STRING, Index, Value);
+      Status = InfIndexFindToken (InfIndex, OPTIONS_SECTION_STRING, EFI_BLOCK_SIZE_STRING, Index, Value);
 
       if (Status == EFI_SUCCESS) {
         //
@@ -306,7 +667,7 @@ Returns:
         // If there is no blocks size, but there is the number of block, then we have a mismatched pair
         // and should return an error.
         //
-        Status = FindToken (InfFile, OPTIONS_SECTION_STRING, EFI_NUM_BLOCKS_STRING, Index, Value);
+        Status = InfIndexFindToken (InfIndex, OPTIONS_SECTION_STRING, EFI_NUM_BLOCKS_STRING, Index, Value);
         if (!EFI_ERROR (Status)) {
           Error (NULL, 0, 2000, "Invalid parameter", "both %s and %s must be specified.", EFI_NUM_BLOCKS_STRING, EFI_BLOCK_SIZE_STRING);
           return EFI_ABORTED;
@@ -321,7 +682,7 @@ Returns:
       //
       // Read blocks number
       //
-      Status = FindToken (InfFile, OPTIONS_SECTION_STRING, EFI_NUM_BLOCKS_STRING, Index, Value);
+      Status = InfIndexFindToken (InfIndex, OPTIONS_SECTION_STRING, EFI_NUM_BLOCKS_STRING, Index, Value);
 
       if (Status == EFI_SUCCESS) {
         //
@@ -347,24 +708,21 @@ Returns:
   //
   // Read files
   //
-  Number = 0;
-  for (Number = 0; Number < MAX_NUMBER_OF_FILES_IN_FV; Number ++) {
-    if (FvInfo->FvFiles[Number][0] == '\0') {
-      break;
-    }
-  }
-
-  for (Index = 0; Index < MAX_NUMBER_OF_FILES_IN_FV; Index++) {
+  Number = FvInfo->FvFileNumber;
+  for (Index = 0;; Index++) {
     //
     // Read the FFS file list
     //
-    Status = FindToken (InfFile, FILES_SECTION_STRING, EFI_FILE_NAME_STRING, Index, Value);
+    Status = InfIndexFindToken (InfIndex, FILES_SECTION_STRING, EFI_FILE_NAME_STRING, Index, Value);
 
     if (Status == EFI_SUCCESS) {
       //
       // Add the file
       //
-      strcpy (FvInfo->FvFiles[Number + Index], Value);
+      if (EFI_ERROR (AddFvFile (FvInfo, Value, 0))) {
+        Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+        return EFI_OUT_OF_RESOURCES;
+      }
       DebugMsg (NULL, 0, 9, "FV component file", "the %uth name is %s", (unsigned) Index, Value);
     } else {
       break;
@@ -378,6 +736,45 @@ Returns:
   return EFI_SUCCESS;
 }
 
+EFI_STATUS
+ParseFvInf (
+  IN  MEMORY_FILE  *InfFile,
+  OUT FV_INFO      *FvInfo
+  )
+/*++
+
+Routine Description:
+
+  This function parses a FV.INF file and copies info into a FV_INFO structure.
+  The file is indexed once, every token lookup then uses the index.
+
+Arguments:
+
+  InfFile         Memory file image.
+  FvInfo          Information read from INF file.
+
+Returns:
+
+  EFI_SUCCESS           INF file information successfully retrieved.
+  EFI_ABORTED           INF file has an invalid format.
+  EFI_NOT_FOUND         A required string was not found in the INF file.
+  EFI_OUT_OF_RESOURCES  No resource to index the INF file.
+--*/
+{
+  INF_INDEX   *InfIndex;
+  EFI_STATUS  Status;
+
+  Status = InfIndexCreate (InfFile, &InfIndex);
+  if (EFI_ERROR (Status)) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    return Status;
+  }
+
+  Status = ReadFvInfo (InfIndex, FvInfo);
+  InfIndexFree (InfIndex);
+  return Status;
+}
+
 VOID
 UpdateFfsFileState (
   IN EFI_FFS_FILE_HEADER          *FfsFile,
@@ -674,603 +1071,1886 @@ Returns:
   }
 }
 
-EFI_STATUS
-WriteMapFile (
-  IN OUT FILE                  *FvMapFile,
-  IN     CHAR8                 *FileName,
-  IN     EFI_FFS_FILE_HEADER   *FfsFile, 
-  IN     EFI_PHYSICAL_ADDRESS  ImageBaseAddress,
-  IN     PE_COFF_LOADER_IMAGE_CONTEXT *pImageContext
-  )
-/*++
-
-Routine Description:
+//
+// Relocation index of a PE32 or TE image of a cached FFS file, keyed by
+// the offset of the image section in the file. Index is NULL for an image
+// PeCoffLoaderBuildRelocationIndex does not handle.
+//
+typedef struct {
+  UINT32                        SectionOffset;
+  PE_COFF_RELOCATION_INDEX      *Index;
+} FV_RELOC_INDEX;
 
-  This function gets the basic debug information (entrypoint, baseaddress, .text, .data section base address)
-  from PE/COFF image and abstracts Pe Map file information and add them into FvMap file for Debug.
+//
+// Relocation indexes of the images of a cached FFS file, built the first
+// time the file is rebased and reused when the file is placed in other
+// FVs. Claimed is set while a FV being generated holds them.
+//
+struct _FV_RELOC_CACHE {
+  UINTN                         Number;
+  FV_RELOC_INDEX                *Indexes;
+  BOOLEAN                       Claimed;
+};
 
-Arguments:
+//
+// Contents of the FFS files read by LoadFvFiles. The cache is only used
+// when a process generates several FVs, see EnableFvFileCache. The FVs may
+// be generated at the same time, mFvFileCacheLock guards the cache. The
+// entries dropped while their relocation indexes are claimed are kept in
+// mFvFileCacheRetired until the cache is freed.
+//
+#define FV_FILE_CACHE_BUCKETS  1024
+
+typedef struct _FV_FILE_CACHE_ENTRY {
+  struct _FV_FILE_CACHE_ENTRY   *Next;
+  CHAR8                         *FileName;
+  UINT8                         *Buffer;
+  UINTN                         Size;
+  UINT32                        Alignment;
+  BOOLEAN                       IsVtf;
+  FV_RELOC_CACHE                RelocCache;
+} FV_FILE_CACHE_ENTRY;
+
+STATIC FV_FILE_CACHE_ENTRY  **mFvFileCache = NULL;
+STATIC FV_FILE_CACHE_ENTRY  *mFvFileCacheRetired = NULL;
+STATIC PARALLEL_LOCK        *mFvFileCacheLock = NULL;
+
+STATIC
+VOID
+FreeFvFileCacheEntry (
+  IN FV_FILE_CACHE_ENTRY  *Entry
+  )
+{
+  UINTN   Index;
 
-  FvMapFile             A pointer to FvMap File
-  FileName              Ffs File PathName
-  FfsFile               A pointer to Ffs file image.
-  ImageBaseAddress      PeImage Base Address.
-  pImageContext         Image Context Information.
-
-Returns:
-
-  EFI_SUCCESS           Added required map information.
+  for (Index = 0; Index < Entry->RelocCache.Number; Index++) {
+    PeCoffLoaderFreeRelocationIndex (Entry->RelocCache.Indexes[Index].Index);
+  }
+  free (Entry->RelocCache.Indexes);
+  free (Entry->FileName);
+  free (Entry->Buffer);
+  free (Entry);
+}
 
---*/
+STATIC
+UINTN
+HashFileName (
+  IN CHAR8    *FileName
+  )
 {
-  CHAR8                               PeMapFileName [_MAX_PATH];
-  CHAR8                               *Cptr, *Cptr2;
-  CHAR8                               FileGuidName [MAX_LINE_LEN];
-  FILE                                *PeMapFile;
-  CHAR8                               Line [MAX_LINE_LEN];
-  CHAR8                               KeyWord [MAX_LINE_LEN];
-  CHAR8                               FunctionName [MAX_LINE_LEN];
-  EFI_PHYSICAL_ADDRESS                FunctionAddress;
-  UINT32                              FunctionType;
-  CHAR8                               FunctionTypeName [MAX_LINE_LEN];
-  UINT32                              Index;
-  UINT32                              AddressOfEntryPoint;
-  UINT32                              Offset;
-  EFI_IMAGE_OPTIONAL_HEADER_UNION     *ImgHdr;
-  EFI_TE_IMAGE_HEADER                 *TEImageHeader;
-  EFI_IMAGE_SECTION_HEADER            *SectionHeader;
-  unsigned long long                  TempLongAddress;
-  UINT32                              TextVirtualAddress;
-  UINT32                              DataVirtualAddress;
-  EFI_PHYSICAL_ADDRESS                LinkTimeBaseAddress;
+  UINTN   Hash;
 
-  //
-  // Init local variable
-  //
-  FunctionType = 0;
-  //
-  // Print FileGuid to string buffer. 
-  //
-  PrintGuidToBuffer (&FfsFile->Name, (UINT8 *)FileGuidName, MAX_LINE_LEN, TRUE);
-  
-  //
-  // Construct Map file Name 
-  //
-  strcpy (PeMapFileName, FileName);
-  
-  //
-  // Change '\\' to '/', unified path format.
-  //
-  Cptr = PeMapFileName;
-  while (*Cptr != '\0') {
-    if (*Cptr == '\\') {
-      *Cptr = FILE_SEP_CHAR;
-    }
-    Cptr ++;
-  }
-  
-  //
-  // Get Map file
-  // 
-  Cptr = PeMapFileName + strlen (PeMapFileName);
-  while ((*Cptr != '.') && (Cptr >= PeMapFileName)) {
-    Cptr --;
-  }
-  if (Cptr < PeMapFileName) {
-    return EFI_NOT_FOUND;
-  } else {
-    *(Cptr + 1) = 'm';
-    *(Cptr + 2) = 'a';
-    *(Cptr + 3) = 'p';
-    *(Cptr + 4) = '\0';
+  Hash = 5381;
+  while (*FileName != '\0') {
+    Hash = Hash * 33 + (UINT8) *FileName++;
   }
+  return Hash % FV_FILE_CACHE_BUCKETS;
+}
 
-  //
-  // Get module Name
-  //
-  Cptr2 = Cptr;
-  while ((*Cptr != FILE_SEP_CHAR) && (Cptr >= PeMapFileName)) {
-    Cptr --;
-  }
-	*Cptr2 = '\0';
-	strcpy (KeyWord, Cptr + 1);
-	*Cptr2 = '.';
+EFI_STATUS
+EnableFvFileCache (
+  VOID
+  )
+/*++
 
-  //
-  // AddressOfEntryPoint and Offset in Image
-  //
-  if (!pImageContext->IsTeImage) {
-  	ImgHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *) ((UINT8 *) pImageContext->Handle + pImageContext->PeCoffHeaderOffset);
-  	AddressOfEntryPoint = ImgHdr->Pe32.OptionalHeader.AddressOfEntryPoint;
-  	Offset = 0;
-    SectionHeader = (EFI_IMAGE_SECTION_HEADER *) (
-                       (UINT8 *) ImgHdr +
-                       sizeof (UINT32) + 
-                       sizeof (EFI_IMAGE_FILE_HEADER) +  
-                       ImgHdr->Pe32.FileHeader.SizeOfOptionalHeader
-                       );
-    Index = ImgHdr->Pe32.FileHeader.NumberOfSections;
-  } else {
-  	TEImageHeader = (EFI_TE_IMAGE_HEADER *) pImageContext->Handle;
-    AddressOfEntryPoint = TEImageHeader->AddressOfEntryPoint;
-    Offset = TEImageHeader->StrippedSize - sizeof (EFI_TE_IMAGE_HEADER);
-    SectionHeader = (EFI_IMAGE_SECTION_HEADER *) (TEImageHeader + 1);
-    Index = TEImageHeader->NumberOfSections;
-  }
+Routine Description:
 
-  //
-  // module information output
-  //
-  if (ImageBaseAddress == 0) {
-    fprintf (FvMapFile, "%s (dummy) (", KeyWord);
-    fprintf (FvMapFile, "BaseAddress=%010llx, ", (unsigned long long) ImageBaseAddress);
-  } else {
-    fprintf (FvMapFile, "%s (Fixed Flash Address, ", KeyWord);
-    fprintf (FvMapFile, "BaseAddress=0x%010llx, ", (unsigned long long) (ImageBaseAddress + Offset));
-  }
+  This function makes LoadFvFiles keep the content of every FFS file it
+  reads, so that a file shared by several FVs of one process is read from
+  disk once. Each FV still gets its own copy of the file to patch. It must
+  be called before the threads that generate the FVs start.
 
-  if (FfsFile->Type != EFI_FV_FILETYPE_SECURITY_CORE && pImageContext->Machine == EFI_IMAGE_MACHINE_IA64) {
-    //
-    // Process IPF PLABEL to get the real address after the image has been rebased. 
-    // PLABEL structure is got by AddressOfEntryPoint offset to ImageBuffer stored in pImageContext->Handle.
-    //
-    fprintf (FvMapFile, "EntryPoint=0x%010llx", (unsigned long long) (*(UINT64 *)((UINTN) pImageContext->Handle + (UINTN) AddressOfEntryPoint)));
-  } else {
-    fprintf (FvMapFile, "EntryPoint=0x%010llx", (unsigned long long) (ImageBaseAddress + AddressOfEntryPoint));
-  }
-  fprintf (FvMapFile, ")\n"); 
-  
-  fprintf (FvMapFile, "(GUID=%s", FileGuidName);
-  TextVirtualAddress = 0;
-  DataVirtualAddress = 0;
-  for (; Index > 0; Index --, SectionHeader ++) {
-    if (stricmp ((CHAR8 *)SectionHeader->Name, ".text") == 0) {
-  		TextVirtualAddress = SectionHeader->VirtualAddress;
-  	} else if (stricmp ((CHAR8 *)SectionHeader->Name, ".data") == 0) {
-  	  DataVirtualAddress = SectionHeader->VirtualAddress;
-  	} else if (stricmp ((CHAR8 *)SectionHeader->Name, ".sdata") == 0) {
-  	  DataVirtualAddress = SectionHeader->VirtualAddress;
-  	}
-  }
-  fprintf (FvMapFile, " .textbaseaddress=0x%010llx", (unsigned long long) (ImageBaseAddress + TextVirtualAddress));
-  fprintf (FvMapFile, " .databaseaddress=0x%010llx", (unsigned long long) (ImageBaseAddress + DataVirtualAddress));
-  fprintf (FvMapFile, ")\n\n");
-   
-  //
-  // Open PeMapFile
-  //
-  PeMapFile = fopen (PeMapFileName, "r");
-  if (PeMapFile == NULL) {
-    // fprintf (stdout, "can't open %s file to reading\n", PeMapFileName);
-    return EFI_ABORTED;
-  }
-  VerboseMsg ("The map file is %s", PeMapFileName);
-  
-  //
-  // Output Functions information into Fv Map file
-  //
-  LinkTimeBaseAddress = 0;
-  while (fgets (Line, MAX_LINE_LEN, PeMapFile) != NULL) {
-    //
-    // Skip blank line
-    //
-    if (Line[0] == 0x0a) {
-      FunctionType = 0;
-      continue;
-    }
-    //
-    // By Address and Static keyword
-    //  
-    if (FunctionType == 0) {
-      sscanf (Line, "%s", KeyWord);
-      if (stricmp (KeyWord, "Address") == 0) {
-        //
-        // function list
-        //
-        FunctionType = 1;
-        fgets (Line, MAX_LINE_LEN, PeMapFile);
-      } else if (stricmp (KeyWord, "Static") == 0) {
-        //
-        // static function list
-        //
-        FunctionType = 2;
-        fgets (Line, MAX_LINE_LEN, PeMapFile);
-      } else if (stricmp (KeyWord, "Preferred") ==0) {
-        sscanf (Line + strlen (" Preferred load address is"), "%llx", &TempLongAddress);
-        LinkTimeBaseAddress = (UINT64) TempLongAddress;
-      }
-      continue;
-    }
-    //
-    // Printf Function Information
-    //
-    if (FunctionType == 1) {
-      sscanf (Line, "%s %s %llx %s", KeyWord, FunctionName, &TempLongAddress, FunctionTypeName);
-      FunctionAddress = (UINT64) TempLongAddress;
-      if (FunctionTypeName [1] == '\0' && (FunctionTypeName [0] == 'f' || FunctionTypeName [0] == 'F')) {
-        fprintf (FvMapFile, "  0x%010llx    ", (unsigned long long) (ImageBaseAddress + FunctionAddress - LinkTimeBaseAddress));
-        fprintf (FvMapFile, "%s\n", FunctionName);
-      }
-    } else if (FunctionType == 2) {
-      sscanf (Line, "%s %s %llx %s", KeyWord, FunctionName, &TempLongAddress, FunctionTypeName);
-      FunctionAddress = (UINT64) TempLongAddress;
-      if (FunctionTypeName [1] == '\0' && (FunctionTypeName [0] == 'f' || FunctionTypeName [0] == 'F')) {
-        fprintf (FvMapFile, "  0x%010llx    ", (unsigned long long) (ImageBaseAddress + FunctionAddress - LinkTimeBaseAddress));
-        fprintf (FvMapFile, "%s\n", FunctionName);
-      }
+Arguments:
+
+  None
+
+Returns:
+
+  EFI_SUCCESS           The cache is enabled.
+  EFI_OUT_OF_RESOURCES  No resource to hold the cache.
+
+--*/
+{
+  if (mFvFileCache == NULL) {
+    mFvFileCache     = (FV_FILE_CACHE_ENTRY **) calloc (FV_FILE_CACHE_BUCKETS, sizeof (FV_FILE_CACHE_ENTRY *));
+    mFvFileCacheLock = CreateParallelLock ();
+    if (mFvFileCache == NULL || mFvFileCacheLock == NULL) {
+      FreeFvFileCache ();
+      return EFI_OUT_OF_RESOURCES;
     }
   }
-  //
-  // Close PeMap file
-  //
-  fprintf (FvMapFile, "\n\n");
-  fclose (PeMapFile);
-  
   return EFI_SUCCESS;
 }
 
-EFI_STATUS
-AddFile (
-  IN OUT MEMORY_FILE          *FvImage,
-  IN FV_INFO                  *FvInfo,
-  IN UINTN                    Index,
-  IN OUT EFI_FFS_FILE_HEADER  **VtfFileImage,
-  IN FILE                     *FvMapFile,
-  IN FILE                     *FvReportFile
+VOID
+RemoveFvFileCacheEntry (
+  IN CHAR8    *FileName
   )
 /*++
 
 Routine Description:
 
-  This function adds a file to the FV image.  The file will pad to the
-  appropriate alignment if required.
+  This function drops the cached content of a file, it must be called when
+  the process writes the file.
 
 Arguments:
 
-  FvImage       The memory image of the FV to add it to.  The current offset
-                must be valid.
-  FvInfo        Pointer to information about the FV.
-  Index         The file in the FvInfo file list to add.
-  VtfFileImage  A pointer to the VTF file within the FvImage.  If this is equal
-                to the end of the FvImage then no VTF previously found.
-  FvMapFile     Pointer to FvMap File
-  FvReportFile  Pointer to FvReport File
+  FileName        Name of the file.
 
 Returns:
 
-  EFI_SUCCESS              The function completed successfully.
-  EFI_INVALID_PARAMETER    One of the input parameters was invalid.
-  EFI_ABORTED              An error occurred.
-  EFI_OUT_OF_RESOURCES     Insufficient resources exist to complete the add.
+  None
 
 --*/
 {
-  FILE                  *NewFile;
-  UINTN                 FileSize;
-  UINT8                 *FileBuffer;
-  UINTN                 NumBytesRead;
-  UINT32                CurrentFileAlignment;
-  EFI_STATUS            Status;
-  UINTN                 Index1;
-  UINT8                 FileGuidString[PRINTED_GUID_BUFFER_SIZE];
-  
-  Index1 = 0;
-  //
-  // Verify input parameters.
-  //
-  if (FvImage == NULL || FvInfo == NULL || FvInfo->FvFiles[Index][0] == 0 || VtfFileImage == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
+  FV_FILE_CACHE_ENTRY   **Link;
+  FV_FILE_CACHE_ENTRY   *Entry;
 
-  //
-  // Read the file to add
-  //
-  NewFile = fopen (FvInfo->FvFiles[Index], "rb");
+  if (mFvFileCache == NULL || FileName == NULL) {
+    return;
+  }
 
-  if (NewFile == NULL) {
-    Error (NULL, 0, 0001, "Error opening file", FvInfo->FvFiles[Index]);
-    return EFI_ABORTED;
+  AcquireParallelLock (mFvFileCacheLock);
+  for (Link = &mFvFileCache[HashFileName (FileName)]; *Link != NULL; Link = &(*Link)->Next) {
+    Entry = *Link;
+    if (strcmp (Entry->FileName, FileName) == 0) {
+      *Link = Entry->Next;
+      if (Entry->RelocCache.Claimed) {
+        Entry->Next         = mFvFileCacheRetired;
+        mFvFileCacheRetired = Entry;
+      } else {
+        FreeFvFileCacheEntry (Entry);
+      }
+      break;
+    }
   }
+  ReleaseParallelLock (mFvFileCacheLock);
+}
 
-  //
-  // Get the file size
-  //
-  FileSize = _filelength (fileno (NewFile));
+VOID
+FreeFvFileCache (
+  VOID
+  )
+/*++
 
-  //
-  // Read the file into a buffer
-  //
-  FileBuffer = malloc (FileSize);
-  if (FileBuffer == NULL) {
-    Error (NULL, 0, 4001, "Resouce", "memory cannot be allocated!");
-    return EFI_OUT_OF_RESOURCES;
-  }
+Routine Description:
 
-  NumBytesRead = fread (FileBuffer, sizeof (UINT8), FileSize, NewFile);
+  This function frees the file cache and disables it.
 
-  //
-  // Done with the file, from this point on we will just use the buffer read.
-  //
-  fclose (NewFile);
-  
-  //
-  // Verify read successful
-  //
-  if (NumBytesRead != sizeof (UINT8) * FileSize) {
-    free  (FileBuffer);
-    Error (NULL, 0, 0004, "Error reading file", FvInfo->FvFiles[Index]);
-    return EFI_ABORTED;
-  }
-  
-  //
-  // For None PI Ffs file, directly add them into FvImage.
-  //
-  if (!FvInfo->IsPiFvImage) {
-    memcpy (FvImage->CurrentFilePointer, FileBuffer, FileSize);
-    if (FvInfo->SizeofFvFiles[Index] > FileSize) {
-    	FvImage->CurrentFilePointer += FvInfo->SizeofFvFiles[Index];
-    } else {
-    	FvImage->CurrentFilePointer += FileSize;
+Arguments:
+
+  None
+
+Returns:
+
+  None
+
+--*/
+{
+  UINTN                 Index;
+  FV_FILE_CACHE_ENTRY   *Entry;
+
+  if (mFvFileCache != NULL) {
+    for (Index = 0; Index < FV_FILE_CACHE_BUCKETS; Index++) {
+      while (mFvFileCache[Index] != NULL) {
+        Entry               = mFvFileCache[Index];
+        mFvFileCache[Index] = Entry->Next;
+        FreeFvFileCacheEntry (Entry);
+      }
     }
-    goto Done;
   }
-  
-  //
-  // Verify Ffs file
-  //
-  Status = VerifyFfsFile ((EFI_FFS_FILE_HEADER *)FileBuffer);
-  if (EFI_ERROR (Status)) {
-    free (FileBuffer);
-    Error (NULL, 0, 3000, "Invalid", "%s is not a valid FFS file.", FvInfo->FvFiles[Index]);
-    return EFI_INVALID_PARAMETER;
+  while (mFvFileCacheRetired != NULL) {
+    Entry               = mFvFileCacheRetired;
+    mFvFileCacheRetired = Entry->Next;
+    FreeFvFileCacheEntry (Entry);
   }
+  free (mFvFileCache);
+  FreeParallelLock (mFvFileCacheLock);
+  mFvFileCache     = NULL;
+  mFvFileCacheLock = NULL;
+}
 
-  //
-  // Verify space exists to add the file
-  //
-  if (FileSize > (UINTN) ((UINTN) *VtfFileImage - (UINTN) FvImage->CurrentFilePointer)) {
-    free (FileBuffer);
-    Error (NULL, 0, 4002, "Resource", "FV space is full, not enough room to add file %s.", FvInfo->FvFiles[Index]);
-    return EFI_OUT_OF_RESOURCES;
-  }
+STATIC
+VOID
+ClaimFvRelocCache (
+  IN     FV_FILE_CACHE_ENTRY   *Entry,
+  IN OUT FV_FILE_IMAGE         *Image
+  )
+/*++
 
-  //
-  // Verify the input file is the duplicated file in this Fv image
-  //
-  for (Index1 = 0; Index1 < Index; Index1 ++) {
-    if (CompareGuid ((EFI_GUID *) FileBuffer, &mFileGuidArray [Index1]) == 0) {
-      Error (NULL, 0, 2000, "Invalid parameter", "the %dth file and %uth file have the same file GUID.", (unsigned) Index1 + 1, (unsigned) Index + 1);
-      PrintGuid ((EFI_GUID *) FileBuffer);
-      return EFI_INVALID_PARAMETER;
-    }
-  }
-  CopyMem (&mFileGuidArray [Index], FileBuffer, sizeof (EFI_GUID));
+Routine Description:
 
-  //
-  // Update the file state based on polarity of the FV.
-  //
-  UpdateFfsFileState (
-    (EFI_FFS_FILE_HEADER *) FileBuffer,
-    (EFI_FIRMWARE_VOLUME_HEADER *) FvImage->FileImage
-    );
+  This function gives the relocation indexes of a cached file to a copy of
+  the file loaded for the current FV, unless another copy holds them. The
+  copies of one FV, and the FVs generated at the same time, are rebased at
+  the same time, so a file placed twice only gets them for one copy, the
+  other copies are rebased without index. The caller owns the cache lock.
 
-  //
-  // Check if alignment is required
-  //
-  ReadFfsAlignment ((EFI_FFS_FILE_HEADER *) FileBuffer, &CurrentFileAlignment);
-  
-  //
-  // Find the largest alignment of all the FFS files in the FV
-  //
-  if (CurrentFileAlignment > MaxFfsAlignment) {
-    MaxFfsAlignment = CurrentFileAlignment;
-  }
-  //
-  // If we have a VTF file, add it at the top.
-  //
-  if (IsVtfFile ((EFI_FFS_FILE_HEADER *) FileBuffer)) {
-    if ((UINTN) *VtfFileImage == (UINTN) FvImage->Eof) {
-      //
-      // No previous VTF, add this one.
-      //
-      *VtfFileImage = (EFI_FFS_FILE_HEADER *) (UINTN) ((UINTN) FvImage->FileImage + FvInfo->Size - FileSize);
-      //
-      // Sanity check. The file MUST align appropriately
-      //
-      if (((UINTN) *VtfFileImage + sizeof (EFI_FFS_FILE_HEADER) - (UINTN) FvImage->FileImage) % (1 << CurrentFileAlignment)) {
-        Error (NULL, 0, 3000, "Invalid", "VTF file cannot be aligned on a %u-byte boundary.", (unsigned) (1 << CurrentFileAlignment));
-        free (FileBuffer);
-        return EFI_ABORTED;
-      }
-      //
-      // Rebase the PE or TE image in FileBuffer of FFS file for XIP 
-      // Rebase for the debug genfvmap tool
-      //
-      Status = FfsRebase (FvInfo, FvInfo->FvFiles[Index], (EFI_FFS_FILE_HEADER *) FileBuffer, (UINTN) *VtfFileImage - (UINTN) FvImage->FileImage, FvMapFile);
-      if (EFI_ERROR (Status)) {
-        Error (NULL, 0, 3000, "Invalid", "Could not rebase %s.", FvInfo->FvFiles[Index]);
-        return Status;
-      }	  
-      //
-      // copy VTF File
-      //
-      memcpy (*VtfFileImage, FileBuffer, FileSize);
-      
-      PrintGuidToBuffer ((EFI_GUID *) FileBuffer, FileGuidString, sizeof (FileGuidString), TRUE); 
-      fprintf (FvReportFile, "0x%08X %s\n", (unsigned)(UINTN) (((UINT8 *)*VtfFileImage) - (UINTN)FvImage->FileImage), FileGuidString);
+Arguments:
 
-      free (FileBuffer);
-      DebugMsg (NULL, 0, 9, "Add VTF FFS file in FV image", NULL);
-      return EFI_SUCCESS;
-    } else {
-      //
-      // Already found a VTF file.
-      //
-      Error (NULL, 0, 3000, "Invalid", "multiple VTF files are not permitted within a single FV.");
-      free (FileBuffer);
-      return EFI_ABORTED;
-    }
-  }
+  Entry           Cache entry of the file.
+  Image           Copy of the file loaded for the current FV.
 
-  //
-  // Add pad file if necessary
-  //
-  Status = AddPadFile (FvImage, 1 << CurrentFileAlignment, *VtfFileImage, NULL);
-  if (EFI_ERROR (Status)) {
-    Error (NULL, 0, 4002, "Resource", "FV space is full, could not add pad file for data alignment property.");
-    free (FileBuffer);
-    return EFI_ABORTED;
-  }
-  //
-  // Add file
-  //
-  if ((UINTN) (FvImage->CurrentFilePointer + FileSize) <= (UINTN) (*VtfFileImage)) {
-    //
-    // Rebase the PE or TE image in FileBuffer of FFS file for XIP. 
-    // Rebase Bs and Rt drivers for the debug genfvmap tool.
-    //
-    Status = FfsRebase (FvInfo, FvInfo->FvFiles[Index], (EFI_FFS_FILE_HEADER *) FileBuffer, (UINTN) FvImage->CurrentFilePointer - (UINTN) FvImage->FileImage, FvMapFile);
-	if (EFI_ERROR (Status)) {
-	  Error (NULL, 0, 3000, "Invalid", "Could not rebase %s.", FvInfo->FvFiles[Index]);
-	  return Status;
-	}	  	
-    //
-    // Copy the file
-    //
-    memcpy (FvImage->CurrentFilePointer, FileBuffer, FileSize);
-    PrintGuidToBuffer ((EFI_GUID *) FileBuffer, FileGuidString, sizeof (FileGuidString), TRUE); 
-    fprintf (FvReportFile, "0x%08X %s\n", (unsigned) (FvImage->CurrentFilePointer - FvImage->FileImage), FileGuidString);
-    FvImage->CurrentFilePointer += FileSize;
-  } else {
-    Error (NULL, 0, 4002, "Resource", "FV space is full, cannot add file %s.", FvInfo->FvFiles[Index]);
-    free (FileBuffer);
-    return EFI_ABORTED;
-  }
-  //
-  // Make next file start at QWord Boundry
-  //
-  while (((UINTN) FvImage->CurrentFilePointer & (EFI_FFS_FILE_HEADER_ALIGNMENT - 1)) != 0) {
-    FvImage->CurrentFilePointer++;
+Returns:
+
+  None
+
+--*/
+{
+  if (!Entry->RelocCache.Claimed) {
+    Entry->RelocCache.Claimed = TRUE;
+    Image->RelocCache         = &Entry->RelocCache;
   }
+}
 
-Done: 
-  //
-  // Free allocated memory.
-  //
-  free (FileBuffer);
+STATIC
+VOID
+ReleaseFvRelocCaches (
+  IN OUT FV_INFO   *FvInfo
+  )
+/*++
 
-  return EFI_SUCCESS;
+Routine Description:
+
+  This function gives back the relocation indexes claimed by the files of
+  a FV, once the FV no longer rebases them.
+
+Arguments:
+
+  FvInfo          FV information whose files were loaded by LoadFvFiles.
+
+Returns:
+
+  None
+
+--*/
+{
+  UINTN   Index;
+
+  if (FvInfo->FvFileImages == NULL) {
+    return;
+  }
+
+  AcquireParallelLock (mFvFileCacheLock);
+  for (Index = 0; Index < FvInfo->FvFileNumber; Index++) {
+    if (FvInfo->FvFileImages[Index].RelocCache != NULL) {
+      FvInfo->FvFileImages[Index].RelocCache->Claimed = FALSE;
+      FvInfo->FvFileImages[Index].RelocCache          = NULL;
+    }
+  }
+  ReleaseParallelLock (mFvFileCacheLock);
 }
 
+STATIC
 EFI_STATUS
-PadFvImage (
-  IN MEMORY_FILE          *FvImage,
-  IN EFI_FFS_FILE_HEADER  *VtfFileImage
+LoadFvFileImage (
+  IN     CHAR8           *FileName,
+  IN OUT FV_FILE_IMAGE   *Image
   )
 /*++
 
 Routine Description:
 
-  This function places a pad file between the last file in the FV and the VTF
-  file if the VTF file exists.
+  This function reads one FFS file into a buffer owned by Image, through
+  the file cache when it is enabled.
 
 Arguments:
 
-  FvImage       Memory file for the FV memory image
-  VtfFileImage  The address of the VTF file.  If this is the end of the FV
-                image, no VTF exists and no pad file is needed.
+  FileName        Name of the FFS file.
+  Image           Receives the file content, size, alignment and VTF flag.
 
 Returns:
 
-  EFI_SUCCESS             Completed successfully.
-  EFI_INVALID_PARAMETER   One of the input parameters was NULL.
+  EFI_SUCCESS           The file was read.
+  EFI_ABORTED           The file could not be opened or read.
+  EFI_OUT_OF_RESOURCES  No resource to hold the file.
 
 --*/
 {
-  EFI_FFS_FILE_HEADER *PadFile;
-  UINTN               FileSize;
+  FILE                  *fpin;
+  FV_FILE_CACHE_ENTRY   *Entry;
+  FV_FILE_CACHE_ENTRY   *CachedEntry;
+  EFI_FFS_FILE_HEADER   FfsHeader;
+  UINTN                 NumBytesRead;
+  UINTN                 Bucket;
+
+  Entry  = NULL;
+  Bucket = 0;
+  if (mFvFileCache != NULL) {
+    Bucket = HashFileName (FileName);
+    AcquireParallelLock (mFvFileCacheLock);
+    for (Entry = mFvFileCache[Bucket]; Entry != NULL; Entry = Entry->Next) {
+      if (strcmp (Entry->FileName, FileName) == 0) {
+        break;
+      }
+    }
+    if (Entry != NULL) {
+      Image->Size      = Entry->Size;
+      Image->Alignment = Entry->Alignment;
+      Image->IsVtf     = Entry->IsVtf;
+      Image->Buffer    = (UINT8 *) malloc (Image->Size + 1);
+      if (Image->Buffer != NULL) {
+        memcpy (Image->Buffer, Entry->Buffer, Image->Size);
+        ClaimFvRelocCache (Entry, Image);
+      }
+    }
+    ReleaseParallelLock (mFvFileCacheLock);
+  }
 
-  //
-  // If there is no VTF or the VTF naturally follows the previous file without a
-  // pad file, then there's nothing to do
-  //
-  if ((UINTN) VtfFileImage == (UINTN) FvImage->Eof || \
-      ((UINTN) VtfFileImage == (UINTN) FvImage->CurrentFilePointer)) {
+  if (Entry != NULL) {
+    if (Image->Buffer == NULL) {
+      Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+      return EFI_OUT_OF_RESOURCES;
+    }
     return EFI_SUCCESS;
   }
 
-  if ((UINTN) VtfFileImage < (UINTN) FvImage->CurrentFilePointer) {
-    return EFI_INVALID_PARAMETER;
+  fpin = fopen (FileName, "rb");
+  if (fpin == NULL) {
+    Error (NULL, 0, 0001, "Error opening file", FileName);
+    return EFI_ABORTED;
   }
 
-  //
-  // Pad file starts at beginning of free space
-  //
-  PadFile = (EFI_FFS_FILE_HEADER *) FvImage->CurrentFilePointer;
+  Image->Size   = _filelength (fileno (fpin));
+  Image->Buffer = (UINT8 *) malloc (Image->Size + 1);
+  if (Image->Buffer == NULL) {
+    fclose (fpin);
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    return EFI_OUT_OF_RESOURCES;
+  }
+  NumBytesRead = fread (Image->Buffer, sizeof (UINT8), Image->Size, fpin);
+  fclose (fpin);
+  ProfileAddBytes (NumBytesRead, 0);
+  if (NumBytesRead != Image->Size) {
+    Error (NULL, 0, 0004, "Error reading file", FileName);
+    return EFI_ABORTED;
+  }
 
   //
-  // write PadFile FFS header with PadType, don't need to set PAD file guid in its header. 
+  // A file shorter than a FFS header is rejected later, cache what a
+  // zero filled header would give for it.
   //
-  PadFile->Type       = EFI_FV_FILETYPE_FFS_PAD;
-  PadFile->Attributes = 0;
+  memset (&FfsHeader, 0, sizeof (EFI_FFS_FILE_HEADER));
+  memcpy (&FfsHeader, Image->Buffer, Image->Size < sizeof (EFI_FFS_FILE_HEADER) ? Image->Size : sizeof (EFI_FFS_FILE_HEADER));
+  ReadFfsAlignment (&FfsHeader, &Image->Alignment);
+  Image->IsVtf = IsVtfFile (&FfsHeader);
 
-  //
-  // FileSize includes the EFI_FFS_FILE_HEADER
-  //
-  FileSize          = (UINTN) VtfFileImage - (UINTN) FvImage->CurrentFilePointer;
-  PadFile->Size[0]  = (UINT8) (FileSize & 0x000000FF);
-  PadFile->Size[1]  = (UINT8) ((FileSize & 0x0000FF00) >> 8);
-  PadFile->Size[2]  = (UINT8) ((FileSize & 0x00FF0000) >> 16);
+  if (mFvFileCache == NULL) {
+    return EFI_SUCCESS;
+  }
 
   //
-  // Fill in checksums and state, must be zero during checksum calculation.
+  // Keep a pristine copy, the buffer of Image is patched by AddFile and
+  // the rebase.
   //
-  PadFile->IntegrityCheck.Checksum.Header = 0;
-  PadFile->IntegrityCheck.Checksum.File   = 0;
-  PadFile->State                          = 0;
-  PadFile->IntegrityCheck.Checksum.Header = CalculateChecksum8 ((UINT8 *) PadFile, sizeof (EFI_FFS_FILE_HEADER));
-  PadFile->IntegrityCheck.Checksum.File   = FFS_FIXED_CHECKSUM;
-
-  PadFile->State = EFI_FILE_HEADER_CONSTRUCTION | EFI_FILE_HEADER_VALID | EFI_FILE_DATA_VALID;
+  Entry = (FV_FILE_CACHE_ENTRY *) calloc (1, sizeof (FV_FILE_CACHE_ENTRY));
+  if (Entry != NULL) {
+    Entry->FileName = (CHAR8 *) malloc (strlen (FileName) + 1);
+    Entry->Buffer   = (UINT8 *) malloc (Image->Size + 1);
+  }
+  if (Entry == NULL || Entry->FileName == NULL || Entry->Buffer == NULL) {
+    if (Entry != NULL) {
+      free (Entry->FileName);
+      free (Entry->Buffer);
+      free (Entry);
+    }
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    return EFI_OUT_OF_RESOURCES;
+  }
+  strcpy (Entry->FileName, FileName);
+  memcpy (Entry->Buffer, Image->Buffer, Image->Size);
+  Entry->Size           = Image->Size;
+  Entry->Alignment      = Image->Alignment;
+  Entry->IsVtf          = Image->IsVtf;
 
-  UpdateFfsFileState (
-    (EFI_FFS_FILE_HEADER *) PadFile,
-    (EFI_FIRMWARE_VOLUME_HEADER *) FvImage->FileImage
-    );
   //
-  // Update the current FV pointer
+  // Another FV may have read the file meanwhile, keep its entry then.
   //
-  FvImage->CurrentFilePointer = FvImage->Eof;
+  AcquireParallelLock (mFvFileCacheLock);
+  for (CachedEntry = mFvFileCache[Bucket]; CachedEntry != NULL; CachedEntry = CachedEntry->Next) {
+    if (strcmp (CachedEntry->FileName, FileName) == 0) {
+      break;
+    }
+  }
+  if (CachedEntry == NULL) {
+    Entry->Next           = mFvFileCache[Bucket];
+    mFvFileCache[Bucket]  = Entry;
+    CachedEntry           = Entry;
+    Entry                 = NULL;
+  }
+  ClaimFvRelocCache (CachedEntry, Image);
+  ReleaseParallelLock (mFvFileCacheLock);
+
+  if (Entry != NULL) {
+    FreeFvFileCacheEntry (Entry);
+  }
 
   return EFI_SUCCESS;
 }
 
 EFI_STATUS
-UpdateResetVector (
-  IN MEMORY_FILE            *FvImage,
-  IN FV_INFO                *FvInfo,
-  IN EFI_FFS_FILE_HEADER    *VtfFile
+LoadFvFiles (
+  IN OUT FV_INFO   *FvInfo
   )
 /*++
 
 Routine Description:
 
-  This parses the FV looking for the PEI core and then plugs the address into
-  the SALE_ENTRY point of the BSF/VTF for IPF and does BUGBUG TBD action to
-  complete an IA32 Bootstrap FV.
+  This function reads every FFS file of a FV_INFO into memory, once, and
+  caches the size, alignment and VTF flag taken from its header. Sizing,
+  layout and rebase then work on these buffers instead of reopening the
+  files. Files already in the file cache are copied from it. In
+  incremental mode the SHA-256 of each file is computed as well.
 
 Arguments:
 
-  FvImage       Memory file for the FV memory image
-  FvInfo        Information read from INF file.
-  VtfFile       Pointer to the VTF file in the FV image.
+  FvInfo          FV information whose file list is loaded.
 
 Returns:
 
-  EFI_SUCCESS             Function Completed successfully.
-  EFI_ABORTED             Error encountered.
-  EFI_INVALID_PARAMETER   A required parameter was NULL.
-  EFI_NOT_FOUND           PEI Core file not found.
+  EFI_SUCCESS           All files were read.
+  EFI_ABORTED           A file could not be opened or read.
+  EFI_OUT_OF_RESOURCES  No resource to hold the files.
+
+--*/
+{
+  UINTN               Index;
+  EFI_STATUS          Status;
+  SHA256_CONTEXT      Sha;
+  UINTN               ProfileRecord;
+
+  if (FvInfo->FvFileImages != NULL) {
+    return EFI_SUCCESS;
+  }
+
+  FvInfo->FvFileImages = (FV_FILE_IMAGE *) calloc (FvInfo->FvFileNumber + 1, sizeof (FV_FILE_IMAGE));
+  if (FvInfo->FvFileImages == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  for (Index = 0; Index < FvInfo->FvFileNumber; Index++) {
+    ProfileRecord = ProfileBegin ("LoadFvFiles", FvInfo->FvFiles[Index]);
+    Status = LoadFvFileImage (FvInfo->FvFiles[Index], &FvInfo->FvFileImages[Index]);
+    ProfileEnd (ProfileRecord);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+    if (FvInfo->Incremental) {
+      Sha256Init (&Sha);
+      Sha256Update (&Sha, FvInfo->FvFileImages[Index].Buffer, FvInfo->FvFileImages[Index].Size);
+      Sha256Final (&Sha, FvInfo->FvFileImages[Index].InputHash);
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+//
+// Function symbols read from a PE map file. Offsets holds the address of
+// each symbol relative to the link time base address of the image, Names
+// holds the symbol names, in the same order, as NUL terminated strings.
+//
+typedef struct {
+  UINT64                  *Offsets;
+  UINTN                   MaxSymbolNumber;
+  UINT32                  SymbolNumber;
+  CHAR8                   *Names;
+  UINTN                   MaxNameSize;
+  UINT32                  NameSize;
+} FV_SYMBOL_TABLE;
+
+//
+// Header of the symbol cache written next to a PE map file. The symbol
+// offsets and then the names of a FV_SYMBOL_TABLE follow the header, DataCrc
+// is the CRC32 of both. Key is the SHA-256 of the image the map file was
+// linked with, as it was before it was rebased, and of the name, size and
+// modification time of the map file. A cache whose key matches is used
+// without reading the map file.
+//
+#define FV_SYMBOL_CACHE_SIGNATURE       EFI_SIGNATURE_32 ('F', 'V', 'S', 'C')
+#define FV_SYMBOL_CACHE_VERSION         3
+#define FV_SYMBOL_CACHE_FILE_EXTENSION  ".symcache"
+
+//
+// Number of names tried for the temporary file a symbol cache is written to.
+//
+#define FV_SYMBOL_CACHE_TEMP_TRIES      16
+
+typedef struct {
+  UINT32                  Signature;
+  UINT32                  Version;
+  UINT8                   Key[SHA256_DIGEST_SIZE];
+  UINT32                  SymbolNumber;
+  UINT32                  NameSize;
+  UINT32                  DataCrc;
+} FV_SYMBOL_CACHE_HEADER;
+
+STATIC
+VOID
+FreePeMapSymbols (
+  IN FV_SYMBOL_TABLE      *Symbols
+  )
+/*++
+
+Routine Description:
+
+  This function frees the symbols of a symbol table and empties it.
+
+Arguments:
+
+  Symbols         The symbol table.
+
+Returns:
+
+  None
+
+--*/
+{
+  free (Symbols->Offsets);
+  free (Symbols->Names);
+  memset (Symbols, 0, sizeof (FV_SYMBOL_TABLE));
+}
+
+STATIC
+EFI_STATUS
+AddPeMapSymbol (
+  IN OUT FV_SYMBOL_TABLE  *Symbols,
+  IN     UINT64           Offset,
+  IN     CHAR8            *Name
+  )
+/*++
+
+Routine Description:
+
+  This function appends a symbol to a symbol table.
+
+Arguments:
+
+  Symbols         The symbol table.
+  Offset          Address of the symbol relative to the link time base address.
+  Name            Name of the symbol.
+
+Returns:
+
+  EFI_SUCCESS           The symbol was added.
+  EFI_OUT_OF_RESOURCES  No resource to grow the table.
+
+--*/
+{
+  UINTN   Length;
+
+  Length = strlen (Name);
+  if (EFI_ERROR (GrowTable ((VOID **) &Symbols->Offsets, &Symbols->MaxSymbolNumber, Symbols->SymbolNumber, sizeof (UINT64))) ||
+      EFI_ERROR (GrowTable ((VOID **) &Symbols->Names, &Symbols->MaxNameSize, Symbols->NameSize + Length, sizeof (CHAR8)))) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Symbols->Offsets[Symbols->SymbolNumber++] = Offset;
+  memcpy (Symbols->Names + Symbols->NameSize, Name, Length + 1);
+  Symbols->NameSize += (UINT32) Length + 1;
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+ParsePeMapFile (
+  IN     FILE             *PeMapFile,
+  IN     CHAR8            *ModuleName,
+  IN OUT FV_SYMBOL_TABLE  *Symbols
+  )
+/*++
+
+Routine Description:
+
+  This function reads the function symbols of a PE map file, the public
+  functions listed after the "Address" line and the static functions listed
+  after the "Static" line, relative to the "Preferred load address".
+
+Arguments:
+
+  PeMapFile       The map file opened for reading.
+  ModuleName      Name of the module of the map file.
+  Symbols         Receives the symbols.
+
+Returns:
+
+  EFI_SUCCESS           The symbols were read.
+  EFI_OUT_OF_RESOURCES  No resource to store the symbols.
+
+--*/
+{
+  CHAR8                               Line [MAX_LINE_LEN];
+  CHAR8                               KeyWord [MAX_LINE_LEN];
+  CHAR8                               FunctionName [MAX_LINE_LEN];
+  CHAR8                               FunctionTypeName [MAX_LINE_LEN];
+  UINT32                              FunctionType;
+  unsigned long long                  TempLongAddress;
+  EFI_PHYSICAL_ADDRESS                FunctionAddress;
+  EFI_PHYSICAL_ADDRESS                LinkTimeBaseAddress;
+
+  FunctionType        = 0;
+  FunctionName[0]     = '\0';
+  FunctionTypeName[0] = '\0';
+  TempLongAddress     = 0;
+  strcpy (KeyWord, ModuleName);
+
+  LinkTimeBaseAddress = 0;
+  while (fgets (Line, MAX_LINE_LEN, PeMapFile) != NULL) {
+    //
+    // Skip blank line
+    //
+    if (Line[0] == 0x0a) {
+      FunctionType = 0;
+      continue;
+    }
+    //
+    // By Address and Static keyword
+    //  
+    if (FunctionType == 0) {
+      sscanf (Line, "%s", KeyWord);
+      if (stricmp (KeyWord, "Address") == 0) {
+        //
+        // function list
+        //
+        FunctionType = 1;
+        fgets (Line, MAX_LINE_LEN, PeMapFile);
+      } else if (stricmp (KeyWord, "Static") == 0) {
+        //
+        // static function list
+        //
+        FunctionType = 2;
+        fgets (Line, MAX_LINE_LEN, PeMapFile);
+      } else if (stricmp (KeyWord, "Preferred") ==0) {
+        sscanf (Line + strlen (" Preferred load address is"), "%llx", &TempLongAddress);
+        LinkTimeBaseAddress = (UINT64) TempLongAddress;
+      }
+      continue;
+    }
+    //
+    // Record Function Information
+    //
+    sscanf (Line, "%s %s %llx %s", KeyWord, FunctionName, &TempLongAddress, FunctionTypeName);
+    FunctionAddress = (UINT64) TempLongAddress;
+    if (FunctionTypeName [1] == '\0' && (FunctionTypeName [0] == 'f' || FunctionTypeName [0] == 'F')) {
+      if (EFI_ERROR (AddPeMapSymbol (Symbols, FunctionAddress - LinkTimeBaseAddress, FunctionName))) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+BOOLEAN
+HashFileStamp (
+  IN OUT SHA256_CONTEXT   *Sha,
+  IN     CHAR8            *FileName
+  )
+/*++
+
+Routine Description:
+
+  This function adds the name, size and modification time of a file to a
+  SHA-256 calculation, so the digest changes whenever the file is written.
+  A missing file is hashed as well, with a stamp no existing file has.
+
+Arguments:
+
+  Sha             The SHA-256 calculation.
+  FileName        Name of the file.
+
+Returns:
+
+  TRUE            The file exists.
+  FALSE           The file is missing.
+
+--*/
+{
+  struct stat   StatBuf;
+  UINT64        Stamp[3];
+  BOOLEAN       Exists;
+
+  Sha256Update (Sha, FileName, strlen (FileName) + 1);
+  memset (Stamp, 0xff, sizeof (Stamp));
+  Exists = (BOOLEAN) (stat (FileName, &StatBuf) == 0);
+  if (Exists) {
+    Stamp[0] = (UINT64) StatBuf.st_size;
+    Stamp[1] = (UINT64) StatBuf.st_mtime;
+#if defined (__APPLE__)
+    Stamp[2] = (UINT64) StatBuf.st_mtimespec.tv_nsec;
+#elif defined (__linux__)
+    Stamp[2] = (UINT64) StatBuf.st_mtim.tv_nsec;
+#else
+    Stamp[2] = 0;
+#endif
+  }
+  Sha256Update (Sha, Stamp, sizeof (Stamp));
+  return Exists;
+}
+
+STATIC
+BOOLEAN
+ReadSymbolCache (
+  IN     CHAR8                    *CacheFileName,
+  IN     FV_SYMBOL_CACHE_HEADER   *Key,
+  IN OUT FV_SYMBOL_TABLE          *Symbols
+  )
+/*++
+
+Routine Description:
+
+  This function reads the symbols of a symbol cache file, if the cache
+  matches the map file it is used for.
+
+Arguments:
+
+  CacheFileName   Name of the symbol cache file.
+  Key             Header expected in the cache, except SymbolNumber,
+                  NameSize and DataCrc.
+  Symbols         Receives the symbols.
+
+Returns:
+
+  TRUE            The symbols were read from the cache.
+  FALSE           The cache is missing, stale or damaged.
+
+--*/
+{
+  FILE                    *CacheFile;
+  FV_SYMBOL_CACHE_HEADER  Header;
+  CRC32_CONTEXT           Crc;
+  UINT32                  Index;
+  UINT32                  NameCount;
+
+  CacheFile = fopen (CacheFileName, "rb");
+  if (CacheFile == NULL) {
+    return FALSE;
+  }
+
+  if (fread (&Header, sizeof (Header), 1, CacheFile) != 1 ||
+      Header.Signature != Key->Signature ||
+      Header.Version != Key->Version ||
+      memcmp (Header.Key, Key->Key, SHA256_DIGEST_SIZE) != 0 ||
+      (UINT64) _filelength (fileno (CacheFile)) != sizeof (Header) + (UINT64) Header.SymbolNumber * sizeof (UINT64) + Header.NameSize) {
+    fclose (CacheFile);
+    return FALSE;
+  }
+
+  Symbols->Offsets = (UINT64 *) malloc ((Header.SymbolNumber + 1) * sizeof (UINT64));
+  Symbols->Names   = (CHAR8 *) malloc (Header.NameSize + 1);
+  if (Symbols->Offsets == NULL || Symbols->Names == NULL ||
+      fread (Symbols->Offsets, sizeof (UINT64), Header.SymbolNumber, CacheFile) != Header.SymbolNumber ||
+      fread (Symbols->Names, 1, Header.NameSize, CacheFile) != Header.NameSize) {
+    fclose (CacheFile);
+    FreePeMapSymbols (Symbols);
+    return FALSE;
+  }
+  fclose (CacheFile);
+  ProfileAddBytes (sizeof (Header) + (UINT64) Header.SymbolNumber * sizeof (UINT64) + Header.NameSize, 0);
+
+  //
+  // The cache may have been cut short or written by two processes at once,
+  // only use it if its data is intact.
+  //
+  Crc32Init (&Crc);
+  Crc32Update (&Crc, Symbols->Offsets, Header.SymbolNumber * sizeof (UINT64));
+  Crc32Update (&Crc, Symbols->Names, Header.NameSize);
+  NameCount = 0;
+  for (Index = 0; Index < Header.NameSize; Index++) {
+    if (Symbols->Names[Index] == '\0') {
+      NameCount++;
+    }
+  }
+  if (Crc32Final (&Crc) != Header.DataCrc || NameCount != Header.SymbolNumber ||
+      (Header.NameSize > 0 && Symbols->Names[Header.NameSize - 1] != '\0')) {
+    FreePeMapSymbols (Symbols);
+    return FALSE;
+  }
+
+  Symbols->SymbolNumber    = Header.SymbolNumber;
+  Symbols->MaxSymbolNumber = Header.SymbolNumber + 1;
+  Symbols->NameSize        = Header.NameSize;
+  Symbols->MaxNameSize     = Header.NameSize + 1;
+  return TRUE;
+}
+
+STATIC
+VOID
+WriteSymbolCache (
+  IN CHAR8                    *CacheFileName,
+  IN FV_SYMBOL_CACHE_HEADER   *Key,
+  IN FV_SYMBOL_TABLE          *Symbols
+  )
+/*++
+
+Routine Description:
+
+  This function writes the symbols of a map file to its symbol cache file.
+  The cache is written to a new temporary file that is then renamed, so
+  processes and threads writing the cache of the same map file at once
+  never remove or mix each other's data. The cache is only an
+  optimization, a cache that cannot be written is ignored.
+
+Arguments:
+
+  CacheFileName   Name of the symbol cache file.
+  Key             Header identifying the map file.
+  Symbols         The symbols read from the map file.
+
+Returns:
+
+  None
+
+--*/
+{
+  FILE                    *CacheFile;
+  FV_SYMBOL_CACHE_HEADER  Header;
+  CRC32_CONTEXT           Crc;
+  BOOLEAN                 Written;
+  CHAR8                   TempFileName [_MAX_PATH];
+  UINTN                   Try;
+
+  memcpy (&Header, Key, sizeof (Header));
+  Header.SymbolNumber = Symbols->SymbolNumber;
+  Header.NameSize     = Symbols->NameSize;
+  Crc32Init (&Crc);
+  Crc32Update (&Crc, Symbols->Offsets, Symbols->SymbolNumber * sizeof (UINT64));
+  Crc32Update (&Crc, Symbols->Names, Symbols->NameSize);
+  Header.DataCrc = Crc32Final (&Crc);
+
+  //
+  // The file is created exclusively, a name taken by another thread of this
+  // process is skipped.
+  //
+  CacheFile = NULL;
+  for (Try = 0; Try < FV_SYMBOL_CACHE_TEMP_TRIES && CacheFile == NULL; Try++) {
+    if (strlen (CacheFileName) + 32 >= _MAX_PATH) {
+      return;
+    }
+    sprintf (TempFileName, "%s.%u.%u.tmp", CacheFileName, (unsigned) getpid (), (unsigned) Try);
+    CacheFile = fopen (TempFileName, "wbx");
+  }
+  if (CacheFile == NULL) {
+    return;
+  }
+  Written = (BOOLEAN) (fwrite (&Header, sizeof (Header), 1, CacheFile) == 1 &&
+                       fwrite (Symbols->Offsets, sizeof (UINT64), Symbols->SymbolNumber, CacheFile) == Symbols->SymbolNumber &&
+                       fwrite (Symbols->Names, 1, Symbols->NameSize, CacheFile) == Symbols->NameSize);
+  if (fclose (CacheFile) != 0 || !Written) {
+    remove (TempFileName);
+    return;
+  }
+  if (rename (TempFileName, CacheFileName) != 0) {
+    //
+    // rename does not replace an existing file on Windows.
+    //
+    remove (CacheFileName);
+    if (rename (TempFileName, CacheFileName) != 0) {
+      remove (TempFileName);
+      return;
+    }
+  }
+  ProfileAddBytes (0, sizeof (Header) + (UINT64) Symbols->SymbolNumber * sizeof (UINT64) + Symbols->NameSize);
+}
+
+STATIC
+EFI_STATUS
+ReadPeMapSymbols (
+  IN     CHAR8            *PeMapFileName,
+  IN     CHAR8            *ModuleName,
+  IN     UINT8            *ImageHash,
+  IN OUT FV_SYMBOL_TABLE  *Symbols
+  )
+/*++
+
+Routine Description:
+
+  This function gets the function symbols of a PE map file. The symbols
+  come from the symbol cache next to the map file when it was written for
+  the same image and the same map file, then the map file is not read.
+  Otherwise the map file is parsed and the cache is rewritten.
+
+Arguments:
+
+  PeMapFileName   Name of the map file, ending with ".map".
+  ModuleName      Name of the module of the map file.
+  ImageHash       SHA-256 of the image before it was rebased.
+  Symbols         Receives the symbols.
+
+Returns:
+
+  EFI_SUCCESS           The symbols were read.
+  EFI_ABORTED           The map file could not be opened.
+  EFI_OUT_OF_RESOURCES  No resource to store the symbols.
+
+--*/
+{
+  FV_SYMBOL_CACHE_HEADER  Key;
+  CHAR8                   CacheFileName [_MAX_PATH];
+  FILE                    *PeMapFile;
+  EFI_STATUS              Status;
+  SHA256_CONTEXT          Sha;
+
+  memset (&Key, 0, sizeof (Key));
+  Key.Signature   = FV_SYMBOL_CACHE_SIGNATURE;
+  Key.Version     = FV_SYMBOL_CACHE_VERSION;
+  Sha256Init (&Sha);
+  Sha256Update (&Sha, ImageHash, SHA256_DIGEST_SIZE);
+  if (!HashFileStamp (&Sha, PeMapFileName)) {
+    return EFI_ABORTED;
+  }
+  Sha256Final (&Sha, Key.Key);
+  VerboseMsg ("The map file is %s", PeMapFileName);
+
+  CacheFileName[0] = '\0';
+  if (strlen (PeMapFileName) - strlen (".map") + strlen (FV_SYMBOL_CACHE_FILE_EXTENSION) < _MAX_PATH) {
+    strcpy (CacheFileName, PeMapFileName);
+    strcpy (CacheFileName + strlen (CacheFileName) - strlen (".map"), FV_SYMBOL_CACHE_FILE_EXTENSION);
+    if (ReadSymbolCache (CacheFileName, &Key, Symbols)) {
+      return EFI_SUCCESS;
+    }
+  }
+
+  PeMapFile = fopen (PeMapFileName, "r");
+  if (PeMapFile == NULL) {
+    return EFI_ABORTED;
+  }
+  Status = ParsePeMapFile (PeMapFile, ModuleName, Symbols);
+  ProfileAddBytes ((UINT64) ftell (PeMapFile), 0);
+  fclose (PeMapFile);
+  if (EFI_ERROR (Status)) {
+    FreePeMapSymbols (Symbols);
+    return Status;
+  }
+
+  if (CacheFileName[0] != '\0') {
+    WriteSymbolCache (CacheFileName, &Key, Symbols);
+  }
+  return EFI_SUCCESS;
+}
+
+STATIC
+BOOLEAN
+GetPeMapFileName (
+  IN  CHAR8     *FileName,
+  OUT CHAR8     *PeMapFileName,
+  OUT CHAR8     *ModuleName
+  )
+/*++
+
+Routine Description:
+
+  This function derives the name of the PE map file of an image, the image
+  or PDB file name with its extension replaced by "map", and the module name.
+
+Arguments:
+
+  FileName              Image or PDB file name.
+  PeMapFileName         Receives the map file name, _MAX_PATH characters.
+  ModuleName            Receives the module name, MAX_LINE_LEN characters.
+
+Returns:
+
+  TRUE                  The names were derived.
+  FALSE                 FileName has no extension or is too long.
+
+--*/
+{
+  CHAR8                               *Cptr, *Cptr2;
+
+  if (strlen (FileName) + strlen ("map") >= _MAX_PATH) {
+    return FALSE;
+  }
+
+  //
+  // Construct Map file Name 
+  //
+  strcpy (PeMapFileName, FileName);
+  
+  //
+  // Change '\\' to '/', unified path format.
+  //
+  Cptr = PeMapFileName;
+  while (*Cptr != '\0') {
+    if (*Cptr == '\\') {
+      *Cptr = FILE_SEP_CHAR;
+    }
+    Cptr ++;
+  }
+  
+  //
+  // Get Map file
+  // 
+  Cptr = PeMapFileName + strlen (PeMapFileName);
+  while ((*Cptr != '.') && (Cptr >= PeMapFileName)) {
+    Cptr --;
+  }
+  if (Cptr < PeMapFileName) {
+    return FALSE;
+  } else {
+    *(Cptr + 1) = 'm';
+    *(Cptr + 2) = 'a';
+    *(Cptr + 3) = 'p';
+    *(Cptr + 4) = '\0';
+  }
+
+  //
+  // Get module Name
+  //
+  Cptr2 = Cptr;
+  while ((*Cptr != FILE_SEP_CHAR) && (Cptr >= PeMapFileName)) {
+    Cptr --;
+  }
+  *Cptr2 = '\0';
+  strcpy (ModuleName, Cptr + 1);
+  *Cptr2 = '.';
+
+  return TRUE;
+}
+
+EFI_STATUS
+WriteMapFile (
+  IN OUT FILE                  *FvMapFile,
+  IN     CHAR8                 *FileName,
+  IN     EFI_FFS_FILE_HEADER   *FfsFile, 
+  IN     EFI_PHYSICAL_ADDRESS  ImageBaseAddress,
+  IN     PE_COFF_LOADER_IMAGE_CONTEXT *pImageContext,
+  IN     UINT8                 *ImageHash
+  )
+/*++
+
+Routine Description:
+
+  This function gets the basic debug information (entrypoint, baseaddress, .text, .data section base address)
+  from PE/COFF image and abstracts Pe Map file information and add them into FvMap file for Debug.
+
+Arguments:
+
+  FvMapFile             A pointer to FvMap File
+  FileName              Ffs File PathName
+  FfsFile               A pointer to Ffs file image.
+  ImageBaseAddress      PeImage Base Address.
+  pImageContext         Image Context Information.
+  ImageHash             SHA-256 of the image before it was rebased.
+
+Returns:
+
+  EFI_SUCCESS           Added required map information.
+
+--*/
+{
+  CHAR8                               PeMapFileName [_MAX_PATH];
+  CHAR8                               FileGuidName [MAX_LINE_LEN];
+  CHAR8                               KeyWord [MAX_LINE_LEN];
+  CHAR8                               *FunctionName;
+  UINT32                              Index;
+  UINT32                              AddressOfEntryPoint;
+  UINT32                              Offset;
+  EFI_IMAGE_OPTIONAL_HEADER_UNION     *ImgHdr;
+  EFI_TE_IMAGE_HEADER                 *TEImageHeader;
+  EFI_IMAGE_SECTION_HEADER            *SectionHeader;
+  UINT32                              TextVirtualAddress;
+  UINT32                              DataVirtualAddress;
+  FV_SYMBOL_TABLE                     Symbols;
+  EFI_STATUS                          Status;
+  UINTN                               ProfileRecord;
+  long                                MapStart;
+
+  //
+  // Print FileGuid to string buffer. 
+  //
+  PrintGuidToBuffer (&FfsFile->Name, (UINT8 *)FileGuidName, MAX_LINE_LEN, TRUE);
+  
+  if (!GetPeMapFileName (FileName, PeMapFileName, KeyWord)) {
+    return EFI_NOT_FOUND;
+  }
+
+  ProfileRecord = ProfileBegin ("WriteMapFile", FileName);
+  MapStart      = ProfileEnabled () ? ftell (FvMapFile) : 0;
+
+  //
+  // AddressOfEntryPoint and Offset in Image
+  //
+  if (!pImageContext->IsTeImage) {
+  	ImgHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *) ((UINT8 *) pImageContext->Handle + pImageContext->PeCoffHeaderOffset);
+  	AddressOfEntryPoint = ImgHdr->Pe32.OptionalHeader.AddressOfEntryPoint;
+  	Offset = 0;
+    SectionHeader = (EFI_IMAGE_SECTION_HEADER *) (
+                       (UINT8 *) ImgHdr +
+                       sizeof (UINT32) + 
+                       sizeof (EFI_IMAGE_FILE_HEADER) +  
+                       ImgHdr->Pe32.FileHeader.SizeOfOptionalHeader
+                       );
+    Index = ImgHdr->Pe32.FileHeader.NumberOfSections;
+  } else {
+  	TEImageHeader = (EFI_TE_IMAGE_HEADER *) pImageContext->Handle;
+    AddressOfEntryPoint = TEImageHeader->AddressOfEntryPoint;
+    Offset = TEImageHeader->StrippedSize - sizeof (EFI_TE_IMAGE_HEADER);
+    SectionHeader = (EFI_IMAGE_SECTION_HEADER *) (TEImageHeader + 1);
+    Index = TEImageHeader->NumberOfSections;
+  }
+
+  //
+  // module information output
+  //
+  if (ImageBaseAddress == 0) {
+    fprintf (FvMapFile, "%s (dummy) (", KeyWord);
+    fprintf (FvMapFile, "BaseAddress=%010llx, ", (unsigned long long) ImageBaseAddress);
+  } else {
+    fprintf (FvMapFile, "%s (Fixed Flash Address, ", KeyWord);
+    fprintf (FvMapFile, "BaseAddress=0x%010llx, ", (unsigned long long) (ImageBaseAddress + Offset));
+  }
+
+  if (FfsFile->Type != EFI_FV_FILETYPE_SECURITY_CORE && pImageContext->Machine == EFI_IMAGE_MACHINE_IA64) {
+    //
+    // Process IPF PLABEL to get the real address after the image has been rebased. 
+    // PLABEL structure is got by AddressOfEntryPoint offset to ImageBuffer stored in pImageContext->Handle.
+    //
+    fprintf (FvMapFile, "EntryPoint=0x%010llx", (unsigned long long) (*(UINT64 *)((UINTN) pImageContext->Handle + (UINTN) AddressOfEntryPoint)));
+  } else {
+    fprintf (FvMapFile, "EntryPoint=0x%010llx", (unsigned long long) (ImageBaseAddress + AddressOfEntryPoint));
+  }
+  fprintf (FvMapFile, ")\n"); 
+  
+  fprintf (FvMapFile, "(GUID=%s", FileGuidName);
+  TextVirtualAddress = 0;
+  DataVirtualAddress = 0;
+  for (; Index > 0; Index --, SectionHeader ++) {
+    if (stricmp ((CHAR8 *)SectionHeader->Name, ".text") == 0) {
+  		TextVirtualAddress = SectionHeader->VirtualAddress;
+  	} else if (stricmp ((CHAR8 *)SectionHeader->Name, ".data") == 0) {
+  	  DataVirtualAddress = SectionHeader->VirtualAddress;
+  	} else if (stricmp ((CHAR8 *)SectionHeader->Name, ".sdata") == 0) {
+  	  DataVirtualAddress = SectionHeader->VirtualAddress;
+  	}
+  }
+  fprintf (FvMapFile, " .textbaseaddress=0x%010llx", (unsigned long long) (ImageBaseAddress + TextVirtualAddress));
+  fprintf (FvMapFile, " .databaseaddress=0x%010llx", (unsigned long long) (ImageBaseAddress + DataVirtualAddress));
+  fprintf (FvMapFile, ")\n\n");
+   
+  //
+  // Get the function symbols of the PeMapFile
+  //
+  memset (&Symbols, 0, sizeof (Symbols));
+  Status = ReadPeMapSymbols (PeMapFileName, KeyWord, ImageHash, &Symbols);
+  if (EFI_ERROR (Status)) {
+    if (ProfileEnabled ()) {
+      ProfileAddBytes (0, ftell (FvMapFile) - MapStart);
+    }
+    ProfileEnd (ProfileRecord);
+    return EFI_ABORTED;
+  }
+
+  //
+  // Output Functions information into Fv Map file
+  //
+  FunctionName = Symbols.Names;
+  for (Index = 0; Index < Symbols.SymbolNumber; Index++) {
+    fprintf (FvMapFile, "  0x%010llx    %s\n", (unsigned long long) (ImageBaseAddress + Symbols.Offsets[Index]), FunctionName);
+    FunctionName += strlen (FunctionName) + 1;
+  }
+  fprintf (FvMapFile, "\n\n");
+  FreePeMapSymbols (&Symbols);
+
+  if (ProfileEnabled ()) {
+    ProfileAddBytes (0, ftell (FvMapFile) - MapStart);
+  }
+  ProfileEnd (ProfileRecord);
+  
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+AddFile (
+  IN OUT MEMORY_FILE          *FvImage,
+  IN FV_INFO                  *FvInfo,
+  IN UINTN                    Index,
+  IN OUT EFI_FFS_FILE_HEADER  **VtfFileImage,
+  IN FILE                     *FvReportFile
+  )
+/*++
+
+Routine Description:
+
+  This function adds a file to the FV image.  The file will pad to the
+  appropriate alignment if required.  The images in the file are rebased
+  later by RebaseFvFiles, once every file has its final offset.
+
+Arguments:
+
+  FvImage       The memory image of the FV to add it to.  The current offset
+                must be valid.
+  FvInfo        Pointer to information about the FV, its files must have
+                been read by LoadFvFiles.
+  Index         The file in the FvInfo file list to add.
+  VtfFileImage  A pointer to the VTF file within the FvImage.  If this is equal
+                to the end of the FvImage then no VTF previously found.
+  FvReportFile  Pointer to FvReport File
+
+Returns:
+
+  EFI_SUCCESS              The function completed successfully.
+  EFI_INVALID_PARAMETER    One of the input parameters was invalid.
+  EFI_ABORTED              An error occurred.
+  EFI_OUT_OF_RESOURCES     Insufficient resources exist to complete the add.
+
+--*/
+{
+  FV_FILE_IMAGE         *Image;
+  UINTN                 FileSize;
+  UINT8                 *FileBuffer;
+  UINT32                CurrentFileAlignment;
+  EFI_STATUS            Status;
+  UINTN                 Index1;
+  UINT8                 FileGuidString[PRINTED_GUID_BUFFER_SIZE];
+  
+  Index1 = 0;
+  //
+  // Verify input parameters.
+  //
+  if (FvImage == NULL || FvInfo == NULL || Index >= FvInfo->FvFileNumber || VtfFileImage == NULL ||
+      FvInfo->FvFileImages == NULL || FvInfo->FvFileImages[Index].Buffer == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // The file was read by LoadFvFiles, it is patched and rebased in place.
+  //
+  Image      = &FvInfo->FvFileImages[Index];
+  FileBuffer = Image->Buffer;
+  FileSize   = Image->Size;
+  
+  //
+  // For None PI Ffs file, directly add them into FvImage.
+  //
+  if (!FvInfo->IsPiFvImage) {
+    memcpy (FvImage->CurrentFilePointer, FileBuffer, FileSize);
+    if (FvInfo->SizeofFvFiles[Index] > FileSize) {
+    	FvImage->CurrentFilePointer += FvInfo->SizeofFvFiles[Index];
+    } else {
+    	FvImage->CurrentFilePointer += FileSize;
+    }
+    goto Done;
+  }
+  
+  //
+  // Verify Ffs file
+  //
+  Status = VerifyFfsFile ((EFI_FFS_FILE_HEADER *)FileBuffer);
+  if (EFI_ERROR (Status)) {
+    Error (NULL, 0, 3000, "Invalid", "%s is not a valid FFS file.", FvInfo->FvFiles[Index]);
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Verify space exists to add the file
+  //
+  if (FileSize > (UINTN) ((UINTN) *VtfFileImage - (UINTN) FvImage->CurrentFilePointer)) {
+    Error (NULL, 0, 4002, "Resource", "FV space is full, not enough room to add file %s.", FvInfo->FvFiles[Index]);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //
+  // Verify the input file is the duplicated file in this Fv image
+  //
+  for (Index1 = 0; Index1 < Index; Index1 ++) {
+    if (CompareGuid ((EFI_GUID *) FileBuffer, &FvInfo->FileGuids [Index1]) == 0) {
+      Error (NULL, 0, 2000, "Invalid parameter", "the %dth file and %uth file have the same file GUID.", (unsigned) Index1 + 1, (unsigned) Index + 1);
+      PrintGuid ((EFI_GUID *) FileBuffer);
+      return EFI_INVALID_PARAMETER;
+    }
+  }
+  CopyMem (&FvInfo->FileGuids [Index], FileBuffer, sizeof (EFI_GUID));
+
+  //
+  // Update the file state based on polarity of the FV.
+  //
+  UpdateFfsFileState (
+    (EFI_FFS_FILE_HEADER *) FileBuffer,
+    (EFI_FIRMWARE_VOLUME_HEADER *) FvImage->FileImage
+    );
+
+  //
+  // Check if alignment is required
+  //
+  CurrentFileAlignment = Image->Alignment;
+  
+  //
+  // Find the largest alignment of all the FFS files in the FV
+  //
+  if (CurrentFileAlignment > FvInfo->MaxFfsAlignment) {
+    FvInfo->MaxFfsAlignment = CurrentFileAlignment;
+  }
+  //
+  // If we have a VTF file, add it at the top.
+  //
+  if (Image->IsVtf) {
+    if ((UINTN) *VtfFileImage == (UINTN) FvImage->Eof) {
+      //
+      // No previous VTF, add this one.
+      //
+      *VtfFileImage = (EFI_FFS_FILE_HEADER *) (UINTN) ((UINTN) FvImage->FileImage + FvInfo->Size - FileSize);
+      //
+      // Sanity check. The file MUST align appropriately
+      //
+      if (((UINTN) *VtfFileImage + sizeof (EFI_FFS_FILE_HEADER) - (UINTN) FvImage->FileImage) % (1 << CurrentFileAlignment)) {
+        Error (NULL, 0, 3000, "Invalid", "VTF file cannot be aligned on a %u-byte boundary.", (unsigned) (1 << CurrentFileAlignment));
+        return EFI_ABORTED;
+      }
+      //
+      // copy VTF File, its images are rebased by RebaseFvFiles
+      //
+      memcpy (*VtfFileImage, FileBuffer, FileSize);
+      Image->FvFile = *VtfFileImage;
+      
+      PrintGuidToBuffer ((EFI_GUID *) FileBuffer, FileGuidString, sizeof (FileGuidString), TRUE); 
+      fprintf (FvReportFile, "0x%08X %s\n", (unsigned)(UINTN) (((UINT8 *)*VtfFileImage) - (UINTN)FvImage->FileImage), FileGuidString);
+      free (Image->Buffer);
+      Image->Buffer = NULL;
+      DebugMsg (NULL, 0, 9, "Add VTF FFS file in FV image", NULL);
+      return EFI_SUCCESS;
+    } else {
+      //
+      // Already found a VTF file.
+      //
+      Error (NULL, 0, 3000, "Invalid", "multiple VTF files are not permitted within a single FV.");
+      return EFI_ABORTED;
+    }
+  }
+
+  //
+  // Add pad file if necessary
+  //
+  Status = AddPadFile (FvImage, 1 << CurrentFileAlignment, *VtfFileImage, NULL);
+  if (EFI_ERROR (Status)) {
+    Error (NULL, 0, 4002, "Resource", "FV space is full, could not add pad file for data alignment property.");
+    return EFI_ABORTED;
+  }
+  //
+  // Add file
+  //
+  if ((UINTN) (FvImage->CurrentFilePointer + FileSize) <= (UINTN) (*VtfFileImage)) {
+    //
+    // Copy the file, its images are rebased by RebaseFvFiles
+    //
+    memcpy (FvImage->CurrentFilePointer, FileBuffer, FileSize);
+    Image->FvFile = (EFI_FFS_FILE_HEADER *) FvImage->CurrentFilePointer;
+    PrintGuidToBuffer ((EFI_GUID *) FileBuffer, FileGuidString, sizeof (FileGuidString), TRUE); 
+    fprintf (FvReportFile, "0x%08X %s\n", (unsigned) (FvImage->CurrentFilePointer - FvImage->FileImage), FileGuidString);
+    FvImage->CurrentFilePointer += FileSize;
+  } else {
+    Error (NULL, 0, 4002, "Resource", "FV space is full, cannot add file %s.", FvInfo->FvFiles[Index]);
+    return EFI_ABORTED;
+  }
+  //
+  // Make next file start at QWord Boundry
+  //
+  while (((UINTN) FvImage->CurrentFilePointer & (EFI_FFS_FILE_HEADER_ALIGNMENT - 1)) != 0) {
+    FvImage->CurrentFilePointer++;
+  }
+
+Done: 
+  //
+  // The file is in the FV image now, release its buffer.
+  //
+  free (Image->Buffer);
+  Image->Buffer = NULL;
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+PadFvImage (
+  IN MEMORY_FILE          *FvImage,
+  IN EFI_FFS_FILE_HEADER  *VtfFileImage
+  )
+/*++
+
+Routine Description:
+
+  This function places a pad file between the last file in the FV and the VTF
+  file if the VTF file exists.
+
+Arguments:
+
+  FvImage       Memory file for the FV memory image
+  VtfFileImage  The address of the VTF file.  If this is the end of the FV
+                image, no VTF exists and no pad file is needed.
+
+Returns:
+
+  EFI_SUCCESS             Completed successfully.
+  EFI_INVALID_PARAMETER   One of the input parameters was NULL.
+
+--*/
+{
+  EFI_FFS_FILE_HEADER *PadFile;
+  UINTN               FileSize;
+
+  //
+  // If there is no VTF or the VTF naturally follows the previous file without a
+  // pad file, then there's nothing to do
+  //
+  if ((UINTN) VtfFileImage == (UINTN) FvImage->Eof || \
+      ((UINTN) VtfFileImage == (UINTN) FvImage->CurrentFilePointer)) {
+    return EFI_SUCCESS;
+  }
+
+  if ((UINTN) VtfFileImage < (UINTN) FvImage->CurrentFilePointer) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Pad file starts at beginning of free space
+  //
+  PadFile = (EFI_FFS_FILE_HEADER *) FvImage->CurrentFilePointer;
+
+  //
+  // write PadFile FFS header with PadType, don't need to set PAD file guid in its header. 
+  //
+  PadFile->Type       = EFI_FV_FILETYPE_FFS_PAD;
+  PadFile->Attributes = 0;
+
+  //
+  // FileSize includes the EFI_FFS_FILE_HEADER
+  //
+  FileSize          = (UINTN) VtfFileImage - (UINTN) FvImage->CurrentFilePointer;
+  PadFile->Size[0]  = (UINT8) (FileSize & 0x000000FF);
+  PadFile->Size[1]  = (UINT8) ((FileSize & 0x0000FF00) >> 8);
+  PadFile->Size[2]  = (UINT8) ((FileSize & 0x00FF0000) >> 16);
+
+  //
+  // Fill in checksums and state, must be zero during checksum calculation.
+  //
+  PadFile->IntegrityCheck.Checksum.Header = 0;
+  PadFile->IntegrityCheck.Checksum.File   = 0;
+  PadFile->State                          = 0;
+  PadFile->IntegrityCheck.Checksum.Header = CalculateChecksum8 ((UINT8 *) PadFile, sizeof (EFI_FFS_FILE_HEADER));
+  PadFile->IntegrityCheck.Checksum.File   = FFS_FIXED_CHECKSUM;
+
+  PadFile->State = EFI_FILE_HEADER_CONSTRUCTION | EFI_FILE_HEADER_VALID | EFI_FILE_DATA_VALID;
+
+  UpdateFfsFileState (
+    (EFI_FFS_FILE_HEADER *) PadFile,
+    (EFI_FIRMWARE_VOLUME_HEADER *) FvImage->FileImage
+    );
+  //
+  // Update the current FV pointer
+  //
+  FvImage->CurrentFilePointer = FvImage->Eof;
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+UpdateResetVector (
+  IN MEMORY_FILE            *FvImage,
+  IN FV_INFO                *FvInfo,
+  IN EFI_FFS_FILE_HEADER    *VtfFile
+  )
+/*++
+
+Routine Description:
+
+  This parses the FV looking for the PEI core and then plugs the address into
+  the SALE_ENTRY point of the BSF/VTF for IPF and does BUGBUG TBD action to
+  complete an IA32 Bootstrap FV.
+
+Arguments:
+
+  FvImage       Memory file for the FV memory image
+  FvInfo        Information read from INF file.
+  VtfFile       Pointer to the VTF file in the FV image.
+
+Returns:
+
+  EFI_SUCCESS             Function Completed successfully.
+  EFI_ABORTED             Error encountered.
+  EFI_INVALID_PARAMETER   A required parameter was NULL.
+  EFI_NOT_FOUND           PEI Core file not found.
+
+--*/
+{
+  EFI_FFS_FILE_HEADER       *PeiCoreFile;
+  EFI_FFS_FILE_HEADER       *SecCoreFile;
+  EFI_STATUS                Status;
+  EFI_FILE_SECTION_POINTER  Pe32Section;
+  UINT32                    EntryPoint;
+  UINT32                    BaseOfCode;
+  UINT16                    MachineType;
+  EFI_PHYSICAL_ADDRESS      PeiCorePhysicalAddress;
+  EFI_PHYSICAL_ADDRESS      SecCorePhysicalAddress;
+  EFI_PHYSICAL_ADDRESS      *SecCoreEntryAddressPtr;
+  INT32                     Ia32SecEntryOffset;
+  UINT32                    *Ia32ResetAddressPtr;
+  UINT8                     *BytePointer;
+  UINT8                     *BytePointer2;
+  UINT16                    *WordPointer;
+  UINT16                    CheckSum;
+  UINT32                    IpiVector;
+  UINTN                     Index;
+  EFI_FFS_FILE_STATE        SavedState;
+  UINT64                    FitAddress;
+  FIT_TABLE                 *FitTablePtr;
+  BOOLEAN                   Vtf0Detected;
+
+  //
+  // Verify input parameters
+  //
+  if (FvImage == NULL || FvInfo == NULL || VtfFile == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+  //
+  // Initialize FV library
+  //
+  InitializeFvLib (FvImage->FileImage, FvInfo->Size);
+
+  //
+  // Verify VTF file
+  //
+  Status = VerifyFfsFile (VtfFile);
+  if (EFI_ERROR (Status)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (
+      (((UINTN)FvImage->Eof - (UINTN)FvImage->FileImage) >=
+        IA32_X64_VTF_SIGNATURE_OFFSET) &&
+      (*(UINT32 *)(VOID*)((UINTN) FvImage->Eof -
+                                  IA32_X64_VTF_SIGNATURE_OFFSET) ==
+        IA32_X64_VTF0_SIGNATURE)
+     ) {
+    Vtf0Detected = TRUE;
+  } else {
+    Vtf0Detected = FALSE;
+  }
+
+  //
+  // Find the Sec Core
+  //
+  Status = GetFileByType (EFI_FV_FILETYPE_SECURITY_CORE, 1, &SecCoreFile);
+  if (EFI_ERROR (Status) || SecCoreFile == NULL) {
+    if (Vtf0Detected) {
+      //
+      // If the SEC core file is not found, but the VTF-0 signature
+      // is found, we'll treat it as a VTF-0 'Volume Top File'.
+      // This means no modifications are required to the VTF.
+      //
+      return EFI_SUCCESS;
+    }
+
+    Error (NULL, 0, 3000, "Invalid", "could not find the SEC core file in the FV.");
+    return EFI_ABORTED;
+  }
+  //
+  // Sec Core found, now find PE32 section
+  //
+  Status = GetSectionByType (SecCoreFile, EFI_SECTION_PE32, 1, &Pe32Section);
+  if (Status == EFI_NOT_FOUND) {
+    Status = GetSectionByType (SecCoreFile, EFI_SECTION_TE, 1, &Pe32Section);
+  }
+
+  if (EFI_ERROR (Status)) {
+    Error (NULL, 0, 3000, "Invalid", "could not find a PE32 section in the SEC core file.");
+    return EFI_ABORTED;
+  }
+
+  Status = GetPe32Info (
+            (VOID *) ((UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32)),
+            &EntryPoint,
+            &BaseOfCode,
+            &MachineType
+            );
+
+  if (EFI_ERROR (Status)) {
+    Error (NULL, 0, 3000, "Invalid", "could not get the PE32 entry point for the SEC core.");
+    return EFI_ABORTED;
+  }  
+
+  if (
+       Vtf0Detected &&
+       (MachineType == EFI_IMAGE_MACHINE_IA32 ||
+        MachineType == EFI_IMAGE_MACHINE_X64)
+     ) {
+    //
+    // If the SEC core code is IA32 or X64 and the VTF-0 signature
+    // is found, we'll treat it as a VTF-0 'Volume Top File'.
+    // This means no modifications are required to the VTF.
+    //
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Physical address is FV base + offset of PE32 + offset of the entry point
+  //
+  SecCorePhysicalAddress = FvInfo->BaseAddress;
+  SecCorePhysicalAddress += (UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32) - (UINTN) FvImage->FileImage;
+  SecCorePhysicalAddress += EntryPoint;
+  DebugMsg (NULL, 0, 9, "SecCore physical entry point address", "Address = 0x%llX", (unsigned long long) SecCorePhysicalAddress); 
+
+  //
+  // Find the PEI Core
+  //
+  Status = GetFileByType (EFI_FV_FILETYPE_PEI_CORE, 1, &PeiCoreFile);
+  if (EFI_ERROR (Status) || PeiCoreFile == NULL) {
+    Error (NULL, 0, 3000, "Invalid", "could not find the PEI core in the FV.");
+    return EFI_ABORTED;
+  }
+  //
+  // PEI Core found, now find PE32 or TE section
+  //
+  Status = GetSectionByType (PeiCoreFile, EFI_SECTION_PE32, 1, &Pe32Section);
+  if (Status == EFI_NOT_FOUND) {
+    Status = GetSectionByType (PeiCoreFile, EFI_SECTION_TE, 1, &Pe32Section);
+  }
+
+  if (EFI_ERROR (Status)) {
+    Error (NULL, 0, 3000, "Invalid", "could not find either a PE32 or a TE section in PEI core file.");
+    return EFI_ABORTED;
+  }
+
+  Status = GetPe32Info (
+            (VOID *) ((UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32)),
+            &EntryPoint,
+            &BaseOfCode,
+            &MachineType
+            );
+
+  if (EFI_ERROR (Status)) {
+    Error (NULL, 0, 3000, "Invalid", "could not get the PE32 entry point for the PEI core.");
+    return EFI_ABORTED;
+  }
+  //
+  // Physical address is FV base + offset of PE32 + offset of the entry point
+  //
+  PeiCorePhysicalAddress = FvInfo->BaseAddress;
+  PeiCorePhysicalAddress += (UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32) - (UINTN) FvImage->FileImage;
+  PeiCorePhysicalAddress += EntryPoint;
+  DebugMsg (NULL, 0, 9, "PeiCore physical entry point address", "Address = 0x%llX", (unsigned long long) PeiCorePhysicalAddress);
+
+  if (MachineType == EFI_IMAGE_MACHINE_IA64) {
+    //
+    // Update PEI_CORE address
+    //
+    //
+    // Set the uncached attribute bit in the physical address
+    //
+    PeiCorePhysicalAddress |= 0x8000000000000000ULL;
+
+    //
+    // Check if address is aligned on a 16 byte boundary
+    //
+    if (PeiCorePhysicalAddress & 0xF) {
+      Error (NULL, 0, 3000, "Invalid",
+        "PEI_CORE entry point is not aligned on a 16 byte boundary, address specified is %llXh.",
+        (unsigned long long) PeiCorePhysicalAddress
+        );
+      return EFI_ABORTED;
+    }
+    //
+    // First Get the FIT table address
+    //
+    FitAddress  = (*(UINT64 *) (FvImage->Eof - IPF_FIT_ADDRESS_OFFSET)) & 0xFFFFFFFF;
+
+    FitTablePtr = (FIT_TABLE *) (FvImage->FileImage + (FitAddress - FvInfo->BaseAddress));
+
+    Status      = UpdatePeiCoreEntryInFit (FitTablePtr, PeiCorePhysicalAddress);
+
+    if (!EFI_ERROR (Status)) {
+      UpdateFitCheckSum (FitTablePtr);
+    }
+
+    //
+    // Update SEC_CORE address
+    //
+    //
+    // Set the uncached attribute bit in the physical address
+    //
+    SecCorePhysicalAddress |= 0x8000000000000000ULL;
+    //
+    // Check if address is aligned on a 16 byte boundary
+    //
+    if (SecCorePhysicalAddress & 0xF) {
+      Error (NULL, 0, 3000, "Invalid",
+        "SALE_ENTRY entry point is not aligned on a 16 byte boundary, address specified is %llXh.",
+        (unsigned long long) SecCorePhysicalAddress
+        );
+      return EFI_ABORTED;
+    }
+    //
+    // Update the address
+    //
+    SecCoreEntryAddressPtr  = (EFI_PHYSICAL_ADDRESS *) ((UINTN) FvImage->Eof - IPF_SALE_ENTRY_ADDRESS_OFFSET);
+    *SecCoreEntryAddressPtr = SecCorePhysicalAddress;
+
+  } else if (MachineType == EFI_IMAGE_MACHINE_IA32 || MachineType == EFI_IMAGE_MACHINE_X64) {
+    //
+    // Get the location to update
+    //
+    Ia32ResetAddressPtr  = (UINT32 *) ((UINTN) FvImage->Eof - IA32_PEI_CORE_ENTRY_OFFSET);
+
+    //
+    // Write lower 32 bits of physical address for Pei Core entry
+    //
+    *Ia32ResetAddressPtr = (UINT32) PeiCorePhysicalAddress;
+    
+    //
+    // Write SecCore Entry point relative address into the jmp instruction in reset vector.
+    // 
+    Ia32ResetAddressPtr  = (UINT32 *) ((UINTN) FvImage->Eof - IA32_SEC_CORE_ENTRY_OFFSET);
+    
+    Ia32SecEntryOffset   = (INT32) (SecCorePhysicalAddress - (FV_IMAGES_TOP_ADDRESS - IA32_SEC_CORE_ENTRY_OFFSET + 2));
+    if (Ia32SecEntryOffset <= -65536) {
+      Error (NULL, 0, 3000, "Invalid", "The SEC EXE file size is too large, it must be less than 64K.");
+      return STATUS_ERROR;
+    }
+    
+    *(UINT16 *) Ia32ResetAddressPtr = (UINT16) Ia32SecEntryOffset;
+
+    //
+    // Update the BFV base address
+    //
+    Ia32ResetAddressPtr   = (UINT32 *) ((UINTN) FvImage->Eof - 4);
+    *Ia32ResetAddressPtr  = (UINT32) (FvInfo->BaseAddress);
+    DebugMsg (NULL, 0, 9, "update BFV base address in the top FV image", "BFV base address = 0x%llX.", (unsigned long long) FvInfo->BaseAddress);
+
+    //
+    // Update the Startup AP in the FVH header block ZeroVector region.
+    //
+    BytePointer   = (UINT8 *) ((UINTN) FvImage->FileImage);
+    if (FvInfo->Size <= 0x10000) {
+      BytePointer2 = m64kRecoveryStartupApDataArray;
+    } else if (FvInfo->Size <= 0x20000) {
+      BytePointer2 = m128kRecoveryStartupApDataArray;
+    } else {
+      BytePointer2 = m128kRecoveryStartupApDataArray;
+      //
+      // Find the position to place Ap reset vector, the offset
+      // between the position and the end of Fvrecovery.fv file
+      // should not exceed 128kB to prevent Ap reset vector from
+      // outside legacy E and F segment
+      //
+      Status = FindApResetVectorPosition (FvImage, &BytePointer);
+      if (EFI_ERROR (Status)) {
+        Error (NULL, 0, 3000, "Invalid", "FV image does not have enough space to place AP reset vector. The FV image needs to reserve at least 4KB of unused space.");
+        return EFI_ABORTED;
+      }
+    }
+
+    for (Index = 0; Index < SIZEOF_STARTUP_DATA_ARRAY; Index++) {
+      BytePointer[Index] = BytePointer2[Index];
+    }
+    //
+    // Calculate the checksum
+    //
+    CheckSum              = 0x0000;
+    WordPointer = (UINT16 *) (BytePointer);
+    for (Index = 0; Index < SIZEOF_STARTUP_DATA_ARRAY / 2; Index++) {
+      CheckSum = (UINT16) (CheckSum + ((UINT16) *WordPointer));
+      WordPointer++;
+    }
+    //
+    // Update the checksum field
+    //
+    WordPointer   = (UINT16 *) (BytePointer + SIZEOF_STARTUP_DATA_ARRAY - 2);
+    *WordPointer  = (UINT16) (0x10000 - (UINT32) CheckSum);
+    
+    //
+    // IpiVector at the 4k aligned address in the top 2 blocks in the PEI FV. 
+    //
+    IpiVector  = (UINT32) (FV_IMAGES_TOP_ADDRESS - ((UINTN) FvImage->Eof - (UINTN) BytePointer));
+    DebugMsg (NULL, 0, 9, "Startup AP Vector address", "IpiVector at 0x%X", (unsigned) IpiVector);
+    if ((IpiVector & 0xFFF) != 0) {
+      Error (NULL, 0, 3000, "Invalid", "Startup AP Vector address are not 4K aligned, because the FV size is not 4K aligned");
+      return EFI_ABORTED;
+    }
+    IpiVector  = IpiVector >> 12;
+    IpiVector  = IpiVector & 0xFF;
+
+    //
+    // Write IPI Vector at Offset FvrecoveryFileSize - 8
+    //
+    Ia32ResetAddressPtr   = (UINT32 *) ((UINTN) FvImage->Eof - 8);
+    *Ia32ResetAddressPtr  = IpiVector;
+  } else if (MachineType == EFI_IMAGE_MACHINE_ARMT) {
+    //
+    // Since the ARM reset vector is in the FV Header you really don't need a
+    // Volume Top File, but if you have one for some reason don't crash...
+    //
+  } else {
+    Error (NULL, 0, 3000, "Invalid", "machine type=0x%X in PEI core.", MachineType);
+    return EFI_ABORTED;
+  }
+
+  //
+  // Now update file checksum
+  //
+  SavedState  = VtfFile->State;
+  VtfFile->IntegrityCheck.Checksum.File = 0;
+  VtfFile->State                        = 0;
+  if (VtfFile->Attributes & FFS_ATTRIB_CHECKSUM) {
+    VtfFile->IntegrityCheck.Checksum.File = CalculateChecksum8 (
+                                              (UINT8 *) (VtfFile + 1),
+                                              GetLength (VtfFile->Size) - sizeof (EFI_FFS_FILE_HEADER)
+                                              );
+  } else {
+    VtfFile->IntegrityCheck.Checksum.File = FFS_FIXED_CHECKSUM;
+  }
+
+  VtfFile->State = SavedState;
+
+  return EFI_SUCCESS;
+}
+
+
+EFI_STATUS
+UpdateArmResetVectorIfNeeded (
+  IN MEMORY_FILE            *FvImage,
+  IN FV_INFO                *FvInfo
+  )
+/*++
+
+Routine Description:
+  This parses the FV looking for SEC and patches that address into the 
+  beginning of the FV header.
+
+  For ARM the reset vector is at 0x00000000 or 0xFFFF0000.
+  This would commonly map to the first entry in the ROM. 
+  ARM Exceptions:
+  Reset            +0    
+  Undefined        +4
+  SWI              +8
+  Prefetch Abort   +12
+  Data Abort       +16
+  IRQ              +20
+  FIQ              +24
+
+  We support two schemes on ARM.
+  1) Beginning of the FV is the reset vector
+  2) Reset vector is data bytes FDF file and that code branches to reset vector 
+    in the beginning of the FV (fixed size offset).
+
+
+  Need to have the jump for the reset vector at location zero.
+  We also need to store the address or PEI (if it exists).
+  We stub out a return from interrupt in case the debugger 
+   is using SWI.
+  The optional entry to the common exception handler is 
+   to support full featured exception handling from ROM and is currently 
+    not support by this tool.
+
+Arguments:
+  FvImage       Memory file for the FV memory image
+  FvInfo        Information read from INF file.
+
+Returns:
+
+  EFI_SUCCESS             Function Completed successfully.
+  EFI_ABORTED             Error encountered.
+  EFI_INVALID_PARAMETER   A required parameter was NULL.
+  EFI_NOT_FOUND           PEI Core file not found.
 
 --*/
 {
@@ -1283,24 +2963,15 @@ Returns:
   UINT16                    MachineType;
   EFI_PHYSICAL_ADDRESS      PeiCorePhysicalAddress;
   EFI_PHYSICAL_ADDRESS      SecCorePhysicalAddress;
-  EFI_PHYSICAL_ADDRESS      *SecCoreEntryAddressPtr;
-  INT32                     Ia32SecEntryOffset;
-  UINT32                    *Ia32ResetAddressPtr;
-  UINT8                     *BytePointer;
-  UINT8                     *BytePointer2;
-  UINT16                    *WordPointer;
-  UINT16                    CheckSum;
-  UINT32                    IpiVector;
-  UINTN                     Index;
-  EFI_FFS_FILE_STATE        SavedState;
-  UINT64                    FitAddress;
-  FIT_TABLE                 *FitTablePtr;
-  BOOLEAN                   Vtf0Detected;
+  INT32                     ResetVector[4]; // 0 - is branch relative to SEC entry point
+                                            // 1 - PEI Entry Point
+                                            // 2 - movs pc,lr for a SWI handler
+                                            // 3 - Place holder for Common Exception Handler
 
   //
   // Verify input parameters
   //
-  if (FvImage == NULL || FvInfo == NULL || VtfFile == NULL) {
+  if (FvImage == NULL || FvInfo == NULL) {
     return EFI_INVALID_PARAMETER;
   }
   //
@@ -1308,43 +2979,69 @@ Returns:
   //
   InitializeFvLib (FvImage->FileImage, FvInfo->Size);
 
-  //
-  // Verify VTF file
-  //
-  Status = VerifyFfsFile (VtfFile);
-  if (EFI_ERROR (Status)) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  if (
-      (((UINTN)FvImage->Eof - (UINTN)FvImage->FileImage) >=
-        IA32_X64_VTF_SIGNATURE_OFFSET) &&
-      (*(UINT32 *)(VOID*)((UINTN) FvImage->Eof -
-                                  IA32_X64_VTF_SIGNATURE_OFFSET) ==
-        IA32_X64_VTF0_SIGNATURE)
-     ) {
-    Vtf0Detected = TRUE;
-  } else {
-    Vtf0Detected = FALSE;
-  }
-
   //
   // Find the Sec Core
   //
   Status = GetFileByType (EFI_FV_FILETYPE_SECURITY_CORE, 1, &SecCoreFile);
   if (EFI_ERROR (Status) || SecCoreFile == NULL) {
-    if (Vtf0Detected) {
+    //
+    // Maybe hardware does SEC job and we only have PEI Core?
+    //
+
+    //
+    // Find the PEI Core. It may not exist if SEC loads DXE core directly
+    //
+    PeiCorePhysicalAddress = 0;
+    Status = GetFileByType (EFI_FV_FILETYPE_PEI_CORE, 1, &PeiCoreFile);
+    if (!EFI_ERROR (Status) && PeiCoreFile != NULL) {
       //
-      // If the SEC core file is not found, but the VTF-0 signature
-      // is found, we'll treat it as a VTF-0 'Volume Top File'.
-      // This means no modifications are required to the VTF.
+      // PEI Core found, now find PE32 or TE section
       //
-      return EFI_SUCCESS;
+      Status = GetSectionByType (PeiCoreFile, EFI_SECTION_PE32, 1, &Pe32Section);
+      if (Status == EFI_NOT_FOUND) {
+        Status = GetSectionByType (PeiCoreFile, EFI_SECTION_TE, 1, &Pe32Section);
+      }
+    
+      if (EFI_ERROR (Status)) {
+        Error (NULL, 0, 3000, "Invalid", "could not find either a PE32 or a TE section in PEI core file!");
+        return EFI_ABORTED;
+      }
+    
+      Status = GetPe32Info (
+                (VOID *) ((UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32)),
+                &EntryPoint,
+                &BaseOfCode,
+                &MachineType
+                );
+    
+      if (EFI_ERROR (Status)) {
+        Error (NULL, 0, 3000, "Invalid", "could not get the PE32 entry point for the PEI core!");
+        return EFI_ABORTED;
+      }
+      //
+      // Physical address is FV base + offset of PE32 + offset of the entry point
+      //
+      PeiCorePhysicalAddress = FvInfo->BaseAddress;
+      PeiCorePhysicalAddress += (UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32) - (UINTN) FvImage->FileImage;
+      PeiCorePhysicalAddress += EntryPoint;
+      DebugMsg (NULL, 0, 9, "PeiCore physical entry point address", "Address = 0x%llX", (unsigned long long) PeiCorePhysicalAddress);
+
+      if (MachineType == EFI_IMAGE_MACHINE_ARMT) {
+        memset (ResetVector, 0, sizeof (ResetVector));
+        // Address of PEI Core, if we have one
+        ResetVector[1] = (UINT32)PeiCorePhysicalAddress;
+      }
+      
+      //
+      // Copy to the beginning of the FV 
+      //
+      memcpy ((UINT8 *) ((UINTN) FvImage->FileImage), ResetVector, sizeof (ResetVector));
+
     }
 
-    Error (NULL, 0, 3000, "Invalid", "could not find the SEC core file in the FV.");
-    return EFI_ABORTED;
+    return EFI_SUCCESS;
   }
+  
   //
   // Sec Core found, now find PE32 section
   //
@@ -1364,601 +3061,810 @@ Returns:
             &BaseOfCode,
             &MachineType
             );
-
   if (EFI_ERROR (Status)) {
     Error (NULL, 0, 3000, "Invalid", "could not get the PE32 entry point for the SEC core.");
     return EFI_ABORTED;
-  }  
-
-  if (
-       Vtf0Detected &&
-       (MachineType == EFI_IMAGE_MACHINE_IA32 ||
-        MachineType == EFI_IMAGE_MACHINE_X64)
-     ) {
+  }
+  
+  if (MachineType != EFI_IMAGE_MACHINE_ARMT) {
     //
-    // If the SEC core code is IA32 or X64 and the VTF-0 signature
-    // is found, we'll treat it as a VTF-0 'Volume Top File'.
-    // This means no modifications are required to the VTF.
+    // If SEC is not ARM we have nothing to do
     //
     return EFI_SUCCESS;
   }
-
-  //
-  // Physical address is FV base + offset of PE32 + offset of the entry point
-  //
-  SecCorePhysicalAddress = FvInfo->BaseAddress;
-  SecCorePhysicalAddress += (UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32) - (UINTN) FvImage->FileImage;
-  SecCorePhysicalAddress += EntryPoint;
-  DebugMsg (NULL, 0, 9, "SecCore physical entry point address", "Address = 0x%llX", (unsigned long long) SecCorePhysicalAddress); 
-
-  //
-  // Find the PEI Core
-  //
-  Status = GetFileByType (EFI_FV_FILETYPE_PEI_CORE, 1, &PeiCoreFile);
-  if (EFI_ERROR (Status) || PeiCoreFile == NULL) {
-    Error (NULL, 0, 3000, "Invalid", "could not find the PEI core in the FV.");
-    return EFI_ABORTED;
-  }
-  //
-  // PEI Core found, now find PE32 or TE section
-  //
-  Status = GetSectionByType (PeiCoreFile, EFI_SECTION_PE32, 1, &Pe32Section);
-  if (Status == EFI_NOT_FOUND) {
-    Status = GetSectionByType (PeiCoreFile, EFI_SECTION_TE, 1, &Pe32Section);
-  }
-
-  if (EFI_ERROR (Status)) {
-    Error (NULL, 0, 3000, "Invalid", "could not find either a PE32 or a TE section in PEI core file.");
-    return EFI_ABORTED;
-  }
-
-  Status = GetPe32Info (
-            (VOID *) ((UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32)),
-            &EntryPoint,
-            &BaseOfCode,
-            &MachineType
-            );
-
-  if (EFI_ERROR (Status)) {
-    Error (NULL, 0, 3000, "Invalid", "could not get the PE32 entry point for the PEI core.");
-    return EFI_ABORTED;
-  }
+  
   //
   // Physical address is FV base + offset of PE32 + offset of the entry point
   //
-  PeiCorePhysicalAddress = FvInfo->BaseAddress;
-  PeiCorePhysicalAddress += (UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32) - (UINTN) FvImage->FileImage;
-  PeiCorePhysicalAddress += EntryPoint;
-  DebugMsg (NULL, 0, 9, "PeiCore physical entry point address", "Address = 0x%llX", (unsigned long long) PeiCorePhysicalAddress);
-
-  if (MachineType == EFI_IMAGE_MACHINE_IA64) {
-    //
-    // Update PEI_CORE address
-    //
-    //
-    // Set the uncached attribute bit in the physical address
-    //
-    PeiCorePhysicalAddress |= 0x8000000000000000ULL;
+  SecCorePhysicalAddress = FvInfo->BaseAddress;
+  SecCorePhysicalAddress += (UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32) - (UINTN) FvImage->FileImage;
+  SecCorePhysicalAddress += EntryPoint;
+  DebugMsg (NULL, 0, 9, "SecCore physical entry point address", "Address = 0x%llX", (unsigned long long) SecCorePhysicalAddress); 
 
+  //
+  // Find the PEI Core. It may not exist if SEC loads DXE core directly
+  //
+  PeiCorePhysicalAddress = 0;
+  Status = GetFileByType (EFI_FV_FILETYPE_PEI_CORE, 1, &PeiCoreFile);
+  if (!EFI_ERROR (Status) && PeiCoreFile != NULL) {
     //
-    // Check if address is aligned on a 16 byte boundary
+    // PEI Core found, now find PE32 or TE section
     //
-    if (PeiCorePhysicalAddress & 0xF) {
-      Error (NULL, 0, 3000, "Invalid",
-        "PEI_CORE entry point is not aligned on a 16 byte boundary, address specified is %llXh.",
-        (unsigned long long) PeiCorePhysicalAddress
-        );
+    Status = GetSectionByType (PeiCoreFile, EFI_SECTION_PE32, 1, &Pe32Section);
+    if (Status == EFI_NOT_FOUND) {
+      Status = GetSectionByType (PeiCoreFile, EFI_SECTION_TE, 1, &Pe32Section);
+    }
+  
+    if (EFI_ERROR (Status)) {
+      Error (NULL, 0, 3000, "Invalid", "could not find either a PE32 or a TE section in PEI core file!");
+      return EFI_ABORTED;
+    }
+  
+    Status = GetPe32Info (
+              (VOID *) ((UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32)),
+              &EntryPoint,
+              &BaseOfCode,
+              &MachineType
+              );
+  
+    if (EFI_ERROR (Status)) {
+      Error (NULL, 0, 3000, "Invalid", "could not get the PE32 entry point for the PEI core!");
       return EFI_ABORTED;
     }
     //
-    // First Get the FIT table address
+    // Physical address is FV base + offset of PE32 + offset of the entry point
     //
-    FitAddress  = (*(UINT64 *) (FvImage->Eof - IPF_FIT_ADDRESS_OFFSET)) & 0xFFFFFFFF;
+    PeiCorePhysicalAddress = FvInfo->BaseAddress;
+    PeiCorePhysicalAddress += (UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32) - (UINTN) FvImage->FileImage;
+    PeiCorePhysicalAddress += EntryPoint;
+    DebugMsg (NULL, 0, 9, "PeiCore physical entry point address", "Address = 0x%llX", (unsigned long long) PeiCorePhysicalAddress);
+  }
+  
+  
+  // B SecEntryPoint - signed_immed_24 part +/-32MB offset
+  // on ARM, the PC is always 8 ahead, so we're not really jumping from the base address, but from base address + 8
+  ResetVector[0] = (INT32)(SecCorePhysicalAddress - FvInfo->BaseAddress - 8) >> 2;
+  
+  if (ResetVector[0] > 0x00FFFFFF) {
+    Error (NULL, 0, 3000, "Invalid", "SEC Entry point must be within 32MB of the start of the FV");
+    return EFI_ABORTED;    
+  }
+  
+  // Add opcode for an uncondional branch with no link. AKA B SecEntryPoint
+  ResetVector[0] |= 0xEB000000;
+  
+  
+  // Address of PEI Core, if we have one
+  ResetVector[1] = (UINT32)PeiCorePhysicalAddress;
+  
+  // SWI handler movs   pc,lr. Just in case a debugger uses SWI
+  ResetVector[2] = 0xE1B0F07E;
+  
+  // Place holder to support a common interrupt handler from ROM. 
+  // Currently not suppprted. For this to be used the reset vector would not be in this FV
+  // and the exception vectors would be hard coded in the ROM and just through this address 
+  // to find a common handler in the a module in the FV.
+  ResetVector[3] = 0;
 
-    FitTablePtr = (FIT_TABLE *) (FvImage->FileImage + (FitAddress - FvInfo->BaseAddress));
+  //
+  // Copy to the beginning of the FV 
+  //
+  memcpy ((UINT8 *) ((UINTN) FvImage->FileImage), ResetVector, sizeof (ResetVector));
 
-    Status      = UpdatePeiCoreEntryInFit (FitTablePtr, PeiCorePhysicalAddress);
+  DebugMsg (NULL, 0, 9, "Update Reset vector in FV Header", NULL);
 
-    if (!EFI_ERROR (Status)) {
-      UpdateFitCheckSum (FitTablePtr);
-    }
+  return EFI_SUCCESS;
+}
 
-    //
-    // Update SEC_CORE address
-    //
-    //
-    // Set the uncached attribute bit in the physical address
-    //
-    SecCorePhysicalAddress |= 0x8000000000000000ULL;
-    //
-    // Check if address is aligned on a 16 byte boundary
-    //
-    if (SecCorePhysicalAddress & 0xF) {
-      Error (NULL, 0, 3000, "Invalid",
-        "SALE_ENTRY entry point is not aligned on a 16 byte boundary, address specified is %llXh.",
-        (unsigned long long) SecCorePhysicalAddress
-        );
-      return EFI_ABORTED;
-    }
-    //
-    // Update the address
-    //
-    SecCoreEntryAddressPtr  = (EFI_PHYSICAL_ADDRESS *) ((UINTN) FvImage->Eof - IPF_SALE_ENTRY_ADDRESS_OFFSET);
-    *SecCoreEntryAddressPtr = SecCorePhysicalAddress;
+EFI_STATUS
+GetPe32Info (
+  IN UINT8                  *Pe32,
+  OUT UINT32                *EntryPoint,
+  OUT UINT32                *BaseOfCode,
+  OUT UINT16                *MachineType
+  )
+/*++
 
-  } else if (MachineType == EFI_IMAGE_MACHINE_IA32 || MachineType == EFI_IMAGE_MACHINE_X64) {
-    //
-    // Get the location to update
-    //
-    Ia32ResetAddressPtr  = (UINT32 *) ((UINTN) FvImage->Eof - IA32_PEI_CORE_ENTRY_OFFSET);
+Routine Description:
 
-    //
-    // Write lower 32 bits of physical address for Pei Core entry
-    //
-    *Ia32ResetAddressPtr = (UINT32) PeiCorePhysicalAddress;
-    
-    //
-    // Write SecCore Entry point relative address into the jmp instruction in reset vector.
-    // 
-    Ia32ResetAddressPtr  = (UINT32 *) ((UINTN) FvImage->Eof - IA32_SEC_CORE_ENTRY_OFFSET);
-    
-    Ia32SecEntryOffset   = (INT32) (SecCorePhysicalAddress - (FV_IMAGES_TOP_ADDRESS - IA32_SEC_CORE_ENTRY_OFFSET + 2));
-    if (Ia32SecEntryOffset <= -65536) {
-      Error (NULL, 0, 3000, "Invalid", "The SEC EXE file size is too large, it must be less than 64K.");
-      return STATUS_ERROR;
-    }
-    
-    *(UINT16 *) Ia32ResetAddressPtr = (UINT16) Ia32SecEntryOffset;
+  Retrieves the PE32 entry point offset and machine type from PE image or TeImage.  
+  See EfiImage.h for machine types.  The entry point offset is from the beginning 
+  of the PE32 buffer passed in.
 
-    //
-    // Update the BFV base address
-    //
-    Ia32ResetAddressPtr   = (UINT32 *) ((UINTN) FvImage->Eof - 4);
-    *Ia32ResetAddressPtr  = (UINT32) (FvInfo->BaseAddress);
-    DebugMsg (NULL, 0, 9, "update BFV base address in the top FV image", "BFV base address = 0x%llX.", (unsigned long long) FvInfo->BaseAddress);
+Arguments:
 
-    //
-    // Update the Startup AP in the FVH header block ZeroVector region.
-    //
-    BytePointer   = (UINT8 *) ((UINTN) FvImage->FileImage);
-    if (FvInfo->Size <= 0x10000) {
-      BytePointer2 = m64kRecoveryStartupApDataArray;
-    } else if (FvInfo->Size <= 0x20000) {
-      BytePointer2 = m128kRecoveryStartupApDataArray;
-    } else {
-      BytePointer2 = m128kRecoveryStartupApDataArray;
-      //
-      // Find the position to place Ap reset vector, the offset
-      // between the position and the end of Fvrecovery.fv file
-      // should not exceed 128kB to prevent Ap reset vector from
-      // outside legacy E and F segment
-      //
-      Status = FindApResetVectorPosition (FvImage, &BytePointer);
-      if (EFI_ERROR (Status)) {
-        Error (NULL, 0, 3000, "Invalid", "FV image does not have enough space to place AP reset vector. The FV image needs to reserve at least 4KB of unused space.");
-        return EFI_ABORTED;
-      }
-    }
+  Pe32          Beginning of the PE32.
+  EntryPoint    Offset from the beginning of the PE32 to the image entry point.
+  BaseOfCode    Base address of code.
+  MachineType   Magic number for the machine type.
 
-    for (Index = 0; Index < SIZEOF_STARTUP_DATA_ARRAY; Index++) {
-      BytePointer[Index] = BytePointer2[Index];
-    }
+Returns:
+
+  EFI_SUCCESS             Function completed successfully.
+  EFI_ABORTED             Error encountered.
+  EFI_INVALID_PARAMETER   A required parameter was NULL.
+  EFI_UNSUPPORTED         The operation is unsupported.
+
+--*/
+{
+  EFI_IMAGE_DOS_HEADER             *DosHeader;
+  EFI_IMAGE_OPTIONAL_HEADER_UNION  *ImgHdr;
+  EFI_TE_IMAGE_HEADER              *TeHeader;
+
+  //
+  // Verify input parameters
+  //
+  if (Pe32 == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // First check whether it is one TE Image.
+  //
+  TeHeader = (EFI_TE_IMAGE_HEADER *) Pe32;
+  if (TeHeader->Signature == EFI_TE_IMAGE_HEADER_SIGNATURE) {
     //
-    // Calculate the checksum
+    // By TeImage Header to get output
     //
-    CheckSum              = 0x0000;
-    WordPointer = (UINT16 *) (BytePointer);
-    for (Index = 0; Index < SIZEOF_STARTUP_DATA_ARRAY / 2; Index++) {
-      CheckSum = (UINT16) (CheckSum + ((UINT16) *WordPointer));
-      WordPointer++;
-    }
+    *EntryPoint   = TeHeader->AddressOfEntryPoint + sizeof (EFI_TE_IMAGE_HEADER) - TeHeader->StrippedSize;
+    *BaseOfCode   = TeHeader->BaseOfCode + sizeof (EFI_TE_IMAGE_HEADER) - TeHeader->StrippedSize;
+    *MachineType  = TeHeader->Machine;
+  } else {
+  
     //
-    // Update the checksum field
+    // Then check whether 
+    // First is the DOS header
     //
-    WordPointer   = (UINT16 *) (BytePointer + SIZEOF_STARTUP_DATA_ARRAY - 2);
-    *WordPointer  = (UINT16) (0x10000 - (UINT32) CheckSum);
-    
+    DosHeader = (EFI_IMAGE_DOS_HEADER *) Pe32;
+  
     //
-    // IpiVector at the 4k aligned address in the top 2 blocks in the PEI FV. 
+    // Verify DOS header is expected
     //
-    IpiVector  = (UINT32) (FV_IMAGES_TOP_ADDRESS - ((UINTN) FvImage->Eof - (UINTN) BytePointer));
-    DebugMsg (NULL, 0, 9, "Startup AP Vector address", "IpiVector at 0x%X", (unsigned) IpiVector);
-    if ((IpiVector & 0xFFF) != 0) {
-      Error (NULL, 0, 3000, "Invalid", "Startup AP Vector address are not 4K aligned, because the FV size is not 4K aligned");
-      return EFI_ABORTED;
+    if (DosHeader->e_magic != EFI_IMAGE_DOS_SIGNATURE) {
+      Error (NULL, 0, 3000, "Invalid", "Unknown magic number in the DOS header, 0x%04X.", DosHeader->e_magic);
+      return EFI_UNSUPPORTED;
     }
-    IpiVector  = IpiVector >> 12;
-    IpiVector  = IpiVector & 0xFF;
-
     //
-    // Write IPI Vector at Offset FvrecoveryFileSize - 8
+    // Immediately following is the NT header.
     //
-    Ia32ResetAddressPtr   = (UINT32 *) ((UINTN) FvImage->Eof - 8);
-    *Ia32ResetAddressPtr  = IpiVector;
-  } else if (MachineType == EFI_IMAGE_MACHINE_ARMT) {
+    ImgHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *) ((UINTN) Pe32 + DosHeader->e_lfanew);
+  
+    //
+    // Verify NT header is expected
     //
-    // Since the ARM reset vector is in the FV Header you really don't need a
-    // Volume Top File, but if you have one for some reason don't crash...
+    if (ImgHdr->Pe32.Signature != EFI_IMAGE_NT_SIGNATURE) {
+      Error (NULL, 0, 3000, "Invalid", "Unrecognized image signature 0x%08X.", (unsigned) ImgHdr->Pe32.Signature);
+      return EFI_UNSUPPORTED;
+    }
     //
-  } else {
-    Error (NULL, 0, 3000, "Invalid", "machine type=0x%X in PEI core.", MachineType);
-    return EFI_ABORTED;
+    // Get output
+    //
+    *EntryPoint   = ImgHdr->Pe32.OptionalHeader.AddressOfEntryPoint;
+    *BaseOfCode   = ImgHdr->Pe32.OptionalHeader.BaseOfCode;
+    *MachineType  = ImgHdr->Pe32.FileHeader.Machine;
   }
 
   //
-  // Now update file checksum
+  // Verify machine type is supported
   //
-  SavedState  = VtfFile->State;
-  VtfFile->IntegrityCheck.Checksum.File = 0;
-  VtfFile->State                        = 0;
-  if (VtfFile->Attributes & FFS_ATTRIB_CHECKSUM) {
-    VtfFile->IntegrityCheck.Checksum.File = CalculateChecksum8 (
-                                              (UINT8 *) (VtfFile + 1),
-                                              GetLength (VtfFile->Size) - sizeof (EFI_FFS_FILE_HEADER)
-                                              );
-  } else {
-    VtfFile->IntegrityCheck.Checksum.File = FFS_FIXED_CHECKSUM;
+  if (*MachineType != EFI_IMAGE_MACHINE_IA32 && *MachineType != EFI_IMAGE_MACHINE_IA64 && *MachineType != EFI_IMAGE_MACHINE_X64 && *MachineType != EFI_IMAGE_MACHINE_EBC && 
+      *MachineType != EFI_IMAGE_MACHINE_ARMT) {
+    Error (NULL, 0, 3000, "Invalid", "Unrecognized machine type in the PE32 file.");
+    return EFI_UNSUPPORTED;
   }
 
-  VtfFile->State = SavedState;
-
   return EFI_SUCCESS;
 }
 
+STATIC
+BOOLEAN
+ReadWholeFile (
+  IN  CHAR8     *FileName,
+  OUT UINT8     **Buffer,
+  OUT UINTN     *Size
+  )
+/*++
 
-EFI_STATUS
-UpdateArmResetVectorIfNeeded (
-  IN MEMORY_FILE            *FvImage,
-  IN FV_INFO                *FvInfo
+Routine Description:
+
+  This function reads a whole file into a new buffer, without reporting
+  an error if the file does not exist.
+
+Arguments:
+
+  FileName        Name of the file.
+  Buffer          Receives the content, free it with free().
+  Size            Receives the size of the file.
+
+Returns:
+
+  TRUE            The file was read.
+  FALSE           The file could not be read.
+
+--*/
+{
+  FILE    *File;
+
+  *Buffer = NULL;
+  *Size   = 0;
+  File    = fopen (FileName, "rb");
+  if (File == NULL) {
+    return FALSE;
+  }
+  *Size   = _filelength (fileno (File));
+  *Buffer = (UINT8 *) malloc (*Size + 1);
+  if (*Buffer == NULL || fread (*Buffer, 1, *Size, File) != *Size) {
+    fclose (File);
+    free (*Buffer);
+    *Buffer = NULL;
+    return FALSE;
+  }
+  fclose (File);
+  return TRUE;
+}
+
+STATIC
+VOID
+DigestToString (
+  IN  UINT8       *Digest,
+  OUT CHAR8       *String
   )
 /*++
 
 Routine Description:
-  This parses the FV looking for SEC and patches that address into the 
-  beginning of the FV header.
 
-  For ARM the reset vector is at 0x00000000 or 0xFFFF0000.
-  This would commonly map to the first entry in the ROM. 
-  ARM Exceptions:
-  Reset            +0    
-  Undefined        +4
-  SWI              +8
-  Prefetch Abort   +12
-  Data Abort       +16
-  IRQ              +20
-  FIQ              +24
+  This function prints a SHA-256 digest as hexadecimal digits.
 
-  We support two schemes on ARM.
-  1) Beginning of the FV is the reset vector
-  2) Reset vector is data bytes FDF file and that code branches to reset vector 
-    in the beginning of the FV (fixed size offset).
+Arguments:
 
+  Digest          The SHA256_DIGEST_SIZE bytes of the digest.
+  String          Receives 2 * SHA256_DIGEST_SIZE digits and a NUL.
 
-  Need to have the jump for the reset vector at location zero.
-  We also need to store the address or PEI (if it exists).
-  We stub out a return from interrupt in case the debugger 
-   is using SWI.
-  The optional entry to the common exception handler is 
-   to support full featured exception handling from ROM and is currently 
-    not support by this tool.
+Returns:
+
+  None
+
+--*/
+{
+  UINTN   Index;
+
+  for (Index = 0; Index < SHA256_DIGEST_SIZE; Index++) {
+    sprintf (String + Index * 2, "%02x", (unsigned) Digest[Index]);
+  }
+}
+
+STATIC
+BOOLEAN
+StringToDigest (
+  IN  CHAR8       *String,
+  OUT UINT8       *Digest
+  )
+/*++
+
+Routine Description:
+
+  This function reads a SHA-256 digest printed by DigestToString.
 
 Arguments:
-  FvImage       Memory file for the FV memory image
-  FvInfo        Information read from INF file.
+
+  String          The hexadecimal digits.
+  Digest          Receives the SHA256_DIGEST_SIZE bytes of the digest.
 
 Returns:
 
-  EFI_SUCCESS             Function Completed successfully.
-  EFI_ABORTED             Error encountered.
-  EFI_INVALID_PARAMETER   A required parameter was NULL.
-  EFI_NOT_FOUND           PEI Core file not found.
+  TRUE            The digest was read.
+  FALSE           String is not a digest.
 
 --*/
 {
-  EFI_FFS_FILE_HEADER       *PeiCoreFile;
-  EFI_FFS_FILE_HEADER       *SecCoreFile;
-  EFI_STATUS                Status;
-  EFI_FILE_SECTION_POINTER  Pe32Section;
-  UINT32                    EntryPoint;
-  UINT32                    BaseOfCode;
-  UINT16                    MachineType;
-  EFI_PHYSICAL_ADDRESS      PeiCorePhysicalAddress;
-  EFI_PHYSICAL_ADDRESS      SecCorePhysicalAddress;
-  INT32                     ResetVector[4]; // 0 - is branch relative to SEC entry point
-                                            // 1 - PEI Entry Point
-                                            // 2 - movs pc,lr for a SWI handler
-                                            // 3 - Place holder for Common Exception Handler
+  UINTN     Index;
+  unsigned  Byte;
 
-  //
-  // Verify input parameters
-  //
-  if (FvImage == NULL || FvInfo == NULL) {
-    return EFI_INVALID_PARAMETER;
+  if (strlen (String) != 2 * SHA256_DIGEST_SIZE) {
+    return FALSE;
   }
-  //
-  // Initialize FV library
-  //
-  InitializeFvLib (FvImage->FileImage, FvInfo->Size);
+  for (Index = 0; Index < SHA256_DIGEST_SIZE; Index++) {
+    if (!isxdigit ((int) String[Index * 2]) || !isxdigit ((int) String[Index * 2 + 1]) ||
+        sscanf (String + Index * 2, "%2x", &Byte) != 1) {
+      return FALSE;
+    }
+    Digest[Index] = (UINT8) Byte;
+  }
+  return TRUE;
+}
 
-  //
-  // Find the Sec Core
-  //
-  Status = GetFileByType (EFI_FV_FILETYPE_SECURITY_CORE, 1, &SecCoreFile);
-  if (EFI_ERROR (Status) || SecCoreFile == NULL) {
-    //
-    // Maybe hardware does SEC job and we only have PEI Core?
-    //
+STATIC
+VOID
+HashPeMapFileStamp (
+  IN OUT SHA256_CONTEXT   *Sha,
+  IN     VOID             *ImageBase,
+  IN     CHAR8            *FileName
+  )
+/*++
 
-    //
-    // Find the PEI Core. It may not exist if SEC loads DXE core directly
-    //
-    PeiCorePhysicalAddress = 0;
-    Status = GetFileByType (EFI_FV_FILETYPE_PEI_CORE, 1, &PeiCoreFile);
-    if (!EFI_ERROR (Status) && PeiCoreFile != NULL) {
-      //
-      // PEI Core found, now find PE32 or TE section
-      //
-      Status = GetSectionByType (PeiCoreFile, EFI_SECTION_PE32, 1, &Pe32Section);
-      if (Status == EFI_NOT_FOUND) {
-        Status = GetSectionByType (PeiCoreFile, EFI_SECTION_TE, 1, &Pe32Section);
-      }
-    
-      if (EFI_ERROR (Status)) {
-        Error (NULL, 0, 3000, "Invalid", "could not find either a PE32 or a TE section in PEI core file!");
-        return EFI_ABORTED;
-      }
-    
-      Status = GetPe32Info (
-                (VOID *) ((UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32)),
-                &EntryPoint,
-                &BaseOfCode,
-                &MachineType
-                );
-    
-      if (EFI_ERROR (Status)) {
-        Error (NULL, 0, 3000, "Invalid", "could not get the PE32 entry point for the PEI core!");
-        return EFI_ABORTED;
-      }
-      //
-      // Physical address is FV base + offset of PE32 + offset of the entry point
-      //
-      PeiCorePhysicalAddress = FvInfo->BaseAddress;
-      PeiCorePhysicalAddress += (UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32) - (UINTN) FvImage->FileImage;
-      PeiCorePhysicalAddress += EntryPoint;
-      DebugMsg (NULL, 0, 9, "PeiCore physical entry point address", "Address = 0x%llX", (unsigned long long) PeiCorePhysicalAddress);
+Routine Description:
 
-      if (MachineType == EFI_IMAGE_MACHINE_ARMT) {
-        memset (ResetVector, 0, sizeof (ResetVector));
-        // Address of PEI Core, if we have one
-        ResetVector[1] = (UINT32)PeiCorePhysicalAddress;
-      }
-      
-      //
-      // Copy to the beginning of the FV 
-      //
-      memcpy ((UINT8 *) ((UINTN) FvImage->FileImage), ResetVector, sizeof (ResetVector));
+  This function adds the stamp of the PE map file WriteMapFile reads for
+  an image to a SHA-256 calculation.
+
+Arguments:
+
+  Sha             The SHA-256 calculation.
+  ImageBase       The PE32 or TE image.
+  FileName        Name of the FFS file, used when the image has no PDB name.
+
+Returns:
+
+  None
+
+--*/
+{
+  CHAR8   *PdbPointer;
+  CHAR8   PeMapFileName[_MAX_PATH];
+  CHAR8   ModuleName[MAX_LINE_LEN];
+
+  PdbPointer = PeCoffLoaderGetPdbPointer (ImageBase);
+  if (PdbPointer == NULL) {
+    PdbPointer = FileName;
+  }
+  if (GetPeMapFileName (PdbPointer, PeMapFileName, ModuleName)) {
+    HashFileStamp (Sha, PeMapFileName);
+  }
+}
+
+STATIC
+VOID
+GetFvFileMapKey (
+  IN  EFI_FFS_FILE_HEADER   *FfsFile,
+  IN  CHAR8                 *FileName,
+  OUT UINT8                 *MapKey
+  )
+/*++
+
+Routine Description:
+
+  This function computes the key of the PE map files of the PE32 and TE
+  images of a FFS file. The map file lines of an unchanged file can only
+  be reused while the key is unchanged.
+
+Arguments:
+
+  FfsFile         The FFS file, as placed in the FV before it is rebased.
+  FileName        Name of the FFS file.
+  MapKey          Receives the SHA256_DIGEST_SIZE bytes of the key.
+
+Returns:
+
+  None
+
+--*/
+{
+  SHA256_CONTEXT              Sha;
+  EFI_FILE_SECTION_POINTER    Section;
+  UINTN                       Index;
+
+  Sha256Init (&Sha);
+  for (Index = 1; GetSectionByType (FfsFile, EFI_SECTION_PE32, Index, &Section) == EFI_SUCCESS; Index++) {
+    HashPeMapFileStamp (&Sha, (UINT8 *) Section.Pe32Section + sizeof (EFI_PE32_SECTION), FileName);
+  }
+  for (Index = 1; GetSectionByType (FfsFile, EFI_SECTION_TE, Index, &Section) == EFI_SUCCESS; Index++) {
+    HashPeMapFileStamp (&Sha, (UINT8 *) Section.Pe32Section + sizeof (EFI_COMMON_SECTION_HEADER), FileName);
+  }
+  Sha256Final (&Sha, MapKey);
+}
+
+STATIC
+VOID
+FreeFvLayout (
+  IN FV_LAYOUT    *Layout
+  )
+/*++
+
+Routine Description:
+
+  This function frees a layout read by ReadFvLayout.
+
+Arguments:
+
+  Layout          The layout, may be NULL.
+
+Returns:
+
+  None
+
+--*/
+{
+  UINTN   Index;
+
+  if (Layout == NULL) {
+    return;
+  }
+  for (Index = 0; Index < Layout->EntryNumber; Index++) {
+    free (Layout->Entries[Index].FileName);
+  }
+  free (Layout->Entries);
+  free (Layout->FvImage);
+  free (Layout->MapImage);
+  free (Layout);
+}
+
+STATIC
+FV_LAYOUT *
+ReadFvLayout (
+  IN FV_INFO      *FvInfo,
+  IN CHAR8        *FvFileName,
+  IN CHAR8        *FvMapName
+  )
+/*++
+
+Routine Description:
+
+  This function reads the layout recorded by the previous incremental
+  generation of a FV, with the FV image and map file it describes. The
+  layout is only returned if the images of the files were rebased the
+  way the new FV rebases them.
+
+Arguments:
+
+  FvInfo          The FV being generated.
+  FvFileName      Name of the FV image.
+  FvMapName       Name of the FV map file.
 
+Returns:
+
+  The layout, or NULL if there is no usable previous layout.
+
+--*/
+{
+  FV_LAYOUT           *Layout;
+  FV_LAYOUT_ENTRY     *Entry;
+  FILE                *LayoutFile;
+  CHAR8               LayoutName[_MAX_PATH + sizeof (FV_LAYOUT_FILE_EXTENSION)];
+  CHAR8               Line[_MAX_PATH + MAX_LINE_LEN];
+  unsigned            Version;
+  unsigned long long  BaseAddress;
+  int                 ForceRebase;
+  unsigned            FvAttributes;
+  unsigned            Arm;
+  CHAR8               MapHash[2 * SHA256_DIGEST_SIZE + 1];
+  unsigned            EntryNumber;
+  unsigned            Field[4];
+  CHAR8               Hash[3][2 * SHA256_DIGEST_SIZE + 1];
+  int                 NameStart;
+  CHAR8               *Name;
+  SHA256_CONTEXT      Sha;
+  UINT8               Digest[SHA256_DIGEST_SIZE];
+  BOOLEAN             Valid;
+
+  sprintf (LayoutName, "%s%s", FvFileName, FV_LAYOUT_FILE_EXTENSION);
+  LayoutFile = fopen (LayoutName, "r");
+  if (LayoutFile == NULL) {
+    VerboseMsg ("No FV layout %s, generate the whole FV", LayoutName);
+    return NULL;
+  }
+
+  Layout = (FV_LAYOUT *) calloc (1, sizeof (FV_LAYOUT));
+  Valid  = (BOOLEAN) (Layout != NULL &&
+           fgets (Line, sizeof (Line), LayoutFile) != NULL && sscanf (Line, "EFI_FV_LAYOUT_VERSION = %u", &Version) == 1 && Version == FV_LAYOUT_VERSION &&
+           fgets (Line, sizeof (Line), LayoutFile) != NULL && sscanf (Line, "EFI_BASE_ADDRESS = 0x%llx", &BaseAddress) == 1 &&
+           fgets (Line, sizeof (Line), LayoutFile) != NULL && sscanf (Line, "EFI_FORCE_REBASE = %d", &ForceRebase) == 1 &&
+           fgets (Line, sizeof (Line), LayoutFile) != NULL && sscanf (Line, "EFI_FV_ATTRIBUTES = 0x%x", &FvAttributes) == 1 &&
+           fgets (Line, sizeof (Line), LayoutFile) != NULL && sscanf (Line, "EFI_FV_ARM = %u", &Arm) == 1 &&
+           fgets (Line, sizeof (Line), LayoutFile) != NULL && sscanf (Line, "EFI_FV_MAP_SHA256 = %64s", MapHash) == 1 &&
+           fgets (Line, sizeof (Line), LayoutFile) != NULL && sscanf (Line, "EFI_FV_FILE_NUMBER = %u", &EntryNumber) == 1);
+  if (Valid) {
+    Layout->BaseAddress  = BaseAddress;
+    Layout->ForceRebase  = (INT8) ForceRebase;
+    Layout->FvAttributes = FvAttributes;
+    Layout->Arm          = (BOOLEAN) (Arm != 0);
+    Layout->Entries      = (FV_LAYOUT_ENTRY *) calloc (EntryNumber + 1, sizeof (FV_LAYOUT_ENTRY));
+    Valid                = (BOOLEAN) (Layout->Entries != NULL && StringToDigest (MapHash, Layout->MapHash));
+  }
+  while (Valid && Layout->EntryNumber < EntryNumber) {
+    Valid = FALSE;
+    if (fgets (Line, sizeof (Line), LayoutFile) == NULL ||
+        sscanf (Line, "0x%x 0x%x %64s %64s %64s 0x%x 0x%x %n", &Field[0], &Field[1], Hash[0], Hash[1], Hash[2], &Field[2], &Field[3], &NameStart) != 7) {
+      break;
+    }
+    Entry = &Layout->Entries[Layout->EntryNumber];
+    if (!StringToDigest (Hash[0], Entry->InputHash) || !StringToDigest (Hash[1], Entry->OutputHash) ||
+        !StringToDigest (Hash[2], Entry->MapKey)) {
+      break;
     }
+    Name = Line + NameStart;
+    Name[strcspn (Name, "\r\n")] = '\0';
+    Entry->FileName = (CHAR8 *) malloc (strlen (Name) + 1);
+    if (Entry->FileName == NULL) {
+      break;
+    }
+    strcpy (Entry->FileName, Name);
+    Entry->Offset    = Field[0];
+    Entry->Size      = Field[1];
+    Entry->MapOffset = Field[2];
+    Entry->MapLength = Field[3];
+    Layout->EntryNumber++;
+    Valid = TRUE;
+  }
+  fclose (LayoutFile);
 
-    return EFI_SUCCESS;
+  if (!Valid) {
+    VerboseMsg ("FV layout %s is not valid, generate the whole FV", LayoutName);
+    FreeFvLayout (Layout);
+    return NULL;
   }
-  
+
   //
-  // Sec Core found, now find PE32 section
+  // The files must be rebased at the same addresses, and ARM images change
+  // the reset vector, which the previous layout does not record.
   //
-  Status = GetSectionByType (SecCoreFile, EFI_SECTION_PE32, 1, &Pe32Section);
-  if (Status == EFI_NOT_FOUND) {
-    Status = GetSectionByType (SecCoreFile, EFI_SECTION_TE, 1, &Pe32Section);
+  if (Layout->BaseAddress != FvInfo->BaseAddress || Layout->ForceRebase != FvInfo->ForceRebase ||
+      Layout->FvAttributes != FvInfo->FvAttributes || Layout->Arm) {
+    VerboseMsg ("FV layout %s does not match the FV options, generate the whole FV", LayoutName);
+    FreeFvLayout (Layout);
+    return NULL;
   }
 
-  if (EFI_ERROR (Status)) {
-    Error (NULL, 0, 3000, "Invalid", "could not find a PE32 section in the SEC core file.");
-    return EFI_ABORTED;
+  //
+  // The map file lines of the files are reused, the map file must be the
+  // one the layout was recorded with.
+  //
+  if (!ReadWholeFile (FvFileName, &Layout->FvImage, &Layout->FvImageSize) ||
+      !ReadWholeFile (FvMapName, &Layout->MapImage, &Layout->MapImageSize)) {
+    VerboseMsg ("The previous FV image or map file is missing, generate the whole FV");
+    FreeFvLayout (Layout);
+    return NULL;
   }
-
-  Status = GetPe32Info (
-            (VOID *) ((UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32)),
-            &EntryPoint,
-            &BaseOfCode,
-            &MachineType
-            );
-  if (EFI_ERROR (Status)) {
-    Error (NULL, 0, 3000, "Invalid", "could not get the PE32 entry point for the SEC core.");
-    return EFI_ABORTED;
+  Sha256Init (&Sha);
+  Sha256Update (&Sha, Layout->MapImage, Layout->MapImageSize);
+  Sha256Final (&Sha, Digest);
+  if (memcmp (Digest, Layout->MapHash, SHA256_DIGEST_SIZE) != 0) {
+    VerboseMsg ("The map file %s was changed since the FV layout was recorded, generate the whole FV", FvMapName);
+    FreeFvLayout (Layout);
+    return NULL;
   }
-  
-  if (MachineType != EFI_IMAGE_MACHINE_ARMT) {
-    //
-    // If SEC is not ARM we have nothing to do
-    //
-    return EFI_SUCCESS;
+
+  return Layout;
+}
+
+STATIC
+FV_LAYOUT_ENTRY *
+FindFvLayoutEntry (
+  IN FV_LAYOUT        *Layout,
+  IN FV_INFO          *FvInfo,
+  IN UINTN            Index,
+  IN UINT32           Offset
+  )
+/*++
+
+Routine Description:
+
+  This function finds the file of the previous layout that can be reused
+  for a file of the FV: the same FFS file, unchanged, at the same offset,
+  whose PE map files are unchanged as well.
+
+Arguments:
+
+  Layout          The previous layout.
+  FvInfo          The FV being generated.
+  Index           The file in the FvInfo file list.
+  Offset          Offset of the file in the new FV image.
+
+Returns:
+
+  The entry of the previous layout, or NULL if the file must be rebased.
+
+--*/
+{
+  FV_FILE_IMAGE       *Image;
+  FV_LAYOUT_ENTRY     *Entry;
+  UINTN               Number;
+
+  Image = &FvInfo->FvFileImages[Index];
+  if (Image->IsVtf) {
+    return NULL;
   }
-  
-  //
-  // Physical address is FV base + offset of PE32 + offset of the entry point
-  //
-  SecCorePhysicalAddress = FvInfo->BaseAddress;
-  SecCorePhysicalAddress += (UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32) - (UINTN) FvImage->FileImage;
-  SecCorePhysicalAddress += EntryPoint;
-  DebugMsg (NULL, 0, 9, "SecCore physical entry point address", "Address = 0x%llX", (unsigned long long) SecCorePhysicalAddress); 
 
   //
-  // Find the PEI Core. It may not exist if SEC loads DXE core directly
+  // Files usually keep their place in the file list, try it first.
   //
-  PeiCorePhysicalAddress = 0;
-  Status = GetFileByType (EFI_FV_FILETYPE_PEI_CORE, 1, &PeiCoreFile);
-  if (!EFI_ERROR (Status) && PeiCoreFile != NULL) {
-    //
-    // PEI Core found, now find PE32 or TE section
-    //
-    Status = GetSectionByType (PeiCoreFile, EFI_SECTION_PE32, 1, &Pe32Section);
-    if (Status == EFI_NOT_FOUND) {
-      Status = GetSectionByType (PeiCoreFile, EFI_SECTION_TE, 1, &Pe32Section);
-    }
-  
-    if (EFI_ERROR (Status)) {
-      Error (NULL, 0, 3000, "Invalid", "could not find either a PE32 or a TE section in PEI core file!");
-      return EFI_ABORTED;
-    }
-  
-    Status = GetPe32Info (
-              (VOID *) ((UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32)),
-              &EntryPoint,
-              &BaseOfCode,
-              &MachineType
-              );
-  
-    if (EFI_ERROR (Status)) {
-      Error (NULL, 0, 3000, "Invalid", "could not get the PE32 entry point for the PEI core!");
-      return EFI_ABORTED;
+  Entry = NULL;
+  if (Index < Layout->EntryNumber && strcmp (Layout->Entries[Index].FileName, FvInfo->FvFiles[Index]) == 0) {
+    Entry = &Layout->Entries[Index];
+  } else {
+    for (Number = 0; Number < Layout->EntryNumber; Number++) {
+      if (Layout->Entries[Number].Offset == Offset && strcmp (Layout->Entries[Number].FileName, FvInfo->FvFiles[Index]) == 0) {
+        Entry = &Layout->Entries[Number];
+        break;
+      }
     }
-    //
-    // Physical address is FV base + offset of PE32 + offset of the entry point
-    //
-    PeiCorePhysicalAddress = FvInfo->BaseAddress;
-    PeiCorePhysicalAddress += (UINTN) Pe32Section.Pe32Section + sizeof (EFI_SECTION_PE32) - (UINTN) FvImage->FileImage;
-    PeiCorePhysicalAddress += EntryPoint;
-    DebugMsg (NULL, 0, 9, "PeiCore physical entry point address", "Address = 0x%llX", (unsigned long long) PeiCorePhysicalAddress);
   }
-  
-  
-  // B SecEntryPoint - signed_immed_24 part +/-32MB offset
-  // on ARM, the PC is always 8 ahead, so we're not really jumping from the base address, but from base address + 8
-  ResetVector[0] = (INT32)(SecCorePhysicalAddress - FvInfo->BaseAddress - 8) >> 2;
-  
-  if (ResetVector[0] > 0x00FFFFFF) {
-    Error (NULL, 0, 3000, "Invalid", "SEC Entry point must be within 32MB of the start of the FV");
-    return EFI_ABORTED;    
+
+  if (Entry == NULL || Entry->Offset != Offset || Entry->Size != Image->Size ||
+      memcmp (Entry->InputHash, Image->InputHash, SHA256_DIGEST_SIZE) != 0 ||
+      memcmp (Entry->MapKey, Image->MapKey, SHA256_DIGEST_SIZE) != 0 ||
+      (UINTN) Entry->Offset + Entry->Size > Layout->FvImageSize ||
+      (UINTN) Entry->MapOffset + Entry->MapLength > Layout->MapImageSize) {
+    return NULL;
   }
-  
-  // Add opcode for an uncondional branch with no link. AKA B SecEntryPoint
-  ResetVector[0] |= 0xEB000000;
-  
-  
-  // Address of PEI Core, if we have one
-  ResetVector[1] = (UINT32)PeiCorePhysicalAddress;
-  
-  // SWI handler movs   pc,lr. Just in case a debugger uses SWI
-  ResetVector[2] = 0xE1B0F07E;
-  
-  // Place holder to support a common interrupt handler from ROM. 
-  // Currently not suppprted. For this to be used the reset vector would not be in this FV
-  // and the exception vectors would be hard coded in the ROM and just through this address 
-  // to find a common handler in the a module in the FV.
-  ResetVector[3] = 0;
+  return Entry;
+}
 
-  //
-  // Copy to the beginning of the FV 
-  //
-  memcpy ((UINT8 *) ((UINTN) FvImage->FileImage), ResetVector, sizeof (ResetVector));
+STATIC
+EFI_STATUS
+WriteFvLayout (
+  IN FV_INFO      *FvInfo,
+  IN UINT8        *FvImage,
+  IN CHAR8        *FvFileName,
+  IN CHAR8        *FvMapName
+  )
+/*++
 
-  DebugMsg (NULL, 0, 9, "Update Reset vector in FV Header", NULL);
+Routine Description:
+
+  This function records the layout of a generated FV for the next
+  incremental generation. It must be called once the FV image and the map
+  file are written.
+
+Arguments:
+
+  FvInfo          The generated FV.
+  FvImage         The FV image.
+  FvFileName      Name of the FV image.
+  FvMapName       Name of the FV map file.
+
+Returns:
 
+  EFI_SUCCESS     The layout was written.
+  EFI_ABORTED     The layout could not be written, it was removed.
+
+--*/
+{
+  FILE            *LayoutFile;
+  CHAR8           LayoutName[_MAX_PATH + sizeof (FV_LAYOUT_FILE_EXTENSION)];
+  UINT8           *MapImage;
+  UINTN           MapImageSize;
+  SHA256_CONTEXT  Sha;
+  UINT8           Digest[SHA256_DIGEST_SIZE];
+  CHAR8           Hash[3][2 * SHA256_DIGEST_SIZE + 1];
+  UINTN           Index;
+  FV_FILE_IMAGE   *Image;
+  UINT32          Offset;
+
+  sprintf (LayoutName, "%s%s", FvFileName, FV_LAYOUT_FILE_EXTENSION);
+  LayoutFile = NULL;
+  if (ReadWholeFile (FvMapName, &MapImage, &MapImageSize)) {
+    Sha256Init (&Sha);
+    Sha256Update (&Sha, MapImage, MapImageSize);
+    Sha256Final (&Sha, Digest);
+    free (MapImage);
+    LayoutFile = fopen (LayoutName, "w");
+  }
+  if (LayoutFile == NULL) {
+    remove (LayoutName);
+    Warning (NULL, 0, 0, "Error writing file", "the FV layout %s, the next generation of the FV is not incremental.", LayoutName);
+    return EFI_ABORTED;
+  }
+
+  fprintf (LayoutFile, "EFI_FV_LAYOUT_VERSION = %u\n", (unsigned) FV_LAYOUT_VERSION);
+  fprintf (LayoutFile, "EFI_BASE_ADDRESS = 0x%llx\n", (unsigned long long) FvInfo->BaseAddress);
+  fprintf (LayoutFile, "EFI_FORCE_REBASE = %d\n", (int) FvInfo->ForceRebase);
+  fprintf (LayoutFile, "EFI_FV_ATTRIBUTES = 0x%x\n", (unsigned) FvInfo->FvAttributes);
+  fprintf (LayoutFile, "EFI_FV_ARM = %u\n", (unsigned) FvInfo->Arm);
+  DigestToString (Digest, Hash[0]);
+  fprintf (LayoutFile, "EFI_FV_MAP_SHA256 = %s\n", Hash[0]);
+  fprintf (LayoutFile, "EFI_FV_FILE_NUMBER = %u\n", (unsigned) FvInfo->FvFileNumber);
+  for (Index = 0; Index < FvInfo->FvFileNumber; Index++) {
+    Image     = &FvInfo->FvFileImages[Index];
+    Offset = FV_LAYOUT_NO_OFFSET;
+    memset (Digest, 0, sizeof (Digest));
+    if (Image->FvFile != NULL) {
+      Offset = (UINT32) ((UINT8 *) Image->FvFile - FvImage);
+      Sha256Init (&Sha);
+      Sha256Update (&Sha, Image->FvFile, Image->Size);
+      Sha256Final (&Sha, Digest);
+    }
+    DigestToString (Image->InputHash, Hash[0]);
+    DigestToString (Digest, Hash[1]);
+    DigestToString (Image->MapKey, Hash[2]);
+    fprintf (
+      LayoutFile,
+      "0x%08x 0x%08x %s %s %s 0x%08x 0x%08x %s\n",
+      (unsigned) Offset,
+      (unsigned) Image->Size,
+      Hash[0],
+      Hash[1],
+      Hash[2],
+      (unsigned) Image->MapOffset,
+      (unsigned) Image->MapLength,
+      FvInfo->FvFiles[Index]
+      );
+  }
+
+  if (fclose (LayoutFile) != 0) {
+    remove (LayoutName);
+    Warning (NULL, 0, 0, "Error writing file", "the FV layout %s, the next generation of the FV is not incremental.", LayoutName);
+    return EFI_ABORTED;
+  }
   return EFI_SUCCESS;
 }
 
+STATIC
 EFI_STATUS
-GetPe32Info (
-  IN UINT8                  *Pe32,
-  OUT UINT32                *EntryPoint,
-  OUT UINT32                *BaseOfCode,
-  OUT UINT16                *MachineType
+PatchFvImageFile (
+  IN CHAR8        *FvFileName,
+  IN UINT8        *FvImage,
+  IN UINT8        *OldFvImage,
+  IN UINTN        FvImageSize
   )
 /*++
 
 Routine Description:
 
-  Retrieves the PE32 entry point offset and machine type from PE image or TeImage.  
-  See EfiImage.h for machine types.  The entry point offset is from the beginning 
-  of the PE32 buffer passed in.
+  This function writes a FV image over the previous image of the same
+  size, only the blocks that changed are written.
 
 Arguments:
 
-  Pe32          Beginning of the PE32.
-  EntryPoint    Offset from the beginning of the PE32 to the image entry point.
-  BaseOfCode    Base address of code.
-  MachineType   Magic number for the machine type.
+  FvFileName      Name of the FV image.
+  FvImage         The new FV image.
+  OldFvImage      The content of the file.
+  FvImageSize     Size of both images.
 
 Returns:
 
-  EFI_SUCCESS             Function completed successfully.
-  EFI_ABORTED             Error encountered.
-  EFI_INVALID_PARAMETER   A required parameter was NULL.
-  EFI_UNSUPPORTED         The operation is unsupported.
+  EFI_SUCCESS     The file was updated.
+  EFI_ABORTED     The file could not be updated.
 
 --*/
 {
-  EFI_IMAGE_DOS_HEADER             *DosHeader;
-  EFI_IMAGE_OPTIONAL_HEADER_UNION  *ImgHdr;
-  EFI_TE_IMAGE_HEADER              *TeHeader;
+  FILE    *FvFile;
+  UINTN   Start;
+  UINTN   End;
+  UINTN   Next;
+  UINTN   Written;
 
-  //
-  // Verify input parameters
-  //
-  if (Pe32 == NULL) {
-    return EFI_INVALID_PARAMETER;
+  FvFile = fopen (FvFileName, "r+b");
+  if (FvFile == NULL) {
+    Error (NULL, 0, 0001, "Error opening file", FvFileName);
+    return EFI_ABORTED;
   }
 
-  //
-  // First check whether it is one TE Image.
-  //
-  TeHeader = (EFI_TE_IMAGE_HEADER *) Pe32;
-  if (TeHeader->Signature == EFI_TE_IMAGE_HEADER_SIGNATURE) {
-    //
-    // By TeImage Header to get output
-    //
-    *EntryPoint   = TeHeader->AddressOfEntryPoint + sizeof (EFI_TE_IMAGE_HEADER) - TeHeader->StrippedSize;
-    *BaseOfCode   = TeHeader->BaseOfCode + sizeof (EFI_TE_IMAGE_HEADER) - TeHeader->StrippedSize;
-    *MachineType  = TeHeader->Machine;
-  } else {
-  
-    //
-    // Then check whether 
-    // First is the DOS header
-    //
-    DosHeader = (EFI_IMAGE_DOS_HEADER *) Pe32;
-  
-    //
-    // Verify DOS header is expected
-    //
-    if (DosHeader->e_magic != EFI_IMAGE_DOS_SIGNATURE) {
-      Error (NULL, 0, 3000, "Invalid", "Unknown magic number in the DOS header, 0x%04X.", DosHeader->e_magic);
-      return EFI_UNSUPPORTED;
+  Written = 0;
+  for (Start = 0; Start < FvImageSize; Start = End) {
+    End = Start + FV_PATCH_BLOCK_SIZE < FvImageSize ? Start + FV_PATCH_BLOCK_SIZE : FvImageSize;
+    if (memcmp (FvImage + Start, OldFvImage + Start, End - Start) == 0) {
+      continue;
     }
     //
-    // Immediately following is the NT header.
-    //
-    ImgHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *) ((UINTN) Pe32 + DosHeader->e_lfanew);
-  
-    //
-    // Verify NT header is expected
+    // Write the changed blocks that follow each other at once
     //
-    if (ImgHdr->Pe32.Signature != EFI_IMAGE_NT_SIGNATURE) {
-      Error (NULL, 0, 3000, "Invalid", "Unrecognized image signature 0x%08X.", (unsigned) ImgHdr->Pe32.Signature);
-      return EFI_UNSUPPORTED;
+    while (End < FvImageSize) {
+      Next = End + FV_PATCH_BLOCK_SIZE < FvImageSize ? End + FV_PATCH_BLOCK_SIZE : FvImageSize;
+      if (memcmp (FvImage + End, OldFvImage + End, Next - End) == 0) {
+        break;
+      }
+      End = Next;
     }
-    //
-    // Get output
-    //
-    *EntryPoint   = ImgHdr->Pe32.OptionalHeader.AddressOfEntryPoint;
-    *BaseOfCode   = ImgHdr->Pe32.OptionalHeader.BaseOfCode;
-    *MachineType  = ImgHdr->Pe32.FileHeader.Machine;
+    if (fseek (FvFile, (long) Start, SEEK_SET) != 0 || fwrite (FvImage + Start, 1, End - Start, FvFile) != End - Start) {
+      fclose (FvFile);
+      Error (NULL, 0, 0002, "Error writing file", FvFileName);
+      return EFI_ABORTED;
+    }
+    Written += End - Start;
   }
+  ProfileAddBytes (0, Written);
 
-  //
-  // Verify machine type is supported
-  //
-  if (*MachineType != EFI_IMAGE_MACHINE_IA32 && *MachineType != EFI_IMAGE_MACHINE_IA64 && *MachineType != EFI_IMAGE_MACHINE_X64 && *MachineType != EFI_IMAGE_MACHINE_EBC && 
-      *MachineType != EFI_IMAGE_MACHINE_ARMT) {
-    Error (NULL, 0, 3000, "Invalid", "Unrecognized machine type in the PE32 file.");
-    return EFI_UNSUPPORTED;
+  if (fclose (FvFile) != 0) {
+    Error (NULL, 0, 0002, "Error writing file", FvFileName);
+    return EFI_ABORTED;
   }
-
+  VerboseMsg ("%u of %u bytes of the FV image were updated", (unsigned) Written, (unsigned) FvImageSize);
   return EFI_SUCCESS;
 }
 
 EFI_STATUS
 GenerateFvImage (
+  IN OUT FV_INFO          *FvInfo,
   IN CHAR8                *InfFileImage,
   IN UINTN                InfFileSize,
   IN CHAR8                *FvFileName,
@@ -1968,10 +3874,13 @@ GenerateFvImage (
 
 Routine Description:
 
-  This is the main function which will be called from application.
+  This is the main function which will be called from application. The
+  state of the generation is kept in FvInfo, so several FVs can be
+  generated at the same time.
 
 Arguments:
 
+  FvInfo         The options of the FV, receives the state of its generation.
   InfFileImage   Buffer containing the INF file contents.
   InfFileSize    Size of the contents of the InfFileImage buffer.
   FvFileName     Requested name for the FV file.
@@ -2003,11 +3912,24 @@ Returns:
   UINTN                           FileSize;
   CHAR8                           FvReportName[_MAX_PATH];
   FILE                            *FvReportFile;
+  UINTN                           ProfileRecord;
+  UINTN                           FileRecord;
+  UINTN                           WriteRecord;
 
   FvBufferHeader = NULL;
+  FvImage        = NULL;
   FvFile         = NULL;
   FvMapFile      = NULL;
   FvReportFile   = NULL;
+  WriteRecord    = PROFILE_NO_RECORD;
+
+  //
+  // The largest file alignment, the ARM flag and the child FV base
+  // addresses are collected per FV.
+  //
+  FvInfo->MaxFfsAlignment          = 0;
+  FvInfo->Arm                      = FALSE;
+  FvInfo->ChildFvBaseAddressNumber = 0;
 
   if (InfFileImage != NULL) {
     //
@@ -2020,7 +3942,10 @@ Returns:
     //
     // Parse the FV inf file for header information
     //
-    Status = ParseFvInf (&InfMemoryFile, &mFvDataInfo);
+    ProfileRecord = ProfileBegin ("ParseFvInf", NULL);
+    ProfileAddBytes (InfFileSize, 0);
+    Status = ParseFvInf (&InfMemoryFile, FvInfo);
+    ProfileEnd (ProfileRecord);
     if (EFI_ERROR (Status)) {
       Error (NULL, 0, 0003, "Error parsing file", "the input FV INF file.");
       return Status;
@@ -2030,8 +3955,8 @@ Returns:
   //
   // Update the file name return values
   //
-  if (FvFileName == NULL && mFvDataInfo.FvName[0] != '\0') {
-    FvFileName = mFvDataInfo.FvName;
+  if (FvFileName == NULL && FvInfo->FvName[0] != '\0') {
+    FvFileName = FvInfo->FvName;
   }
 
   if (FvFileName == NULL) {
@@ -2039,7 +3964,7 @@ Returns:
     return EFI_ABORTED;
   }
   
-  if (mFvDataInfo.FvBlocks[0].Length == 0) {
+  if (FvInfo->FvBlocks == NULL || FvInfo->FvBlocks[0].Length == 0) {
     Error (NULL, 0, 1001, "Missing required argument", "Block Size");
     return EFI_ABORTED;
   }
@@ -2047,19 +3972,19 @@ Returns:
   //
   // Debug message Fv File System Guid
   //
-  if (mFvDataInfo.FvFileSystemGuidSet) {
+  if (FvInfo->FvFileSystemGuidSet) {
     DebugMsg (NULL, 0, 9, "FV File System Guid", "%08X-%04X-%04X-%02X%02X-%02X%02X%02X%02X%02X%02X", 
-                  (unsigned) mFvDataInfo.FvFileSystemGuid.Data1,
-                  mFvDataInfo.FvFileSystemGuid.Data2,
-                  mFvDataInfo.FvFileSystemGuid.Data3,
-                  mFvDataInfo.FvFileSystemGuid.Data4[0],
-                  mFvDataInfo.FvFileSystemGuid.Data4[1],
-                  mFvDataInfo.FvFileSystemGuid.Data4[2],
-                  mFvDataInfo.FvFileSystemGuid.Data4[3],
-                  mFvDataInfo.FvFileSystemGuid.Data4[4],
-                  mFvDataInfo.FvFileSystemGuid.Data4[5],
-                  mFvDataInfo.FvFileSystemGuid.Data4[6],
-                  mFvDataInfo.FvFileSystemGuid.Data4[7]);
+                  (unsigned) FvInfo->FvFileSystemGuid.Data1,
+                  FvInfo->FvFileSystemGuid.Data2,
+                  FvInfo->FvFileSystemGuid.Data3,
+                  FvInfo->FvFileSystemGuid.Data4[0],
+                  FvInfo->FvFileSystemGuid.Data4[1],
+                  FvInfo->FvFileSystemGuid.Data4[2],
+                  FvInfo->FvFileSystemGuid.Data4[3],
+                  FvInfo->FvFileSystemGuid.Data4[4],
+                  FvInfo->FvFileSystemGuid.Data4[5],
+                  FvInfo->FvFileSystemGuid.Data4[6],
+                  FvInfo->FvFileSystemGuid.Data4[7]);
   }
 
   //
@@ -2067,11 +3992,11 @@ Returns:
   //
   FvExtHeader = NULL;
   FvExtHeaderFile = NULL;
-  if (mFvDataInfo.FvExtHeaderFile[0] != 0) {
+  if (FvInfo->FvExtHeaderFile[0] != 0) {
     //
     // Open the FV Extension Header file
     //
-    FvExtHeaderFile = fopen (mFvDataInfo.FvExtHeaderFile, "rb");
+    FvExtHeaderFile = fopen (FvInfo->FvExtHeaderFile, "rb");
 
     //
     // Get the file size
@@ -2096,12 +4021,12 @@ Returns:
     //
     // See if there is an override for the FV Name GUID
     //
-    if (mFvDataInfo.FvNameGuidSet) {
-      memcpy (&FvExtHeader->FvName, &mFvDataInfo.FvNameGuid, sizeof (EFI_GUID));
+    if (FvInfo->FvNameGuidSet) {
+      memcpy (&FvExtHeader->FvName, &FvInfo->FvNameGuid, sizeof (EFI_GUID));
     }
-    memcpy (&mFvDataInfo.FvNameGuid, &FvExtHeader->FvName, sizeof (EFI_GUID));
-    mFvDataInfo.FvNameGuidSet = TRUE;
-  } else if (mFvDataInfo.FvNameGuidSet) {
+    memcpy (&FvInfo->FvNameGuid, &FvExtHeader->FvName, sizeof (EFI_GUID));
+    FvInfo->FvNameGuidSet = TRUE;
+  } else if (FvInfo->FvNameGuidSet) {
     //
     // Allocate a buffer for the FV Extension Header
     //
@@ -2109,30 +4034,30 @@ Returns:
     if (FvExtHeader == NULL) {
       return EFI_OUT_OF_RESOURCES;
     }
-    memcpy (&FvExtHeader->FvName, &mFvDataInfo.FvNameGuid, sizeof (EFI_GUID));
+    memcpy (&FvExtHeader->FvName, &FvInfo->FvNameGuid, sizeof (EFI_GUID));
     FvExtHeader->ExtHeaderSize = sizeof (EFI_FIRMWARE_VOLUME_EXT_HEADER);
   }
 
   //
   // Debug message Fv Name Guid
   //
-  if (mFvDataInfo.FvNameGuidSet) {
+  if (FvInfo->FvNameGuidSet) {
       DebugMsg (NULL, 0, 9, "FV Name Guid", "%08X-%04X-%04X-%02X%02X-%02X%02X%02X%02X%02X%02X", 
-                  (unsigned) mFvDataInfo.FvNameGuid.Data1,
-                  mFvDataInfo.FvNameGuid.Data2,
-                  mFvDataInfo.FvNameGuid.Data3,
-                  mFvDataInfo.FvNameGuid.Data4[0],
-                  mFvDataInfo.FvNameGuid.Data4[1],
-                  mFvDataInfo.FvNameGuid.Data4[2],
-                  mFvDataInfo.FvNameGuid.Data4[3],
-                  mFvDataInfo.FvNameGuid.Data4[4],
-                  mFvDataInfo.FvNameGuid.Data4[5],
-                  mFvDataInfo.FvNameGuid.Data4[6],
-                  mFvDataInfo.FvNameGuid.Data4[7]);
+                  (unsigned) FvInfo->FvNameGuid.Data1,
+                  FvInfo->FvNameGuid.Data2,
+                  FvInfo->FvNameGuid.Data3,
+                  FvInfo->FvNameGuid.Data4[0],
+                  FvInfo->FvNameGuid.Data4[1],
+                  FvInfo->FvNameGuid.Data4[2],
+                  FvInfo->FvNameGuid.Data4[3],
+                  FvInfo->FvNameGuid.Data4[4],
+                  FvInfo->FvNameGuid.Data4[5],
+                  FvInfo->FvNameGuid.Data4[6],
+                  FvInfo->FvNameGuid.Data4[7]);
   }
 
-  if (CompareGuid (&mFvDataInfo.FvFileSystemGuid, &mEfiFirmwareFileSystem2Guid) == 0) {
-    mFvDataInfo.IsPiFvImage = TRUE;
+  if (CompareGuid (&FvInfo->FvFileSystemGuid, &mEfiFirmwareFileSystem2Guid) == 0) {
+    FvInfo->IsPiFvImage = TRUE;
   }
 
   //
@@ -2153,39 +4078,57 @@ Returns:
   strcat (FvReportName, ".txt");
 
   //
-  // Calculate the FV size and Update Fv Size based on the actual FFS files.
-  // And Update mFvDataInfo data.
+  // Read every FFS file once, reorder them if asked to, then calculate the
+  // FV size and Update Fv Size based on the actual FFS files. And Update
+  // FvInfo data.
   //
-  Status = CalculateFvSize (&mFvDataInfo);
+  ProfileRecord = ProfileBegin ("LoadFvFiles", NULL);
+  Status = LoadFvFiles (FvInfo);
+  ProfileEnd (ProfileRecord);
+  if (EFI_ERROR (Status)) {
+    goto Finish;
+  }
+  if (FvInfo->PackFiles) {
+    ProfileRecord = ProfileBegin ("PackFvFiles", NULL);
+    Status = PackFvFiles (FvInfo);
+    ProfileEnd (ProfileRecord);
+    if (EFI_ERROR (Status)) {
+      goto Finish;
+    }
+  }
+  ProfileRecord = ProfileBegin ("CalculateFvSize", NULL);
+  Status = CalculateFvSize (FvInfo);
+  ProfileEnd (ProfileRecord);
   if (EFI_ERROR (Status)) {
-    return Status;    
+    goto Finish;
   }
-  VerboseMsg ("the generated FV image size is %u bytes", (unsigned) mFvDataInfo.Size);
+  VerboseMsg ("the generated FV image size is %u bytes", (unsigned) FvInfo->Size);
   
   //
   // support fv image and empty fv image
   //
-  FvImageSize = mFvDataInfo.Size;
+  FvImageSize = FvInfo->Size;
 
   //
   // Allocate the FV, assure FvImage Header 8 byte alignment
   //
   FvBufferHeader = malloc (FvImageSize + sizeof (UINT64));
   if (FvBufferHeader == NULL) {
-    return EFI_OUT_OF_RESOURCES;
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Finish;
   }
   FvImage = (UINT8 *) (((UINTN) FvBufferHeader + 7) & ~7);
 
   //
   // Initialize the FV to the erase polarity
   //
-  if (mFvDataInfo.FvAttributes == 0) {
+  if (FvInfo->FvAttributes == 0) {
     //
     // Set Default Fv Attribute 
     //
-    mFvDataInfo.FvAttributes = FV_DEFAULT_ATTRIBUTE;
+    FvInfo->FvAttributes = FV_DEFAULT_ATTRIBUTE;
   }
-  if (mFvDataInfo.FvAttributes & EFI_FVB2_ERASE_POLARITY) {
+  if (FvInfo->FvAttributes & EFI_FVB2_ERASE_POLARITY) {
     memset (FvImage, -1, FvImageSize);
   } else {
     memset (FvImage, 0, FvImageSize);
@@ -2204,11 +4147,11 @@ Returns:
   //
   // Copy the Fv file system GUID
   //
-  memcpy (&FvHeader->FileSystemGuid, &mFvDataInfo.FvFileSystemGuid, sizeof (EFI_GUID));
+  memcpy (&FvHeader->FileSystemGuid, &FvInfo->FvFileSystemGuid, sizeof (EFI_GUID));
 
   FvHeader->FvLength        = FvImageSize;
   FvHeader->Signature       = EFI_FVH_SIGNATURE;
-  FvHeader->Attributes      = mFvDataInfo.FvAttributes;
+  FvHeader->Attributes      = FvInfo->FvAttributes;
   FvHeader->Revision        = EFI_FVH_REVISION;
   FvHeader->ExtHeaderOffset = 0;
   FvHeader->Reserved[0]     = 0;
@@ -2216,9 +4159,9 @@ Returns:
   //
   // Copy firmware block map
   //
-  for (Index = 0; mFvDataInfo.FvBlocks[Index].Length != 0; Index++) {
-    FvHeader->BlockMap[Index].NumBlocks   = mFvDataInfo.FvBlocks[Index].NumBlocks;
-    FvHeader->BlockMap[Index].Length      = mFvDataInfo.FvBlocks[Index].Length;
+  for (Index = 0; FvInfo->FvBlocks[Index].Length != 0; Index++) {
+    FvHeader->BlockMap[Index].NumBlocks   = FvInfo->FvBlocks[Index].NumBlocks;
+    FvHeader->BlockMap[Index].Length      = FvInfo->FvBlocks[Index].Length;
   }
 
   //
@@ -2237,7 +4180,7 @@ Returns:
   //
   // If there is no FFS file, generate one empty FV
   //
-  if (mFvDataInfo.FvFiles[0][0] == 0 && !mFvDataInfo.FvNameGuidSet) {
+  if (FvInfo->FvFileNumber == 0 && !FvInfo->FvNameGuidSet) {
     goto WriteFile;
   }
 
@@ -2258,13 +4201,22 @@ Returns:
   //
   VtfFileImage = (EFI_FFS_FILE_HEADER *) FvImageMemoryFile.Eof;
 
+  //
+  // In incremental mode, read the previous layout before the map file is
+  // overwritten.
+  //
+  if (FvInfo->Incremental) {
+    FvInfo->Layout = ReadFvLayout (FvInfo, FvFileName, FvMapName);
+  }
+
   //
   // Open FvMap file
   //
   FvMapFile = fopen (FvMapName, "w");
   if (FvMapFile == NULL) {
     Error (NULL, 0, 0001, "Error opening file", FvMapName);
-    return EFI_ABORTED;
+    Status = EFI_ABORTED;
+    goto Finish;
   }
   
   //
@@ -2273,29 +4225,33 @@ Returns:
   FvReportFile = fopen(FvReportName, "w");
   if (FvReportFile == NULL) {
     Error (NULL, 0, 0001, "Error opening file", FvReportName);
-    return EFI_ABORTED;
+    Status = EFI_ABORTED;
+    goto Finish;
   }
   //
   // record FV size information into FvMap file.
   //
-  if (mFvTotalSize != 0) {
+  if (FvInfo->TotalSize != 0) {
     fprintf (FvMapFile, EFI_FV_TOTAL_SIZE_STRING);
-    fprintf (FvMapFile, " = 0x%x\n", (unsigned) mFvTotalSize);
+    fprintf (FvMapFile, " = 0x%x\n", (unsigned) FvInfo->TotalSize);
   }
-  if (mFvTakenSize != 0) {
+  if (FvInfo->TakenSize != 0) {
     fprintf (FvMapFile, EFI_FV_TAKEN_SIZE_STRING);
-    fprintf (FvMapFile, " = 0x%x\n", (unsigned) mFvTakenSize);
+    fprintf (FvMapFile, " = 0x%x\n", (unsigned) FvInfo->TakenSize);
   }
-  if (mFvTotalSize != 0 && mFvTakenSize != 0) {
+  if (FvInfo->TotalSize != 0 && FvInfo->TakenSize != 0) {
     fprintf (FvMapFile, EFI_FV_SPACE_SIZE_STRING);
-    fprintf (FvMapFile, " = 0x%x\n\n", (unsigned) (mFvTotalSize - mFvTakenSize));
+    fprintf (FvMapFile, " = 0x%x\n\n", (unsigned) (FvInfo->TotalSize - FvInfo->TakenSize));
   }
 
   //
   // record FV size information to FvReportFile.
   //
-  fprintf (FvReportFile, "%s = 0x%x\n", EFI_FV_TOTAL_SIZE_STRING, (unsigned) mFvTotalSize);
-  fprintf (FvReportFile, "%s = 0x%x\n", EFI_FV_TAKEN_SIZE_STRING, (unsigned) mFvTakenSize);
+  fprintf (FvReportFile, "%s = 0x%x\n", EFI_FV_TOTAL_SIZE_STRING, (unsigned) FvInfo->TotalSize);
+  fprintf (FvReportFile, "%s = 0x%x\n", EFI_FV_TAKEN_SIZE_STRING, (unsigned) FvInfo->TakenSize);
+  if (FvInfo->PackFiles) {
+    fprintf (FvReportFile, "%s = 0x%x\n", EFI_FV_PAD_SAVED_SIZE_STRING, (unsigned) FvInfo->PadSizeSaved);
+  }
 
   //
   // Add PI FV extension header
@@ -2316,19 +4272,42 @@ Returns:
   //
   // Add files to FV
   //
-  for (Index = 0; mFvDataInfo.FvFiles[Index][0] != 0; Index++) {
+  FvInfo->FileGuids = (EFI_GUID *) malloc (FvInfo->FvFileNumber * sizeof (EFI_GUID));
+  if (FvInfo->FileGuids == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Finish;
+  }
+
+  ProfileRecord = ProfileBegin ("AddFile", NULL);
+  for (Index = 0; Index < FvInfo->FvFileNumber; Index++) {
     //
     // Add the file
     //
-    Status = AddFile (&FvImageMemoryFile, &mFvDataInfo, Index, &VtfFileImage, FvMapFile, FvReportFile);
+    FileRecord = ProfileBegin ("AddFile", FvInfo->FvFiles[Index]);
+    Status = AddFile (&FvImageMemoryFile, FvInfo, Index, &VtfFileImage, FvReportFile);
+    ProfileEnd (FileRecord);
 
     //
     // Exit if error detected while adding the file
     //
     if (EFI_ERROR (Status)) {
+      ProfileEnd (ProfileRecord);
       goto Finish;
     }
   }
+  ProfileEnd (ProfileRecord);
+
+  //
+  // Every file has its final offset, rebase the PE32 and TE images for XIP
+  // and for the debug genfvmap tool.
+  //
+  ProfileRecord = ProfileBegin ("FfsRebase", NULL);
+  Status = RebaseFvFiles (&FvImageMemoryFile, FvInfo, FvMapFile);
+  ProfileEnd (ProfileRecord);
+  if (EFI_ERROR (Status)) {
+    goto Finish;
+  }
 
   //
   // If there is a VTF file, some special actions need to occur.
@@ -2343,7 +4322,7 @@ Returns:
       Error (NULL, 0, 4002, "Resource", "FV space is full, cannot add pad file between the last file and the VTF file.");
       goto Finish;
     }
-    if (!mArm) {
+    if (!FvInfo->Arm) {
       //
       // Update reset vector (SALE_ENTRY for IPF)
       // Now for IA32 and IA64 platform, the fv which has bsf file must have the 
@@ -2351,8 +4330,10 @@ Returns:
       // reset vector. If the PEI Core is found, the VTF file will probably get  
       // corrupted by updating the entry point.                                  
       //
-      if ((mFvDataInfo.BaseAddress + mFvDataInfo.Size) == FV_IMAGES_TOP_ADDRESS) {       
-        Status = UpdateResetVector (&FvImageMemoryFile, &mFvDataInfo, VtfFileImage);
+      if ((FvInfo->BaseAddress + FvInfo->Size) == FV_IMAGES_TOP_ADDRESS) {       
+        ProfileRecord = ProfileBegin ("UpdateResetVector", NULL);
+        Status = UpdateResetVector (&FvImageMemoryFile, FvInfo, VtfFileImage);
+        ProfileEnd (ProfileRecord);
         if (EFI_ERROR(Status)) {                                               
           Error (NULL, 0, 3000, "Invalid", "Could not update the reset vector.");
           goto Finish;                                              
@@ -2362,8 +4343,10 @@ Returns:
     }
   } 
 
-  if (mArm) {
-    Status = UpdateArmResetVectorIfNeeded (&FvImageMemoryFile, &mFvDataInfo);
+  if (FvInfo->Arm) {
+    ProfileRecord = ProfileBegin ("UpdateResetVector", NULL);
+    Status = UpdateArmResetVectorIfNeeded (&FvImageMemoryFile, FvInfo);
+    ProfileEnd (ProfileRecord);
     if (EFI_ERROR (Status)) {                                               
       Error (NULL, 0, 3000, "Invalid", "Could not update the reset vector.");
       goto Finish;                                              
@@ -2379,8 +4362,8 @@ Returns:
   //
   // Update FV Alignment attribute to the largest alignment of all the FFS files in the FV
   //
-  if ((((FvHeader->Attributes & EFI_FVB2_ALIGNMENT) >> 16)) < MaxFfsAlignment) {
-    FvHeader->Attributes = ((MaxFfsAlignment << 16) | (FvHeader->Attributes & 0xFFFF));
+  if ((((FvHeader->Attributes & EFI_FVB2_ALIGNMENT) >> 16)) < FvInfo->MaxFfsAlignment) {
+    FvHeader->Attributes = ((FvInfo->MaxFfsAlignment << 16) | (FvHeader->Attributes & 0xFFFF));
     //
     // Update Checksum for FvHeader
     //
@@ -2392,6 +4375,12 @@ WriteFile:
   //
   // Write fv file
   //
+  WriteRecord = ProfileBegin ("WriteFvImage", NULL);
+  RemoveFvFileCacheEntry (FvFileName);
+  if (FvInfo->Layout != NULL && FvInfo->Layout->FvImageSize == FvImageSize) {
+    Status = PatchFvImageFile (FvFileName, FvImage, FvInfo->Layout->FvImage, FvImageSize);
+    goto Finish;
+  }
   FvFile = fopen (FvFileName, "wb");
   if (FvFile == NULL) {
     Error (NULL, 0, 0001, "Error opening file", FvFileName);
@@ -2404,10 +4393,12 @@ WriteFile:
     Status = EFI_ABORTED;
     goto Finish;
   }
+  ProfileAddBytes (0, FvImageSize);
 
 Finish:
-  if (FvBufferHeader != NULL) {
-    free (FvBufferHeader);
+  if (FvInfo->FileGuids != NULL) {
+    free (FvInfo->FileGuids);
+    FvInfo->FileGuids = NULL;
   }
 
   if (FvExtHeader != NULL) {
@@ -2418,16 +4409,36 @@ Finish:
     fflush (FvFile);
     fclose (FvFile);
   }
+  ProfileEnd (WriteRecord);
   
   if (FvMapFile != NULL) {
     fflush (FvMapFile);
     fclose (FvMapFile);
+    //
+    // Record the layout of the new FV for the next incremental generation.
+    //
+    if (Status == EFI_SUCCESS && FvInfo->Incremental) {
+      WriteFvLayout (FvInfo, FvImage, FvFileName, FvMapName);
+    }
   }
 
   if (FvReportFile != NULL) {
     fflush (FvReportFile);
     fclose (FvReportFile);
   }
+
+  if (FvBufferHeader != NULL) {
+    free (FvBufferHeader);
+  }
+
+  FreeFvLayout (FvInfo->Layout);
+  FvInfo->Layout = NULL;
+
+  //
+  // Let the FVs generated next, or at the same time, rebase with the
+  // relocation indexes of the files of this FV.
+  //
+  ReleaseFvRelocCaches (FvInfo);
   return Status;
 }
 
@@ -2501,50 +4512,31 @@ Returns:
   }
 }
 
+STATIC
 EFI_STATUS
-CalculateFvSize (
-  FV_INFO *FvInfoPtr
+GetFvFirstFileOffset (
+  IN  FV_INFO     *FvInfoPtr,
+  OUT UINTN       *Offset
   )
 /*++
 Routine Description:
-  Calculate the FV size and Update Fv Size based on the actual FFS files.
-  And Update FvInfo data.
+  Calculate the offset of the first FFS file of the FV, after the FV header,
+  its block map and the FV extension header.
 
 Arguments:
   FvInfoPtr     - The pointer to FV_INFO structure.
+  Offset        - Receives the offset of the first file.
 
 Returns:
-  EFI_ABORTED   - Ffs Image Error
-  EFI_SUCCESS   - Successfully update FvSize
+  EFI_ABORTED   - The FV extension header file can't be opened
+  EFI_SUCCESS   - The offset is calculated
 --*/
 {
   UINTN               CurrentOffset;
   UINTN               Index;
   FILE                *fpin;
-  UINTN               FfsFileSize;
   UINTN               FvExtendHeaderSize;
-  UINT32              FfsAlignment;
-  EFI_FFS_FILE_HEADER FfsHeader;
-  BOOLEAN             VtfFileFlag;
-  UINTN               VtfFileSize;
-  
-  FvExtendHeaderSize = 0;
-  VtfFileSize = 0;
-  VtfFileFlag = FALSE;
-  fpin  = NULL;
-  Index = 0;
 
-  //
-  // Compute size for easy access later
-  //
-  FvInfoPtr->Size = 0;
-  for (Index = 0; FvInfoPtr->FvBlocks[Index].NumBlocks > 0 && FvInfoPtr->FvBlocks[Index].Length > 0; Index++) {
-    FvInfoPtr->Size += FvInfoPtr->FvBlocks[Index].NumBlocks * FvInfoPtr->FvBlocks[Index].Length;
-  }
-  
-  //
-  // Caculate the required sizes for all FFS files.
-  //
   CurrentOffset = sizeof (EFI_FIRMWARE_VOLUME_HEADER);
   
   for (Index = 1;; Index ++) {
@@ -2557,52 +4549,120 @@ Returns:
   //
   // Calculate PI extension header
   //
-  if (mFvDataInfo.FvExtHeaderFile[0] != '\0') {
-    fpin = fopen (mFvDataInfo.FvExtHeaderFile, "rb");
+  if (FvInfoPtr->FvExtHeaderFile[0] != '\0') {
+    fpin = fopen (FvInfoPtr->FvExtHeaderFile, "rb");
     if (fpin == NULL) {
-      Error (NULL, 0, 0001, "Error opening file", mFvDataInfo.FvExtHeaderFile);
+      Error (NULL, 0, 0001, "Error opening file", FvInfoPtr->FvExtHeaderFile);
       return EFI_ABORTED;
     }
     FvExtendHeaderSize = _filelength (fileno (fpin));
     fclose (fpin);
     CurrentOffset += sizeof (EFI_FFS_FILE_HEADER) + FvExtendHeaderSize;
     CurrentOffset = (CurrentOffset + 7) & (~7);
-  } else if (mFvDataInfo.FvNameGuidSet) {
+  } else if (FvInfoPtr->FvNameGuidSet) {
     CurrentOffset += sizeof (EFI_FFS_FILE_HEADER) + sizeof (EFI_FIRMWARE_VOLUME_EXT_HEADER);
     CurrentOffset = (CurrentOffset + 7) & (~7);
   }
 
+  *Offset = CurrentOffset;
+  return EFI_SUCCESS;
+}
+
+STATIC
+UINTN
+GetFfsFileOffset (
+  IN UINTN        CurrentOffset,
+  IN UINT32       Alignment
+  )
+/*++
+Routine Description:
+  Calculate where a FFS file is placed when the free space of the FV starts
+  at CurrentOffset, this is after the pad file AddFile inserts for its
+  alignment, if any.
+
+Arguments:
+  CurrentOffset - Start of the free space, QWord aligned.
+  Alignment     - Alignment of the file, as returned by ReadFfsAlignment.
+
+Returns:
+  The offset of the FFS file header.
+--*/
+{
+  UINTN               FfsAlignment;
+
+  FfsAlignment = (UINTN) 1 << Alignment;
+  if (((CurrentOffset + sizeof (EFI_FFS_FILE_HEADER)) % FfsAlignment) != 0) {
+    CurrentOffset = (CurrentOffset + sizeof (EFI_FFS_FILE_HEADER) * 2 + FfsAlignment - 1) & ~(FfsAlignment - 1);
+    CurrentOffset -= sizeof (EFI_FFS_FILE_HEADER);
+  }
+  return CurrentOffset;
+}
+
+EFI_STATUS
+CalculateFvSize (
+  FV_INFO *FvInfoPtr
+  )
+/*++
+Routine Description:
+  Calculate the FV size and Update Fv Size based on the actual FFS files.
+  And Update FvInfo data.
+
+Arguments:
+  FvInfoPtr     - The pointer to FV_INFO structure, its files must have been
+                  read by LoadFvFiles.
+
+Returns:
+  EFI_ABORTED   - Ffs Image Error
+  EFI_SUCCESS   - Successfully update FvSize
+--*/
+{
+  UINTN               CurrentOffset;
+  UINTN               Index;
+  UINTN               FfsFileSize;
+  FV_FILE_IMAGE       *Image;
+  BOOLEAN             VtfFileFlag;
+  UINTN               VtfFileSize;
+  EFI_STATUS          Status;
+  
+  VtfFileSize = 0;
+  VtfFileFlag = FALSE;
+  Index = 0;
+
+  //
+  // Compute size for easy access later
+  //
+  FvInfoPtr->Size = 0;
+  for (Index = 0; FvInfoPtr->FvBlocks[Index].NumBlocks > 0 && FvInfoPtr->FvBlocks[Index].Length > 0; Index++) {
+    FvInfoPtr->Size += FvInfoPtr->FvBlocks[Index].NumBlocks * FvInfoPtr->FvBlocks[Index].Length;
+  }
+  
+  //
+  // Caculate the required sizes for all FFS files.
+  //
+  Status = GetFvFirstFileOffset (FvInfoPtr, &CurrentOffset);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   //
   // Accumlate every FFS file size.
   //
-  for (Index = 0; FvInfoPtr->FvFiles[Index][0] != 0; Index++) {
-    //
-    // Open FFS file
-    //
-    fpin = NULL;
-    fpin = fopen (FvInfoPtr->FvFiles[Index], "rb");
-    if (fpin == NULL) {
-      Error (NULL, 0, 0001, "Error opening file", FvInfoPtr->FvFiles[Index]);
-      return EFI_ABORTED;
-    }
-    //
-    // Get the file size
-    //
-    FfsFileSize = _filelength (fileno (fpin));
-    //
-    // Read Ffs File header
-    //
-    fread (&FfsHeader, sizeof (UINT8), sizeof (EFI_FFS_FILE_HEADER), fpin);
+  if (FvInfoPtr->FvFileImages == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  for (Index = 0; Index < FvInfoPtr->FvFileNumber; Index++) {
     //
-    // close file
+    // Use the size and header data cached when the file was read
     //
-    fclose (fpin);
+    Image       = &FvInfoPtr->FvFileImages[Index];
+    FfsFileSize = Image->Size;
     
     if (FvInfoPtr->IsPiFvImage) {
 	    //
 	    // Check whether this ffs file is vtf file
 	    //
-	    if (IsVtfFile (&FfsHeader)) {
+	    if (Image->IsVtf) {
 	      if (VtfFileFlag) {
 	        //
 	        // One Fv image can't have two vtf files.
@@ -2615,17 +4675,9 @@ Returns:
       }
 
       //
-      // Get the alignment of FFS file 
+      // Add Pad file for the alignment of FFS file
       //
-      ReadFfsAlignment (&FfsHeader, &FfsAlignment);
-      FfsAlignment = 1 << FfsAlignment;
-      //
-      // Add Pad file
-      //
-      if (((CurrentOffset + sizeof (EFI_FFS_FILE_HEADER)) % FfsAlignment) != 0) {
-        CurrentOffset = (CurrentOffset + sizeof (EFI_FFS_FILE_HEADER) * 2 + FfsAlignment - 1) & ~(FfsAlignment - 1);
-        CurrentOffset -= sizeof (EFI_FFS_FILE_HEADER);
-      }
+      CurrentOffset = GetFfsFileOffset (CurrentOffset, Image->Alignment);
 	  }
 
     //
@@ -2666,12 +4718,258 @@ Returns:
   //
   // Set Fv Size Information
   //
-  mFvTotalSize = FvInfoPtr->Size;
-  mFvTakenSize = CurrentOffset;
+  FvInfoPtr->TotalSize = FvInfoPtr->Size;
+  FvInfoPtr->TakenSize = CurrentOffset;
 
   return EFI_SUCCESS;
 }
 
+STATIC
+BOOLEAN
+IsPinnedFvFile (
+  IN FV_FILE_IMAGE    *Image
+  )
+/*++
+Routine Description:
+  Check whether a FFS file must keep its place in the file list: the VTF
+  file and the PEI and DXE apriori files.
+
+Arguments:
+  Image         - The file, read by LoadFvFiles.
+
+Returns:
+  TRUE          - The file can't be moved
+  FALSE         - The file can be moved
+--*/
+{
+  EFI_FFS_FILE_HEADER *FfsFile;
+
+  if (Image->IsVtf || Image->Size < sizeof (EFI_FFS_FILE_HEADER)) {
+    return TRUE;
+  }
+  FfsFile = (EFI_FFS_FILE_HEADER *) Image->Buffer;
+  return (BOOLEAN) (CompareGuid (&FfsFile->Name, &mPeiAprioriFileNameGuid) == 0 ||
+                    CompareGuid (&FfsFile->Name, &mDxeAprioriFileNameGuid) == 0);
+}
+
+STATIC
+UINTN
+PlaceFvFile (
+  IN     FV_FILE_IMAGE    *Image,
+  IN     UINTN            CurrentOffset,
+  IN OUT UINTN            *PadSize
+  )
+/*++
+Routine Description:
+  Place a FFS file at the start of the free space of the FV, the way
+  CalculateFvSize accounts for it.
+
+Arguments:
+  Image         - The file, read by LoadFvFiles.
+  CurrentOffset - Start of the free space.
+  PadSize       - The size of the pad file inserted before the file is added to it.
+
+Returns:
+  The start of the free space after the file.
+--*/
+{
+  UINTN   FileOffset;
+
+  if (Image->IsVtf) {
+    return CurrentOffset;
+  }
+  FileOffset = GetFfsFileOffset (CurrentOffset, Image->Alignment);
+  *PadSize  += FileOffset - CurrentOffset;
+  return (FileOffset + Image->Size + EFI_FFS_FILE_HEADER_ALIGNMENT - 1) & ~(EFI_FFS_FILE_HEADER_ALIGNMENT - 1);
+}
+
+STATIC
+UINTN
+SelectFvFile (
+  IN FV_INFO          *FvInfo,
+  IN BOOLEAN          *Placed,
+  IN UINTN            CurrentOffset
+  )
+/*++
+Routine Description:
+  Choose the movable FFS file placed next. An aligned file that needs no pad
+  file at CurrentOffset is taken first, the most aligned one. Otherwise the
+  space before the aligned file that needs the smallest pad file is filled
+  with the largest file that still leaves that file at the same offset.
+  Files with no alignment are taken in file order once no aligned file is
+  left.
+
+Arguments:
+  FvInfo        - The FV, its files must have been read by LoadFvFiles.
+  Placed        - The files already placed and the pinned files.
+  CurrentOffset - Start of the free space.
+
+Returns:
+  The index of the file to place.
+--*/
+{
+  UINTN           Index;
+  UINTN           Target;
+  UINTN           TargetOffset;
+  UINTN           Filler;
+  UINTN           FileOffset;
+  UINTN           PadSize;
+  FV_FILE_IMAGE   *Image;
+
+  Target       = FvInfo->FvFileNumber;
+  TargetOffset = 0;
+  Filler       = FvInfo->FvFileNumber;
+  for (Index = 0; Index < FvInfo->FvFileNumber; Index++) {
+    Image = &FvInfo->FvFileImages[Index];
+    if (Placed[Index]) {
+      continue;
+    }
+    if (Image->Alignment <= EFI_FFS_FILE_HEADER_ALIGNMENT_SHIFT) {
+      if (Filler == FvInfo->FvFileNumber) {
+        Filler = Index;
+      }
+      continue;
+    }
+    FileOffset = GetFfsFileOffset (CurrentOffset, Image->Alignment);
+    if (Target == FvInfo->FvFileNumber || FileOffset < TargetOffset ||
+        (FileOffset == TargetOffset && Image->Alignment > FvInfo->FvFileImages[Target].Alignment)) {
+      Target       = Index;
+      TargetOffset = FileOffset;
+    }
+  }
+
+  if (Target == FvInfo->FvFileNumber || TargetOffset == CurrentOffset) {
+    return Target != FvInfo->FvFileNumber ? Target : Filler;
+  }
+
+  //
+  // Fill the space before the target with the largest file that fits.
+  //
+  Filler = FvInfo->FvFileNumber;
+  for (Index = 0; Index < FvInfo->FvFileNumber; Index++) {
+    Image = &FvInfo->FvFileImages[Index];
+    if (Placed[Index] || Image->Alignment > EFI_FFS_FILE_HEADER_ALIGNMENT_SHIFT) {
+      continue;
+    }
+    if (Filler != FvInfo->FvFileNumber && Image->Size <= FvInfo->FvFileImages[Filler].Size) {
+      continue;
+    }
+    PadSize = 0;
+    if (GetFfsFileOffset (PlaceFvFile (Image, CurrentOffset, &PadSize), FvInfo->FvFileImages[Target].Alignment) == TargetOffset) {
+      Filler = Index;
+    }
+  }
+
+  return Filler != FvInfo->FvFileNumber ? Filler : Target;
+}
+
+EFI_STATUS
+PackFvFiles (
+  IN OUT FV_INFO      *FvInfo
+  )
+/*++
+Routine Description:
+  Reorder the FFS files of the FV to reduce the size of the pad files that
+  AddFile inserts for the file alignments. The VTF and apriori files keep
+  their place in the file list. The new order is only kept if it needs less
+  padding than the original one, FvInfo->PadSizeSaved receives the number
+  of bytes saved.
+
+Arguments:
+  FvInfo        - The FV, its files must have been read by LoadFvFiles.
+
+Returns:
+  EFI_SUCCESS           - The files are in their final order
+  EFI_OUT_OF_RESOURCES  - No resource to reorder the files
+  EFI_ABORTED           - The FV extension header file can't be opened
+--*/
+{
+  EFI_STATUS      Status;
+  UINTN           FileNumber;
+  UINTN           Index;
+  UINTN           StartOffset;
+  UINTN           CurrentOffset;
+  UINTN           PadSize;
+  UINTN           PackedPadSize;
+  UINTN           *Order;
+  BOOLEAN         *Placed;
+  CHAR8           **FvFiles;
+  UINT32          *SizeofFvFiles;
+  FV_FILE_IMAGE   *FvFileImages;
+
+  FvInfo->PadSizeSaved = 0;
+  FileNumber           = FvInfo->FvFileNumber;
+  if (!FvInfo->IsPiFvImage || FileNumber < 2) {
+    return EFI_SUCCESS;
+  }
+
+  Status = GetFvFirstFileOffset (FvInfo, &StartOffset);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Order         = (UINTN *) malloc (FileNumber * sizeof (UINTN));
+  Placed        = (BOOLEAN *) calloc (FileNumber, sizeof (BOOLEAN));
+  FvFiles       = (CHAR8 **) malloc (FvInfo->FvFileMaxNumber * sizeof (CHAR8 *));
+  SizeofFvFiles = (UINT32 *) malloc (FvInfo->FvFileMaxNumber * sizeof (UINT32));
+  FvFileImages  = (FV_FILE_IMAGE *) malloc ((FileNumber + 1) * sizeof (FV_FILE_IMAGE));
+  if (Order == NULL || Placed == NULL || FvFiles == NULL || SizeofFvFiles == NULL || FvFileImages == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  //
+  // Padding of the original order
+  //
+  PadSize       = 0;
+  CurrentOffset = StartOffset;
+  for (Index = 0; Index < FileNumber; Index++) {
+    CurrentOffset = PlaceFvFile (&FvInfo->FvFileImages[Index], CurrentOffset, &PadSize);
+    Placed[Index] = IsPinnedFvFile (&FvInfo->FvFileImages[Index]);
+  }
+
+  //
+  // Pinned files stay in their slot, the other slots get the file chosen
+  // for the offset they start at.
+  //
+  PackedPadSize = 0;
+  CurrentOffset = StartOffset;
+  for (Index = 0; Index < FileNumber; Index++) {
+    if (IsPinnedFvFile (&FvInfo->FvFileImages[Index])) {
+      Order[Index] = Index;
+    } else {
+      Order[Index] = SelectFvFile (FvInfo, Placed, CurrentOffset);
+      Placed[Order[Index]] = TRUE;
+    }
+    CurrentOffset = PlaceFvFile (&FvInfo->FvFileImages[Order[Index]], CurrentOffset, &PackedPadSize);
+  }
+
+  VerboseMsg ("the pad files of the FV take %u bytes in file order and %u bytes packed", (unsigned) PadSize, (unsigned) PackedPadSize);
+  if (PackedPadSize >= PadSize) {
+    goto Done;
+  }
+
+  memcpy (FvFiles, FvInfo->FvFiles, FvInfo->FvFileMaxNumber * sizeof (CHAR8 *));
+  memcpy (SizeofFvFiles, FvInfo->SizeofFvFiles, FvInfo->FvFileMaxNumber * sizeof (UINT32));
+  memcpy (FvFileImages, FvInfo->FvFileImages, (FileNumber + 1) * sizeof (FV_FILE_IMAGE));
+  for (Index = 0; Index < FileNumber; Index++) {
+    FvInfo->FvFiles[Index]       = FvFiles[Order[Index]];
+    FvInfo->SizeofFvFiles[Index] = SizeofFvFiles[Order[Index]];
+    FvInfo->FvFileImages[Index]  = FvFileImages[Order[Index]];
+    DebugMsg (NULL, 0, 9, "FV component file", "the %uth file is %s", (unsigned) Index + 1, FvInfo->FvFiles[Index]);
+  }
+  FvInfo->PadSizeSaved = (UINT32) (PadSize - PackedPadSize);
+
+Done:
+  free (Order);
+  free (Placed);
+  free (FvFiles);
+  free (SizeofFvFiles);
+  free (FvFileImages);
+  return Status;
+}
+
 EFI_STATUS
 FfsRebaseImageRead (
   IN     VOID    *FileHandle,
@@ -2744,23 +5042,94 @@ Returns:
   EFI_FIRMWARE_VOLUME_HEADER          *SubFvImageHeader;
   EFI_PHYSICAL_ADDRESS                SubFvBaseAddress;
 
-  for (Index = 1;; Index++) {
-    //
-    // Find FV section 
-    //
-    Status = GetSectionByType (FfsFile, EFI_SECTION_FIRMWARE_VOLUME_IMAGE, Index, &SubFvSection);
-    if (EFI_ERROR (Status)) {
+  for (Index = 1;; Index++) {
+    //
+    // Find FV section 
+    //
+    Status = GetSectionByType (FfsFile, EFI_SECTION_FIRMWARE_VOLUME_IMAGE, Index, &SubFvSection);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+    SubFvImageHeader = (EFI_FIRMWARE_VOLUME_HEADER *) ((UINT8 *) SubFvSection.FVImageSection + sizeof (EFI_FIRMWARE_VOLUME_IMAGE_SECTION));
+    //
+    // Rebase on Flash
+    //
+    SubFvBaseAddress = FvInfo->BaseAddress + (UINTN) SubFvImageHeader - (UINTN) FfsFile + XipOffset;
+    if (EFI_ERROR (GrowTable ((VOID **) &FvInfo->ChildFvBaseAddress, &FvInfo->ChildFvBaseAddressMaxNumber, FvInfo->ChildFvBaseAddressNumber, sizeof (EFI_PHYSICAL_ADDRESS)))) {
+      Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+      return EFI_OUT_OF_RESOURCES;
+    }
+    FvInfo->ChildFvBaseAddress[FvInfo->ChildFvBaseAddressNumber ++ ] = SubFvBaseAddress;
+  }
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+RelocateFvImage (
+  IN OUT PE_COFF_LOADER_IMAGE_CONTEXT  *ImageContext,
+  IN     FV_RELOC_CACHE                *RelocCache,
+  IN     UINT32                        SectionOffset
+  )
+/*++
+
+Routine Description:
+
+  This function relocates a loaded image of a FFS file to
+  ImageContext->DestinationAddress. Without relocation cache the relocation
+  blocks are walked by PeCoffLoaderRelocateImage. With one, the relocation
+  index of the image is built the first time and applied to the copies of
+  the file placed in the later FVs.
+
+Arguments:
+
+  ImageContext      Context of the loaded image.
+  RelocCache        Relocation indexes of the file, or NULL.
+  SectionOffset     Offset of the image section in the FFS file.
+
+Returns:
+
+  EFI_SUCCESS             The image was relocated.
+  EFI_OUT_OF_RESOURCES    No resource to build the index.
+  Others                  The image could not be relocated.
+
+--*/
+{
+  UINTN                       Index;
+  FV_RELOC_INDEX              *Indexes;
+  PE_COFF_RELOCATION_INDEX    *RelocIndex;
+  RETURN_STATUS               Status;
+
+  if (RelocCache == NULL) {
+    return PeCoffLoaderRelocateImage (ImageContext);
+  }
+
+  for (Index = 0; Index < RelocCache->Number; Index++) {
+    if (RelocCache->Indexes[Index].SectionOffset == SectionOffset) {
       break;
     }
-    SubFvImageHeader = (EFI_FIRMWARE_VOLUME_HEADER *) ((UINT8 *) SubFvSection.FVImageSection + sizeof (EFI_FIRMWARE_VOLUME_IMAGE_SECTION));
-    //
-    // Rebase on Flash
-    //
-    SubFvBaseAddress = FvInfo->BaseAddress + (UINTN) SubFvImageHeader - (UINTN) FfsFile + XipOffset;
-    mFvBaseAddress[mFvBaseAddressNumber ++ ] = SubFvBaseAddress;
   }
 
-  return EFI_SUCCESS;
+  if (Index == RelocCache->Number) {
+    Indexes = (FV_RELOC_INDEX *) realloc (RelocCache->Indexes, (RelocCache->Number + 1) * sizeof (FV_RELOC_INDEX));
+    if (Indexes == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+    RelocCache->Indexes = Indexes;
+    Status = PeCoffLoaderBuildRelocationIndex (ImageContext, &RelocIndex);
+    if (Status == RETURN_OUT_OF_RESOURCES) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+    Indexes[Index].SectionOffset = SectionOffset;
+    Indexes[Index].Index         = RelocIndex;
+    RelocCache->Number++;
+  }
+
+  if (RelocCache->Indexes[Index].Index == NULL) {
+    return PeCoffLoaderRelocateImage (ImageContext);
+  }
+  return PeCoffLoaderRelocateImageWithIndex (ImageContext, RelocCache->Indexes[Index].Index);
 }
 
 EFI_STATUS
@@ -2769,7 +5138,9 @@ FfsRebase (
   IN      CHAR8                 *FileName,           
   IN OUT  EFI_FFS_FILE_HEADER   *FfsFile,
   IN      UINTN                 XipOffset,
-  IN      FILE                  *FvMapFile
+  IN      FILE                  *FvMapFile,
+  IN      FV_RELOC_CACHE        *RelocCache,
+  OUT     BOOLEAN               *ArmImage
   )
 /*++
 
@@ -2785,6 +5156,12 @@ Arguments:
   FfsFile           A pointer to Ffs file image.
   XipOffset         The offset address to use for rebasing the XIP file image.
   FvMapFile         FvMapFile to record the function address in one Fvimage
+  RelocCache        Relocation indexes of the file, or NULL.
+  ArmImage          Set to TRUE when the file holds an ARM Thumb image,
+                    left unchanged otherwise.
+
+  Different files can be rebased at the same time, this function only
+  changes FfsFile and ArmImage and writes to FvMapFile.
 
 Returns:
 
@@ -2814,6 +5191,8 @@ Returns:
   UINT8                                 *PeFileBuffer;
   UINT32                                PeFileSize;
   CHAR8                                 *PdbPointer;
+  SHA256_CONTEXT                        Sha;
+  UINT8                                 ImageHash[SHA256_DIGEST_SIZE];
 
   Index              = 0;  
   MemoryImagePointer = NULL;
@@ -2854,12 +5233,8 @@ Returns:
       break;
     case EFI_FV_FILETYPE_FIRMWARE_VOLUME_IMAGE:
       //
-      // Rebase the inside FvImage.
-      //
-      GetChildFvFromFfs (FvInfo, FfsFile, XipOffset);
-
-      //
-      // Search PE/TE section in FV sectin.
+      // Search PE/TE section in FV sectin. The base addresses of the inside
+      // FvImages are recorded by RebaseFvFiles.
       //
       break;
     default:
@@ -2896,7 +5271,7 @@ Returns:
     }
 
     if (ImageContext.Machine == EFI_IMAGE_MACHINE_ARMT) {
-      mArm = TRUE;
+      *ArmImage = TRUE;
     }
 
     //
@@ -3022,6 +5397,13 @@ Returns:
       continue;
     }
 
+    //
+    // The symbol cache of the map file is keyed on the image as it was built.
+    //
+    Sha256Init (&Sha);
+    Sha256Update (&Sha, CurrentPe32Section.Pe32Section, GetLength (CurrentPe32Section.CommonHeader->Size));
+    Sha256Final (&Sha, ImageHash);
+
     //
     // Relocation exist and rebase
     //
@@ -3044,7 +5426,11 @@ Returns:
     }
          
     ImageContext.DestinationAddress = NewPe32BaseAddress;
-    Status                          = PeCoffLoaderRelocateImage (&ImageContext);
+    Status                          = RelocateFvImage (
+                                        &ImageContext,
+                                        RelocCache,
+                                        (UINT32) ((UINTN) CurrentPe32Section.Pe32Section - (UINTN) FfsFile)
+                                        );
     if (EFI_ERROR (Status)) {
       Error (NULL, 0, 3000, "Invalid", "RelocateImage() call failed on rebase of %s", FileName);
       free ((VOID *) MemoryImagePointer);
@@ -3116,7 +5502,7 @@ Returns:
       PdbPointer = FileName;
     }
 
-    WriteMapFile (FvMapFile, PdbPointer, FfsFile, NewPe32BaseAddress, &OrigImageContext);
+    WriteMapFile (FvMapFile, PdbPointer, FfsFile, NewPe32BaseAddress, &OrigImageContext, ImageHash);
   }
 
   if (FfsFile->Type != EFI_FV_FILETYPE_SECURITY_CORE &&
@@ -3164,7 +5550,7 @@ Returns:
     }
 
     if (ImageContext.Machine == EFI_IMAGE_MACHINE_ARMT) {
-      mArm = TRUE;
+      *ArmImage = TRUE;
     }
 
     //
@@ -3249,6 +5635,13 @@ Returns:
       continue;
     }
 
+    //
+    // The symbol cache of the map file is keyed on the image as it was built.
+    //
+    Sha256Init (&Sha);
+    Sha256Update (&Sha, CurrentPe32Section.Pe32Section, GetLength (CurrentPe32Section.CommonHeader->Size));
+    Sha256Final (&Sha, ImageHash);
+
     //
     // Relocation exist and rebase
     //
@@ -3273,7 +5666,11 @@ Returns:
     // Reloacate TeImage
     // 
     ImageContext.DestinationAddress = NewPe32BaseAddress;
-    Status                          = PeCoffLoaderRelocateImage (&ImageContext);
+    Status                          = RelocateFvImage (
+                                        &ImageContext,
+                                        RelocCache,
+                                        (UINT32) ((UINTN) CurrentPe32Section.Pe32Section - (UINTN) FfsFile)
+                                        );
     if (EFI_ERROR (Status)) {
       Error (NULL, 0, 3000, "Invalid", "RelocateImage() call failed on rebase of TE image %s", FileName);
       free ((VOID *) MemoryImagePointer);
@@ -3344,13 +5741,311 @@ Returns:
       PdbPointer, 
       FfsFile,
       NewPe32BaseAddress, 
-      &OrigImageContext
+      &OrigImageContext,
+      ImageHash
       );
   }
  
   return EFI_SUCCESS;
 }
 
+//
+// One image rebase of RebaseFvFiles. The map file lines of the job are
+// written to the temporary map file of the worker that runs it, between
+// MapStart and MapEnd. Arm records an ARM Thumb image for FV_INFO.Arm.
+//
+typedef struct {
+  UINTN                 FileIndex;
+  UINTN                 WorkerIndex;
+  long                  MapStart;
+  long                  MapEnd;
+  BOOLEAN               Arm;
+  EFI_STATUS            Status;
+} FV_REBASE_JOB;
+
+typedef struct {
+  MEMORY_FILE           *FvImage;
+  FV_INFO               *FvInfo;
+  FV_REBASE_JOB         *Jobs;
+  FILE                  **MapFiles;
+  UINTN                 ProfileRecord;
+} FV_REBASE_CONTEXT;
+
+STATIC
+VOID
+RebaseFvFileJob (
+  IN VOID               *Context,
+  IN UINTN              JobIndex,
+  IN UINTN              WorkerIndex
+  )
+/*++
+
+Routine Description:
+
+  This function rebases the images of one file of the FV, it runs on a
+  worker of RunParallelJobs.
+
+Arguments:
+
+  Context           The FV_REBASE_CONTEXT of the rebase.
+  JobIndex          The job to run.
+  WorkerIndex       The worker running the job.
+
+Returns:
+
+  None, the status is stored in the job.
+
+--*/
+{
+  FV_REBASE_CONTEXT     *Rebase;
+  FV_REBASE_JOB         *Job;
+  FV_FILE_IMAGE         *Image;
+  FILE                  *MapFile;
+  FV_LAYOUT_ENTRY       *Previous;
+  SHA256_CONTEXT        Sha;
+  UINT8                 Digest[SHA256_DIGEST_SIZE];
+  UINTN                 ProfileRecord;
+
+  Rebase  = (FV_REBASE_CONTEXT *) Context;
+  Job     = &Rebase->Jobs[JobIndex];
+  Image   = &Rebase->FvInfo->FvFileImages[Job->FileIndex];
+  MapFile = Rebase->MapFiles[WorkerIndex];
+
+  ProfileRecord    = ProfileBeginIn (Rebase->ProfileRecord, "FfsRebase", Rebase->FvInfo->FvFiles[Job->FileIndex]);
+  Job->WorkerIndex = WorkerIndex;
+  Job->MapStart    = ftell (MapFile);
+
+  //
+  // An unchanged file at the same offset is taken from the previous FV
+  // image, once it is checked to be the image the layout recorded.
+  //
+  if (Image->Previous != NULL) {
+    Previous = Image->Previous;
+    Sha256Init (&Sha);
+    Sha256Update (&Sha, Rebase->FvInfo->Layout->FvImage + Previous->Offset, Previous->Size);
+    Sha256Final (&Sha, Digest);
+    if (memcmp (Digest, Previous->OutputHash, SHA256_DIGEST_SIZE) == 0) {
+      memcpy (Image->FvFile, Rebase->FvInfo->Layout->FvImage + Previous->Offset, Previous->Size);
+      fwrite (Rebase->FvInfo->Layout->MapImage + Previous->MapOffset, 1, Previous->MapLength, MapFile);
+      ProfileAddBytes (0, Previous->MapLength);
+      Job->Status = EFI_SUCCESS;
+      Job->MapEnd = ftell (MapFile);
+      ProfileEnd (ProfileRecord);
+      return;
+    }
+    Image->Previous = NULL;
+  }
+
+  //
+  // FfsRebase checks the file with the FV library, whose FV is set per
+  // thread.
+  //
+  InitializeFvLib (Rebase->FvImage->FileImage, (UINT32) (Rebase->FvImage->Eof - Rebase->FvImage->FileImage));
+  Job->Status      = FfsRebase (
+                       Rebase->FvInfo,
+                       Rebase->FvInfo->FvFiles[Job->FileIndex],
+                       Image->FvFile,
+                       (UINTN) Image->FvFile - (UINTN) Rebase->FvImage->FileImage,
+                       MapFile,
+                       Image->RelocCache,
+                       &Job->Arm
+                       );
+  Job->MapEnd      = ftell (MapFile);
+  ProfileEnd (ProfileRecord);
+}
+
+EFI_STATUS
+RebaseFvFiles (
+  IN      MEMORY_FILE           *FvImage,
+  IN OUT  FV_INFO               *FvInfo,
+  IN      FILE                  *FvMapFile
+  )
+/*++
+
+Routine Description:
+
+  This function rebases the PE32 and TE images of all the files placed in
+  the FV image by AddFile. The file offsets are final at this point, so
+  the files are independent and are rebased on FvInfo->RebaseThreads
+  workers, or one worker per processor if it is zero. The map file lines
+  of each worker go to a temporary file first and are then copied to
+  FvMapFile in file order, so the map file does not depend on the number
+  of workers. In incremental mode, the files found unchanged at the same
+  offset in the previous layout are copied from the previous FV image and
+  map file instead of being rebased.
+
+Arguments:
+
+  FvImage           The memory image of the FV.
+  FvInfo            A pointer to FV_INFO struture.
+  FvMapFile         FvMapFile to record the function address in one Fvimage
+
+Returns:
+
+  EFI_SUCCESS             All images were rebased.
+  EFI_OUT_OF_RESOURCES    Could not allocate a required resource.
+  Others                  The status of the first file that failed, in file order.
+
+--*/
+{
+  EFI_STATUS            Status;
+  FV_REBASE_CONTEXT     Rebase;
+  FV_REBASE_JOB         *Jobs;
+  FILE                  *MapFiles[MAX_PARALLEL_WORKERS];
+  UINTN                 JobCount;
+  UINTN                 WorkerCount;
+  UINTN                 Index;
+  UINT8                 Buffer[0x1000];
+  long                  Remaining;
+  size_t                Size;
+  FV_FILE_IMAGE         *Image;
+  UINTN                 ReuseNumber;
+  UINTN                 ProfileRecord;
+
+  //
+  // Don't need to relocate image when BaseAddress is zero and no ForceRebase Flag specified.
+  // If ForceRebase Flag specified to FALSE, will always not take rebase action.
+  //
+  if ((FvInfo->BaseAddress == 0 && FvInfo->ForceRebase == -1) || FvInfo->ForceRebase == 0) {
+    return EFI_SUCCESS;
+  }
+
+  Jobs = (FV_REBASE_JOB *) malloc ((FvInfo->FvFileNumber + 1) * sizeof (FV_REBASE_JOB));
+  if (Jobs == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //
+  // Record the child FvImages in file order, they only depend on the file offset.
+  //
+  JobCount = 0;
+  for (Index = 0; Index < FvInfo->FvFileNumber; Index++) {
+    if (FvInfo->FvFileImages[Index].FvFile == NULL) {
+      continue;
+    }
+    if (FvInfo->FvFileImages[Index].FvFile->Type == EFI_FV_FILETYPE_FIRMWARE_VOLUME_IMAGE) {
+      Status = GetChildFvFromFfs (
+                 FvInfo,
+                 FvInfo->FvFileImages[Index].FvFile,
+                 (UINTN) FvInfo->FvFileImages[Index].FvFile - (UINTN) FvImage->FileImage
+                 );
+      if (EFI_ERROR (Status)) {
+        free (Jobs);
+        return Status;
+      }
+    }
+    if (FvInfo->Incremental) {
+      GetFvFileMapKey (FvInfo->FvFileImages[Index].FvFile, FvInfo->FvFiles[Index], FvInfo->FvFileImages[Index].MapKey);
+    }
+    if (FvInfo->Layout != NULL) {
+      FvInfo->FvFileImages[Index].Previous = FindFvLayoutEntry (
+                                               FvInfo->Layout,
+                                               FvInfo,
+                                               Index,
+                                               (UINT32) ((UINTN) FvInfo->FvFileImages[Index].FvFile - (UINTN) FvImage->FileImage)
+                                               );
+    }
+    Jobs[JobCount].FileIndex = Index;
+    Jobs[JobCount].Arm       = FALSE;
+    Jobs[JobCount].Status    = EFI_SUCCESS;
+    JobCount++;
+  }
+
+  WorkerCount = FvInfo->RebaseThreads != 0 ? FvInfo->RebaseThreads : GetProcessorCount ();
+  if (WorkerCount > JobCount) {
+    WorkerCount = JobCount;
+  }
+  if (WorkerCount > MAX_PARALLEL_WORKERS) {
+    WorkerCount = MAX_PARALLEL_WORKERS;
+  }
+
+  //
+  // With one worker the map file is written directly. The same is done when
+  // a temporary map file cannot be created.
+  //
+  memset (MapFiles, 0, sizeof (MapFiles));
+  if (WorkerCount > 1) {
+    for (Index = 0; Index < WorkerCount; Index++) {
+      MapFiles[Index] = tmpfile ();
+      if (MapFiles[Index] == NULL) {
+        break;
+      }
+    }
+    if (Index < WorkerCount) {
+      for (Index = 0; Index < WorkerCount; Index++) {
+        if (MapFiles[Index] != NULL) {
+          fclose (MapFiles[Index]);
+          MapFiles[Index] = NULL;
+        }
+      }
+      WorkerCount = 1;
+    }
+  }
+  if (WorkerCount <= 1) {
+    WorkerCount = 1;
+    MapFiles[0] = FvMapFile;
+  }
+
+  Rebase.FvImage  = FvImage;
+  Rebase.FvInfo   = FvInfo;
+  Rebase.Jobs     = Jobs;
+  Rebase.MapFiles = MapFiles;
+  Rebase.ProfileRecord = ProfileCurrent ();
+  VerboseMsg ("Rebase %u files on %u threads", (unsigned) JobCount, (unsigned) WorkerCount);
+  RunParallelJobs (RebaseFvFileJob, &Rebase, JobCount, WorkerCount);
+
+  //
+  // Copy the map file lines, collect the ARM flags and report the first
+  // failure in file order.
+  //
+  ProfileRecord = MapFiles[0] != FvMapFile ? ProfileBegin ("WriteMapFile", NULL) : PROFILE_NO_RECORD;
+  Status      = EFI_SUCCESS;
+  ReuseNumber = 0;
+  for (Index = 0; Index < JobCount; Index++) {
+    Image = &FvInfo->FvFileImages[Jobs[Index].FileIndex];
+    if (EFI_ERROR (Jobs[Index].Status)) {
+      Error (NULL, 0, 3000, "Invalid", "Could not rebase %s.", FvInfo->FvFiles[Jobs[Index].FileIndex]);
+      Status = Jobs[Index].Status;
+      break;
+    }
+    if (Jobs[Index].Arm) {
+      FvInfo->Arm = TRUE;
+    }
+    if (Image->Previous != NULL) {
+      ReuseNumber++;
+    }
+    Image->MapLength = (UINT32) (Jobs[Index].MapEnd - Jobs[Index].MapStart);
+    if (MapFiles[0] == FvMapFile) {
+      Image->MapOffset = (UINT32) Jobs[Index].MapStart;
+      continue;
+    }
+    Image->MapOffset = (UINT32) ftell (FvMapFile);
+    fseek (MapFiles[Jobs[Index].WorkerIndex], Jobs[Index].MapStart, SEEK_SET);
+    for (Remaining = Jobs[Index].MapEnd - Jobs[Index].MapStart; Remaining > 0; Remaining -= (long) Size) {
+      Size = fread (Buffer, 1, Remaining < (long) sizeof (Buffer) ? (size_t) Remaining : sizeof (Buffer), MapFiles[Jobs[Index].WorkerIndex]);
+      if (Size == 0) {
+        break;
+      }
+      fwrite (Buffer, 1, Size, FvMapFile);
+      ProfileAddBytes (Size, Size);
+    }
+  }
+
+  ProfileEnd (ProfileRecord);
+
+  if (MapFiles[0] != FvMapFile) {
+    for (Index = 0; Index < WorkerCount; Index++) {
+      fclose (MapFiles[Index]);
+    }
+  }
+  if (FvInfo->Layout != NULL) {
+    VerboseMsg ("%u of %u files were taken from the previous FV image", (unsigned) ReuseNumber, (unsigned) JobCount);
+  }
+  free (Jobs);
+  return Status;
+}
+
 EFI_STATUS
 FindApResetVectorPosition (
   IN  MEMORY_FILE  *FvImage,
@@ -3428,20 +6123,21 @@ Returns:
   return EFI_NOT_FOUND;
 }
 
+STATIC
 EFI_STATUS
-ParseCapInf (
-  IN  MEMORY_FILE  *InfFile,
+ReadCapInfo (
+  IN  INF_INDEX    *InfIndex,
   OUT CAP_INFO     *CapInfo
   )
 /*++
 
 Routine Description:
 
-  This function parses a Cap.INF file and copies info into a CAP_INFO structure.
+  This function copies the info of an indexed Cap.INF file into a CAP_INFO structure.
 
 Arguments:
 
-  InfFile        Memory file image.
+  InfIndex       Index of the INF file.
   CapInfo        Information read from INF file.
 
 Returns:
@@ -3453,7 +6149,7 @@ Returns:
 {
   CHAR8       Value[_MAX_PATH];
   UINT64      Value64;
-  UINTN       Index, Number;
+  UINTN       Number;
   EFI_STATUS  Status;
 
   //
@@ -3465,7 +6161,7 @@ Returns:
   //
   // Read the Capsule Guid
   //
-  Status = FindToken (InfFile, OPTIONS_SECTION_STRING, EFI_CAPSULE_GUID_STRING, 0, Value);
+  Status = InfIndexFindToken (InfIndex, OPTIONS_SECTION_STRING, EFI_CAPSULE_GUID_STRING, 0, Value);
   if (Status == EFI_SUCCESS) {
     //
     // Get the Capsule Guid
@@ -3481,7 +6177,7 @@ Returns:
   //
   // Read the Capsule Header Size
   //
-  Status = FindToken (InfFile, OPTIONS_SECTION_STRING, EFI_CAPSULE_HEADER_SIZE_STRING, 0, Value);
+  Status = InfIndexFindToken (InfIndex, OPTIONS_SECTION_STRING, EFI_CAPSULE_HEADER_SIZE_STRING, 0, Value);
   if (Status == EFI_SUCCESS) {
     Status = AsciiStringToUint64 (Value, FALSE, &Value64);
     if (EFI_ERROR (Status)) {
@@ -3495,7 +6191,7 @@ Returns:
   //
   // Read the Capsule Flag
   //
-  Status = FindToken (InfFile, OPTIONS_SECTION_STRING, EFI_CAPSULE_FLAGS_STRING, 0, Value);
+  Status = InfIndexFindToken (InfIndex, OPTIONS_SECTION_STRING, EFI_CAPSULE_FLAGS_STRING, 0, Value);
   if (Status == EFI_SUCCESS) {
     if (strstr (Value, "PopulateSystemTable") != NULL) {
       CapInfo->Flags |= CAPSULE_FLAGS_PERSIST_ACROSS_RESET | CAPSULE_FLAGS_POPULATE_SYSTEM_TABLE;
@@ -3517,7 +6213,7 @@ Returns:
   //
   // Read Capsule File name
   //
-  Status = FindToken (InfFile, OPTIONS_SECTION_STRING, EFI_FILE_NAME_STRING, 0, Value);
+  Status = InfIndexFindToken (InfIndex, OPTIONS_SECTION_STRING, EFI_FILE_NAME_STRING, 0, Value);
   if (Status == EFI_SUCCESS) {
     //
     // Get output file name
@@ -3528,34 +6224,193 @@ Returns:
   //
   // Read the Capsule FileImage
   //
-  Number = 0;
-  for (Index = 0; Index < MAX_NUMBER_OF_FILES_IN_CAP; Index++) {
-    if (CapInfo->CapFiles[Index][0] != '\0') {
-      continue;
-    }
+  for (Number = 0;; Number++) {
     //
     // Read the capsule file name
     //
-    Status = FindToken (InfFile, FILES_SECTION_STRING, EFI_FILE_NAME_STRING, Number++, Value);
+    Status = InfIndexFindToken (InfIndex, FILES_SECTION_STRING, EFI_FILE_NAME_STRING, Number, Value);
 
     if (Status == EFI_SUCCESS) {
       //
       // Add the file
       //
-      strcpy (CapInfo->CapFiles[Index], Value);
-      DebugMsg (NULL, 0, 9, "Capsule component file", "the %uth file name is %s", (unsigned) Index, CapInfo->CapFiles[Index]); 
+      if (EFI_ERROR (AddCapFile (CapInfo, Value))) {
+        Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+        return EFI_OUT_OF_RESOURCES;
+      }
+      DebugMsg (NULL, 0, 9, "Capsule component file", "the %uth file name is %s", (unsigned) CapInfo->CapFileNumber - 1, Value); 
     } else {
       break;
     }
   }
   
-  if (Index == 0) {
+  if (CapInfo->CapFileNumber == 0) {
     Warning (NULL, 0, 0, "Capsule components are not specified.", NULL);
   }
 
   return EFI_SUCCESS;
 }
 
+EFI_STATUS
+ParseCapInf (
+  IN  MEMORY_FILE  *InfFile,
+  OUT CAP_INFO     *CapInfo
+  )
+/*++
+
+Routine Description:
+
+  This function parses a Cap.INF file and copies info into a CAP_INFO structure.
+  The file is indexed once, every token lookup then uses the index.
+
+Arguments:
+
+  InfFile        Memory file image.
+  CapInfo        Information read from INF file.
+
+Returns:
+
+  EFI_SUCCESS           INF file information successfully retrieved.
+  EFI_ABORTED           INF file has an invalid format.
+  EFI_NOT_FOUND         A required string was not found in the INF file.
+  EFI_OUT_OF_RESOURCES  No resource to index the INF file.
+--*/
+{
+  INF_INDEX   *InfIndex;
+  EFI_STATUS  Status;
+
+  Status = InfIndexCreate (InfFile, &InfIndex);
+  if (EFI_ERROR (Status)) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    return Status;
+  }
+
+  Status = ReadCapInfo (InfIndex, CapInfo);
+  InfIndexFree (InfIndex);
+  return Status;
+}
+
+//
+// Size of the bounce buffer used when the capsule payload cannot be copied
+// by the kernel directly.
+//
+#define CAPSULE_COPY_BUFFER_SIZE  0x10000
+
+STATIC
+EFI_STATUS
+CopyCapsuleFile (
+  IN FILE                 *OutFile,
+  IN CHAR8                *OutFileName,
+  IN CHAR8                *InFileName,
+  IN UINT32               FileSize
+  )
+/*++
+
+Routine Description:
+
+  Append the contents of one capsule payload file to the capsule output file.
+  On Linux the data is moved with sendfile so it never enters user space,
+  otherwise it is copied through a fixed size buffer. The memory used does
+  not depend on the size of the file.
+
+Arguments:
+
+  OutFile        The capsule output file, positioned at its end.
+  OutFileName    Name of the capsule output file, for error messages.
+  InFileName     The payload file to append.
+  FileSize       Expected size of the payload file.
+
+Returns:
+
+  EFI_SUCCESS           The whole file was appended.
+  EFI_ABORTED           The file could not be read, was shorter than expected,
+                        or the output could not be written.
+  EFI_OUT_OF_RESOURCES  The copy buffer could not be allocated.
+
+--*/
+{
+  FILE                  *InFile;
+  UINT8                 *Buffer;
+  UINT32                Remaining;
+  UINT32                Chunk;
+#ifdef __linux__
+  ssize_t               Sent;
+#endif
+
+  InFile = fopen (InFileName, "rb");
+  if (InFile == NULL) {
+    Error (NULL, 0, 0001, "Error opening file", InFileName);
+    return EFI_ABORTED;
+  }
+
+  Remaining = FileSize;
+
+#ifdef __linux__
+  Sent = 0;
+  //
+  // The output stream buffer must be empty before writing to its descriptor.
+  //
+  if (fflush (OutFile) != 0) {
+    Error (NULL, 0, 0002, "Error writing file", OutFileName);
+    fclose (InFile);
+    return EFI_ABORTED;
+  }
+  while (Remaining > 0) {
+    Sent = sendfile (fileno (OutFile), fileno (InFile), NULL, Remaining);
+    if (Sent <= 0) {
+      break;
+    }
+    Remaining -= (UINT32) Sent;
+  }
+  if (Remaining == 0) {
+    fclose (InFile);
+    ProfileAddBytes (FileSize, FileSize);
+    return EFI_SUCCESS;
+  }
+  if (Sent == 0) {
+    Error (NULL, 0, 0004, "Error reading file", InFileName);
+    fclose (InFile);
+    return EFI_ABORTED;
+  }
+  if (errno != EINVAL && errno != ENOSYS) {
+    Error (NULL, 0, 0002, "Error writing file", OutFileName);
+    fclose (InFile);
+    return EFI_ABORTED;
+  }
+  //
+  // sendfile is not supported for these files, continue with a buffered copy
+  // from where it stopped. Resynchronize the output stream with its descriptor.
+  //
+  fseek (OutFile, 0, SEEK_END);
+  fseek (InFile, FileSize - Remaining, SEEK_SET);
+#endif
+
+  Buffer = (UINT8 *) malloc (CAPSULE_COPY_BUFFER_SIZE);
+  if (Buffer == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated for creating the capsule.");
+    fclose (InFile);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  while (Remaining > 0) {
+    Chunk = Remaining < CAPSULE_COPY_BUFFER_SIZE ? Remaining : CAPSULE_COPY_BUFFER_SIZE;
+    if (fread (Buffer, 1, Chunk, InFile) != Chunk) {
+      Error (NULL, 0, 0004, "Error reading file", InFileName);
+      break;
+    }
+    if (fwrite (Buffer, 1, Chunk, OutFile) != Chunk) {
+      Error (NULL, 0, 0002, "Error writing file", OutFileName);
+      break;
+    }
+    Remaining -= Chunk;
+  }
+
+  free (Buffer);
+  fclose (InFile);
+  ProfileAddBytes (FileSize - Remaining, FileSize - Remaining);
+  return Remaining == 0 ? EFI_SUCCESS : EFI_ABORTED;
+}
+
 EFI_STATUS
 GenerateCapImage (
   IN CHAR8                *InfFileImage,
@@ -3567,6 +6422,8 @@ GenerateCapImage (
 Routine Description:
 
   This is the main function which will be called from application to create UEFI Capsule image.
+  The capsule is streamed to the output file, the header is built from the
+  sizes of the payload files and each payload file is then appended in turn.
 
 Arguments:
 
@@ -3583,13 +6440,14 @@ Returns:
 
 --*/
 {
-  UINT32                CapSize;
+  UINT64                CapSize;
   UINT8                 *CapBuffer;
   EFI_CAPSULE_HEADER    *CapsuleHeader;
   MEMORY_FILE           InfMemoryFile;
-  UINT32                FileSize;
+  UINT32                *FileSize;
   UINT32                Index;
-  FILE                  *fpin, *fpout;
+  FILE                  *fpout;
+  struct stat           StatBuf;
   EFI_STATUS            Status;
   
   if (InfFileImage != NULL) {
@@ -3638,29 +6496,37 @@ Returns:
     memcpy (&mCapDataInfo.CapGuid, &mDefaultCapsuleGuid, sizeof (EFI_GUID));
   }
   //
-  // Calculate the size of capsule image.
+  // Calculate the size of capsule image from the file system, the payload
+  // files are only opened when they are copied.
   //
-  Index    = 0;
-  FileSize = 0;
+  FileSize = (UINT32 *) malloc ((mCapDataInfo.CapFileNumber + 1) * sizeof (UINT32));
+  if (FileSize == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated for creating the capsule.");
+    return EFI_OUT_OF_RESOURCES;
+  }
   CapSize  = mCapDataInfo.HeaderSize;
-  while (mCapDataInfo.CapFiles [Index][0] != '\0') {
-    fpin = fopen (mCapDataInfo.CapFiles[Index], "rb");
-    if (fpin == NULL) {
+  for (Index = 0; Index < mCapDataInfo.CapFileNumber; Index ++) {
+    if (stat (mCapDataInfo.CapFiles[Index], &StatBuf) != 0) {
       Error (NULL, 0, 0001, "Error opening file", mCapDataInfo.CapFiles[Index]);
+      free (FileSize);
       return EFI_ABORTED;
     }
-    FileSize  = _filelength (fileno (fpin));
-    CapSize  += FileSize;
-    fclose (fpin);
-    Index ++;
+    CapSize += (UINT64) StatBuf.st_size;
+    if (CapSize > 0xFFFFFFFF) {
+      Error (NULL, 0, 2000, "Invalid parameter", "The capsule image size exceeds 4GB.");
+      free (FileSize);
+      return EFI_INVALID_PARAMETER;
+    }
+    FileSize[Index] = (UINT32) StatBuf.st_size;
   }
 
   //
-  // Allocate buffer for capsule image.
+  // Allocate buffer for capsule header.
   //
-  CapBuffer = (UINT8 *) malloc (CapSize);
+  CapBuffer = (UINT8 *) malloc (mCapDataInfo.HeaderSize);
   if (CapBuffer == NULL) {
     Error (NULL, 0, 4001, "Resource", "memory cannot be allocated for creating the capsule.");
+    free (FileSize);
     return EFI_OUT_OF_RESOURCES;
   }
 
@@ -3670,44 +6536,46 @@ Returns:
   memset (CapBuffer, 0, mCapDataInfo.HeaderSize);
   
   //
-  // create capsule header and get capsule body
+  // create capsule header
   //
   CapsuleHeader = (EFI_CAPSULE_HEADER *) CapBuffer;
   memcpy (&CapsuleHeader->CapsuleGuid, &mCapDataInfo.CapGuid, sizeof (EFI_GUID));
   CapsuleHeader->HeaderSize       = mCapDataInfo.HeaderSize;
   CapsuleHeader->Flags            = mCapDataInfo.Flags;
-  CapsuleHeader->CapsuleImageSize = CapSize;
+  CapsuleHeader->CapsuleImageSize = (UINT32) CapSize;
 
-  Index    = 0;
-  FileSize = 0;
-  CapSize  = CapsuleHeader->HeaderSize;
-  while (mCapDataInfo.CapFiles [Index][0] != '\0') {
-    fpin = fopen (mCapDataInfo.CapFiles[Index], "rb");
-    if (fpin == NULL) {
-      Error (NULL, 0, 0001, "Error opening file", mCapDataInfo.CapFiles[Index]);
-      free (CapBuffer);
-      return EFI_ABORTED;
-    }
-    FileSize = _filelength (fileno (fpin));
-    fread (CapBuffer + CapSize, 1, FileSize, fpin);
-    fclose (fpin);
-    Index ++;
-    CapSize += FileSize;
-  }
-  
   //
-  // write capsule data into the output file
+  // write capsule header and then each capsule body file into the output file
   //
   fpout = fopen (CapFileName, "wb");
   if (fpout == NULL) {
     Error (NULL, 0, 0001, "Error opening file", CapFileName);
     free (CapBuffer);
+    free (FileSize);
     return EFI_ABORTED;
   }
 
-  fwrite (CapBuffer, 1, CapSize, fpout);
-  fclose (fpout);
-  
+  Status = EFI_SUCCESS;
+  if (fwrite (CapBuffer, 1, mCapDataInfo.HeaderSize, fpout) != mCapDataInfo.HeaderSize) {
+    Error (NULL, 0, 0002, "Error writing file", CapFileName);
+    Status = EFI_ABORTED;
+  }
+  free (CapBuffer);
+
+  for (Index = 0; Index < mCapDataInfo.CapFileNumber && !EFI_ERROR (Status); Index ++) {
+    Status = CopyCapsuleFile (fpout, CapFileName, mCapDataInfo.CapFiles[Index], FileSize[Index]);
+  }
+  free (FileSize);
+
+  if (fclose (fpout) != 0 && !EFI_ERROR (Status)) {
+    Error (NULL, 0, 0002, "Error writing file", CapFileName);
+    Status = EFI_ABORTED;
+  }
+  if (EFI_ERROR (Status)) {
+    remove (CapFileName);
+    return Status;
+  }
+
   VerboseMsg ("The size of the generated capsule image is %u bytes", (unsigned) CapSize);
 
   return EFI_SUCCESS;
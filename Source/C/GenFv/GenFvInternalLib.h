@@ -39,6 +39,7 @@ Abstract:
 #include "CommonLib.h"
 #include "ParseInf.h"
 #include "EfiUtilityMsgs.h"
+#include "Sha256.h"
 
 //
 // Different file separater for Linux and Windows
@@ -46,21 +47,17 @@ Abstract:
 #define FILE_SEP_CHAR '/'
 
 //
-// The maximum number of Pad file guid entries.
+// Block map, file list and address tables are allocated on demand and
+// grow by doubling, starting from this number of entries.
 //
-#define MAX_NUMBER_OF_PAD_FILE_GUIDS    1024
+#define FV_INFO_INITIAL_ENTRIES         16
 
 //
-// The maximum number of block map entries supported by the library
+// Size of one chunk of the pool that holds FV and capsule file names.
 //
-#define MAX_NUMBER_OF_FV_BLOCKS         100
-
-//
-// The maximum number of files in the FV supported by the library
-//
-#define MAX_NUMBER_OF_FILES_IN_FV       1000
-#define MAX_NUMBER_OF_FILES_IN_CAP      1000
+#define FV_INFO_NAME_POOL_SIZE          0x4000
 #define EFI_FFS_FILE_HEADER_ALIGNMENT   8
+#define EFI_FFS_FILE_HEADER_ALIGNMENT_SHIFT 3
 //
 // INF file strings
 //
@@ -87,6 +84,7 @@ Abstract:
 #define EFI_FV_TOTAL_SIZE_STRING    "EFI_FV_TOTAL_SIZE"
 #define EFI_FV_TAKEN_SIZE_STRING    "EFI_FV_TAKEN_SIZE"
 #define EFI_FV_SPACE_SIZE_STRING    "EFI_FV_SPACE_SIZE"
+#define EFI_FV_PAD_SAVED_SIZE_STRING "EFI_FV_PAD_SAVED_SIZE"
 
 //
 // Attributes section
@@ -215,7 +213,96 @@ typedef struct {
 } COMPONENT_INFO;
 
 //
-// FV and capsule information holder
+// Chunk of a file name pool. Names are packed one after another in the
+// bytes that follow the header.
+//
+typedef struct _NAME_POOL {
+  struct _NAME_POOL       *Next;
+  UINTN                   Size;
+  UINTN                   Used;
+} NAME_POOL;
+
+//
+// One file of the layout recorded next to a FV image in incremental mode.
+// InputHash and OutputHash are the SHA-256 of the FFS file as read and as
+// placed and rebased in the FV. MapKey identifies the PE map files of its
+// images by name, size and modification time. MapOffset and MapLength
+// locate its lines in the FV map file. Offset is FV_LAYOUT_NO_OFFSET for a
+// file that was not placed as a FFS file.
+//
+#define FV_LAYOUT_NO_OFFSET       0xFFFFFFFF
+#define FV_LAYOUT_VERSION         2
+#define FV_LAYOUT_FILE_EXTENSION  ".layout"
+
+//
+// Granularity of the writes that update a FV image in place.
+//
+#define FV_PATCH_BLOCK_SIZE       0x1000
+
+typedef struct {
+  CHAR8                   *FileName;
+  UINT32                  Offset;
+  UINT32                  Size;
+  UINT8                   InputHash[SHA256_DIGEST_SIZE];
+  UINT8                   OutputHash[SHA256_DIGEST_SIZE];
+  UINT8                   MapKey[SHA256_DIGEST_SIZE];
+  UINT32                  MapOffset;
+  UINT32                  MapLength;
+} FV_LAYOUT_ENTRY;
+
+//
+// Layout of the previous FV image, with the FV and map file it describes.
+//
+typedef struct {
+  EFI_PHYSICAL_ADDRESS    BaseAddress;
+  INT8                    ForceRebase;
+  EFI_FVB_ATTRIBUTES_2    FvAttributes;
+  BOOLEAN                 Arm;
+  UINT8                   MapHash[SHA256_DIGEST_SIZE];
+  FV_LAYOUT_ENTRY         *Entries;
+  UINTN                   EntryNumber;
+  UINT8                   *FvImage;
+  UINTN                   FvImageSize;
+  UINT8                   *MapImage;
+  UINTN                   MapImageSize;
+} FV_LAYOUT;
+
+//
+// FFS file read once by LoadFvFiles. The header fields needed to size and
+// lay out the FV are cached with the file data, Alignment uses the same
+// encoding as ReadFfsAlignment. FvFile is the copy placed in the FV image
+// by AddFile, it is left NULL for files that are never rebased. In
+// incremental mode InputHash and MapKey are the keys of FV_LAYOUT_ENTRY,
+// Previous is the matching file of the previous layout, and MapOffset and
+// MapLength locate the lines of the file in the new map.
+// RelocCache holds the relocation indexes of the images of the file when
+// the file cache is enabled, it is NULL otherwise.
+//
+typedef struct _FV_RELOC_CACHE  FV_RELOC_CACHE;
+
+typedef struct {
+  UINT8                   *Buffer;
+  UINTN                   Size;
+  UINT32                  Alignment;
+  BOOLEAN                 IsVtf;
+  EFI_FFS_FILE_HEADER     *FvFile;
+  UINT8                   InputHash[SHA256_DIGEST_SIZE];
+  UINT8                   MapKey[SHA256_DIGEST_SIZE];
+  FV_LAYOUT_ENTRY         *Previous;
+  UINT32                  MapOffset;
+  UINT32                  MapLength;
+  FV_RELOC_CACHE          *RelocCache;
+} FV_FILE_IMAGE;
+
+//
+// FV and capsule information holder. FvBlocks is terminated by an entry
+// with zero Length; FvFiles and CapFiles hold FvFileNumber and CapFileNumber
+// names taken from NamePool.
+//
+// FV_INFO also holds the state of the generation of its FV, so several FVs
+// can be generated at the same time: the GUIDs of the files already added,
+// the largest file alignment, whether an ARM image was found, the base
+// addresses of the child FVs and the total and used size of the FV.
 //
 typedef struct {
   BOOLEAN                 BaseAddressSet;
@@ -228,11 +315,29 @@ typedef struct {
   UINTN                   Size;
   EFI_FVB_ATTRIBUTES_2    FvAttributes;
   CHAR8                   FvName[_MAX_PATH];
-  EFI_FV_BLOCK_MAP_ENTRY  FvBlocks[MAX_NUMBER_OF_FV_BLOCKS];
-  CHAR8                   FvFiles[MAX_NUMBER_OF_FILES_IN_FV][_MAX_PATH];
-  UINT32                  SizeofFvFiles[MAX_NUMBER_OF_FILES_IN_FV];
+  EFI_FV_BLOCK_MAP_ENTRY  *FvBlocks;
+  UINTN                   FvBlockMaxNumber;
+  CHAR8                   **FvFiles;
+  UINT32                  *SizeofFvFiles;
+  UINTN                   FvFileNumber;
+  UINTN                   FvFileMaxNumber;
+  NAME_POOL               *NamePool;
+  FV_FILE_IMAGE           *FvFileImages;
   BOOLEAN                 IsPiFvImage;
   INT8                    ForceRebase;
+  UINT32                  RebaseThreads;
+  BOOLEAN                 Incremental;
+  FV_LAYOUT               *Layout;
+  BOOLEAN                 PackFiles;
+  UINT32                  PadSizeSaved;
+  EFI_GUID                *FileGuids;
+  UINT32                  MaxFfsAlignment;
+  BOOLEAN                 Arm;
+  EFI_PHYSICAL_ADDRESS    *ChildFvBaseAddress;
+  UINTN                   ChildFvBaseAddressNumber;
+  UINTN                   ChildFvBaseAddressMaxNumber;
+  UINT32                  TotalSize;
+  UINT32                  TakenSize;
 } FV_INFO;
 
 typedef struct {
@@ -240,7 +345,10 @@ typedef struct {
   UINT32                  HeaderSize;
   UINT32                  Flags;
   CHAR8                   CapName[_MAX_PATH];
-  CHAR8                   CapFiles[MAX_NUMBER_OF_FILES_IN_CAP][_MAX_PATH];
+  CHAR8                   **CapFiles;
+  UINTN                   CapFileNumber;
+  UINTN                   CapFileMaxNumber;
+  NAME_POOL               *NamePool;
 } CAP_INFO;
 
 #pragma pack(1)
@@ -259,11 +367,7 @@ typedef struct {
 extern FV_INFO    mFvDataInfo;
 extern CAP_INFO   mCapDataInfo;
 extern EFI_GUID   mEfiFirmwareFileSystem2Guid;
-extern UINT32     mFvTotalSize;
-extern UINT32     mFvTakenSize;
 
-extern EFI_PHYSICAL_ADDRESS mFvBaseAddress[];
-extern UINT32               mFvBaseAddressNumber;
 //
 // Local function prototypes
 //
@@ -335,6 +439,55 @@ ParseCapInf (
   OUT CAP_INFO     *CapInfo
   );
 
+EFI_STATUS
+ReserveFvBlocks (
+  IN OUT FV_INFO   *FvInfo,
+  IN     UINTN     Number
+  );
+
+EFI_STATUS
+AddFvFile (
+  IN OUT FV_INFO   *FvInfo,
+  IN     CHAR8     *FileName,
+  IN     UINT32    SizeofFile
+  );
+
+EFI_STATUS
+AddCapFile (
+  IN OUT CAP_INFO  *CapInfo,
+  IN     CHAR8     *FileName
+  );
+
+EFI_STATUS
+LoadFvFiles (
+  IN OUT FV_INFO   *FvInfo
+  );
+
+VOID
+FreeFvInfo (
+  IN OUT FV_INFO   *FvInfo
+  );
+
+EFI_STATUS
+EnableFvFileCache (
+  VOID
+  );
+
+VOID
+RemoveFvFileCacheEntry (
+  IN CHAR8         *FileName
+  );
+
+VOID
+FreeFvFileCache (
+  VOID
+  );
+
+VOID
+FreeCapInfo (
+  IN OUT CAP_INFO  *CapInfo
+  );
+
 EFI_STATUS
 FindApResetVectorPosition (
   IN  MEMORY_FILE  *FvImage,
@@ -346,12 +499,26 @@ CalculateFvSize (
   FV_INFO *FvInfoPtr
   );
 
+EFI_STATUS
+PackFvFiles (
+  IN OUT FV_INFO   *FvInfo
+  );
+
 EFI_STATUS
 FfsRebase ( 
   IN OUT  FV_INFO               *FvInfo, 
   IN      CHAR8                 *FileName,           
   IN OUT  EFI_FFS_FILE_HEADER   *FfsFile,
   IN      UINTN                 XipOffset,
+  IN      FILE                  *FvMapFile,
+  IN      FV_RELOC_CACHE        *RelocCache,
+  OUT     BOOLEAN               *ArmImage
+  );
+
+EFI_STATUS
+RebaseFvFiles (
+  IN      MEMORY_FILE           *FvImage,
+  IN OUT  FV_INFO               *FvInfo,
   IN      FILE                  *FvMapFile
   );
 
@@ -389,6 +556,7 @@ Returns:
 
 EFI_STATUS
 GenerateFvImage (
+  IN OUT FV_INFO          *FvInfo,
   IN CHAR8                *InfFileImage,
   IN UINTN                InfFileSize,
   IN CHAR8                *FvFileName,  
@@ -399,10 +567,12 @@ GenerateFvImage (
 Routine Description:
 
   This is the main function which will be called from application to 
-  generate Firmware Image conforms to PI spec.
+  generate Firmware Image conforms to PI spec. Several FVs can be generated
+  at the same time on different threads, each with its own FvInfo.
 
 Arguments:
 
+  FvInfo         The options of the FV, receives the state of its generation.
   InfFileImage   Buffer containing the INF file contents.
   InfFileSize    Size of the contents of the InfFileImage buffer.
   FvFileName     Requested name for the FV file.
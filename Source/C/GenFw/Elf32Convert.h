@@ -17,7 +17,7 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 
 BOOLEAN
 InitializeElf32 (
-  UINT8               *FileBuffer,
+  ELF_CONVERT_CONTEXT *Context,
   ELF_FUNCTION_TABLE  *ElfFunctions
   );
 
@@ -37,37 +37,38 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 STATIC
 VOID
 ScanSections64 (
-  VOID
+  ELF_CONVERT_CONTEXT   *Context
   );
 
 STATIC
 BOOLEAN
 WriteSections64 (
+  ELF_CONVERT_CONTEXT   *Context,
   SECTION_FILTER_TYPES  FilterType
   );
 
 STATIC
 VOID
 WriteRelocations64 (
-  VOID
+  ELF_CONVERT_CONTEXT   *Context
   );
 
 STATIC
 VOID
 WriteDebug64 (
-  VOID
+  ELF_CONVERT_CONTEXT   *Context
   );
 
 STATIC
 VOID
 SetImageSize64 (
-  VOID
+  ELF_CONVERT_CONTEXT   *Context
   );
 
 STATIC
 VOID
 CleanUp64 (
-  VOID
+  ELF_CONVERT_CONTEXT   *Context
   );
 
 //
@@ -84,13 +85,6 @@ typedef Elf64_Dyn Elf_Dyn;
 #define ELF_R_TYPE(r) ELF64_R_TYPE(r)
 #define ELF_R_SYM(r) ELF64_R_SYM(r)
 
-//
-// Well known ELF structures.
-//
-STATIC Elf_Ehdr *mEhdr;
-STATIC Elf_Shdr *mShdrBase;
-STATIC Elf_Phdr *mPhdrBase;
-
 //
 // Coff information
 //
@@ -101,73 +95,54 @@ STATIC const UINT32 mCoffAlignment = 0x20;
 //
 STATIC const UINT16 mCoffNbrSections = 5;
 
-//
-// ELF sections to offset in Coff file.
-//
-STATIC UINT32 *mCoffSectionsOffset = NULL;
-
-//
-// Offsets in COFF file
-//
-STATIC UINT32 mNtHdrOffset;
-STATIC UINT32 mTextOffset;
-STATIC UINT32 mDataOffset;
-STATIC UINT32 mHiiRsrcOffset;
-STATIC UINT32 mRelocOffset;
-
 //
 // Initialization Function
 //
 BOOLEAN
 InitializeElf64 (
-  UINT8               *FileBuffer,
+  ELF_CONVERT_CONTEXT *Context,
   ELF_FUNCTION_TABLE  *ElfFunctions
   )
 {
+  Elf_Ehdr            *Ehdr;
+
   //
   // Initialize data pointer and structures.
   //
   VerboseMsg ("Set EHDR");
-  mEhdr = (Elf_Ehdr*) FileBuffer;
+  Ehdr = (Elf_Ehdr*) Context->ElfImage;
 
   //
   // Check the ELF64 specific header information.
   //
   VerboseMsg ("Check ELF64 Header Information");
-  if (mEhdr->e_ident[EI_CLASS] != ELFCLASS64) {
+  if (Ehdr->e_ident[EI_CLASS] != ELFCLASS64) {
     Error (NULL, 0, 3000, "Unsupported", "ELF EI_DATA not ELFCLASS64");
     return FALSE;
   }
-  if (mEhdr->e_ident[EI_DATA] != ELFDATA2LSB) {
+  if (Ehdr->e_ident[EI_DATA] != ELFDATA2LSB) {
     Error (NULL, 0, 3000, "Unsupported", "ELF EI_DATA not ELFDATA2LSB");
     return FALSE;
   }
-  if ((mEhdr->e_type != ET_EXEC) && (mEhdr->e_type != ET_DYN)) {
+  if ((Ehdr->e_type != ET_EXEC) && (Ehdr->e_type != ET_DYN)) {
     Error (NULL, 0, 3000, "Unsupported", "ELF e_type not ET_EXEC or ET_DYN");
     return FALSE;
   }
-  if (!((mEhdr->e_machine == EM_X86_64))) {
+  if (!((Ehdr->e_machine == EM_X86_64))) {
     Error (NULL, 0, 3000, "Unsupported", "ELF e_machine not EM_X86_64");
     return FALSE;
   }
-  if (mEhdr->e_version != EV_CURRENT) {
-    Error (NULL, 0, 3000, "Unsupported", "ELF e_version (%u) not EV_CURRENT (%d)", (unsigned) mEhdr->e_version, EV_CURRENT);
+  if (Ehdr->e_version != EV_CURRENT) {
+    Error (NULL, 0, 3000, "Unsupported", "ELF e_version (%u) not EV_CURRENT (%d)", (unsigned) Ehdr->e_version, EV_CURRENT);
     return FALSE;
   }
 
-  //
-  // Update section header pointers
-  //
-  VerboseMsg ("Update Header Pointers");
-  mShdrBase  = (Elf_Shdr *)((UINT8 *)mEhdr + mEhdr->e_shoff);
-  mPhdrBase = (Elf_Phdr *)((UINT8 *)mEhdr + mEhdr->e_phoff);
-
   //
   // Create COFF Section offset buffer and zero.
   //
   VerboseMsg ("Create COFF Section Offset Buffer");
-  mCoffSectionsOffset = (UINT32 *)malloc(mEhdr->e_shnum * sizeof (UINT32));
-  memset(mCoffSectionsOffset, 0, mEhdr->e_shnum * sizeof(UINT32));
+  Context->CoffSectionsOffset = (UINT32 *)malloc(Ehdr->e_shnum * sizeof (UINT32));
+  memset(Context->CoffSectionsOffset, 0, Ehdr->e_shnum * sizeof(UINT32));
 
   //
   // Fill in function pointers.
@@ -190,12 +165,17 @@ InitializeElf64 (
 STATIC
 Elf_Shdr*
 GetShdrByIndex (
-  UINT32 Num
+  ELF_CONVERT_CONTEXT   *Context,
+  UINT32                Num
   )
 {
-  if (Num >= mEhdr->e_shnum)
+  Elf_Ehdr *Ehdr;
+
+  Ehdr = (Elf_Ehdr *) Context->ElfImage;
+
+  if (Num >= Ehdr->e_shnum)
     return NULL;
-  return (Elf_Shdr*)((UINT8*)mShdrBase + Num * mEhdr->e_shentsize);
+  return (Elf_Shdr*)((UINT8*)Ehdr + Ehdr->e_shoff + Num * Ehdr->e_shentsize);
 }
 
 STATIC
@@ -213,7 +193,8 @@ CoffAlign (
 STATIC
 BOOLEAN
 IsTextShdr (
-  Elf_Shdr *Shdr
+  ELF_CONVERT_CONTEXT   *Context,
+  Elf_Shdr              *Shdr
   )
 {
   return (BOOLEAN) ((Shdr->sh_flags & (SHF_WRITE | SHF_ALLOC)) == SHF_ALLOC);
@@ -222,26 +203,93 @@ IsTextShdr (
 STATIC
 BOOLEAN
 IsHiiRsrcShdr (
-  Elf_Shdr *Shdr
+  ELF_CONVERT_CONTEXT   *Context,
+  Elf_Shdr              *Shdr
   )
 {
-  Elf_Shdr *Namedr = GetShdrByIndex(mEhdr->e_shstrndx);
+  Elf_Ehdr *Ehdr;
+  Elf_Shdr *Namedr;
 
-  return (BOOLEAN) (strcmp((CHAR8*)mEhdr + Namedr->sh_offset + Shdr->sh_name, ELF_HII_SECTION_NAME) == 0);
+  Ehdr = (Elf_Ehdr *) Context->ElfImage;
+  Namedr = GetShdrByIndex(Context, Ehdr->e_shstrndx);
+
+  return (BOOLEAN) (strcmp((CHAR8*)Ehdr + Namedr->sh_offset + Shdr->sh_name, ELF_HII_SECTION_NAME) == 0);
 }
 
 STATIC
 BOOLEAN
 IsDataShdr (
-  Elf_Shdr *Shdr
+  ELF_CONVERT_CONTEXT   *Context,
+  Elf_Shdr              *Shdr
   )
 {
-  if (IsHiiRsrcShdr(Shdr)) {
+  if (IsHiiRsrcShdr(Context, Shdr)) {
     return FALSE;
   }
   return (BOOLEAN) (Shdr->sh_flags & (SHF_WRITE | SHF_ALLOC)) == (SHF_ALLOC | SHF_WRITE);
 }
 
+//
+// Translate the ELF relocations of the text and data sections into Coff
+// fixups. Only needs the section placement computed by ScanSections64.
+//
+STATIC
+VOID
+ScanRelocations64 (
+  ELF_CONVERT_CONTEXT   *Context
+  )
+{
+  Elf_Ehdr                         *Ehdr;
+  UINT32                           Index;
+
+  Ehdr = (Elf_Ehdr *) Context->ElfImage;
+
+  for (Index = 0; Index < Ehdr->e_shnum; Index++) {
+    Elf_Shdr *RelShdr = GetShdrByIndex(Context, Index);
+    if ((RelShdr->sh_type == SHT_REL) || (RelShdr->sh_type == SHT_RELA)) {
+      Elf_Shdr *SecShdr = GetShdrByIndex (Context, RelShdr->sh_info);
+      if (IsTextShdr(Context, SecShdr) || IsDataShdr(Context, SecShdr)) {
+        UINT64 RelIdx;
+
+        for (RelIdx = 0; RelIdx < RelShdr->sh_size; RelIdx += RelShdr->sh_entsize) {
+          Elf_Rela *Rel = (Elf_Rela *)((UINT8*)Ehdr + RelShdr->sh_offset + RelIdx);
+
+          if (Ehdr->e_machine == EM_X86_64) {
+            switch (ELF_R_TYPE(Rel->r_info)) {
+            case R_X86_64_NONE:
+            case R_X86_64_PC32:
+              break;
+            case R_X86_64_64:
+              VerboseMsg ("EFI_IMAGE_REL_BASED_DIR64 Offset: 0x%08X", 
+                Context->CoffSectionsOffset[RelShdr->sh_info] + (Rel->r_offset - SecShdr->sh_addr));
+              CoffAddFixup(
+                Context,
+                (UINT32) ((UINT64) Context->CoffSectionsOffset[RelShdr->sh_info]
+                + (Rel->r_offset - SecShdr->sh_addr)),
+                EFI_IMAGE_REL_BASED_DIR64);
+              break;
+            case R_X86_64_32S:
+            case R_X86_64_32:
+              VerboseMsg ("EFI_IMAGE_REL_BASED_HIGHLOW Offset: 0x%08X", 
+                Context->CoffSectionsOffset[RelShdr->sh_info] + (Rel->r_offset - SecShdr->sh_addr));
+              CoffAddFixup(
+                Context,
+                (UINT32) ((UINT64) Context->CoffSectionsOffset[RelShdr->sh_info]
+                + (Rel->r_offset - SecShdr->sh_addr)),
+                EFI_IMAGE_REL_BASED_HIGHLOW);
+              break;
+            default:
+              Error (NULL, 0, 3000, "Invalid", "%s unsupported ELF EM_X86_64 relocation 0x%x.", Context->InImageName, (unsigned) ELF_R_TYPE(Rel->r_info));
+            }
+          } else {
+            Error (NULL, 0, 3000, "Not Supported", "This tool does not support relocations for ELF with e_machine %u (processor type).", (unsigned) Ehdr->e_machine);
+          }
+        }
+      }
+    }
+  }
+}
+
 //
 // Elf functions interface implementation
 //
@@ -249,52 +297,56 @@ IsDataShdr (
 STATIC
 VOID
 ScanSections64 (
-  VOID
+  ELF_CONVERT_CONTEXT   *Context
   )
 {
+  Elf_Ehdr                        *Ehdr;
   UINT32                          i;
   EFI_IMAGE_DOS_HEADER            *DosHdr;
   EFI_IMAGE_OPTIONAL_HEADER_UNION *NtHdr;
   UINT32                          CoffEntry;
   UINT32                          SectionCount;
+  UINT32                          DebugSize;
+
+  Ehdr = (Elf_Ehdr *) Context->ElfImage;
 
   CoffEntry = 0;
-  mCoffOffset = 0;
+  Context->CoffOffset = 0;
 
   //
   // Coff file start with a DOS header.
   //
-  mCoffOffset = sizeof(EFI_IMAGE_DOS_HEADER) + 0x40;
-  mNtHdrOffset = mCoffOffset;
-  switch (mEhdr->e_machine) {
+  Context->CoffOffset = sizeof(EFI_IMAGE_DOS_HEADER) + 0x40;
+  Context->NtHdrOffset = Context->CoffOffset;
+  switch (Ehdr->e_machine) {
   case EM_X86_64:
   case EM_IA_64:
-    mCoffOffset += sizeof (EFI_IMAGE_NT_HEADERS64);
+    Context->CoffOffset += sizeof (EFI_IMAGE_NT_HEADERS64);
   break;
   default:
-    VerboseMsg ("%s unknown e_machine type. Assume X64", (UINTN)mEhdr->e_machine);
-    mCoffOffset += sizeof (EFI_IMAGE_NT_HEADERS64);
+    VerboseMsg ("%s unknown e_machine type. Assume X64", (UINTN)Ehdr->e_machine);
+    Context->CoffOffset += sizeof (EFI_IMAGE_NT_HEADERS64);
   break;
   }
 
-  mTableOffset = mCoffOffset;
-  mCoffOffset += mCoffNbrSections * sizeof(EFI_IMAGE_SECTION_HEADER);
+  Context->TableOffset = Context->CoffOffset;
+  Context->CoffOffset += mCoffNbrSections * sizeof(EFI_IMAGE_SECTION_HEADER);
 
   //
   // First text sections.
   //
-  mCoffOffset = CoffAlign(mCoffOffset);
-  mTextOffset = mCoffOffset;
+  Context->CoffOffset = CoffAlign(Context->CoffOffset);
+  Context->TextOffset = Context->CoffOffset;
   SectionCount = 0;
-  for (i = 0; i < mEhdr->e_shnum; i++) {
-    Elf_Shdr *shdr = GetShdrByIndex(i);
-    if (IsTextShdr(shdr)) {
+  for (i = 0; i < Ehdr->e_shnum; i++) {
+    Elf_Shdr *shdr = GetShdrByIndex(Context, i);
+    if (IsTextShdr(Context, shdr)) {
       if ((shdr->sh_addralign != 0) && (shdr->sh_addralign != 1)) {
         // the alignment field is valid
         if ((shdr->sh_addr & (shdr->sh_addralign - 1)) == 0) {
           // if the section address is aligned we must align PE/COFF
-          mCoffOffset = (UINT32) ((mCoffOffset + shdr->sh_addralign - 1) & ~(shdr->sh_addralign - 1));
-        } else if ((shdr->sh_addr % shdr->sh_addralign) != (mCoffOffset % shdr->sh_addralign)) {
+          Context->CoffOffset = (UINT32) ((Context->CoffOffset + shdr->sh_addralign - 1) & ~(shdr->sh_addralign - 1));
+        } else if ((shdr->sh_addr % shdr->sh_addralign) != (Context->CoffOffset % shdr->sh_addralign)) {
           // ARM RVCT tools have behavior outside of the ELF specification to try
           // and make images smaller.  If sh_addr is not aligned to sh_addralign
           // then the section needs to preserve sh_addr MOD sh_addralign.
@@ -304,38 +356,38 @@ ScanSections64 (
       }
 
       /* Relocate entry.  */
-      if ((mEhdr->e_entry >= shdr->sh_addr) &&
-          (mEhdr->e_entry < shdr->sh_addr + shdr->sh_size)) {
-        CoffEntry = (UINT32) (mCoffOffset + mEhdr->e_entry - shdr->sh_addr);
+      if ((Ehdr->e_entry >= shdr->sh_addr) &&
+          (Ehdr->e_entry < shdr->sh_addr + shdr->sh_size)) {
+        CoffEntry = (UINT32) (Context->CoffOffset + Ehdr->e_entry - shdr->sh_addr);
       }
-      mCoffSectionsOffset[i] = mCoffOffset;
-      mCoffOffset += (UINT32) shdr->sh_size;
+      Context->CoffSectionsOffset[i] = Context->CoffOffset;
+      Context->CoffOffset += (UINT32) shdr->sh_size;
       SectionCount ++;
     }
   }
 
-  if (mEhdr->e_machine != EM_ARM) {
-    mCoffOffset = CoffAlign(mCoffOffset);
+  if (Ehdr->e_machine != EM_ARM) {
+    Context->CoffOffset = CoffAlign(Context->CoffOffset);
   }
 
-  if (SectionCount > 1 && mOutImageType == FW_EFI_IMAGE) {
-    Warning (NULL, 0, 0, NULL, "Mulitple sections in %s are merged into 1 text section. Source level debug might not work correctly.", mInImageName);
+  if (SectionCount > 1 && Context->OutImageType == FW_EFI_IMAGE) {
+    Warning (NULL, 0, 0, NULL, "Mulitple sections in %s are merged into 1 text section. Source level debug might not work correctly.", Context->InImageName);
   }
 
   //
   //  Then data sections.
   //
-  mDataOffset = mCoffOffset;
+  Context->DataOffset = Context->CoffOffset;
   SectionCount = 0;
-  for (i = 0; i < mEhdr->e_shnum; i++) {
-    Elf_Shdr *shdr = GetShdrByIndex(i);
-    if (IsDataShdr(shdr)) {
+  for (i = 0; i < Ehdr->e_shnum; i++) {
+    Elf_Shdr *shdr = GetShdrByIndex(Context, i);
+    if (IsDataShdr(Context, shdr)) {
       if ((shdr->sh_addralign != 0) && (shdr->sh_addralign != 1)) {
         // the alignment field is valid
         if ((shdr->sh_addr & (shdr->sh_addralign - 1)) == 0) {
           // if the section address is aligned we must align PE/COFF
-          mCoffOffset = (UINT32) ((mCoffOffset + shdr->sh_addralign - 1) & ~(shdr->sh_addralign - 1));
-        } else if ((shdr->sh_addr % shdr->sh_addralign) != (mCoffOffset % shdr->sh_addralign)) {
+          Context->CoffOffset = (UINT32) ((Context->CoffOffset + shdr->sh_addralign - 1) & ~(shdr->sh_addralign - 1));
+        } else if ((shdr->sh_addr % shdr->sh_addralign) != (Context->CoffOffset % shdr->sh_addralign)) {
           // ARM RVCT tools have behavior outside of the ELF specification to try
           // and make images smaller.  If sh_addr is not aligned to sh_addralign
           // then the section needs to preserve sh_addr MOD sh_addralign.
@@ -343,30 +395,30 @@ ScanSections64 (
           Error (NULL, 0, 3000, "Invalid", "Unsupported section alignment.");
         }
       }
-      mCoffSectionsOffset[i] = mCoffOffset;
-      mCoffOffset += (UINT32) shdr->sh_size;
+      Context->CoffSectionsOffset[i] = Context->CoffOffset;
+      Context->CoffOffset += (UINT32) shdr->sh_size;
       SectionCount ++;
     }
   }
-  mCoffOffset = CoffAlign(mCoffOffset);
+  Context->CoffOffset = CoffAlign(Context->CoffOffset);
 
-  if (SectionCount > 1 && mOutImageType == FW_EFI_IMAGE) {
-    Warning (NULL, 0, 0, NULL, "Mulitple sections in %s are merged into 1 data section. Source level debug might not work correctly.", mInImageName);
+  if (SectionCount > 1 && Context->OutImageType == FW_EFI_IMAGE) {
+    Warning (NULL, 0, 0, NULL, "Mulitple sections in %s are merged into 1 data section. Source level debug might not work correctly.", Context->InImageName);
   }
 
   //
   //  The HII resource sections.
   //
-  mHiiRsrcOffset = mCoffOffset;
-  for (i = 0; i < mEhdr->e_shnum; i++) {
-    Elf_Shdr *shdr = GetShdrByIndex(i);
-    if (IsHiiRsrcShdr(shdr)) {
+  Context->HiiRsrcOffset = Context->CoffOffset;
+  for (i = 0; i < Ehdr->e_shnum; i++) {
+    Elf_Shdr *shdr = GetShdrByIndex(Context, i);
+    if (IsHiiRsrcShdr(Context, shdr)) {
       if ((shdr->sh_addralign != 0) && (shdr->sh_addralign != 1)) {
         // the alignment field is valid
         if ((shdr->sh_addr & (shdr->sh_addralign - 1)) == 0) {
           // if the section address is aligned we must align PE/COFF
-          mCoffOffset = (UINT32) ((mCoffOffset + shdr->sh_addralign - 1) & ~(shdr->sh_addralign - 1));
-        } else if ((shdr->sh_addr % shdr->sh_addralign) != (mCoffOffset % shdr->sh_addralign)) {
+          Context->CoffOffset = (UINT32) ((Context->CoffOffset + shdr->sh_addralign - 1) & ~(shdr->sh_addralign - 1));
+        } else if ((shdr->sh_addr % shdr->sh_addralign) != (Context->CoffOffset % shdr->sh_addralign)) {
           // ARM RVCT tools have behavior outside of the ELF specification to try
           // and make images smaller.  If sh_addr is not aligned to sh_addralign
           // then the section needs to preserve sh_addr MOD sh_addralign.
@@ -375,35 +427,40 @@ ScanSections64 (
         }
       }
       if (shdr->sh_size != 0) {
-        mCoffSectionsOffset[i] = mCoffOffset;
-        mCoffOffset += (UINT32) shdr->sh_size;
-        mCoffOffset = CoffAlign(mCoffOffset);
-        SetHiiResourceHeader ((UINT8*) mEhdr + shdr->sh_offset, mHiiRsrcOffset);
+        Context->CoffSectionsOffset[i] = Context->CoffOffset;
+        Context->CoffOffset += (UINT32) shdr->sh_size;
+        Context->CoffOffset = CoffAlign(Context->CoffOffset);
       }
       break;
     }
   }
 
-  mRelocOffset = mCoffOffset;
+  Context->RelocOffset = Context->CoffOffset;
 
   //
-  // Allocate base Coff file.  Will be expanded later for relocations.
+  // Translate the relocations now that the sections are placed, so that the
+  // Coff file is allocated once with room for .reloc and .debug.
   //
-  mCoffFile = (UINT8 *)malloc(mCoffOffset);
-  memset(mCoffFile, 0, mCoffOffset);
+  ScanRelocations64 (Context);
+  DebugSize = CoffAlign (sizeof (EFI_IMAGE_DEBUG_DIRECTORY_ENTRY)
+    + sizeof (EFI_IMAGE_DEBUG_CODEVIEW_NB10_ENTRY)
+    + (UINT32) strlen (Context->InImageName) + 1);
+  if (!CoffReserve (Context, Context->RelocOffset + CoffSortFixups (Context, mCoffAlignment) + DebugSize)) {
+    return;
+  }
 
   //
   // Fill headers.
   //
-  DosHdr = (EFI_IMAGE_DOS_HEADER *)mCoffFile;
+  DosHdr = (EFI_IMAGE_DOS_HEADER *)Context->CoffFile;
   DosHdr->e_magic = EFI_IMAGE_DOS_SIGNATURE;
-  DosHdr->e_lfanew = mNtHdrOffset;
+  DosHdr->e_lfanew = Context->NtHdrOffset;
 
-  NtHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION*)(mCoffFile + mNtHdrOffset);
+  NtHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION*)(Context->CoffFile + Context->NtHdrOffset);
 
   NtHdr->Pe32Plus.Signature = EFI_IMAGE_NT_SIGNATURE;
 
-  switch (mEhdr->e_machine) {
+  switch (Ehdr->e_machine) {
   case EM_X86_64:
     NtHdr->Pe32Plus.FileHeader.Machine = EFI_IMAGE_MACHINE_X64;
     NtHdr->Pe32Plus.OptionalHeader.Magic = EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC;
@@ -413,14 +470,14 @@ ScanSections64 (
     NtHdr->Pe32Plus.OptionalHeader.Magic = EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC;
     break;
   default:
-    VerboseMsg ("%s unknown e_machine type. Assume X64", (UINTN)mEhdr->e_machine);
+    VerboseMsg ("%s unknown e_machine type. Assume X64", (UINTN)Ehdr->e_machine);
     NtHdr->Pe32Plus.FileHeader.Machine = EFI_IMAGE_MACHINE_X64;
     NtHdr->Pe32Plus.OptionalHeader.Magic = EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC;
   }
 
   NtHdr->Pe32Plus.FileHeader.NumberOfSections = mCoffNbrSections;
   NtHdr->Pe32Plus.FileHeader.TimeDateStamp = (UINT32) time(NULL);
-  mImageTimeStamp = NtHdr->Pe32Plus.FileHeader.TimeDateStamp;
+  Context->ImageTimeStamp = NtHdr->Pe32Plus.FileHeader.TimeDateStamp;
   NtHdr->Pe32Plus.FileHeader.PointerToSymbolTable = 0;
   NtHdr->Pe32Plus.FileHeader.NumberOfSymbols = 0;
   NtHdr->Pe32Plus.FileHeader.SizeOfOptionalHeader = sizeof(NtHdr->Pe32Plus.OptionalHeader);
@@ -429,26 +486,26 @@ ScanSections64 (
     | EFI_IMAGE_FILE_LOCAL_SYMS_STRIPPED
     | EFI_IMAGE_FILE_LARGE_ADDRESS_AWARE;
 
-  NtHdr->Pe32Plus.OptionalHeader.SizeOfCode = mDataOffset - mTextOffset;
-  NtHdr->Pe32Plus.OptionalHeader.SizeOfInitializedData = mRelocOffset - mDataOffset;
+  NtHdr->Pe32Plus.OptionalHeader.SizeOfCode = Context->DataOffset - Context->TextOffset;
+  NtHdr->Pe32Plus.OptionalHeader.SizeOfInitializedData = Context->RelocOffset - Context->DataOffset;
   NtHdr->Pe32Plus.OptionalHeader.SizeOfUninitializedData = 0;
   NtHdr->Pe32Plus.OptionalHeader.AddressOfEntryPoint = CoffEntry;
 
-  NtHdr->Pe32Plus.OptionalHeader.BaseOfCode = mTextOffset;
+  NtHdr->Pe32Plus.OptionalHeader.BaseOfCode = Context->TextOffset;
 
   NtHdr->Pe32Plus.OptionalHeader.ImageBase = 0;
   NtHdr->Pe32Plus.OptionalHeader.SectionAlignment = mCoffAlignment;
   NtHdr->Pe32Plus.OptionalHeader.FileAlignment = mCoffAlignment;
   NtHdr->Pe32Plus.OptionalHeader.SizeOfImage = 0;
 
-  NtHdr->Pe32Plus.OptionalHeader.SizeOfHeaders = mTextOffset;
+  NtHdr->Pe32Plus.OptionalHeader.SizeOfHeaders = Context->TextOffset;
   NtHdr->Pe32Plus.OptionalHeader.NumberOfRvaAndSizes = EFI_IMAGE_NUMBER_OF_DIRECTORY_ENTRIES;
 
   //
   // Section headers.
   //
-  if ((mDataOffset - mTextOffset) > 0) {
-    CreateSectionHeader (".text", mTextOffset, mDataOffset - mTextOffset,
+  if ((Context->DataOffset - Context->TextOffset) > 0) {
+    CreateSectionHeader (Context, ".text", Context->TextOffset, Context->DataOffset - Context->TextOffset,
             EFI_IMAGE_SCN_CNT_CODE
             | EFI_IMAGE_SCN_MEM_EXECUTE
             | EFI_IMAGE_SCN_MEM_READ);
@@ -457,8 +514,8 @@ ScanSections64 (
     NtHdr->Pe32Plus.FileHeader.NumberOfSections--;
   }
 
-  if ((mHiiRsrcOffset - mDataOffset) > 0) {
-    CreateSectionHeader (".data", mDataOffset, mHiiRsrcOffset - mDataOffset,
+  if ((Context->HiiRsrcOffset - Context->DataOffset) > 0) {
+    CreateSectionHeader (Context, ".data", Context->DataOffset, Context->HiiRsrcOffset - Context->DataOffset,
             EFI_IMAGE_SCN_CNT_INITIALIZED_DATA
             | EFI_IMAGE_SCN_MEM_WRITE
             | EFI_IMAGE_SCN_MEM_READ);
@@ -467,13 +524,13 @@ ScanSections64 (
     NtHdr->Pe32Plus.FileHeader.NumberOfSections--;
   }
 
-  if ((mRelocOffset - mHiiRsrcOffset) > 0) {
-    CreateSectionHeader (".rsrc", mHiiRsrcOffset, mRelocOffset - mHiiRsrcOffset,
+  if ((Context->RelocOffset - Context->HiiRsrcOffset) > 0) {
+    CreateSectionHeader (Context, ".rsrc", Context->HiiRsrcOffset, Context->RelocOffset - Context->HiiRsrcOffset,
             EFI_IMAGE_SCN_CNT_INITIALIZED_DATA
             | EFI_IMAGE_SCN_MEM_READ);
 
-    NtHdr->Pe32Plus.OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_RESOURCE].Size = mRelocOffset - mHiiRsrcOffset;
-    NtHdr->Pe32Plus.OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_RESOURCE].VirtualAddress = mHiiRsrcOffset;
+    NtHdr->Pe32Plus.OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_RESOURCE].Size = Context->RelocOffset - Context->HiiRsrcOffset;
+    NtHdr->Pe32Plus.OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_RESOURCE].VirtualAddress = Context->HiiRsrcOffset;
   } else {
     // Don't make a section of size 0.
     NtHdr->Pe32Plus.FileHeader.NumberOfSections--;
@@ -484,13 +541,17 @@ ScanSections64 (
 STATIC
 BOOLEAN
 WriteSections64 (
+  ELF_CONVERT_CONTEXT   *Context,
   SECTION_FILTER_TYPES  FilterType
   )
 {
+  Elf_Ehdr    *Ehdr;
   UINT32      Idx;
   Elf_Shdr    *SecShdr;
   UINT32      SecOffset;
-  BOOLEAN     (*Filter)(Elf_Shdr *);
+
+  Ehdr = (Elf_Ehdr *) Context->ElfImage;
+  BOOLEAN     (*Filter)(ELF_CONVERT_CONTEXT *, Elf_Shdr *);
 
   //
   // Initialize filter pointer
@@ -512,26 +573,32 @@ WriteSections64 (
   //
   // First: copy sections.
   //
-  for (Idx = 0; Idx < mEhdr->e_shnum; Idx++) {
-    Elf_Shdr *Shdr = GetShdrByIndex(Idx);
-    if ((*Filter)(Shdr)) {
+  for (Idx = 0; Idx < Ehdr->e_shnum; Idx++) {
+    Elf_Shdr *Shdr = GetShdrByIndex(Context, Idx);
+    if ((*Filter)(Context, Shdr)) {
       switch (Shdr->sh_type) {
       case SHT_PROGBITS:
         /* Copy.  */
-        memcpy(mCoffFile + mCoffSectionsOffset[Idx],
-              (UINT8*)mEhdr + Shdr->sh_offset,
+        memcpy(Context->CoffFile + Context->CoffSectionsOffset[Idx],
+              (UINT8*)Ehdr + Shdr->sh_offset,
               (size_t) Shdr->sh_size);
+        if (FilterType == SECTION_HII && Shdr->sh_size != 0) {
+          //
+          // Fix up the copy, the ELF image is mapped read only.
+          //
+          SetHiiResourceHeader (Context->CoffFile + Context->CoffSectionsOffset[Idx], Context->HiiRsrcOffset);
+        }
         break;
 
       case SHT_NOBITS:
-        memset(mCoffFile + mCoffSectionsOffset[Idx], 0, (size_t) Shdr->sh_size);
+        memset(Context->CoffFile + Context->CoffSectionsOffset[Idx], 0, (size_t) Shdr->sh_size);
         break;
 
       default:
         //
         //  Ignore for unkown section type.
         //
-        VerboseMsg ("%s unknown section type %x. We directly copy this section into Coff file", mInImageName, (unsigned)Shdr->sh_type);
+        VerboseMsg ("%s unknown section type %x. We directly copy this section into Coff file", Context->InImageName, (unsigned)Shdr->sh_type);
         break;
       }
     }
@@ -541,37 +608,37 @@ WriteSections64 (
   // Second: apply relocations.
   //
   VerboseMsg ("Applying Relocations...");
-  for (Idx = 0; Idx < mEhdr->e_shnum; Idx++) {
-    Elf_Shdr *RelShdr = GetShdrByIndex(Idx);
+  for (Idx = 0; Idx < Ehdr->e_shnum; Idx++) {
+    Elf_Shdr *RelShdr = GetShdrByIndex(Context, Idx);
     if ((RelShdr->sh_type != SHT_REL) && (RelShdr->sh_type != SHT_RELA)) {
       continue;
     }
-    SecShdr = GetShdrByIndex(RelShdr->sh_info);
-    SecOffset = mCoffSectionsOffset[RelShdr->sh_info];
-    if (RelShdr->sh_type == SHT_RELA && (*Filter)(SecShdr)) {
+    SecShdr = GetShdrByIndex(Context, RelShdr->sh_info);
+    SecOffset = Context->CoffSectionsOffset[RelShdr->sh_info];
+    if (RelShdr->sh_type == SHT_RELA && (*Filter)(Context, SecShdr)) {
       UINT64 RelIdx;
-      Elf_Shdr *SymtabShdr = GetShdrByIndex(RelShdr->sh_link);
-      UINT8 *Symtab = (UINT8*)mEhdr + SymtabShdr->sh_offset;
+      Elf_Shdr *SymtabShdr = GetShdrByIndex(Context, RelShdr->sh_link);
+      UINT8 *Symtab = (UINT8*)Ehdr + SymtabShdr->sh_offset;
       for (RelIdx = 0; RelIdx < RelShdr->sh_size; RelIdx += (UINT32) RelShdr->sh_entsize) {
-        Elf_Rela *Rel = (Elf_Rela *)((UINT8*)mEhdr + RelShdr->sh_offset + RelIdx);
+        Elf_Rela *Rel = (Elf_Rela *)((UINT8*)Ehdr + RelShdr->sh_offset + RelIdx);
         Elf_Sym  *Sym = (Elf_Sym *)(Symtab + ELF_R_SYM(Rel->r_info) * SymtabShdr->sh_entsize);
         Elf_Shdr *SymShdr;
         UINT8    *Targ;
 
         if (Sym->st_shndx == SHN_UNDEF
             || Sym->st_shndx == SHN_ABS
-            || Sym->st_shndx > mEhdr->e_shnum) {
-          Error (NULL, 0, 3000, "Invalid", "%s bad symbol definition.", mInImageName);
+            || Sym->st_shndx > Ehdr->e_shnum) {
+          Error (NULL, 0, 3000, "Invalid", "%s bad symbol definition.", Context->InImageName);
         }
-        SymShdr = GetShdrByIndex(Sym->st_shndx);
+        SymShdr = GetShdrByIndex(Context, Sym->st_shndx);
 
         //
         // Note: r_offset in a memory address.
         //  Convert it to a pointer in the coff file.
         //
-        Targ = mCoffFile + SecOffset + (Rel->r_offset - SecShdr->sh_addr);
+        Targ = Context->CoffFile + SecOffset + (Rel->r_offset - SecShdr->sh_addr);
 
-        if (mEhdr->e_machine == EM_X86_64) {
+        if (Ehdr->e_machine == EM_X86_64) {
           switch (ELF_R_TYPE(Rel->r_info)) {
           case R_X86_64_NONE:
             break;
@@ -583,7 +650,7 @@ WriteSections64 (
             VerboseMsg ("Offset: 0x%08X, Addend: 0x%016LX", 
               (UINT32)(SecOffset + (Rel->r_offset - SecShdr->sh_addr)), 
               *(UINT64 *)Targ);
-            *(UINT64 *)Targ = *(UINT64 *)Targ - SymShdr->sh_addr + mCoffSectionsOffset[Sym->st_shndx];
+            *(UINT64 *)Targ = *(UINT64 *)Targ - SymShdr->sh_addr + Context->CoffSectionsOffset[Sym->st_shndx];
             VerboseMsg ("Relocation:  0x%016LX", *(UINT64*)Targ);
             break;
           case R_X86_64_32:
@@ -591,7 +658,7 @@ WriteSections64 (
             VerboseMsg ("Offset: 0x%08X, Addend: 0x%08X", 
               (UINT32)(SecOffset + (Rel->r_offset - SecShdr->sh_addr)), 
               *(UINT32 *)Targ);
-            *(UINT32 *)Targ = (UINT32)((UINT64)(*(UINT32 *)Targ) - SymShdr->sh_addr + mCoffSectionsOffset[Sym->st_shndx]);
+            *(UINT32 *)Targ = (UINT32)((UINT64)(*(UINT32 *)Targ) - SymShdr->sh_addr + Context->CoffSectionsOffset[Sym->st_shndx]);
             VerboseMsg ("Relocation:  0x%08X", *(UINT32*)Targ);
             break;
           case R_X86_64_32S:
@@ -599,7 +666,7 @@ WriteSections64 (
             VerboseMsg ("Offset: 0x%08X, Addend: 0x%08X", 
               (UINT32)(SecOffset + (Rel->r_offset - SecShdr->sh_addr)), 
               *(UINT32 *)Targ);
-            *(INT32 *)Targ = (INT32)((INT64)(*(INT32 *)Targ) - SymShdr->sh_addr + mCoffSectionsOffset[Sym->st_shndx]);
+            *(INT32 *)Targ = (INT32)((INT64)(*(INT32 *)Targ) - SymShdr->sh_addr + Context->CoffSectionsOffset[Sym->st_shndx]);
             VerboseMsg ("Relocation:  0x%08X", *(UINT32*)Targ);
             break;
           case R_X86_64_PC32:
@@ -611,12 +678,12 @@ WriteSections64 (
               (UINT32)(SecOffset + (Rel->r_offset - SecShdr->sh_addr)), 
               *(UINT32 *)Targ);
             *(UINT32 *)Targ = (UINT32) (*(UINT32 *)Targ
-              + (mCoffSectionsOffset[Sym->st_shndx] - SymShdr->sh_addr)
+              + (Context->CoffSectionsOffset[Sym->st_shndx] - SymShdr->sh_addr)
               - (SecOffset - SecShdr->sh_addr));
             VerboseMsg ("Relocation:  0x%08X", *(UINT32 *)Targ);
             break;
           default:
-            Error (NULL, 0, 3000, "Invalid", "%s unsupported ELF EM_X86_64 relocation 0x%x.", mInImageName, (unsigned) ELF_R_TYPE(Rel->r_info));
+            Error (NULL, 0, 3000, "Invalid", "%s unsupported ELF EM_X86_64 relocation 0x%x.", Context->InImageName, (unsigned) ELF_R_TYPE(Rel->r_info));
           }
         } else {
           Error (NULL, 0, 3000, "Invalid", "Not EM_X86_X64");
@@ -631,73 +698,27 @@ WriteSections64 (
 STATIC
 VOID
 WriteRelocations64 (
-  VOID
+  ELF_CONVERT_CONTEXT   *Context
   )
 {
-  UINT32                           Index;
   EFI_IMAGE_OPTIONAL_HEADER_UNION  *NtHdr;
   EFI_IMAGE_DATA_DIRECTORY         *Dir;
 
-  for (Index = 0; Index < mEhdr->e_shnum; Index++) {
-    Elf_Shdr *RelShdr = GetShdrByIndex(Index);
-    if ((RelShdr->sh_type == SHT_REL) || (RelShdr->sh_type == SHT_RELA)) {
-      Elf_Shdr *SecShdr = GetShdrByIndex (RelShdr->sh_info);
-      if (IsTextShdr(SecShdr) || IsDataShdr(SecShdr)) {
-        UINT64 RelIdx;
-
-        for (RelIdx = 0; RelIdx < RelShdr->sh_size; RelIdx += RelShdr->sh_entsize) {
-          Elf_Rela *Rel = (Elf_Rela *)((UINT8*)mEhdr + RelShdr->sh_offset + RelIdx);
-
-          if (mEhdr->e_machine == EM_X86_64) {
-            switch (ELF_R_TYPE(Rel->r_info)) {
-            case R_X86_64_NONE:
-            case R_X86_64_PC32:
-              break;
-            case R_X86_64_64:
-              VerboseMsg ("EFI_IMAGE_REL_BASED_DIR64 Offset: 0x%08X", 
-                mCoffSectionsOffset[RelShdr->sh_info] + (Rel->r_offset - SecShdr->sh_addr));
-              CoffAddFixup(
-                (UINT32) ((UINT64) mCoffSectionsOffset[RelShdr->sh_info]
-                + (Rel->r_offset - SecShdr->sh_addr)),
-                EFI_IMAGE_REL_BASED_DIR64);
-              break;
-            case R_X86_64_32S:
-            case R_X86_64_32:
-              VerboseMsg ("EFI_IMAGE_REL_BASED_HIGHLOW Offset: 0x%08X", 
-                mCoffSectionsOffset[RelShdr->sh_info] + (Rel->r_offset - SecShdr->sh_addr));
-              CoffAddFixup(
-                (UINT32) ((UINT64) mCoffSectionsOffset[RelShdr->sh_info]
-                + (Rel->r_offset - SecShdr->sh_addr)),
-                EFI_IMAGE_REL_BASED_HIGHLOW);
-              break;
-            default:
-              Error (NULL, 0, 3000, "Invalid", "%s unsupported ELF EM_X86_64 relocation 0x%x.", mInImageName, (unsigned) ELF_R_TYPE(Rel->r_info));
-            }
-          } else {
-            Error (NULL, 0, 3000, "Not Supported", "This tool does not support relocations for ELF with e_machine %u (processor type).", (unsigned) mEhdr->e_machine);
-          }
-        }
-      }
-    }
-  }
-
   //
-  // Pad by adding empty entries.
+  // Write one block per page, padded with empty entries.
   //
-  while (mCoffOffset & (mCoffAlignment - 1)) {
-    CoffAddFixupEntry(0);
-  }
+  CoffWriteFixups (Context, mCoffAlignment);
 
-  NtHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(mCoffFile + mNtHdrOffset);
+  NtHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(Context->CoffFile + Context->NtHdrOffset);
   Dir = &NtHdr->Pe32Plus.OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC];
-  Dir->Size = mCoffOffset - mRelocOffset;
+  Dir->Size = Context->CoffOffset - Context->RelocOffset;
   if (Dir->Size == 0) {
     // If no relocations, null out the directory entry and don't add the .reloc section
     Dir->VirtualAddress = 0;
     NtHdr->Pe32Plus.FileHeader.NumberOfSections--;
   } else {
-    Dir->VirtualAddress = mRelocOffset;
-    CreateSectionHeader (".reloc", mRelocOffset, mCoffOffset - mRelocOffset,
+    Dir->VirtualAddress = Context->RelocOffset;
+    CreateSectionHeader (Context, ".reloc", Context->RelocOffset, Context->CoffOffset - Context->RelocOffset,
             EFI_IMAGE_SCN_CNT_INITIALIZED_DATA
             | EFI_IMAGE_SCN_MEM_DISCARDABLE
             | EFI_IMAGE_SCN_MEM_READ);
@@ -707,7 +728,7 @@ WriteRelocations64 (
 STATIC
 VOID
 WriteDebug64 (
-  VOID
+  ELF_CONVERT_CONTEXT   *Context
   )
 {
   UINT32                              Len;
@@ -717,18 +738,19 @@ WriteDebug64 (
   EFI_IMAGE_DEBUG_DIRECTORY_ENTRY     *Dir;
   EFI_IMAGE_DEBUG_CODEVIEW_NB10_ENTRY *Nb10;
 
-  Len = strlen(mInImageName) + 1;
-  DebugOffset = mCoffOffset;
+  Len = strlen(Context->InImageName) + 1;
+  DebugOffset = Context->CoffOffset;
 
-  mCoffOffset += sizeof(EFI_IMAGE_DEBUG_DIRECTORY_ENTRY)
+  Context->CoffOffset += sizeof(EFI_IMAGE_DEBUG_DIRECTORY_ENTRY)
     + sizeof(EFI_IMAGE_DEBUG_CODEVIEW_NB10_ENTRY)
     + Len;
-  mCoffOffset = CoffAlign(mCoffOffset);
+  Context->CoffOffset = CoffAlign(Context->CoffOffset);
 
-  mCoffFile = realloc(mCoffFile, mCoffOffset);
-  memset(mCoffFile + DebugOffset, 0, mCoffOffset - DebugOffset);
+  if (!CoffReserve (Context, Context->CoffOffset)) {
+    return;
+  }
 
-  Dir = (EFI_IMAGE_DEBUG_DIRECTORY_ENTRY*)(mCoffFile + DebugOffset);
+  Dir = (EFI_IMAGE_DEBUG_DIRECTORY_ENTRY*)(Context->CoffFile + DebugOffset);
   Dir->Type = EFI_IMAGE_DEBUG_TYPE_CODEVIEW;
   Dir->SizeOfData = sizeof(EFI_IMAGE_DEBUG_CODEVIEW_NB10_ENTRY) + Len;
   Dir->RVA = DebugOffset + sizeof(EFI_IMAGE_DEBUG_DIRECTORY_ENTRY);
@@ -736,20 +758,20 @@ WriteDebug64 (
 
   Nb10 = (EFI_IMAGE_DEBUG_CODEVIEW_NB10_ENTRY*)(Dir + 1);
   Nb10->Signature = CODEVIEW_SIGNATURE_NB10;
-  strcpy ((char *)(Nb10 + 1), mInImageName);
+  strcpy ((char *)(Nb10 + 1), Context->InImageName);
 
 
-  NtHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(mCoffFile + mNtHdrOffset);
+  NtHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(Context->CoffFile + Context->NtHdrOffset);
   DataDir = &NtHdr->Pe32Plus.OptionalHeader.DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_DEBUG];
   DataDir->VirtualAddress = DebugOffset;
-  DataDir->Size = mCoffOffset - DebugOffset;
+  DataDir->Size = Context->CoffOffset - DebugOffset;
   if (DataDir->Size == 0) {
     // If no debug, null out the directory entry and don't add the .debug section
     DataDir->VirtualAddress = 0;
     NtHdr->Pe32Plus.FileHeader.NumberOfSections--;
   } else {
     DataDir->VirtualAddress = DebugOffset;
-    CreateSectionHeader (".debug", DebugOffset, mCoffOffset - DebugOffset,
+    CreateSectionHeader (Context, ".debug", DebugOffset, Context->CoffOffset - DebugOffset,
             EFI_IMAGE_SCN_CNT_INITIALIZED_DATA
             | EFI_IMAGE_SCN_MEM_DISCARDABLE
             | EFI_IMAGE_SCN_MEM_READ);
@@ -760,7 +782,7 @@ WriteDebug64 (
 STATIC
 VOID
 SetImageSize64 (
-  VOID
+  ELF_CONVERT_CONTEXT   *Context
   )
 {
   EFI_IMAGE_OPTIONAL_HEADER_UNION *NtHdr;
@@ -768,18 +790,18 @@ SetImageSize64 (
   //
   // Set image size
   //
-  NtHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(mCoffFile + mNtHdrOffset);
-  NtHdr->Pe32Plus.OptionalHeader.SizeOfImage = mCoffOffset;
+  NtHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(Context->CoffFile + Context->NtHdrOffset);
+  NtHdr->Pe32Plus.OptionalHeader.SizeOfImage = Context->CoffOffset;
 }
 
 STATIC
 VOID
 CleanUp64 (
-  VOID
+  ELF_CONVERT_CONTEXT   *Context
   )
 {
-  if (mCoffSectionsOffset != NULL) {
-    free (mCoffSectionsOffset);
+  if (Context->CoffSectionsOffset != NULL) {
+    free (Context->CoffSectionsOffset);
   }
 }
 
@@ -34,98 +34,178 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 #include "Elf32Convert.h"
 #include "Elf64Convert.h"
 
-//
-// Result Coff file in memory.
-//
-UINT8 *mCoffFile = NULL;
-
-//
-// COFF relocation data
-//
-EFI_IMAGE_BASE_RELOCATION *mCoffBaseRel;
-UINT16                    *mCoffEntryRel;
-
-//
-// Current offset in coff file.
-//
-UINT32 mCoffOffset;
-
-//
-// Offset in Coff file of headers and sections.
-//
-UINT32 mTableOffset;
-
 //
 //*****************************************************************************
 // Common ELF Functions
 //*****************************************************************************
 //
 
-VOID
-CoffAddFixupEntry(
-  UINT16 Val
+STATIC
+int
+CompareCoffFixup (
+  const VOID *Fixup1,
+  const VOID *Fixup2
   )
 {
-  *mCoffEntryRel = Val;
-  mCoffEntryRel++;
-  mCoffBaseRel->SizeOfBlock += 2;
-  mCoffOffset += 2;
+  const COFF_FIXUP *F1 = (const COFF_FIXUP *) Fixup1;
+  const COFF_FIXUP *F2 = (const COFF_FIXUP *) Fixup2;
+
+  if (F1->Offset != F2->Offset) {
+    return F1->Offset < F2->Offset ? -1 : 1;
+  }
+  return (int) F1->Type - (int) F2->Type;
 }
 
 VOID
 CoffAddFixup(
-  UINT32 Offset,
-  UINT8  Type
+  ELF_CONVERT_CONTEXT *Context,
+  UINT32              Offset,
+  UINT8               Type
   )
 {
-  if (mCoffBaseRel == NULL
-      || mCoffBaseRel->VirtualAddress != (Offset & ~0xfff)) {
-    if (mCoffBaseRel != NULL) {
-      //
-      // Add a null entry (is it required ?)
-      //
-      CoffAddFixupEntry (0);
-      
-      //
-      // Pad for alignment.
-      //
-      if (mCoffOffset % 4 != 0)
-        CoffAddFixupEntry (0);
-    }
+  COFF_FIXUP *NewFixups;
 
-    mCoffFile = realloc (
-      mCoffFile,
-      mCoffOffset + sizeof(EFI_IMAGE_BASE_RELOCATION) + 2*0x1000
-      );
-    memset (
-      mCoffFile + mCoffOffset, 0,
-      sizeof(EFI_IMAGE_BASE_RELOCATION) + 2*0x1000
+  if (Context->CoffFixupNumber == Context->CoffFixupMax) {
+    NewFixups = realloc (
+      Context->CoffFixups,
+      (Context->CoffFixupMax == 0 ? 0x100 : Context->CoffFixupMax * 2) * sizeof (COFF_FIXUP)
       );
+    if (NewFixups == NULL) {
+      Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+      return;
+    }
+    Context->CoffFixups = NewFixups;
+    Context->CoffFixupMax = Context->CoffFixupMax == 0 ? 0x100 : Context->CoffFixupMax * 2;
+  }
+
+  Context->CoffFixups[Context->CoffFixupNumber].Offset = Offset;
+  Context->CoffFixups[Context->CoffFixupNumber].Type = Type;
+  Context->CoffFixupNumber++;
+}
+
+BOOLEAN
+CoffReserve (
+  ELF_CONVERT_CONTEXT *Context,
+  UINT32              Size
+  )
+{
+  UINT8 *NewCoffFile;
+
+  if (Size <= Context->CoffFileSize) {
+    return TRUE;
+  }
+
+  NewCoffFile = realloc (Context->CoffFile, Size);
+  if (NewCoffFile == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    return FALSE;
+  }
+  memset (NewCoffFile + Context->CoffFileSize, 0, Size - Context->CoffFileSize);
+  Context->CoffFile = NewCoffFile;
+  Context->CoffFileSize = Size;
+  return TRUE;
+}
+
+UINT32
+CoffSortFixups (
+  ELF_CONVERT_CONTEXT *Context,
+  UINT32              Alignment
+  )
+{
+  UINT32                    Index;
+  UINT32                    Number;
+  UINT32                    Page;
+  UINT32                    RelocSize;
+
+  if (Context->CoffFixupNumber == 0) {
+    return 0;
+  }
+
+  //
+  // Sort the fixups by offset and drop the duplicates, so that each page
+  // gets a single block.
+  //
+  qsort (Context->CoffFixups, Context->CoffFixupNumber, sizeof (COFF_FIXUP), CompareCoffFixup);
+  for (Index = 1, Number = 1; Index < Context->CoffFixupNumber; Index++) {
+    if (CompareCoffFixup (&Context->CoffFixups[Index], &Context->CoffFixups[Number - 1]) != 0) {
+      Context->CoffFixups[Number++] = Context->CoffFixups[Index];
+    }
+  }
+  Context->CoffFixupNumber = Number;
+
+  //
+  // One block per page, each padded to 4 bytes, and empty entries at the
+  // end of the last block up to Alignment.
+  //
+  RelocSize = 0;
+  for (Index = 0; Index < Context->CoffFixupNumber; Index = Number) {
+    Page = Context->CoffFixups[Index].Offset & ~0xfff;
+    for (Number = Index + 1; Number < Context->CoffFixupNumber && (Context->CoffFixups[Number].Offset & ~0xfff) == Page; Number++) {
+    }
+    RelocSize += sizeof (EFI_IMAGE_BASE_RELOCATION) + (((Number - Index) * sizeof (UINT16) + 3) & ~3);
+  }
+  while (((Context->CoffOffset + RelocSize) & (Alignment - 1)) != 0) {
+    RelocSize += sizeof (UINT16);
+  }
 
-    mCoffBaseRel = (EFI_IMAGE_BASE_RELOCATION*)(mCoffFile + mCoffOffset);
-    mCoffBaseRel->VirtualAddress = Offset & ~0xfff;
-    mCoffBaseRel->SizeOfBlock = sizeof(EFI_IMAGE_BASE_RELOCATION);
+  return RelocSize;
+}
 
-    mCoffEntryRel = (UINT16 *)(mCoffBaseRel + 1);
-    mCoffOffset += sizeof(EFI_IMAGE_BASE_RELOCATION);
+VOID
+CoffWriteFixups (
+  ELF_CONVERT_CONTEXT *Context,
+  UINT32              Alignment
+  )
+{
+  UINT32                    Index;
+  UINT32                    Number;
+  UINT32                    Page;
+  UINT32                    RelocSize;
+  EFI_IMAGE_BASE_RELOCATION *BaseRel;
+  UINT16                    *EntryRel;
+
+  RelocSize = CoffSortFixups (Context, Alignment);
+  if (RelocSize == 0 || !CoffReserve (Context, Context->CoffOffset + RelocSize)) {
+    return;
   }
+  memset (Context->CoffFile + Context->CoffOffset, 0, RelocSize);
 
   //
-  // Fill the entry.
+  // Fill the blocks. The entries left zero are EFI_IMAGE_REL_BASED_ABSOLUTE.
   //
-  CoffAddFixupEntry((UINT16) ((Type << 12) | (Offset & 0xfff)));
+  BaseRel = NULL;
+  for (Index = 0; Index < Context->CoffFixupNumber; Index = Number) {
+    Page = Context->CoffFixups[Index].Offset & ~0xfff;
+    BaseRel = (EFI_IMAGE_BASE_RELOCATION *) (Context->CoffFile + Context->CoffOffset);
+    BaseRel->VirtualAddress = Page;
+    EntryRel = (UINT16 *) (BaseRel + 1);
+    for (Number = Index; Number < Context->CoffFixupNumber && (Context->CoffFixups[Number].Offset & ~0xfff) == Page; Number++) {
+      *EntryRel++ = (UINT16) ((Context->CoffFixups[Number].Type << 12) | (Context->CoffFixups[Number].Offset & 0xfff));
+    }
+    BaseRel->SizeOfBlock = sizeof (EFI_IMAGE_BASE_RELOCATION) + (((Number - Index) * sizeof (UINT16) + 3) & ~3);
+    Context->CoffOffset += BaseRel->SizeOfBlock;
+    RelocSize   -= BaseRel->SizeOfBlock;
+  }
+  BaseRel->SizeOfBlock += RelocSize;
+  Context->CoffOffset += RelocSize;
+
+  free (Context->CoffFixups);
+  Context->CoffFixups = NULL;
+  Context->CoffFixupNumber = 0;
+  Context->CoffFixupMax = 0;
 }
 
 VOID
 CreateSectionHeader (
-  const CHAR8 *Name,
-  UINT32      Offset,
-  UINT32      Size,
-  UINT32      Flags
+  ELF_CONVERT_CONTEXT *Context,
+  const CHAR8         *Name,
+  UINT32              Offset,
+  UINT32              Size,
+  UINT32              Flags
   )
 {
   EFI_IMAGE_SECTION_HEADER *Hdr;
-  Hdr = (EFI_IMAGE_SECTION_HEADER*)(mCoffFile + mTableOffset);
+  Hdr = (EFI_IMAGE_SECTION_HEADER*)(Context->CoffFile + Context->TableOffset);
 
   strcpy((char *)Hdr->Name, Name);
   Hdr->Misc.VirtualSize = Size;
@@ -138,7 +218,7 @@ CreateSectionHeader (
   Hdr->NumberOfLinenumbers = 0;
   Hdr->Characteristics = Flags;
 
-  mTableOffset += sizeof (EFI_IMAGE_SECTION_HEADER);
+  Context->TableOffset += sizeof (EFI_IMAGE_SECTION_HEADER);
 }
 
 //
@@ -160,24 +240,38 @@ IsElfHeader (
 
 BOOLEAN
 ConvertElf (
+  UINT8  *ElfBuffer,
+  CHAR8  *InImageName,
+  UINT32 OutImageType,
   UINT8  **FileBuffer,
-  UINT32 *FileLength
+  UINT32 *FileLength,
+  UINT32 *ImageTimeStamp
   )
 {
+  ELF_CONVERT_CONTEXT             Context;
   ELF_FUNCTION_TABLE              ElfFunctions;
   UINT8                           EiClass;
 
+  //
+  // All the state of the conversion is kept in Context, so images can be
+  // converted by several threads at the same time.
+  //
+  memset (&Context, 0, sizeof (Context));
+  Context.InImageName  = InImageName;
+  Context.OutImageType = OutImageType;
+  Context.ElfImage     = ElfBuffer;
+
   //
   // Determine ELF type and set function table pointer correctly.
   //
   VerboseMsg ("Check Elf Image Header");
-  EiClass = (*FileBuffer)[EI_CLASS];
+  EiClass = ElfBuffer[EI_CLASS];
   if (EiClass == ELFCLASS32) {
-    if (!InitializeElf32 (*FileBuffer, &ElfFunctions)) {
+    if (!InitializeElf32 (&Context, &ElfFunctions)) {
       return FALSE;
     }
   } else if (EiClass == ELFCLASS64) {
-    if (!InitializeElf64 (*FileBuffer, &ElfFunctions)) {
+    if (!InitializeElf64 (&Context, &ElfFunctions)) {
       return FALSE;
     }
   } else {
@@ -189,45 +283,51 @@ ConvertElf (
   // Compute sections new address.
   //  
   VerboseMsg ("Compute sections new address.");
-  ElfFunctions.ScanSections ();
+  ElfFunctions.ScanSections (&Context);
+  if (Context.CoffFile == NULL) {
+    ElfFunctions.CleanUp (&Context);
+    free (Context.CoffFixups);
+    return FALSE;
+  }
 
   //
   // Write and relocate sections.
   //
   VerboseMsg ("Write and relocate sections.");
-  ElfFunctions.WriteSections (SECTION_TEXT);
-  ElfFunctions.WriteSections (SECTION_DATA);
-  ElfFunctions.WriteSections (SECTION_HII);
+  ElfFunctions.WriteSections (&Context, SECTION_TEXT);
+  ElfFunctions.WriteSections (&Context, SECTION_DATA);
+  ElfFunctions.WriteSections (&Context, SECTION_HII);
 
   //
   // Translate and write relocations.
   //
   VerboseMsg ("Translate and write relocations.");
-  ElfFunctions.WriteRelocations ();
+  ElfFunctions.WriteRelocations (&Context);
 
   //
   // Write debug info.
   //
   VerboseMsg ("Write debug info.");
-  ElfFunctions.WriteDebug ();
+  ElfFunctions.WriteDebug (&Context);
 
   //
   // Make sure image size is correct before returning the new image.
   //
   VerboseMsg ("Set image size.");
-  ElfFunctions.SetImageSize ();
+  ElfFunctions.SetImageSize (&Context);
 
   //
-  // Replace.
+  // Return the new image. The ELF image is left untouched.
   //
-  free (*FileBuffer);
-  *FileBuffer = mCoffFile;
-  *FileLength = mCoffOffset;
+  *FileBuffer     = Context.CoffFile;
+  *FileLength     = Context.CoffOffset;
+  *ImageTimeStamp = Context.ImageTimeStamp;
 
   //
   // Free resources used by ELF functions.
   //
-  ElfFunctions.CleanUp ();
+  ElfFunctions.CleanUp (&Context);
+  free (Context.CoffFixups);
   
   return TRUE;
 }
@@ -19,16 +19,6 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 #include "elf32.h"
 #include "elf64.h"
 
-//
-// Externally defined variables
-//
-extern UINT32 mCoffOffset;
-extern CHAR8  *mInImageName;
-extern UINT32 mImageTimeStamp;
-extern UINT8  *mCoffFile;
-extern UINT32 mTableOffset;
-extern UINT32 mOutImageType;
-
 //
 // Common EFI specific data.
 //
@@ -44,16 +34,76 @@ typedef enum {
   
 } SECTION_FILTER_TYPES;
 
+//
+// COFF relocation data. The fixups are collected by CoffAddFixup and written
+// page by page by CoffWriteFixups once all of them are known.
+//
+typedef struct {
+  UINT32  Offset;
+  UINT8   Type;
+} COFF_FIXUP;
+
+//
+// State of one ELF to PE/COFF conversion. Each conversion has its own, so
+// several images can be converted at the same time.
+//
+typedef struct {
+  //
+  // Name of the input image, recorded in the debug entry, and the action
+  // the image is converted for.
+  //
+  CHAR8       *InImageName;
+  UINT32      OutImageType;
+
+  //
+  // ELF image and the offset in the Coff file of each of its sections.
+  //
+  UINT8       *ElfImage;
+  UINT32      *CoffSectionsOffset;
+
+  //
+  // Result Coff file in memory, its allocated size, the current offset and
+  // the offset of the next section header.
+  //
+  UINT8       *CoffFile;
+  UINT32      CoffFileSize;
+  UINT32      CoffOffset;
+  UINT32      TableOffset;
+
+  //
+  // Offsets in Coff file
+  //
+  UINT32      NtHdrOffset;
+  UINT32      TextOffset;
+  UINT32      DataOffset;
+  UINT32      HiiRsrcOffset;
+  UINT32      RelocOffset;
+
+  //
+  // Offset of the last ARM MOVW, the MOVT that follows must be next to it.
+  //
+  UINT32      MovwOffset;
+
+  COFF_FIXUP  *CoffFixups;
+  UINT32      CoffFixupNumber;
+  UINT32      CoffFixupMax;
+
+  //
+  // Time stamp written in the Coff file header.
+  //
+  UINT32      ImageTimeStamp;
+} ELF_CONVERT_CONTEXT;
+
 //
 // FunctionTalbe
 //
 typedef struct {
-  VOID    (*ScanSections) ();
-  BOOLEAN (*WriteSections) (SECTION_FILTER_TYPES  FilterType);
-  VOID    (*WriteRelocations) ();
-  VOID    (*WriteDebug) ();
-  VOID    (*SetImageSize) ();
-  VOID    (*CleanUp) ();
+  VOID    (*ScanSections) (ELF_CONVERT_CONTEXT *Context);
+  BOOLEAN (*WriteSections) (ELF_CONVERT_CONTEXT *Context, SECTION_FILTER_TYPES  FilterType);
+  VOID    (*WriteRelocations) (ELF_CONVERT_CONTEXT *Context);
+  VOID    (*WriteDebug) (ELF_CONVERT_CONTEXT *Context);
+  VOID    (*SetImageSize) (ELF_CONVERT_CONTEXT *Context);
+  VOID    (*CleanUp) (ELF_CONVERT_CONTEXT *Context);
   
 } ELF_FUNCTION_TABLE;
 
@@ -62,22 +112,37 @@ typedef struct {
 //
 VOID
 CoffAddFixup (
-  UINT32 Offset,
-  UINT8  Type
+  ELF_CONVERT_CONTEXT *Context,
+  UINT32              Offset,
+  UINT8               Type
+  );
+
+UINT32
+CoffSortFixups (
+  ELF_CONVERT_CONTEXT *Context,
+  UINT32              Alignment
   );
 
 VOID
-CoffAddFixupEntry (
-  UINT16 Val
+CoffWriteFixups (
+  ELF_CONVERT_CONTEXT *Context,
+  UINT32              Alignment
+  );
+
+BOOLEAN
+CoffReserve (
+  ELF_CONVERT_CONTEXT *Context,
+  UINT32              Size
   );
 
 
 VOID
 CreateSectionHeader (
-  const CHAR8 *Name,
-  UINT32      Offset,
-  UINT32      Size,
-  UINT32      Flags
+  ELF_CONVERT_CONTEXT *Context,
+  const CHAR8         *Name,
+  UINT32              Offset,
+  UINT32              Size,
+  UINT32              Flags
   );
 
 #endif
@@ -26,6 +26,8 @@ Abstract:
 #include <io.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#else
+#include <sys/mman.h>
 #endif
 #include <stdio.h>
 #include <stdlib.h>
@@ -52,6 +54,7 @@ Abstract:
 #include "EfiUtilityMsgs.h"
 
 #include "GenFw.h"
+#include "ParallelJobs.h"
 
 //
 // Version of this utility
@@ -97,26 +100,65 @@ static const char *gHiiPackageRCFileHeader[] = {
 };
 
 //
-// Module image information
+// An action of a GenFw command on an image, with the values of its options.
+// Option is the command line option that asked for the action.
 //
-CHAR8  *mInImageName;
-UINT32 mImageTimeStamp = 0;
-UINT32 mImageSize = 0;
-UINT32 mOutImageType = FW_DUMMY_IMAGE;
+typedef struct {
+  UINT32    Type;
+  CHAR8     *Option;
+  CHAR8     *ModuleType;
+  CHAR8     *TimeStamp;
+  UINT64    NewBaseAddress;
+  BOOLEAN   NegativeAddr;
+} GENFW_ACTION;
+
+//
+// Options of a GenFw command that are followed by a value.
+//
+STATIC CHAR8 *mValueOptions[] = {
+  "-o", "--outputfile", "-e", "--efiImage", "-s", "--stamp", "-a", "--align",
+  "-p", "--pad", "-d", "--debug", "-g", "--hiiguid", "--rebase", "--address",
+  NULL
+};
+
+//
+// One command of a batch manifest. Level orders the commands that share
+// files, Status is the result of the command once Done.
+//
+typedef struct {
+  UINT32    LineNumber;
+  int       Argc;
+  char      **Argv;
+  UINTN     Level;
+  STATUS    Status;
+  BOOLEAN   Done;
+} GENFW_BATCH_JOB;
+
+//
+// A file named in a batch manifest, with the levels after the last command
+// that writes it and after the last command that uses it.
+//
+typedef struct {
+  CHAR8     *Name;
+  UINTN     WriteLevel;
+  UINTN     UseLevel;
+} GENFW_BATCH_FILE;
 
 
 STATIC
 EFI_STATUS
 ZeroDebugData (
   IN OUT UINT8   *FileBuffer,
-  BOOLEAN        ZeroDebug
+  BOOLEAN        ZeroDebug,
+  OUT UINT32     *ImageTimeStamp
   );
 
 STATIC
 EFI_STATUS
 SetStamp (
   IN OUT UINT8  *FileBuffer,
-  IN     CHAR8  *TimeStamp
+  IN     CHAR8  *TimeStamp,
+  OUT    UINT32 *ImageTimeStamp
   );
 
 STATIC
@@ -291,6 +333,23 @@ Returns:
                         except for -o or -r option. It is a action option.\n\
                         If it is combined with other action options, the later\n\
                         input action option will override the previous one.\n");
+  fprintf (stdout, "  --chain               Apply the action options -e, -t, -l, -z, -s, --rebase,\n\
+                        --address, -b and -c in the order they are given, each\n\
+                        one to the image made by the previous one, and write\n\
+                        the output file once. The output is the same as when\n\
+                        GenFw runs once per action, each run reading the file\n\
+                        written by the previous one. -t uses the module type\n\
+                        of the -e before it. -b and -c can only be the last\n\
+                        action.\n");
+  fprintf (stdout, "  --batch Manifest      Run the GenFw commands listed in Manifest, one per line\n\
+                        with their options and files, in this process. A # starts\n\
+                        a comment up to the end of the line. Commands run at the\n\
+                        same time on several threads, except the commands that use\n\
+                        a file written by another command, which run after it.\n\
+                        It can only be combined with --threads and the message\n\
+                        options, which apply to all the commands.\n");
+  fprintf (stdout, "  --threads Number      Number of threads that run the commands of --batch,\n\
+                        from 1 to %u. The default is one per processor.\n", (unsigned) MAX_PARALLEL_WORKERS);
   fprintf (stdout, "  -v, --verbose         Turn on verbose output with informational messages.\n");
   fprintf (stdout, "  -q, --quiet           Disable all messages except key message and fatal error\n");
   fprintf (stdout, "  -d, --debug level     Enable debug messages, at input debug level.\n");
@@ -1037,61 +1096,163 @@ Returns:
   return Status;
 }
 
-int
-main (
-  int  argc,
-  char *argv[]
+STATIC
+UINT8 *
+ReadInputFile (
+  IN  FILE     *InFile,
+  IN  UINT32   FileLength,
+  IN  BOOLEAN  AllowMapping,
+  OUT BOOLEAN  *Mapped
   )
 /*++
 
 Routine Description:
 
-  Main function.
+  Gets the content of the input file. The file is mapped read only when
+  possible, so that only the pages the tool looks at are read: the debug
+  sections of an ELF image are never touched. It is read into memory
+  otherwise.
 
 Arguments:
 
-  argc - Number of command line parameters.
-  argv - Array of pointers to command line parameter strings.
+  InFile         - The input file, open for reading.
+  FileLength     - The size of the file.
+  AllowMapping   - FALSE if the file is rewritten while its content is in use.
+  Mapped         - Receives TRUE if the content is mapped.
 
 Returns:
-  STATUS_SUCCESS - Utility exits successfully.
-  STATUS_ERROR   - Some error occurred during execution.
+
+  The content of the file, to release with FreeInputFile.
+  NULL if the memory cannot be allocated.
+
+--*/
+{
+  UINT8   *Buffer;
+#ifndef __GNUC__
+  HANDLE  Mapping;
+#endif
+
+  *Mapped = FALSE;
+  if (AllowMapping && FileLength != 0) {
+#ifndef __GNUC__
+    Mapping = CreateFileMapping ((HANDLE) _get_osfhandle (_fileno (InFile)), NULL, PAGE_READONLY, 0, 0, NULL);
+    if (Mapping != NULL) {
+      Buffer = MapViewOfFile (Mapping, FILE_MAP_READ, 0, 0, 0);
+      CloseHandle (Mapping);
+      if (Buffer != NULL) {
+        *Mapped = TRUE;
+        return Buffer;
+      }
+    }
+#else
+    Buffer = mmap (NULL, FileLength, PROT_READ, MAP_PRIVATE, fileno (InFile), 0);
+    if (Buffer != MAP_FAILED) {
+      *Mapped = TRUE;
+      return Buffer;
+    }
+#endif
+  }
+
+  Buffer = malloc (FileLength);
+  if (Buffer == NULL) {
+    return NULL;
+  }
+  fread (Buffer, 1, FileLength, InFile);
+  return Buffer;
+}
+
+STATIC
+VOID
+FreeInputFile (
+  IN UINT8    *Buffer,
+  IN UINT32   FileLength,
+  IN BOOLEAN  Mapped
+  )
+/*++
+
+Routine Description:
+
+  Releases the content of the input file returned by ReadInputFile.
+
+Arguments:
+
+  Buffer         - The content of the file.
+  FileLength     - The size of the file.
+  Mapped         - TRUE if the content is mapped.
+
+Returns:
+
+  None
+
+--*/
+{
+  if (!Mapped) {
+    free (Buffer);
+    return;
+  }
+#ifndef __GNUC__
+  UnmapViewOfFile (Buffer);
+#else
+  munmap (Buffer, FileLength);
+#endif
+}
+
+STATIC
+STATUS
+ApplyImageAction (
+  IN     GENFW_ACTION   *Action,
+  IN     CHAR8          *InImageName,
+  IN     BOOLEAN        KeepExceptionTableFlag,
+  IN     BOOLEAN        KeepZeroPendingFlag,
+  IN     UINT8          *InputFileBuffer,
+  IN     UINT32         InputFileLength,
+  IN OUT UINT8          **ImageBuffer,
+  IN OUT UINT32         *ImageLength,
+  OUT    UINT32         *ImageTimeStamp
+  )
+/*++
+
+Routine Description:
+
+  Apply one action to an image in memory: convert an ELF or PE image to an
+  EFI or TE image, remove its relocations, zero its debug data, set its time
+  stamp or base address, or extract its binary or ACPI data. The image is
+  the same as the output file of a GenFw command with only this action.
+
+Arguments:
+
+  Action          - The action and the values of its options.
+  InImageName     - Name of the input file, for the messages and the debug
+                    entry of a converted ELF image.
+  KeepExceptionTableFlag - TRUE to keep the exception table of the image.
+  KeepZeroPendingFlag    - TRUE to keep the zero padding of .reloc.
+  InputFileBuffer - Data of the input file, read by the first action.
+  InputFileLength - Size of the input file data.
+  ImageBuffer     - The image made by the previous action, NULL for the first
+                    action. Receives the image made by this action, which
+                    may be a new buffer.
+  ImageLength     - Size of the image.
+  ImageTimeStamp  - Receives the time stamp set in the image by this action,
+                    0 if it sets none.
+
+Returns:
+
+  STATUS_SUCCESS - The action was applied.
+  STATUS_ERROR   - The action failed, the error is reported.
 
 --*/
 {
   UINT32                           Type;
-  UINT32                           InputFileNum;
-  CHAR8                            **InputFileName;
-  char                             *OutImageName;
-  char                             *ModuleType;
-  CHAR8                            *TimeStamp;
-  FILE                             *fpIn;
-  FILE                             *fpOut;
-  FILE                             *fpInOut;
-  UINT32                           Data;
-  UINT32                           *DataPointer;
-  UINT32                           *OldDataPointer;
-  UINT32                           CheckSum;
   UINT32                           Index;
   UINT32                           Index1;
   UINT32                           Index2;
-  UINT64                           Temp64;
-  UINT32                           MciAlignment;
-  UINT8                            MciPadValue;
   UINT32                           AllignedRelocSize;
   UINT8                            *FileBuffer;
   UINT32                           FileLength;
-  UINT8                            *OutputFileBuffer;
-  UINT32                           OutputFileLength;
-  UINT8                            *InputFileBuffer;
-  UINT32                           InputFileLength;
   RUNTIME_FUNCTION                 *RuntimeFunction;
   UNWIND_INFO                      *UnwindInfo;
-  STATUS                           Status;
-  BOOLEAN                          ReplaceFlag;
-  BOOLEAN                          KeepExceptionTableFlag;
-  BOOLEAN                          KeepZeroPendingFlag;
-  UINT64                           LogLevel;
+  EFI_STATUS                       Status;
+  STATUS                           ActionStatus;
   EFI_TE_IMAGE_HEADER              TEImageHeader;
   EFI_TE_IMAGE_HEADER              *TeHdr;
   EFI_IMAGE_SECTION_HEADER         *SectionHeader;
@@ -1100,172 +1261,985 @@ Returns:
   EFI_IMAGE_OPTIONAL_HEADER32      *Optional32;
   EFI_IMAGE_OPTIONAL_HEADER64      *Optional64;
   EFI_IMAGE_DOS_HEADER             BackupDosHdr;
-  MICROCODE_IMAGE_HEADER           *MciHeader;
-  UINT8                            *HiiPackageListBuffer;
-  UINT8                            *HiiPackageDataPointer;
-  EFI_GUID                         HiiPackageListGuid;
-  EFI_HII_PACKAGE_LIST_HEADER      HiiPackageListHeader;
-  EFI_HII_PACKAGE_HEADER           HiiPackageHeader;
-  EFI_IFR_FORM_SET                 IfrFormSet;
-  UINT8                            NumberOfFormPacakge;
-  EFI_HII_PACKAGE_HEADER           EndPackage;
-  UINT32                           HiiSectionHeaderSize;
-  UINT8                            *HiiSectionHeader;
   UINT64                           NewBaseAddress;
-  BOOLEAN                          NegativeAddr;
-  FILE                             *ReportFile;
-  CHAR8                            *ReportFileName;
-  UINTN                            FileLen;
-  time_t                           InputFileTime;
-  time_t                           OutputFileTime;
-  struct stat                      Stat_Buf;
 
-  SetUtilityName (UTILITY_NAME);
+  FileBuffer      = *ImageBuffer;
+  FileLength      = *ImageLength;
+  Type            = 0;
+  Optional32      = NULL;
+  Optional64      = NULL;
+  NewBaseAddress  = Action->NewBaseAddress;
+  ActionStatus    = STATUS_ERROR;
+  *ImageTimeStamp = 0;
 
   //
-  // Assign to fix compile warning
+  // The first action reads the input file data. An ELF image is converted
+  // straight from the input file data, FileBuffer then receives the PE/COFF
+  // image.
   //
-  FileLen           = 0;
-  InputFileNum      = 0;
-  InputFileName     = NULL;
-  mInImageName      = NULL;
-  OutImageName      = NULL;
-  ModuleType        = NULL;
-  Type              = 0;
-  Status            = STATUS_SUCCESS;
-  FileBuffer        = NULL;
-  fpIn              = NULL;
-  fpOut             = NULL;
-  fpInOut           = NULL;
-  TimeStamp         = NULL;
-  MciAlignment      = DEFAULT_MC_ALIGNMENT;
-  MciPadValue       = DEFAULT_MC_PAD_BYTE_VALUE;
-  FileLength        = 0;
-  MciHeader         = NULL;
-  CheckSum          = 0;
-  ReplaceFlag       = FALSE;
-  LogLevel          = 0;
-  OutputFileBuffer  = NULL;
-  OutputFileLength  = 0;
-  InputFileBuffer   = NULL;
-  InputFileLength   = 0;
-  Optional32        = NULL;
-  Optional64        = NULL;
-  KeepExceptionTableFlag = FALSE;
-  KeepZeroPendingFlag    = FALSE;
-  NumberOfFormPacakge    = 0;
-  HiiPackageListBuffer   = NULL;
-  HiiPackageDataPointer  = NULL;
-  EndPackage.Length      = sizeof (EFI_HII_PACKAGE_HEADER);
-  EndPackage.Type        = EFI_HII_PACKAGE_END;
-  memset (&HiiPackageListGuid, 0, sizeof (HiiPackageListGuid));
-  HiiSectionHeaderSize   = 0;
-  HiiSectionHeader       = NULL;
-  NewBaseAddress         = 0;
-  NegativeAddr           = FALSE;
-  InputFileTime          = 0;
-  OutputFileTime         = 0;
-
-  if (argc == 1) {
-    Error (NULL, 0, 1001, "Missing options", "No input options.");
-    Usage ();
-    return STATUS_ERROR;
-  }
-
-  argc --;
-  argv ++;
-
-  if ((stricmp (argv[0], "-h") == 0) || (stricmp (argv[0], "--help") == 0)) {
-    Version ();
-    Usage ();
-    return STATUS_SUCCESS;
-  }
-
-  if (stricmp (argv[0], "--version") == 0) {
-    Version ();
-    return STATUS_SUCCESS;
-  }
-
-  while (argc > 0) {
-    if ((stricmp (argv[0], "-o") == 0) || (stricmp (argv[0], "--outputfile") == 0)) {
-      if (argv[1] == NULL || argv[1][0] == '-') {
-        Error (NULL, 0, 1003, "Invalid option value", "Output file name is missing for -o option");
+  if (FileBuffer == NULL) {
+    FileLength = InputFileLength;
+    if (!IsElfHeader (InputFileBuffer)) {
+      FileBuffer = malloc (FileLength);
+      if (FileBuffer == NULL) {
+        Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
         goto Finish;
       }
-      OutImageName = argv[1];
-      argc -= 2;
-      argv += 2;
-      continue;
+      memcpy (FileBuffer, InputFileBuffer, InputFileLength);
     }
+  }
 
-    if ((stricmp (argv[0], "-e") == 0) || (stricmp (argv[0], "--efiImage") == 0)) {
-      if (argv[1] == NULL || argv[1][0] == '-') {
-        Error (NULL, 0, 1003, "Invalid option value", "Module Type is missing for -o option");
+  //
+  // Following code to convert dll to efi image or te image.
+  // Get new image type
+  //
+  if ((Action->Type == FW_EFI_IMAGE) || (Action->Type == FW_TE_IMAGE)) {
+    if (Action->ModuleType == NULL) {
+      if (Action->Type == FW_EFI_IMAGE) {
+        Error (NULL, 0, 1001, "Missing option", "EFI_FILETYPE");
         goto Finish;
+      } else if (Action->Type == FW_TE_IMAGE) {
+        //
+        // Default TE Image Type is Boot service driver
+        //
+        Type = EFI_IMAGE_SUBSYSTEM_EFI_BOOT_SERVICE_DRIVER;
+        VerboseMsg ("Efi Image subsystem type is efi boot service driver.");
       }
-      ModuleType = argv[1];
-      if (mOutImageType != FW_TE_IMAGE) {
-        mOutImageType = FW_EFI_IMAGE;
-      }
-      argc -= 2;
-      argv += 2;
-      continue;
-    }
-
-    if ((stricmp (argv[0], "-l") == 0) || (stricmp (argv[0], "--stripped") == 0)) {
-      mOutImageType = FW_RELOC_STRIPEED_IMAGE;
-      argc --;
-      argv ++;
-      continue;
-    }
+    } else {
+      if (stricmp (Action->ModuleType, "BASE") == 0 ||
+        stricmp (Action->ModuleType, "SEC") == 0 ||
+        stricmp (Action->ModuleType, "SECURITY_CORE") == 0 ||
+        stricmp (Action->ModuleType, "PEI_CORE") == 0 ||
+        stricmp (Action->ModuleType, "PEIM") == 0 ||
+        stricmp (Action->ModuleType, "COMBINED_PEIM_DRIVER") == 0 ||
+        stricmp (Action->ModuleType, "PIC_PEIM") == 0 ||
+        stricmp (Action->ModuleType, "RELOCATABLE_PEIM") == 0 ||
+        stricmp (Action->ModuleType, "DXE_CORE") == 0 ||
+        stricmp (Action->ModuleType, "BS_DRIVER") == 0  ||
+        stricmp (Action->ModuleType, "DXE_DRIVER") == 0 ||
+        stricmp (Action->ModuleType, "DXE_SMM_DRIVER") == 0  ||
+        stricmp (Action->ModuleType, "UEFI_DRIVER") == 0 ||
+        stricmp (Action->ModuleType, "SMM_CORE") == 0) {
+          Type = EFI_IMAGE_SUBSYSTEM_EFI_BOOT_SERVICE_DRIVER;
+          VerboseMsg ("Efi Image subsystem type is efi boot service driver.");
 
-    if ((stricmp (argv[0], "-c") == 0) || (stricmp (argv[0], "--acpi") == 0)) {
-      mOutImageType = FW_ACPI_IMAGE;
-      argc --;
-      argv ++;
-      continue;
-    }
+      } else if (stricmp (Action->ModuleType, "UEFI_APPLICATION") == 0 ||
+        stricmp (Action->ModuleType, "APPLICATION") == 0) {
+          Type = EFI_IMAGE_SUBSYSTEM_EFI_APPLICATION;
+          VerboseMsg ("Efi Image subsystem type is efi application.");
 
-    if ((stricmp (argv[0], "-t") == 0) || (stricmp (argv[0], "--terse") == 0)) {
-      mOutImageType = FW_TE_IMAGE;
-      argc --;
-      argv ++;
-      continue;
-    }
+      } else if (stricmp (Action->ModuleType, "DXE_RUNTIME_DRIVER") == 0 ||
+        stricmp (Action->ModuleType, "RT_DRIVER") == 0) {
+          Type = EFI_IMAGE_SUBSYSTEM_EFI_RUNTIME_DRIVER;
+          VerboseMsg ("Efi Image subsystem type is efi runtime driver.");
 
-    if ((stricmp (argv[0], "-u") == 0) || (stricmp (argv[0], "--dump") == 0)) {
-      mOutImageType = DUMP_TE_HEADER;
-      argc --;
-      argv ++;
-      continue;
-    }
+      } else if (stricmp (Action->ModuleType, "DXE_SAL_DRIVER") == 0 ||
+        stricmp (Action->ModuleType, "SAL_RT_DRIVER") == 0) {
+          Type = EFI_IMAGE_SUBSYSTEM_SAL_RUNTIME_DRIVER;
+          VerboseMsg ("Efi Image subsystem type is efi sal runtime driver.");
 
-    if ((stricmp (argv[0], "-b") == 0) || (stricmp (argv[0], "--exe2bin") == 0)) {
-      mOutImageType = FW_BIN_IMAGE;
-      argc --;
-      argv ++;
-      continue;
+      } else {
+        Error (NULL, 0, 1003, "Invalid option value", "EFI_FILETYPE = %s", Action->ModuleType);
+        goto Finish;
+      }
     }
+  }
 
-    if ((stricmp (argv[0], "-z") == 0) || (stricmp (argv[0], "--zero") == 0)) {
-      mOutImageType = FW_ZERO_DEBUG_IMAGE;
-      argc --;
-      argv ++;
-      continue;
+  //
+  // Convert ELF image to PeImage
+  //
+  if (FileBuffer == NULL) {
+    VerboseMsg ("Convert %s from ELF to PE/COFF.", InImageName);
+    if (!ConvertElf(InputFileBuffer, InImageName, Action->Type, &FileBuffer, &FileLength, ImageTimeStamp)) {
+      Error (NULL, 0, 3000, "Invalid", "Unable to convert %s from ELF to PE/COFF.", InImageName);
+      goto Finish;
     }
+  }
 
-    if ((stricmp (argv[0], "-s") == 0) || (stricmp (argv[0], "--stamp") == 0)) {
-      mOutImageType = FW_SET_STAMP_IMAGE;
+  //
+  // Make sure File Offsets and Virtual Offsets are the same in the image so it is XIP
+  // XIP == eXecute In Place
+  //
+  PeCoffConvertImageToXip (&FileBuffer, &FileLength);
+
+  //
+  // Remove reloc section from PE or TE image
+  //
+  if (Action->Type == FW_RELOC_STRIPEED_IMAGE) {
+    //
+    // Check TeImage
+    //
+    TeHdr = (EFI_TE_IMAGE_HEADER *) FileBuffer;
+    if (TeHdr->Signature == EFI_TE_IMAGE_HEADER_SIGNATURE) {
+      SectionHeader = (EFI_IMAGE_SECTION_HEADER *) (TeHdr + 1);
+      for (Index = 0; Index < TeHdr->NumberOfSections; Index ++, SectionHeader ++) {
+        if (strcmp ((char *)SectionHeader->Name, ".reloc") == 0) {
+          //
+          // Check the reloc section is in the end of image.
+          //
+          if ((SectionHeader->PointerToRawData + SectionHeader->SizeOfRawData) ==
+            (FileLength + TeHdr->StrippedSize - sizeof (EFI_TE_IMAGE_HEADER))) {
+              //
+              // Remove .reloc section and update TeImage Header
+              //
+              FileLength = FileLength - SectionHeader->SizeOfRawData;
+              SectionHeader->SizeOfRawData = 0;
+              SectionHeader->Misc.VirtualSize = 0;
+              TeHdr->DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = 0;
+              TeHdr->DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size           = 0;
+              break;
+          }
+        }
+      }
+    } else {
+      //
+      // Check PE Image
+      //
+      DosHdr = (EFI_IMAGE_DOS_HEADER *) FileBuffer;
+      if (DosHdr->e_magic != EFI_IMAGE_DOS_SIGNATURE) {
+        PeHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(FileBuffer);
+        if (PeHdr->Pe32.Signature != EFI_IMAGE_NT_SIGNATURE) {
+          Error (NULL, 0, 3000, "Invalid", "TE and DOS header signatures were not found in %s image.", InImageName);
+          goto Finish;
+        }
+        DosHdr = NULL;
+      } else {
+        PeHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(FileBuffer + DosHdr->e_lfanew);
+        if (PeHdr->Pe32.Signature != EFI_IMAGE_NT_SIGNATURE) {
+          Error (NULL, 0, 3000, "Invalid", "PE header signature was not found in %s image.", InImageName);
+          goto Finish;
+        }
+      }
+      SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
+      for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index ++, SectionHeader ++) {
+        if (strcmp ((char *)SectionHeader->Name, ".reloc") == 0) {
+          //
+          // Check the reloc section is in the end of image.
+          //
+          if ((SectionHeader->PointerToRawData + SectionHeader->SizeOfRawData) == FileLength) {
+            //
+            // Remove .reloc section and update PeImage Header
+            //
+            FileLength = FileLength - SectionHeader->SizeOfRawData;
+
+            PeHdr->Pe32.FileHeader.Characteristics |= EFI_IMAGE_FILE_RELOCS_STRIPPED;
+            if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
+              Optional32 = (EFI_IMAGE_OPTIONAL_HEADER32 *)&PeHdr->Pe32.OptionalHeader;
+              Optional32->SizeOfImage -= SectionHeader->SizeOfRawData;
+              Optional32->SizeOfInitializedData -= SectionHeader->SizeOfRawData;
+              if (Optional32->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC) {
+                Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = 0;
+                Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size = 0;
+              }
+            }
+            if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
+              Optional64 = (EFI_IMAGE_OPTIONAL_HEADER64 *)&PeHdr->Pe32.OptionalHeader;
+              Optional64->SizeOfImage -= SectionHeader->SizeOfRawData;
+              Optional64->SizeOfInitializedData -= SectionHeader->SizeOfRawData;
+              if (Optional64->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC) {
+                Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = 0;
+                Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size = 0;
+              }
+            }
+            SectionHeader->Misc.VirtualSize = 0;
+            SectionHeader->SizeOfRawData = 0;
+            break;
+          }
+        }
+      }
+    }
+    //
+    // Write file
+    //
+    goto Done;
+  }
+  //
+  // Read the dos & pe hdrs of the image
+  //
+  DosHdr = (EFI_IMAGE_DOS_HEADER *)FileBuffer;
+  if (DosHdr->e_magic != EFI_IMAGE_DOS_SIGNATURE) {
+    // NO DOS header, check for PE/COFF header
+    PeHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(FileBuffer);
+    if (PeHdr->Pe32.Signature != EFI_IMAGE_NT_SIGNATURE) {
+      Error (NULL, 0, 3000, "Invalid", "DOS header signature was not found in %s image.", InImageName);
+      goto Finish;
+    }
+    DosHdr = NULL;
+  } else {
+
+    PeHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(FileBuffer + DosHdr->e_lfanew);
+    if (PeHdr->Pe32.Signature != EFI_IMAGE_NT_SIGNATURE) {
+      Error (NULL, 0, 3000, "Invalid", "PE header signature was not found in %s image.", InImageName);
+      goto Finish;
+    }
+  }
+
+  if (PeHdr->Pe32.FileHeader.Machine == IMAGE_FILE_MACHINE_ARM) {
+    // Some tools kick out IMAGE_FILE_MACHINE_ARM (0x1c0) vs IMAGE_FILE_MACHINE_ARMT (0x1c2)
+    // so patch back to the offical UEFI value.
+    PeHdr->Pe32.FileHeader.Machine = IMAGE_FILE_MACHINE_ARMT;
+  }
+
+  //
+  // Set new base address into image
+  //
+  if (Action->Type == FW_REBASE_IMAGE || Action->Type == FW_SET_ADDRESS_IMAGE) {
+    if ((PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) && (PeHdr->Pe32.FileHeader.Machine != IMAGE_FILE_MACHINE_IA64)) {
+      if (NewBaseAddress >= 0x100000000ULL) {
+        Error (NULL, 0, 3000, "Invalid", "New base address is larger than 4G for 32bit PE image");
+        goto Finish;
+      }
+    }
+    
+    if (Action->NegativeAddr) {
+      //
+      // Set Base Address to a negative value.
+      //
+      NewBaseAddress = (UINT64) (0 - NewBaseAddress);
+    }
+    if (Action->Type == FW_REBASE_IMAGE) {
+      Status = RebaseImage (InImageName, FileBuffer, NewBaseAddress);
+    } else {
+      Status = SetAddressToSectionHeader (InImageName, FileBuffer, NewBaseAddress);
+    }
+    if (EFI_ERROR (Status)) {
+      if (Action->NegativeAddr) {
+        Error (NULL, 0, 3000, "Invalid", "Rebase/Set Image %s to Base address -0x%llx can't success", InImageName, 0 - NewBaseAddress);
+      } else {
+        Error (NULL, 0, 3000, "Invalid", "Rebase/Set Image %s to Base address 0x%llx can't success", InImageName, NewBaseAddress);
+      }
+      goto Finish;
+    }
+
+    //
+    // Write file
+    //
+    goto Done;
+  }
+
+  //
+  // Extract bin data from Pe image.
+  //
+  if (Action->Type == FW_BIN_IMAGE) {
+    if (FileLength < PeHdr->Pe32.OptionalHeader.SizeOfHeaders) {
+      Error (NULL, 0, 3000, "Invalid", "FileSize of %s is not a legal size.", InImageName);
+      goto Finish;
+    }
+    //
+    // Output bin data from exe file
+    //
+    FileLength = FileLength - PeHdr->Pe32.OptionalHeader.SizeOfHeaders;
+    memmove (FileBuffer, FileBuffer + PeHdr->Pe32.OptionalHeader.SizeOfHeaders, FileLength);
+    VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
+    goto Done;
+  }
+
+  //
+  // Zero Debug Information of Pe Image
+  //
+  if (Action->Type == FW_ZERO_DEBUG_IMAGE) {
+    Status = ZeroDebugData (FileBuffer, TRUE, ImageTimeStamp);
+    if (EFI_ERROR (Status)) {
+      Error (NULL, 0, 3000, "Invalid", "Zero DebugData Error status is 0x%x", (int) Status);
+      goto Finish;
+    }
+
+    //
+    // Write the updated Image
+    //
+    VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
+    goto Done;
+  }
+
+  //
+  // Set Time Stamp of Pe Image
+  //
+  if (Action->Type == FW_SET_STAMP_IMAGE) {
+    Status = SetStamp (FileBuffer, Action->TimeStamp, ImageTimeStamp);
+    if (EFI_ERROR (Status)) {
+      goto Finish;
+    }
+
+    //
+    // Write the updated Image
+    //
+    VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
+    goto Done;
+  }
+
+  //
+  // Extract acpi data from pe image.
+  //
+  if (Action->Type == FW_ACPI_IMAGE) {
+    SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
+    for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index ++, SectionHeader ++) {
+      if (strcmp ((char *)SectionHeader->Name, ".data") == 0 || strcmp ((char *)SectionHeader->Name, ".sdata") == 0) {
+        //
+        // Check Acpi Table
+        //
+        if (SectionHeader->Misc.VirtualSize < SectionHeader->SizeOfRawData) {
+          FileLength = SectionHeader->Misc.VirtualSize;
+        } else {
+          FileLength = SectionHeader->SizeOfRawData;
+        }
+
+        if (CheckAcpiTable (FileBuffer + SectionHeader->PointerToRawData, FileLength) != STATUS_SUCCESS) {
+          Error (NULL, 0, 3000, "Invalid", "ACPI table check failed in %s.", InImageName);
+          goto Finish;
+        }
+
+        //
+        // Output Apci data to file
+        //
+        memmove (FileBuffer, FileBuffer + SectionHeader->PointerToRawData, FileLength);
+        VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
+        goto Done;
+      }
+    }
+    Error (NULL, 0, 3000, "Invalid", "failed to get ACPI table from %s.", InImageName);
+    goto Finish;
+  }
+  //
+  // Zero all unused fields of the DOS header
+  //
+  if (DosHdr != NULL) {
+    memcpy (&BackupDosHdr, DosHdr, sizeof (EFI_IMAGE_DOS_HEADER));
+    memset (DosHdr, 0, sizeof (EFI_IMAGE_DOS_HEADER));
+    DosHdr->e_magic  = BackupDosHdr.e_magic;
+    DosHdr->e_lfanew = BackupDosHdr.e_lfanew;
+
+    for (Index = sizeof (EFI_IMAGE_DOS_HEADER); Index < (UINT32 ) DosHdr->e_lfanew; Index++) {
+      FileBuffer[Index] = (UINT8) DosHdr->e_cp;
+    }
+  }
+
+  //
+  // Initialize TeImage Header
+  //
+  memset (&TEImageHeader, 0, sizeof (EFI_TE_IMAGE_HEADER));
+  TEImageHeader.Signature        = EFI_TE_IMAGE_HEADER_SIGNATURE;
+  TEImageHeader.Machine          = PeHdr->Pe32.FileHeader.Machine;
+  TEImageHeader.NumberOfSections = (UINT8) PeHdr->Pe32.FileHeader.NumberOfSections;
+  TEImageHeader.StrippedSize     = (UINT16) ((UINTN) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader) - (UINTN) FileBuffer);
+  TEImageHeader.Subsystem        = (UINT8) Type;
+
+  //
+  // Patch the PE header
+  //
+  PeHdr->Pe32.OptionalHeader.Subsystem = (UINT16) Type;
+
+  if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
+    Optional32 = (EFI_IMAGE_OPTIONAL_HEADER32 *)&PeHdr->Pe32.OptionalHeader;
+    Optional32->MajorOperatingSystemVersion = 0;
+    Optional32->MinorOperatingSystemVersion = 0;
+    Optional32->MajorImageVersion           = 0;
+    Optional32->MinorImageVersion           = 0;
+    Optional32->MajorSubsystemVersion       = 0;
+    Optional32->MinorSubsystemVersion       = 0;
+    Optional32->Win32VersionValue           = 0;
+    Optional32->CheckSum                    = 0;
+    Optional32->SizeOfStackReserve = 0;
+    Optional32->SizeOfStackCommit  = 0;
+    Optional32->SizeOfHeapReserve  = 0;
+    Optional32->SizeOfHeapCommit   = 0;
+
+    TEImageHeader.AddressOfEntryPoint = Optional32->AddressOfEntryPoint;
+    TEImageHeader.BaseOfCode          = Optional32->BaseOfCode;
+    TEImageHeader.ImageBase           = (UINT64) (Optional32->ImageBase);
+
+    if (Optional32->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC) {
+      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress;
+      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size = Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size;
+    }
+
+    if (Optional32->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_DEBUG) {
+      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_DEBUG].VirtualAddress = Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_DEBUG].VirtualAddress;
+      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_DEBUG].Size = Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_DEBUG].Size;
+    }
+
+    //
+    // Zero .pdata section data.
+    //
+    if (!KeepExceptionTableFlag && Optional32->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION &&
+      Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].VirtualAddress != 0 &&
+      Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].Size != 0) {
+        SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
+        for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index++, SectionHeader++) {
+          if (SectionHeader->VirtualAddress == Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].VirtualAddress) {
+            //
+            // Zero .pdata Section data
+            //
+            memset (FileBuffer + SectionHeader->PointerToRawData, 0, SectionHeader->SizeOfRawData);
+            //
+            // Zero .pdata Section header name
+            //
+            memset (SectionHeader->Name, 0, sizeof (SectionHeader->Name));
+            //
+            // Zero Execption Table
+            //
+            Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].VirtualAddress = 0;
+            Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].Size           = 0;
+            DebugMsg (NULL, 0, 9, "Zero the .pdata section for PE image", NULL);
+            break;
+          }
+        }
+    }
+
+    //
+    // Strip zero padding at the end of the .reloc section
+    //
+    if (!KeepZeroPendingFlag && Optional32->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC) {
+      if (Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size != 0) {
+        SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
+        for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index++, SectionHeader++) {
+          //
+          // Look for the Section Header that starts as the same virtual address as the Base Relocation Data Directory
+          //
+          if (SectionHeader->VirtualAddress == Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress) {
+            SectionHeader->Misc.VirtualSize = Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size;
+            AllignedRelocSize = (Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size + Optional32->FileAlignment - 1) & (~(Optional32->FileAlignment - 1));
+            //
+            // Check to see if there is zero padding at the end of the base relocations
+            //
+            if (AllignedRelocSize < SectionHeader->SizeOfRawData) {
+              //
+              // Check to see if the base relocations are at the end of the file
+              //
+              if (SectionHeader->PointerToRawData + SectionHeader->SizeOfRawData == Optional32->SizeOfImage) {
+                //
+                // All the required conditions are met to strip the zero padding of the end of the base relocations section
+                //
+                Optional32->SizeOfImage -= (SectionHeader->SizeOfRawData - AllignedRelocSize);
+                Optional32->SizeOfInitializedData -= (SectionHeader->SizeOfRawData - AllignedRelocSize);
+                SectionHeader->SizeOfRawData = AllignedRelocSize;
+                FileLength = Optional32->SizeOfImage;
+                DebugMsg (NULL, 0, 9, "Remove the zero padding bytes at the end of the base relocations", "The size of padding bytes is %u", (unsigned) (SectionHeader->SizeOfRawData - AllignedRelocSize));
+              }
+            }
+          }
+        }
+      }
+    }
+  } else if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
+    Optional64 = (EFI_IMAGE_OPTIONAL_HEADER64 *)&PeHdr->Pe32.OptionalHeader;
+    Optional64->MajorOperatingSystemVersion = 0;
+    Optional64->MinorOperatingSystemVersion = 0;
+    Optional64->MajorImageVersion           = 0;
+    Optional64->MinorImageVersion           = 0;
+    Optional64->MajorSubsystemVersion       = 0;
+    Optional64->MinorSubsystemVersion       = 0;
+    Optional64->Win32VersionValue           = 0;
+    Optional64->CheckSum                    = 0;
+    Optional64->SizeOfStackReserve = 0;
+    Optional64->SizeOfStackCommit  = 0;
+    Optional64->SizeOfHeapReserve  = 0;
+    Optional64->SizeOfHeapCommit   = 0;
+
+    TEImageHeader.AddressOfEntryPoint = Optional64->AddressOfEntryPoint;
+    TEImageHeader.BaseOfCode          = Optional64->BaseOfCode;
+    TEImageHeader.ImageBase           = (UINT64) (Optional64->ImageBase);
+
+    if (Optional64->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC) {
+      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress;
+      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size = Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size;
+    }
+
+    if (Optional64->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_DEBUG) {
+      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_DEBUG].VirtualAddress = Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_DEBUG].VirtualAddress;
+      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_DEBUG].Size = Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_DEBUG].Size;
+    }
+
+    //
+    // Zero the .pdata section for X64 machine and don't check the Debug Directory is empty
+    // For Itaninum and X64 Image, remove .pdata section.
+    //
+    if ((!KeepExceptionTableFlag && PeHdr->Pe32.FileHeader.Machine == IMAGE_FILE_MACHINE_X64) || PeHdr->Pe32.FileHeader.Machine == IMAGE_FILE_MACHINE_IA64) {
+      if (Optional64->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION &&
+        Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].VirtualAddress != 0 &&
+        Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].Size != 0) {
+          SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
+          for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index++, SectionHeader++) {
+            if (SectionHeader->VirtualAddress == Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].VirtualAddress) {
+              //
+              // Zero .pdata Section header name
+              //
+              memset (SectionHeader->Name, 0, sizeof (SectionHeader->Name));
+
+              RuntimeFunction = (RUNTIME_FUNCTION *)(FileBuffer + SectionHeader->PointerToRawData);
+              for (Index1 = 0; Index1 < Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].Size / sizeof (RUNTIME_FUNCTION); Index1++, RuntimeFunction++) {
+                SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
+                for (Index2 = 0; Index2 < PeHdr->Pe32.FileHeader.NumberOfSections; Index2++, SectionHeader++) {
+                  if (RuntimeFunction->UnwindInfoAddress >= SectionHeader->VirtualAddress && RuntimeFunction->UnwindInfoAddress < (SectionHeader->VirtualAddress + SectionHeader->SizeOfRawData)) {
+                    UnwindInfo = (UNWIND_INFO *)(FileBuffer + SectionHeader->PointerToRawData + (RuntimeFunction->UnwindInfoAddress - SectionHeader->VirtualAddress));
+                    if (UnwindInfo->Version == 1) {
+                      memset (UnwindInfo + 1, 0, UnwindInfo->CountOfUnwindCodes * sizeof (UINT16));
+                      memset (UnwindInfo, 0, sizeof (UNWIND_INFO));
+                    }
+                    break;
+                  }
+                }
+                memset (RuntimeFunction, 0, sizeof (RUNTIME_FUNCTION));
+              }
+              //
+              // Zero Execption Table
+              //
+              Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].Size = 0;
+              Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].VirtualAddress = 0;
+              DebugMsg (NULL, 0, 9, "Zero the .pdata section if the machine type is X64 for PE32+ image", NULL);
+              break;
+            }
+          }
+      }
+    }
+
+    //
+    // Strip zero padding at the end of the .reloc section
+    //
+    if (!KeepZeroPendingFlag && Optional64->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_DEBUG) {
+      if (Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size != 0) {
+        SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
+        for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index++, SectionHeader++) {
+          //
+          // Look for the Section Header that starts as the same virtual address as the Base Relocation Data Directory
+          //
+          if (SectionHeader->VirtualAddress == Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress) {
+            SectionHeader->Misc.VirtualSize = Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size;
+            AllignedRelocSize = (Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size + Optional64->FileAlignment - 1) & (~(Optional64->FileAlignment - 1));
+            //
+            // Check to see if there is zero padding at the end of the base relocations
+            //
+            if (AllignedRelocSize < SectionHeader->SizeOfRawData) {
+              //
+              // Check to see if the base relocations are at the end of the file
+              //
+              if (SectionHeader->PointerToRawData + SectionHeader->SizeOfRawData == Optional64->SizeOfImage) {
+                //
+                // All the required conditions are met to strip the zero padding of the end of the base relocations section
+                //
+                Optional64->SizeOfImage -= (SectionHeader->SizeOfRawData - AllignedRelocSize);
+                Optional64->SizeOfInitializedData -= (SectionHeader->SizeOfRawData - AllignedRelocSize);
+                SectionHeader->SizeOfRawData = AllignedRelocSize;
+                FileLength = Optional64->SizeOfImage;
+                DebugMsg (NULL, 0, 9, "Remove the zero padding bytes at the end of the base relocations", "The size of padding bytes is %u", (unsigned) (SectionHeader->SizeOfRawData - AllignedRelocSize));
+              }
+            }
+          }
+        }
+      }
+    }
+  } else {
+    Error (NULL, 0, 3000, "Invalid", "Magic 0x%x of PeImage %s is unknown.", PeHdr->Pe32.OptionalHeader.Magic, InImageName);
+    goto Finish;
+  }
+
+  if (((PeHdr->Pe32.FileHeader.Characteristics & EFI_IMAGE_FILE_RELOCS_STRIPPED) == 0) && \
+    (TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress == 0) && \
+    (TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size == 0)) {
+      //
+      // PeImage can be loaded into memory, but it has no relocation section. 
+      // Fix TeImage Header to set VA of relocation data directory to not zero, the size is still zero.
+      //
+      if (Optional32 != NULL) {
+        TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = Optional32->SizeOfImage - sizeof (EFI_IMAGE_BASE_RELOCATION);
+      } else if (Optional64 != NULL) {
+        TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = Optional64->SizeOfImage - sizeof (EFI_IMAGE_BASE_RELOCATION);
+      }
+  }
+
+  //
+  // Fill HII section data
+  //
+  SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
+  for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index++) {
+    if (stricmp ((char *)SectionHeader[Index].Name, ".hii") == 0) {
+      //
+      // Update resource section header offset
+      //
+      SetHiiResourceHeader ((UINT8*) FileBuffer + SectionHeader[Index].PointerToRawData, SectionHeader[Index].VirtualAddress);
+      //
+      // Update resource section name
+      //
+      strcpy((char *) SectionHeader[Index].Name, ".rsrc");
+      //
+      // Update resource data directory.
+      //
+      if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
+        Optional32 = (EFI_IMAGE_OPTIONAL_HEADER32 *)&PeHdr->Pe32.OptionalHeader;
+        Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_RESOURCE].VirtualAddress = SectionHeader[Index].VirtualAddress;
+        Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_RESOURCE].Size = SectionHeader[Index].Misc.VirtualSize;
+      } else if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
+        Optional64 = (EFI_IMAGE_OPTIONAL_HEADER64 *)&PeHdr->Pe32.OptionalHeader;
+        Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_RESOURCE].VirtualAddress = SectionHeader[Index].VirtualAddress;
+        Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_RESOURCE].Size = SectionHeader[Index].Misc.VirtualSize;
+      }
+      break;
+    }
+  }
+
+  //
+  // Zero ExceptionTable Xdata
+  //
+  if (!KeepExceptionTableFlag) {
+    SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
+    for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index++) {
+      if (stricmp ((char *)SectionHeader[Index].Name, ".xdata") == 0) {
+        //
+        // zero .xdata section
+        //
+        memset (FileBuffer + SectionHeader[Index].PointerToRawData, 0, SectionHeader[Index].SizeOfRawData);
+        DebugMsg (NULL, 0, 9, NULL, "Zero the .xdata section for PE image at Offset 0x%x and Length 0x%x", (unsigned) SectionHeader[Index].PointerToRawData, (unsigned) SectionHeader[Index].SizeOfRawData);
+        break;
+      }
+    }
+  }
+
+  //
+  // Zero Time/Data field
+  //
+  ZeroDebugData (FileBuffer, FALSE, ImageTimeStamp);
+
+  if (Action->Type == FW_TE_IMAGE) {
+    if ((PeHdr->Pe32.FileHeader.NumberOfSections &~0xFF) || (Type &~0xFF)) {
+      //
+      // Pack the subsystem and NumberOfSections into 1 byte. Make sure they fit both.
+      //
+      Error (NULL, 0, 3000, "Invalid", "Image's subsystem or NumberOfSections of PeImage %s cannot be packed into 1 byte.", InImageName);
+      goto Finish;
+    }
+
+    if ((PeHdr->Pe32.OptionalHeader.SectionAlignment != PeHdr->Pe32.OptionalHeader.FileAlignment)) {
+      //
+      // TeImage has the same section alignment and file alignment.
+      //
+      Error (NULL, 0, 3000, "Invalid", "Section-Alignment and File-Alignment of PeImage %s do not match, they must be equal for a TeImage.", InImageName);
+      goto Finish;
+    }
+
+    DebugMsg (NULL, 0, 9, "TeImage Header Info", "Machine type is %X, Number of sections is %X, Stripped size is %X, EntryPoint is %X, BaseOfCode is %X, ImageBase is %llX",
+      TEImageHeader.Machine, TEImageHeader.NumberOfSections, TEImageHeader.StrippedSize, (unsigned) TEImageHeader.AddressOfEntryPoint, (unsigned) TEImageHeader.BaseOfCode, (unsigned long long) TEImageHeader.ImageBase);
+    //
+    // Update Image to TeImage
+    //
+    FileLength = FileLength - TEImageHeader.StrippedSize;
+    memmove (FileBuffer + sizeof (EFI_TE_IMAGE_HEADER), FileBuffer + TEImageHeader.StrippedSize, FileLength);
+    FileLength = FileLength + sizeof (EFI_TE_IMAGE_HEADER);
+    memcpy (FileBuffer, &TEImageHeader, sizeof (EFI_TE_IMAGE_HEADER));
+    VerboseMsg ("the size of output file is %u bytes", (unsigned) (FileLength));
+  } else {
+
+    //
+    // Following codes are to fix the objcopy's issue:
+    // objcopy in binutil 2.50.18 will set PE image's charactices to "RELOC_STRIPPED" if image has no ".reloc" section
+    // It cause issue for EFI image which has no ".reloc" sections.
+    // Following codes will be removed when objcopy in binutil fix this problem for PE image.
+    //
+    if ((PeHdr->Pe32.FileHeader.Characteristics & EFI_IMAGE_FILE_RELOCS_STRIPPED) != 0) {
+      if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
+        Optional32 = (EFI_IMAGE_OPTIONAL_HEADER32 *)&PeHdr->Pe32.OptionalHeader;
+        if (Optional32->ImageBase == 0) {
+          PeHdr->Pe32.FileHeader.Characteristics &= ~EFI_IMAGE_FILE_RELOCS_STRIPPED;
+        }
+      } else if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
+        Optional64 = (EFI_IMAGE_OPTIONAL_HEADER64 *)&PeHdr->Pe32.OptionalHeader;
+        if (Optional64->ImageBase == 0) {
+          PeHdr->Pe32.FileHeader.Characteristics &= ~EFI_IMAGE_FILE_RELOCS_STRIPPED;
+        }
+      }
+    }
+  }
+
+Done:
+  ActionStatus = STATUS_SUCCESS;
+
+Finish:
+  *ImageBuffer = FileBuffer;
+  *ImageLength = FileLength;
+  return ActionStatus;
+}
+
+STATIC
+VOID
+AddImageAction (
+  IN OUT GENFW_ACTION   *Actions,
+  IN OUT UINTN          *ActionNumber,
+  IN     UINT32         Type,
+  IN     CHAR8          *Option,
+  IN     CHAR8          *ModuleType,
+  IN     CHAR8          *TimeStamp,
+  IN     UINT64         NewBaseAddress,
+  IN     BOOLEAN        NegativeAddr
+  )
+/*++
+
+Routine Description:
+
+  Append an action to the actions of a GenFw command.
+
+Arguments:
+
+  Actions        - The actions of the command.
+  ActionNumber   - Number of actions, incremented.
+  Type           - The action, FW_*_IMAGE.
+  Option         - The option that asked for the action.
+  ModuleType     - Module type of the last -e option, or NULL.
+  TimeStamp      - Time stamp of the last -s option, or NULL.
+  NewBaseAddress - Address of the last --rebase or --address option.
+  NegativeAddr   - TRUE if that address is negative.
+
+Returns:
+
+  None
+
+--*/
+{
+  GENFW_ACTION  *Action;
+
+  Action                 = &Actions[(*ActionNumber)++];
+  Action->Type           = Type;
+  Action->Option         = Option;
+  Action->ModuleType     = ModuleType;
+  Action->TimeStamp      = TimeStamp;
+  Action->NewBaseAddress = NewBaseAddress;
+  Action->NegativeAddr   = NegativeAddr;
+}
+
+STATIC
+STATUS
+ProcessImage (
+  IN int      argc,
+  IN char     *argv[],
+  IN BOOLEAN  BatchJob
+  )
+/*++
+
+Routine Description:
+
+  Runs one GenFw command: parses its options and creates the output file
+  from the input files. All the state of the command is local, so the
+  commands of a batch manifest can run on several threads at the same time.
+
+Arguments:
+
+  argc     - Number of options and file names.
+  argv     - Options and file names, followed by a NULL entry.
+  BatchJob - TRUE for a command of a batch manifest, which can't change the
+             message level of the process.
+
+Returns:
+  STATUS_SUCCESS - The command succeeded.
+  STATUS_ERROR   - Some error occurred during the command.
+
+--*/
+{
+  UINT32                           InputFileNum;
+  CHAR8                            **InputFileName;
+  char                             *OutImageName;
+  char                             *ModuleType;
+  CHAR8                            *TimeStamp;
+  FILE                             *fpIn;
+  FILE                             *fpOut;
+  FILE                             *fpInOut;
+  UINT32                           Data;
+  UINT32                           *DataPointer;
+  UINT32                           *OldDataPointer;
+  UINT32                           CheckSum;
+  UINT32                           Index;
+  UINT64                           Temp64;
+  UINT32                           MciAlignment;
+  UINT8                            MciPadValue;
+  UINT8                            *FileBuffer;
+  UINT32                           FileLength;
+  UINT8                            *OutputFileBuffer;
+  UINT32                           OutputFileLength;
+  UINT8                            *InputFileBuffer;
+  UINT32                           InputFileLength;
+  BOOLEAN                          InputFileMapped;
+  STATUS                           Status;
+  BOOLEAN                          ReplaceFlag;
+  BOOLEAN                          KeepExceptionTableFlag;
+  BOOLEAN                          KeepZeroPendingFlag;
+  UINT64                           LogLevel;
+  EFI_TE_IMAGE_HEADER              TEImageHeader;
+  MICROCODE_IMAGE_HEADER           *MciHeader;
+  UINT8                            *HiiPackageListBuffer;
+  UINT8                            *HiiPackageDataPointer;
+  EFI_GUID                         HiiPackageListGuid;
+  EFI_HII_PACKAGE_LIST_HEADER      HiiPackageListHeader;
+  EFI_HII_PACKAGE_HEADER           HiiPackageHeader;
+  EFI_IFR_FORM_SET                 IfrFormSet;
+  UINT8                            NumberOfFormPacakge;
+  EFI_HII_PACKAGE_HEADER           EndPackage;
+  UINT32                           HiiSectionHeaderSize;
+  UINT8                            *HiiSectionHeader;
+  UINT64                           NewBaseAddress;
+  BOOLEAN                          NegativeAddr;
+  FILE                             *ReportFile;
+  CHAR8                            *ReportFileName;
+  UINTN                            FileLen;
+  time_t                           InputFileTime;
+  time_t                           OutputFileTime;
+  struct stat                      Stat_Buf;
+  CHAR8                            *InImageName;
+  UINT32                           OutImageType;
+  UINT32                           ImageTimeStamp;
+  UINT32                           ImageSize;
+  GENFW_ACTION                     *Actions;
+  UINTN                            ActionNumber;
+  BOOLEAN                          ChainFlag;
+
+  ResetThreadUtilityStatus ();
+
+  //
+  // Assign to fix compile warning
+  //
+  FileLen           = 0;
+  InputFileNum      = 0;
+  InputFileName     = NULL;
+  InImageName       = NULL;
+  OutImageType      = FW_DUMMY_IMAGE;
+  ImageTimeStamp    = 0;
+  ImageSize         = 0;
+  OutImageName      = NULL;
+  ModuleType        = NULL;
+  Status            = STATUS_SUCCESS;
+  FileBuffer        = NULL;
+  fpIn              = NULL;
+  fpOut             = NULL;
+  fpInOut           = NULL;
+  TimeStamp         = NULL;
+  MciAlignment      = DEFAULT_MC_ALIGNMENT;
+  MciPadValue       = DEFAULT_MC_PAD_BYTE_VALUE;
+  FileLength        = 0;
+  MciHeader         = NULL;
+  CheckSum          = 0;
+  ReplaceFlag       = FALSE;
+  LogLevel          = 0;
+  OutputFileBuffer  = NULL;
+  OutputFileLength  = 0;
+  InputFileBuffer   = NULL;
+  InputFileLength   = 0;
+  InputFileMapped   = FALSE;
+  KeepExceptionTableFlag = FALSE;
+  KeepZeroPendingFlag    = FALSE;
+  NumberOfFormPacakge    = 0;
+  HiiPackageListBuffer   = NULL;
+  HiiPackageDataPointer  = NULL;
+  EndPackage.Length      = sizeof (EFI_HII_PACKAGE_HEADER);
+  EndPackage.Type        = EFI_HII_PACKAGE_END;
+  memset (&HiiPackageListGuid, 0, sizeof (HiiPackageListGuid));
+  HiiSectionHeaderSize   = 0;
+  HiiSectionHeader       = NULL;
+  NewBaseAddress         = 0;
+  NegativeAddr           = FALSE;
+  InputFileTime          = 0;
+  OutputFileTime         = 0;
+  ActionNumber           = 0;
+  ChainFlag              = FALSE;
+
+  //
+  // Each option asks for one action at most.
+  //
+  Actions = (GENFW_ACTION *) malloc ((argc + 1) * sizeof (GENFW_ACTION));
+  if (Actions == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    goto Finish;
+  }
+
+  while (argc > 0) {
+    if ((stricmp (argv[0], "-o") == 0) || (stricmp (argv[0], "--outputfile") == 0)) {
+      if (argv[1] == NULL || argv[1][0] == '-') {
+        Error (NULL, 0, 1003, "Invalid option value", "Output file name is missing for -o option");
+        goto Finish;
+      }
+      OutImageName = argv[1];
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    if ((stricmp (argv[0], "-e") == 0) || (stricmp (argv[0], "--efiImage") == 0)) {
+      if (argv[1] == NULL || argv[1][0] == '-') {
+        Error (NULL, 0, 1003, "Invalid option value", "Module Type is missing for -o option");
+        goto Finish;
+      }
+      ModuleType = argv[1];
+      if (OutImageType != FW_TE_IMAGE) {
+        OutImageType = FW_EFI_IMAGE;
+      }
+      AddImageAction (Actions, &ActionNumber, FW_EFI_IMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
+      argc -= 2;
+      argv += 2;
+      continue;
+    }
+
+    if ((stricmp (argv[0], "-l") == 0) || (stricmp (argv[0], "--stripped") == 0)) {
+      OutImageType = FW_RELOC_STRIPEED_IMAGE;
+      AddImageAction (Actions, &ActionNumber, FW_RELOC_STRIPEED_IMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
+      argc --;
+      argv ++;
+      continue;
+    }
+
+    if ((stricmp (argv[0], "-c") == 0) || (stricmp (argv[0], "--acpi") == 0)) {
+      OutImageType = FW_ACPI_IMAGE;
+      AddImageAction (Actions, &ActionNumber, FW_ACPI_IMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
+      argc --;
+      argv ++;
+      continue;
+    }
+
+    if ((stricmp (argv[0], "-t") == 0) || (stricmp (argv[0], "--terse") == 0)) {
+      OutImageType = FW_TE_IMAGE;
+      AddImageAction (Actions, &ActionNumber, FW_TE_IMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
+      argc --;
+      argv ++;
+      continue;
+    }
+
+    if ((stricmp (argv[0], "-u") == 0) || (stricmp (argv[0], "--dump") == 0)) {
+      OutImageType = DUMP_TE_HEADER;
+      AddImageAction (Actions, &ActionNumber, DUMP_TE_HEADER, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
+      argc --;
+      argv ++;
+      continue;
+    }
+
+    if ((stricmp (argv[0], "-b") == 0) || (stricmp (argv[0], "--exe2bin") == 0)) {
+      OutImageType = FW_BIN_IMAGE;
+      AddImageAction (Actions, &ActionNumber, FW_BIN_IMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
+      argc --;
+      argv ++;
+      continue;
+    }
+
+    if ((stricmp (argv[0], "-z") == 0) || (stricmp (argv[0], "--zero") == 0)) {
+      OutImageType = FW_ZERO_DEBUG_IMAGE;
+      AddImageAction (Actions, &ActionNumber, FW_ZERO_DEBUG_IMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
+      argc --;
+      argv ++;
+      continue;
+    }
+
+    if ((stricmp (argv[0], "-s") == 0) || (stricmp (argv[0], "--stamp") == 0)) {
+      OutImageType = FW_SET_STAMP_IMAGE;
       if (argv[1] == NULL || argv[1][0] == '-') {
         Error (NULL, 0, 1003, "Invalid option value", "time stamp is missing for -s option");
         goto Finish;
       }
       TimeStamp = argv[1];
+      AddImageAction (Actions, &ActionNumber, FW_SET_STAMP_IMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
       argc -= 2;
       argv += 2;
       continue;
     }
 
+    if (stricmp (argv[0], "--chain") == 0) {
+      ChainFlag = TRUE;
+      argc --;
+      argv ++;
+      continue;
+    }
+
     if ((stricmp (argv[0], "-r") == 0) || (stricmp (argv[0], "--replace") == 0)) {
       ReplaceFlag = TRUE;
       argc --;
@@ -1288,14 +2262,16 @@ Returns:
     }
 
     if ((stricmp (argv[0], "-m") == 0) || (stricmp (argv[0], "--mcifile") == 0)) {
-      mOutImageType = FW_MCI_IMAGE;
+      OutImageType = FW_MCI_IMAGE;
+      AddImageAction (Actions, &ActionNumber, FW_MCI_IMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
       argc --;
       argv ++;
       continue;
     }
 
     if ((stricmp (argv[0], "-j") == 0) || (stricmp (argv[0], "--join") == 0)) {
-      mOutImageType = FW_MERGE_IMAGE;
+      OutImageType = FW_MERGE_IMAGE;
+      AddImageAction (Actions, &ActionNumber, FW_MERGE_IMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
       argc --;
       argv ++;
       continue;
@@ -1324,8 +2300,9 @@ Returns:
         Error (NULL, 0, 1003, "Invalid option value", "%s = %s", argv[0], argv[1]);
         goto Finish;
       }
-      mOutImageType = FW_REBASE_IMAGE;
+      OutImageType = FW_REBASE_IMAGE;
       NewBaseAddress = (UINT64) Temp64;
+      AddImageAction (Actions, &ActionNumber, FW_REBASE_IMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
       argc -= 2;
       argv += 2;
       continue;
@@ -1343,8 +2320,9 @@ Returns:
         Error (NULL, 0, 1003, "Invalid option value", "%s = %s", argv[0], argv[1]);
         goto Finish;
       }
-      mOutImageType = FW_SET_ADDRESS_IMAGE;
+      OutImageType = FW_SET_ADDRESS_IMAGE;
       NewBaseAddress = (UINT64) Temp64;
+      AddImageAction (Actions, &ActionNumber, FW_SET_ADDRESS_IMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
       argc -= 2;
       argv += 2;
       continue;
@@ -1361,6 +2339,14 @@ Returns:
       continue;
     }
 
+    if (BatchJob &&
+        ((stricmp (argv[0], "-v") == 0) || (stricmp (argv[0], "--verbose") == 0) ||
+         (stricmp (argv[0], "-q") == 0) || (stricmp (argv[0], "--quiet") == 0) ||
+         (stricmp (argv[0], "-d") == 0) || (stricmp (argv[0], "--debug") == 0))) {
+      Error (NULL, 0, 1000, "Invalid option", "%s applies to the whole batch, give it on the command line instead of the manifest.", argv[0]);
+      goto Finish;
+    }
+
     if ((stricmp (argv[0], "-v") == 0) || (stricmp (argv[0], "--verbose") == 0)) {
       SetPrintLevel (VERBOSE_LOG_LEVEL);
       VerboseMsg ("Verbose output Mode Set!");
@@ -1406,14 +2392,16 @@ Returns:
     }
 
     if (stricmp (argv[0], "--hiipackage") == 0) {
-      mOutImageType = FW_HII_PACKAGE_LIST_RCIMAGE;
+      OutImageType = FW_HII_PACKAGE_LIST_RCIMAGE;
+      AddImageAction (Actions, &ActionNumber, FW_HII_PACKAGE_LIST_RCIMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
       argc --;
       argv ++;
       continue;
     }
 
     if (stricmp (argv[0], "--hiibinpackage") == 0) {
-      mOutImageType = FW_HII_PACKAGE_LIST_BINIMAGE;
+      OutImageType = FW_HII_PACKAGE_LIST_BINIMAGE;
+      AddImageAction (Actions, &ActionNumber, FW_HII_PACKAGE_LIST_BINIMAGE, argv[0], ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
       argc --;
       argv ++;
       continue;
@@ -1458,7 +2446,7 @@ Returns:
 
   VerboseMsg ("%s tool start.", UTILITY_NAME);
 
-  if (mOutImageType == FW_DUMMY_IMAGE) {
+  if (OutImageType == FW_DUMMY_IMAGE) {
     Error (NULL, 0, 1001, "Missing option", "No create file action specified; pls specify -e, -c or -t option to create efi image, or acpi table or TeImage!");
     if (ReplaceFlag) {
       Error (NULL, 0, 1001, "Missing option", "-r option is not supported as the independent option. It can be used together with other create file option specified at the above.");
@@ -1466,6 +2454,38 @@ Returns:
     goto Finish;
   }
 
+  //
+  // Without --chain the last action option wins and uses the values of all
+  // the options, with --chain the actions apply in the order they are given.
+  //
+  if (!ChainFlag) {
+    ActionNumber = 0;
+    AddImageAction (Actions, &ActionNumber, OutImageType, NULL, ModuleType, TimeStamp, NewBaseAddress, NegativeAddr);
+  } else {
+    for (Index = 0; Index < ActionNumber; Index++) {
+      switch (Actions[Index].Type) {
+      case FW_ACPI_IMAGE:
+      case FW_BIN_IMAGE:
+        if (Index + 1 < ActionNumber) {
+          Error (NULL, 0, 1002, "Conflicting option", "%s doesn't make an image, it can only be the last action of --chain.", Actions[Index].Option);
+          goto Finish;
+        }
+        break;
+      case FW_EFI_IMAGE:
+      case FW_TE_IMAGE:
+      case FW_RELOC_STRIPEED_IMAGE:
+      case FW_ZERO_DEBUG_IMAGE:
+      case FW_SET_STAMP_IMAGE:
+      case FW_REBASE_IMAGE:
+      case FW_SET_ADDRESS_IMAGE:
+        break;
+      default:
+        Error (NULL, 0, 1002, "Conflicting option", "%s cannot be used with --chain.", Actions[Index].Option);
+        goto Finish;
+      }
+    }
+  }
+
   //
   // check input files
   //
@@ -1477,7 +2497,7 @@ Returns:
   //
   // Combine MciBinary files to one file
   //
-  if ((mOutImageType == FW_MERGE_IMAGE) && ReplaceFlag) {
+  if ((OutImageType == FW_MERGE_IMAGE) && ReplaceFlag) {
     Error (NULL, 0, 1002, "Conflicting option", "-r replace option cannot be used with -j merge files option.");
     goto Finish;
   }
@@ -1485,12 +2505,12 @@ Returns:
   //
   // Combine HiiBinary packages to a single package list
   //
-  if ((mOutImageType == FW_HII_PACKAGE_LIST_RCIMAGE) && ReplaceFlag) {
+  if ((OutImageType == FW_HII_PACKAGE_LIST_RCIMAGE) && ReplaceFlag) {
     Error (NULL, 0, 1002, "Conflicting option", "-r replace option cannot be used with --hiipackage merge files option.");
     goto Finish;
   }
 
-  if ((mOutImageType == FW_HII_PACKAGE_LIST_BINIMAGE) && ReplaceFlag) {
+  if ((OutImageType == FW_HII_PACKAGE_LIST_BINIMAGE) && ReplaceFlag) {
     Error (NULL, 0, 1002, "Conflicting option", "-r replace option cannot be used with --hiibinpackage merge files option.");
     goto Finish;
   }
@@ -1498,57 +2518,59 @@ Returns:
   //
   // Input image file
   //
-  mInImageName = InputFileName [InputFileNum - 1];
-  VerboseMsg ("the input file name is %s", mInImageName);
+  InImageName = InputFileName [InputFileNum - 1];
+  VerboseMsg ("the input file name is %s", InImageName);
 
   //
-  // Action will be taken for the input file.
+  // Actions will be taken for the input file.
   //
-  switch (mOutImageType) {
-  case FW_EFI_IMAGE:
-    VerboseMsg ("Create efi image on module type %s based on the input PE image.", ModuleType);
-    break;
-  case FW_TE_IMAGE:
-    VerboseMsg ("Create Te Image based on the input PE image.");
-    break;
-  case FW_ACPI_IMAGE:
-    VerboseMsg ("Get acpi table data from the input PE image.");
-    break;
-  case FW_RELOC_STRIPEED_IMAGE:
-    VerboseMsg ("Remove relocation section from Pe or Te image.");
-    break;
-  case FW_BIN_IMAGE:
-    VerboseMsg ("Convert the input EXE to the output BIN file.");
-    break;
-  case FW_ZERO_DEBUG_IMAGE:
-    VerboseMsg ("Zero the Debug Data Fields and Time Stamp in input PE image.");
-    break;
-  case FW_SET_STAMP_IMAGE:
-    VerboseMsg ("Set new time stamp %s in the input PE image.", TimeStamp);
-    break;
-  case DUMP_TE_HEADER:
-    VerboseMsg ("Dump the TE header information of the input TE image.");
-    break;
-  case FW_MCI_IMAGE:
-    VerboseMsg ("Conver input MicroCode.txt file to MicroCode.bin file.");
-    break;
-  case FW_MERGE_IMAGE:
-    VerboseMsg ("Combine the input multi microcode bin files to one bin file.");
-    break;
-  case FW_HII_PACKAGE_LIST_RCIMAGE:
-    VerboseMsg ("Combine the input multi hii bin packages to one text pacakge list RC file.");
-    break;
-  case FW_HII_PACKAGE_LIST_BINIMAGE:
-    VerboseMsg ("Combine the input multi hii bin packages to one binary pacakge list file.");
-    break;
-  case FW_REBASE_IMAGE:
-    VerboseMsg ("Rebase the input image to new base address.");
-    break;
-  case FW_SET_ADDRESS_IMAGE:
-    VerboseMsg ("Set the preferred address into the section header of the input image");
-    break;
-  default:
-    break;
+  for (Index = 0; Index < ActionNumber; Index++) {
+    switch (Actions[Index].Type) {
+    case FW_EFI_IMAGE:
+      VerboseMsg ("Create efi image on module type %s based on the input PE image.", Actions[Index].ModuleType);
+      break;
+    case FW_TE_IMAGE:
+      VerboseMsg ("Create Te Image based on the input PE image.");
+      break;
+    case FW_ACPI_IMAGE:
+      VerboseMsg ("Get acpi table data from the input PE image.");
+      break;
+    case FW_RELOC_STRIPEED_IMAGE:
+      VerboseMsg ("Remove relocation section from Pe or Te image.");
+      break;
+    case FW_BIN_IMAGE:
+      VerboseMsg ("Convert the input EXE to the output BIN file.");
+      break;
+    case FW_ZERO_DEBUG_IMAGE:
+      VerboseMsg ("Zero the Debug Data Fields and Time Stamp in input PE image.");
+      break;
+    case FW_SET_STAMP_IMAGE:
+      VerboseMsg ("Set new time stamp %s in the input PE image.", Actions[Index].TimeStamp);
+      break;
+    case DUMP_TE_HEADER:
+      VerboseMsg ("Dump the TE header information of the input TE image.");
+      break;
+    case FW_MCI_IMAGE:
+      VerboseMsg ("Conver input MicroCode.txt file to MicroCode.bin file.");
+      break;
+    case FW_MERGE_IMAGE:
+      VerboseMsg ("Combine the input multi microcode bin files to one bin file.");
+      break;
+    case FW_HII_PACKAGE_LIST_RCIMAGE:
+      VerboseMsg ("Combine the input multi hii bin packages to one text pacakge list RC file.");
+      break;
+    case FW_HII_PACKAGE_LIST_BINIMAGE:
+      VerboseMsg ("Combine the input multi hii bin packages to one binary pacakge list file.");
+      break;
+    case FW_REBASE_IMAGE:
+      VerboseMsg ("Rebase the input image to new base address.");
+      break;
+    case FW_SET_ADDRESS_IMAGE:
+      VerboseMsg ("Set the preferred address into the section header of the input image");
+      break;
+    default:
+      break;
+    }
   }
 
   if (ReplaceFlag) {
@@ -1582,7 +2604,7 @@ Returns:
       fpOut = NULL;
     }
     VerboseMsg ("Output file name is %s", OutImageName);
-  } else if (!ReplaceFlag && mOutImageType != DUMP_TE_HEADER) {
+  } else if (!ReplaceFlag && OutImageType != DUMP_TE_HEADER) {
     Error (NULL, 0, 1001, "Missing option", "output file");
     goto Finish;
   }
@@ -1590,9 +2612,9 @@ Returns:
   //
   // Open input file and read file data into file buffer.
   //
-  fpIn = fopen (mInImageName, "rb");
+  fpIn = fopen (InImageName, "rb");
   if (fpIn == NULL) {
-    Error (NULL, 0, 0001, "Error opening file", mInImageName);
+    Error (NULL, 0, 0001, "Error opening file", InImageName);
     goto Finish;
   }
   //
@@ -1601,23 +2623,22 @@ Returns:
   fstat(fileno (fpIn), &Stat_Buf);
   InputFileTime = Stat_Buf.st_mtime;
   //
-  // Get Input file data
+  // Get Input file data. It can't be mapped when the input file is replaced.
   //
   InputFileLength = _filelength (fileno (fpIn));
-  InputFileBuffer = malloc (InputFileLength);
+  InputFileBuffer = ReadInputFile (fpIn, InputFileLength, (BOOLEAN) !ReplaceFlag, &InputFileMapped);
   if (InputFileBuffer == NULL) {
     Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
     fclose (fpIn);
     goto Finish;
   }
-  fread (InputFileBuffer, 1, InputFileLength, fpIn);
   fclose (fpIn);
   DebugMsg (NULL, 0, 9, "input file info", "the input file size is %u bytes", (unsigned) InputFileLength);
 
   //
   // Combine multi binary HII package files.
   //
-  if (mOutImageType == FW_HII_PACKAGE_LIST_RCIMAGE || mOutImageType == FW_HII_PACKAGE_LIST_BINIMAGE) {
+  if (OutImageType == FW_HII_PACKAGE_LIST_RCIMAGE || OutImageType == FW_HII_PACKAGE_LIST_BINIMAGE) {
     //
     // Open output file handle.
     //
@@ -1694,7 +2715,7 @@ Returns:
     //
     // write the hii package into the binary package list file with the resource section header
     //
-    if (mOutImageType == FW_HII_PACKAGE_LIST_BINIMAGE) {
+    if (OutImageType == FW_HII_PACKAGE_LIST_BINIMAGE) {
       //
       // Create the resource section header
       //
@@ -1718,7 +2739,7 @@ Returns:
     //
     // write the hii package into the text package list rc file.
     //
-    if (mOutImageType == FW_HII_PACKAGE_LIST_RCIMAGE) {
+    if (OutImageType == FW_HII_PACKAGE_LIST_RCIMAGE) {
       for (Index = 0; gHiiPackageRCFileHeader[Index] != NULL; Index++) {
         fprintf (fpOut, "%s\n", gHiiPackageRCFileHeader[Index]);
       }
@@ -1753,7 +2774,7 @@ Returns:
   //
   // Combine MciBinary files to one file
   //
-  if (mOutImageType == FW_MERGE_IMAGE) {
+  if (OutImageType == FW_MERGE_IMAGE) {
     //
     // Open output file handle.
     //
@@ -1804,10 +2825,10 @@ Returns:
   //
   // Convert MicroCode.txt file to MicroCode.bin file
   //
-  if (mOutImageType == FW_MCI_IMAGE) {
-    fpIn = fopen (mInImageName, "r");
+  if (OutImageType == FW_MCI_IMAGE) {
+    fpIn = fopen (InImageName, "r");
     if (fpIn == NULL) {
-      Error (NULL, 0, 0001, "Error opening file", mInImageName);
+      Error (NULL, 0, 0001, "Error opening file", InImageName);
       goto Finish;
     }
 
@@ -1829,11 +2850,11 @@ Returns:
     // Error if no data.
     //
     if (FileLength == 0) {
-      Error (NULL, 0, 3000, "Invalid", "no parseable data found in file %s", mInImageName);
+      Error (NULL, 0, 3000, "Invalid", "no parseable data found in file %s", InImageName);
       goto Finish;
     }
     if (FileLength < sizeof (MICROCODE_IMAGE_HEADER)) {
-      Error (NULL, 0, 3000, "Invalid", "amount of parseable data in %s is insufficient to contain a microcode header", mInImageName);
+      Error (NULL, 0, 3000, "Invalid", "amount of parseable data in %s is insufficient to contain a microcode header", InImageName);
       goto Finish;
     }
 
@@ -1878,7 +2899,7 @@ Returns:
     }
 
     if (Index != FileLength) {
-      Error (NULL, 0, 3000, "Invalid", "file length of %s (0x%x) does not equal expected TotalSize: 0x%04X.", mInImageName, (unsigned) FileLength, (unsigned) Index);
+      Error (NULL, 0, 3000, "Invalid", "file length of %s (0x%x) does not equal expected TotalSize: 0x%04X.", InImageName, (unsigned) FileLength, (unsigned) Index);
       goto Finish;
     }
 
@@ -1894,843 +2915,777 @@ Returns:
       Index       += sizeof (*DataPointer);
     }
     if (CheckSum != 0) {
-      Error (NULL, 0, 3000, "Invalid", "checksum (0x%x) failed on file %s.", (unsigned) CheckSum, mInImageName);
-      goto Finish;
-    }
-    //
-    // Open the output file and write the buffer contents
-    //
-    VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
-    goto WriteFile;
-  }
-
-  //
-  // Open input file and read file data into file buffer.
-  //
-  FileLength = InputFileLength;
-  FileBuffer = malloc (FileLength);
-  if (FileBuffer == NULL) {
-    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
-    goto Finish;
-  }
-  memcpy (FileBuffer, InputFileBuffer, InputFileLength);
-
-  //
-  // Dump TeImage Header into output file.
-  //
-  if (mOutImageType == DUMP_TE_HEADER) {
-    memcpy (&TEImageHeader, FileBuffer, sizeof (TEImageHeader));
-    if (TEImageHeader.Signature != EFI_TE_IMAGE_HEADER_SIGNATURE) {
-      Error (NULL, 0, 3000, "Invalid", "TE header signature of file %s is not correct.", mInImageName);
-      goto Finish;
-    }
-    //
-    // Open the output file handle.
-    //
-    if (ReplaceFlag) {
-      fpInOut = fopen (mInImageName, "wb");
-      if (fpInOut == NULL) {
-        Error (NULL, 0, 0001, "Error opening file", mInImageName);
-        goto Finish;
-      }
-    } else {
-      if (OutImageName != NULL) {
-        fpOut = fopen (OutImageName, "wb");
-      } else {
-        fpOut = stdout;
-      }
-      if (fpOut == NULL) {
-        Error (NULL, 0, 0001, "Error opening output file", OutImageName);
-        goto Finish;
-      }
-    }
-    if (fpInOut != NULL) {
-      fprintf (fpInOut, "Dump of file %s\n\n", mInImageName);
-      fprintf (fpInOut, "TE IMAGE HEADER VALUES\n");
-      fprintf (fpInOut, "%17X machine\n", TEImageHeader.Machine);
-      fprintf (fpInOut, "%17X number of sections\n", TEImageHeader.NumberOfSections);
-      fprintf (fpInOut, "%17X subsystems\n", TEImageHeader.Subsystem);
-      fprintf (fpInOut, "%17X stripped size\n", TEImageHeader.StrippedSize);
-      fprintf (fpInOut, "%17X entry point\n", (unsigned) TEImageHeader.AddressOfEntryPoint);
-      fprintf (fpInOut, "%17X base of code\n", (unsigned) TEImageHeader.BaseOfCode);
-      fprintf (fpInOut, "%17llX image base\n", (unsigned long long)TEImageHeader.ImageBase);
-      fprintf (fpInOut, "%17X [%8X] RVA [size] of Base Relocation Directory\n", (unsigned) TEImageHeader.DataDirectory[0].VirtualAddress, (unsigned) TEImageHeader.DataDirectory[0].Size);
-      fprintf (fpInOut, "%17X [%8X] RVA [size] of Debug Directory\n", (unsigned) TEImageHeader.DataDirectory[1].VirtualAddress, (unsigned) TEImageHeader.DataDirectory[1].Size);
-    }
-    if (fpOut != NULL) {
-      fprintf (fpOut, "Dump of file %s\n\n", mInImageName);
-      fprintf (fpOut, "TE IMAGE HEADER VALUES\n");
-      fprintf (fpOut, "%17X machine\n", TEImageHeader.Machine);
-      fprintf (fpOut, "%17X number of sections\n", TEImageHeader.NumberOfSections);
-      fprintf (fpOut, "%17X subsystems\n", TEImageHeader.Subsystem);
-      fprintf (fpOut, "%17X stripped size\n", TEImageHeader.StrippedSize);
-      fprintf (fpOut, "%17X entry point\n", (unsigned) TEImageHeader.AddressOfEntryPoint);
-      fprintf (fpOut, "%17X base of code\n", (unsigned) TEImageHeader.BaseOfCode);
-      fprintf (fpOut, "%17llX image base\n", (unsigned long long)TEImageHeader.ImageBase);
-      fprintf (fpOut, "%17X [%8X] RVA [size] of Base Relocation Directory\n", (unsigned) TEImageHeader.DataDirectory[0].VirtualAddress, (unsigned) TEImageHeader.DataDirectory[0].Size);
-      fprintf (fpOut, "%17X [%8X] RVA [size] of Debug Directory\n", (unsigned) TEImageHeader.DataDirectory[1].VirtualAddress, (unsigned) TEImageHeader.DataDirectory[1].Size);
-    }
-    goto Finish;
-  }
-
-  //
-  // Following code to convert dll to efi image or te image.
-  // Get new image type
-  //
-  if ((mOutImageType == FW_EFI_IMAGE) || (mOutImageType == FW_TE_IMAGE)) {
-    if (ModuleType == NULL) {
-      if (mOutImageType == FW_EFI_IMAGE) {
-        Error (NULL, 0, 1001, "Missing option", "EFI_FILETYPE");
-        goto Finish;
-      } else if (mOutImageType == FW_TE_IMAGE) {
-        //
-        // Default TE Image Type is Boot service driver
-        //
-        Type = EFI_IMAGE_SUBSYSTEM_EFI_BOOT_SERVICE_DRIVER;
-        VerboseMsg ("Efi Image subsystem type is efi boot service driver.");
-      }
-    } else {
-      if (stricmp (ModuleType, "BASE") == 0 ||
-        stricmp (ModuleType, "SEC") == 0 ||
-        stricmp (ModuleType, "SECURITY_CORE") == 0 ||
-        stricmp (ModuleType, "PEI_CORE") == 0 ||
-        stricmp (ModuleType, "PEIM") == 0 ||
-        stricmp (ModuleType, "COMBINED_PEIM_DRIVER") == 0 ||
-        stricmp (ModuleType, "PIC_PEIM") == 0 ||
-        stricmp (ModuleType, "RELOCATABLE_PEIM") == 0 ||
-        stricmp (ModuleType, "DXE_CORE") == 0 ||
-        stricmp (ModuleType, "BS_DRIVER") == 0  ||
-        stricmp (ModuleType, "DXE_DRIVER") == 0 ||
-        stricmp (ModuleType, "DXE_SMM_DRIVER") == 0  ||
-        stricmp (ModuleType, "UEFI_DRIVER") == 0 ||
-        stricmp (ModuleType, "SMM_CORE") == 0) {
-          Type = EFI_IMAGE_SUBSYSTEM_EFI_BOOT_SERVICE_DRIVER;
-          VerboseMsg ("Efi Image subsystem type is efi boot service driver.");
-
-      } else if (stricmp (ModuleType, "UEFI_APPLICATION") == 0 ||
-        stricmp (ModuleType, "APPLICATION") == 0) {
-          Type = EFI_IMAGE_SUBSYSTEM_EFI_APPLICATION;
-          VerboseMsg ("Efi Image subsystem type is efi application.");
-
-      } else if (stricmp (ModuleType, "DXE_RUNTIME_DRIVER") == 0 ||
-        stricmp (ModuleType, "RT_DRIVER") == 0) {
-          Type = EFI_IMAGE_SUBSYSTEM_EFI_RUNTIME_DRIVER;
-          VerboseMsg ("Efi Image subsystem type is efi runtime driver.");
-
-      } else if (stricmp (ModuleType, "DXE_SAL_DRIVER") == 0 ||
-        stricmp (ModuleType, "SAL_RT_DRIVER") == 0) {
-          Type = EFI_IMAGE_SUBSYSTEM_SAL_RUNTIME_DRIVER;
-          VerboseMsg ("Efi Image subsystem type is efi sal runtime driver.");
-
-      } else {
-        Error (NULL, 0, 1003, "Invalid option value", "EFI_FILETYPE = %s", ModuleType);
-        goto Finish;
-      }
-    }
-  }
-
-  //
-  // Convert ELF image to PeImage
-  //
-  if (IsElfHeader(FileBuffer)) {
-    VerboseMsg ("Convert %s from ELF to PE/COFF.", mInImageName);
-    if (!ConvertElf(&FileBuffer, &FileLength)) {
-      Error (NULL, 0, 3000, "Invalid", "Unable to convert %s from ELF to PE/COFF.", mInImageName);
-      goto Finish;
-    }
-  }
-
-  //
-  // Make sure File Offsets and Virtual Offsets are the same in the image so it is XIP
-  // XIP == eXecute In Place
-  //
-  PeCoffConvertImageToXip (&FileBuffer, &FileLength);
-
-  //
-  // Remove reloc section from PE or TE image
-  //
-  if (mOutImageType == FW_RELOC_STRIPEED_IMAGE) {
-    //
-    // Check TeImage
-    //
-    TeHdr = (EFI_TE_IMAGE_HEADER *) FileBuffer;
-    if (TeHdr->Signature == EFI_TE_IMAGE_HEADER_SIGNATURE) {
-      SectionHeader = (EFI_IMAGE_SECTION_HEADER *) (TeHdr + 1);
-      for (Index = 0; Index < TeHdr->NumberOfSections; Index ++, SectionHeader ++) {
-        if (strcmp ((char *)SectionHeader->Name, ".reloc") == 0) {
-          //
-          // Check the reloc section is in the end of image.
-          //
-          if ((SectionHeader->PointerToRawData + SectionHeader->SizeOfRawData) ==
-            (FileLength + TeHdr->StrippedSize - sizeof (EFI_TE_IMAGE_HEADER))) {
-              //
-              // Remove .reloc section and update TeImage Header
-              //
-              FileLength = FileLength - SectionHeader->SizeOfRawData;
-              SectionHeader->SizeOfRawData = 0;
-              SectionHeader->Misc.VirtualSize = 0;
-              TeHdr->DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = 0;
-              TeHdr->DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size           = 0;
-              break;
-          }
-        }
-      }
-    } else {
-      //
-      // Check PE Image
-      //
-      DosHdr = (EFI_IMAGE_DOS_HEADER *) FileBuffer;
-      if (DosHdr->e_magic != EFI_IMAGE_DOS_SIGNATURE) {
-        PeHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(FileBuffer);
-        if (PeHdr->Pe32.Signature != EFI_IMAGE_NT_SIGNATURE) {
-          Error (NULL, 0, 3000, "Invalid", "TE and DOS header signatures were not found in %s image.", mInImageName);
-          goto Finish;
-        }
-        DosHdr = NULL;
-      } else {
-        PeHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(FileBuffer + DosHdr->e_lfanew);
-        if (PeHdr->Pe32.Signature != EFI_IMAGE_NT_SIGNATURE) {
-          Error (NULL, 0, 3000, "Invalid", "PE header signature was not found in %s image.", mInImageName);
-          goto Finish;
-        }
-      }
-      SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
-      for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index ++, SectionHeader ++) {
-        if (strcmp ((char *)SectionHeader->Name, ".reloc") == 0) {
-          //
-          // Check the reloc section is in the end of image.
-          //
-          if ((SectionHeader->PointerToRawData + SectionHeader->SizeOfRawData) == FileLength) {
-            //
-            // Remove .reloc section and update PeImage Header
-            //
-            FileLength = FileLength - SectionHeader->SizeOfRawData;
-
-            PeHdr->Pe32.FileHeader.Characteristics |= EFI_IMAGE_FILE_RELOCS_STRIPPED;
-            if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-              Optional32 = (EFI_IMAGE_OPTIONAL_HEADER32 *)&PeHdr->Pe32.OptionalHeader;
-              Optional32->SizeOfImage -= SectionHeader->SizeOfRawData;
-              Optional32->SizeOfInitializedData -= SectionHeader->SizeOfRawData;
-              if (Optional32->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC) {
-                Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = 0;
-                Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size = 0;
-              }
-            }
-            if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
-              Optional64 = (EFI_IMAGE_OPTIONAL_HEADER64 *)&PeHdr->Pe32.OptionalHeader;
-              Optional64->SizeOfImage -= SectionHeader->SizeOfRawData;
-              Optional64->SizeOfInitializedData -= SectionHeader->SizeOfRawData;
-              if (Optional64->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC) {
-                Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = 0;
-                Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size = 0;
-              }
-            }
-            SectionHeader->Misc.VirtualSize = 0;
-            SectionHeader->SizeOfRawData = 0;
-            break;
-          }
-        }
-      }
-    }
-    //
-    // Write file
-    //
-    goto WriteFile;
-  }
-  //
-  // Read the dos & pe hdrs of the image
-  //
-  DosHdr = (EFI_IMAGE_DOS_HEADER *)FileBuffer;
-  if (DosHdr->e_magic != EFI_IMAGE_DOS_SIGNATURE) {
-    // NO DOS header, check for PE/COFF header
-    PeHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(FileBuffer);
-    if (PeHdr->Pe32.Signature != EFI_IMAGE_NT_SIGNATURE) {
-      Error (NULL, 0, 3000, "Invalid", "DOS header signature was not found in %s image.", mInImageName);
-      goto Finish;
-    }
-    DosHdr = NULL;
-  } else {
-
-    PeHdr = (EFI_IMAGE_OPTIONAL_HEADER_UNION *)(FileBuffer + DosHdr->e_lfanew);
-    if (PeHdr->Pe32.Signature != EFI_IMAGE_NT_SIGNATURE) {
-      Error (NULL, 0, 3000, "Invalid", "PE header signature was not found in %s image.", mInImageName);
-      goto Finish;
-    }
-  }
-
-  if (PeHdr->Pe32.FileHeader.Machine == IMAGE_FILE_MACHINE_ARM) {
-    // Some tools kick out IMAGE_FILE_MACHINE_ARM (0x1c0) vs IMAGE_FILE_MACHINE_ARMT (0x1c2)
-    // so patch back to the offical UEFI value.
-    PeHdr->Pe32.FileHeader.Machine = IMAGE_FILE_MACHINE_ARMT;
-  }
-
-  //
-  // Set new base address into image
-  //
-  if (mOutImageType == FW_REBASE_IMAGE || mOutImageType == FW_SET_ADDRESS_IMAGE) {
-    if ((PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) && (PeHdr->Pe32.FileHeader.Machine != IMAGE_FILE_MACHINE_IA64)) {
-      if (NewBaseAddress >= 0x100000000ULL) {
-        Error (NULL, 0, 3000, "Invalid", "New base address is larger than 4G for 32bit PE image");
-        goto Finish;
-      }
-    }
-    
-    if (NegativeAddr) {
-      //
-      // Set Base Address to a negative value.
-      //
-      NewBaseAddress = (UINT64) (0 - NewBaseAddress);
-    }
-    if (mOutImageType == FW_REBASE_IMAGE) {
-      Status = RebaseImage (mInImageName, FileBuffer, NewBaseAddress);
-    } else {
-      Status = SetAddressToSectionHeader (mInImageName, FileBuffer, NewBaseAddress);
-    }
-    if (EFI_ERROR (Status)) {
-      if (NegativeAddr) {
-        Error (NULL, 0, 3000, "Invalid", "Rebase/Set Image %s to Base address -0x%llx can't success", mInImageName, 0 - NewBaseAddress);
-      } else {
-        Error (NULL, 0, 3000, "Invalid", "Rebase/Set Image %s to Base address 0x%llx can't success", mInImageName, NewBaseAddress);
-      }
+      Error (NULL, 0, 3000, "Invalid", "checksum (0x%x) failed on file %s.", (unsigned) CheckSum, InImageName);
       goto Finish;
     }
-
     //
-    // Write file
+    // Open the output file and write the buffer contents
     //
+    VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
     goto WriteFile;
   }
 
   //
-  // Extract bin data from Pe image.
+  // Dump TeImage Header into output file.
   //
-  if (mOutImageType == FW_BIN_IMAGE) {
-    if (FileLength < PeHdr->Pe32.OptionalHeader.SizeOfHeaders) {
-      Error (NULL, 0, 3000, "Invalid", "FileSize of %s is not a legal size.", mInImageName);
+  if (OutImageType == DUMP_TE_HEADER) {
+    memcpy (&TEImageHeader, InputFileBuffer, sizeof (TEImageHeader));
+    if (TEImageHeader.Signature != EFI_TE_IMAGE_HEADER_SIGNATURE) {
+      Error (NULL, 0, 3000, "Invalid", "TE header signature of file %s is not correct.", InImageName);
       goto Finish;
     }
     //
-    // Output bin data from exe file
+    // Open the output file handle.
     //
-    FileLength = FileLength - PeHdr->Pe32.OptionalHeader.SizeOfHeaders;
-    memmove (FileBuffer, FileBuffer + PeHdr->Pe32.OptionalHeader.SizeOfHeaders, FileLength);
-    VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
-    goto WriteFile;
+    if (ReplaceFlag) {
+      fpInOut = fopen (InImageName, "wb");
+      if (fpInOut == NULL) {
+        Error (NULL, 0, 0001, "Error opening file", InImageName);
+        goto Finish;
+      }
+    } else {
+      if (OutImageName != NULL) {
+        fpOut = fopen (OutImageName, "wb");
+      } else {
+        fpOut = stdout;
+      }
+      if (fpOut == NULL) {
+        Error (NULL, 0, 0001, "Error opening output file", OutImageName);
+        goto Finish;
+      }
+    }
+    if (fpInOut != NULL) {
+      fprintf (fpInOut, "Dump of file %s\n\n", InImageName);
+      fprintf (fpInOut, "TE IMAGE HEADER VALUES\n");
+      fprintf (fpInOut, "%17X machine\n", TEImageHeader.Machine);
+      fprintf (fpInOut, "%17X number of sections\n", TEImageHeader.NumberOfSections);
+      fprintf (fpInOut, "%17X subsystems\n", TEImageHeader.Subsystem);
+      fprintf (fpInOut, "%17X stripped size\n", TEImageHeader.StrippedSize);
+      fprintf (fpInOut, "%17X entry point\n", (unsigned) TEImageHeader.AddressOfEntryPoint);
+      fprintf (fpInOut, "%17X base of code\n", (unsigned) TEImageHeader.BaseOfCode);
+      fprintf (fpInOut, "%17llX image base\n", (unsigned long long)TEImageHeader.ImageBase);
+      fprintf (fpInOut, "%17X [%8X] RVA [size] of Base Relocation Directory\n", (unsigned) TEImageHeader.DataDirectory[0].VirtualAddress, (unsigned) TEImageHeader.DataDirectory[0].Size);
+      fprintf (fpInOut, "%17X [%8X] RVA [size] of Debug Directory\n", (unsigned) TEImageHeader.DataDirectory[1].VirtualAddress, (unsigned) TEImageHeader.DataDirectory[1].Size);
+    }
+    if (fpOut != NULL) {
+      fprintf (fpOut, "Dump of file %s\n\n", InImageName);
+      fprintf (fpOut, "TE IMAGE HEADER VALUES\n");
+      fprintf (fpOut, "%17X machine\n", TEImageHeader.Machine);
+      fprintf (fpOut, "%17X number of sections\n", TEImageHeader.NumberOfSections);
+      fprintf (fpOut, "%17X subsystems\n", TEImageHeader.Subsystem);
+      fprintf (fpOut, "%17X stripped size\n", TEImageHeader.StrippedSize);
+      fprintf (fpOut, "%17X entry point\n", (unsigned) TEImageHeader.AddressOfEntryPoint);
+      fprintf (fpOut, "%17X base of code\n", (unsigned) TEImageHeader.BaseOfCode);
+      fprintf (fpOut, "%17llX image base\n", (unsigned long long)TEImageHeader.ImageBase);
+      fprintf (fpOut, "%17X [%8X] RVA [size] of Base Relocation Directory\n", (unsigned) TEImageHeader.DataDirectory[0].VirtualAddress, (unsigned) TEImageHeader.DataDirectory[0].Size);
+      fprintf (fpOut, "%17X [%8X] RVA [size] of Debug Directory\n", (unsigned) TEImageHeader.DataDirectory[1].VirtualAddress, (unsigned) TEImageHeader.DataDirectory[1].Size);
+    }
+    goto Finish;
   }
 
   //
-  // Zero Debug Information of Pe Image
-  //
-  if (mOutImageType == FW_ZERO_DEBUG_IMAGE) {
-    Status = ZeroDebugData (FileBuffer, TRUE);
-    if (EFI_ERROR (Status)) {
-      Error (NULL, 0, 3000, "Invalid", "Zero DebugData Error status is 0x%x", (int) Status);
+  // Apply the actions one after the other, each one to the image made by
+  // the previous one, and write the last image.
+  //
+  for (Index = 0; Index < ActionNumber; Index++) {
+    if (ApplyImageAction (
+          &Actions[Index],
+          InImageName,
+          KeepExceptionTableFlag,
+          KeepZeroPendingFlag,
+          InputFileBuffer,
+          InputFileLength,
+          &FileBuffer,
+          &FileLength,
+          &ImageTimeStamp
+          ) != STATUS_SUCCESS) {
       goto Finish;
     }
-
-    //
-    // Write the updated Image
-    //
-    VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
-    goto WriteFile;
   }
 
+WriteFile:
   //
-  // Set Time Stamp of Pe Image
+  // Update Image to EfiImage or TE image
   //
-  if (mOutImageType == FW_SET_STAMP_IMAGE) {
-    Status = SetStamp (FileBuffer, TimeStamp);
-    if (EFI_ERROR (Status)) {
-      goto Finish;
+  if (ReplaceFlag) {
+    if ((FileLength != InputFileLength) || (memcmp (FileBuffer, InputFileBuffer, FileLength) != 0)) {
+      //
+      // Update File when File is changed.
+      //
+      fpInOut = fopen (InImageName, "wb");
+      if (fpInOut == NULL) {
+        Error (NULL, 0, 0001, "Error opening file", InImageName);
+        goto Finish;
+      }
+      fwrite (FileBuffer, 1, FileLength, fpInOut);
+      VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
+    }
+  } else {
+    if ((OutputFileTime < InputFileTime) || (FileLength != OutputFileLength) || (memcmp (FileBuffer, OutputFileBuffer, FileLength) != 0)) {
+      //
+      // Update File when File is changed or File is old.
+      //
+      fpOut = fopen (OutImageName, "wb");
+      if (fpOut == NULL) {
+        Error (NULL, 0, 0001, "Error opening output file", OutImageName);
+        goto Finish;
+      }
+      fwrite (FileBuffer, 1, FileLength, fpOut);
+      VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
     }
+  }
+  ImageSize = FileLength;
 
+Finish:
+  if (fpInOut != NULL) {
+    if (GetThreadUtilityStatus () != STATUS_SUCCESS) {
+      //
+      // when file updates failed, original file is still recovered.
+      //
+      fwrite (InputFileBuffer, 1, InputFileLength, fpInOut);
+    }
     //
-    // Write the updated Image
+    // Write converted data into fpInOut file and close input file.
     //
-    VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
-    goto WriteFile;
+    fclose (fpInOut);
   }
 
-  //
-  // Extract acpi data from pe image.
-  //
-  if (mOutImageType == FW_ACPI_IMAGE) {
-    SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
-    for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index ++, SectionHeader ++) {
-      if (strcmp ((char *)SectionHeader->Name, ".data") == 0 || strcmp ((char *)SectionHeader->Name, ".sdata") == 0) {
-        //
-        // Check Acpi Table
-        //
-        if (SectionHeader->Misc.VirtualSize < SectionHeader->SizeOfRawData) {
-          FileLength = SectionHeader->Misc.VirtualSize;
-        } else {
-          FileLength = SectionHeader->SizeOfRawData;
-        }
+  if (FileBuffer != NULL) {
+    free (FileBuffer);
+  }
 
-        if (CheckAcpiTable (FileBuffer + SectionHeader->PointerToRawData, FileLength) != STATUS_SUCCESS) {
-          Error (NULL, 0, 3000, "Invalid", "ACPI table check failed in %s.", mInImageName);
-          goto Finish;
-        }
+  if (InputFileName != NULL) {
+    free (InputFileName);
+  }
 
-        //
-        // Output Apci data to file
-        //
-        memmove (FileBuffer, FileBuffer + SectionHeader->PointerToRawData, FileLength);
-        VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
-        goto WriteFile;
+  if (Actions != NULL) {
+    free (Actions);
+  }
+
+  if (fpOut != NULL) {
+    //
+    // Write converted data into fpOut file and close output file.
+    //
+    fclose (fpOut);
+    if (GetThreadUtilityStatus () != STATUS_SUCCESS) {
+      if (OutputFileBuffer == NULL) {
+        remove (OutImageName);
+      } else {
+        fpOut = fopen (OutImageName, "wb");
+        fwrite (OutputFileBuffer, 1, OutputFileLength, fpOut);
+        fclose (fpOut);
       }
     }
-    Error (NULL, 0, 3000, "Invalid", "failed to get ACPI table from %s.", mInImageName);
-    goto Finish;
   }
-  //
-  // Zero all unused fields of the DOS header
-  //
-  if (DosHdr != NULL) {
-    memcpy (&BackupDosHdr, DosHdr, sizeof (EFI_IMAGE_DOS_HEADER));
-    memset (DosHdr, 0, sizeof (EFI_IMAGE_DOS_HEADER));
-    DosHdr->e_magic  = BackupDosHdr.e_magic;
-    DosHdr->e_lfanew = BackupDosHdr.e_lfanew;
+  
+  if (InputFileBuffer != NULL) {
+    FreeInputFile (InputFileBuffer, InputFileLength, InputFileMapped);
+  }
 
-    for (Index = sizeof (EFI_IMAGE_DOS_HEADER); Index < (UINT32 ) DosHdr->e_lfanew; Index++) {
-      FileBuffer[Index] = (UINT8) DosHdr->e_cp;
-    }
+  if (OutputFileBuffer != NULL) {
+    free (OutputFileBuffer);
   }
 
   //
-  // Initialize TeImage Header
+  // Write module size and time stamp to report file.
   //
-  memset (&TEImageHeader, 0, sizeof (EFI_TE_IMAGE_HEADER));
-  TEImageHeader.Signature        = EFI_TE_IMAGE_HEADER_SIGNATURE;
-  TEImageHeader.Machine          = PeHdr->Pe32.FileHeader.Machine;
-  TEImageHeader.NumberOfSections = (UINT8) PeHdr->Pe32.FileHeader.NumberOfSections;
-  TEImageHeader.StrippedSize     = (UINT16) ((UINTN) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader) - (UINTN) FileBuffer);
-  TEImageHeader.Subsystem        = (UINT8) Type;
+  if (OutImageName != NULL) {
+    FileLen = strlen (OutImageName);
+  }
+  if (FileLen >= 4 && strcmp (OutImageName + (FileLen - 4), ".efi") == 0) {
+    ReportFileName = (CHAR8 *) malloc (FileLen + 1);
+    if (ReportFileName != NULL) {
+      strcpy (ReportFileName, OutImageName);
+      strcpy (ReportFileName + (FileLen - 4), ".txt"); 
+      ReportFile = fopen (ReportFileName, "w+");
+      if (ReportFile != NULL) {
+        fprintf (ReportFile, "MODULE_SIZE = %u\n", (unsigned) ImageSize);
+        fprintf (ReportFile, "TIME_STAMP = %u\n", (unsigned) ImageTimeStamp);
+        fclose(ReportFile);
+      }
+      free (ReportFileName);
+    }
+  }
+  return GetThreadUtilityStatus ();
+}
 
-  //
-  // Patch the PE header
-  //
-  PeHdr->Pe32.OptionalHeader.Subsystem = (UINT16) Type;
+STATIC
+BOOLEAN
+IsValueOption (
+  IN CHAR8  *Option
+  )
+/*++
 
-  if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-    Optional32 = (EFI_IMAGE_OPTIONAL_HEADER32 *)&PeHdr->Pe32.OptionalHeader;
-    Optional32->MajorOperatingSystemVersion = 0;
-    Optional32->MinorOperatingSystemVersion = 0;
-    Optional32->MajorImageVersion           = 0;
-    Optional32->MinorImageVersion           = 0;
-    Optional32->MajorSubsystemVersion       = 0;
-    Optional32->MinorSubsystemVersion       = 0;
-    Optional32->Win32VersionValue           = 0;
-    Optional32->CheckSum                    = 0;
-    Optional32->SizeOfStackReserve = 0;
-    Optional32->SizeOfStackCommit  = 0;
-    Optional32->SizeOfHeapReserve  = 0;
-    Optional32->SizeOfHeapCommit   = 0;
+Routine Description:
 
-    TEImageHeader.AddressOfEntryPoint = Optional32->AddressOfEntryPoint;
-    TEImageHeader.BaseOfCode          = Optional32->BaseOfCode;
-    TEImageHeader.ImageBase           = (UINT64) (Optional32->ImageBase);
+  Tell whether an option of a GenFw command is followed by a value.
 
-    if (Optional32->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC) {
-      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress;
-      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size = Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size;
-    }
+Arguments:
 
-    if (Optional32->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_DEBUG) {
-      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_DEBUG].VirtualAddress = Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_DEBUG].VirtualAddress;
-      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_DEBUG].Size = Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_DEBUG].Size;
+  Option - The option.
+
+Returns:
+
+  TRUE if the next argument is the value of the option, not a file name.
+
+--*/
+{
+  UINTN   Index;
+
+  for (Index = 0; mValueOptions[Index] != NULL; Index++) {
+    if (stricmp (Option, mValueOptions[Index]) == 0) {
+      return TRUE;
     }
+  }
+  return FALSE;
+}
 
-    //
-    // Zero .pdata section data.
-    //
-    if (!KeepExceptionTableFlag && Optional32->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION &&
-      Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].VirtualAddress != 0 &&
-      Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].Size != 0) {
-        SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
-        for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index++, SectionHeader++) {
-          if (SectionHeader->VirtualAddress == Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].VirtualAddress) {
-            //
-            // Zero .pdata Section data
-            //
-            memset (FileBuffer + SectionHeader->PointerToRawData, 0, SectionHeader->SizeOfRawData);
-            //
-            // Zero .pdata Section header name
-            //
-            memset (SectionHeader->Name, 0, sizeof (SectionHeader->Name));
-            //
-            // Zero Execption Table
-            //
-            Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].VirtualAddress = 0;
-            Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].Size           = 0;
-            DebugMsg (NULL, 0, 9, "Zero the .pdata section for PE image", NULL);
-            break;
-          }
-        }
+STATIC
+EFI_STATUS
+ReadBatchManifest (
+  IN  CHAR8             *ManifestFileName,
+  IN  CHAR8             *ManifestImage,
+  OUT GENFW_BATCH_JOB   **Jobs,
+  OUT UINTN             *JobNumber
+  )
+/*++
+
+Routine Description:
+
+  Split the lines of a batch manifest into the arguments of their command.
+  The arguments are separated by blanks, an argument in double quotes can
+  contain blanks. A # outside quotes starts a comment that runs to the end
+  of the line, and lines without arguments are skipped.
+
+Arguments:
+
+  ManifestFileName - Name of the manifest, for the error messages.
+  ManifestImage - Content of the manifest, NULL terminated. The arguments
+                  are terminated in place and stay in this buffer.
+  Jobs          - Receives the commands, in manifest order.
+  JobNumber     - Receives the number of commands.
+
+Returns:
+
+  EFI_SUCCESS           - The manifest was read.
+  EFI_ABORTED           - A quote is not closed.
+  EFI_OUT_OF_RESOURCES  - No resource to hold the commands.
+
+--*/
+{
+  CHAR8             *Line;
+  CHAR8             *Next;
+  CHAR8             *Cptr;
+  UINT32            LineNumber;
+  UINTN             MaxNumber;
+  int               Argc;
+  GENFW_BATCH_JOB   *Job;
+  VOID              *NewBuffer;
+
+  *Jobs      = NULL;
+  *JobNumber = 0;
+  MaxNumber  = 0;
+
+  for (Line = ManifestImage, LineNumber = 1; *Line != '\0'; Line = Next, LineNumber++) {
+    for (Next = Line; *Next != '\0' && *Next != '\n'; Next++) {
+    }
+    if (*Next == '\n') {
+      *Next++ = '\0';
     }
 
     //
-    // Strip zero padding at the end of the .reloc section
+    // Count the arguments, then terminate them in place.
     //
-    if (!KeepZeroPendingFlag && Optional32->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC) {
-      if (Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size != 0) {
-        SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
-        for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index++, SectionHeader++) {
-          //
-          // Look for the Section Header that starts as the same virtual address as the Base Relocation Data Directory
-          //
-          if (SectionHeader->VirtualAddress == Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress) {
-            SectionHeader->Misc.VirtualSize = Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size;
-            AllignedRelocSize = (Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size + Optional32->FileAlignment - 1) & (~(Optional32->FileAlignment - 1));
-            //
-            // Check to see if there is zero padding at the end of the base relocations
-            //
-            if (AllignedRelocSize < SectionHeader->SizeOfRawData) {
-              //
-              // Check to see if the base relocations are at the end of the file
-              //
-              if (SectionHeader->PointerToRawData + SectionHeader->SizeOfRawData == Optional32->SizeOfImage) {
-                //
-                // All the required conditions are met to strip the zero padding of the end of the base relocations section
-                //
-                Optional32->SizeOfImage -= (SectionHeader->SizeOfRawData - AllignedRelocSize);
-                Optional32->SizeOfInitializedData -= (SectionHeader->SizeOfRawData - AllignedRelocSize);
-                SectionHeader->SizeOfRawData = AllignedRelocSize;
-                FileLength = Optional32->SizeOfImage;
-                DebugMsg (NULL, 0, 9, "Remove the zero padding bytes at the end of the base relocations", "The size of padding bytes is %u", (unsigned) (SectionHeader->SizeOfRawData - AllignedRelocSize));
-              }
-            }
-          }
+    Argc = 0;
+    for (Cptr = Line; ; Argc++) {
+      while (*Cptr == ' ' || *Cptr == '\t' || *Cptr == '\r') {
+        Cptr++;
+      }
+      if (*Cptr == '\0' || *Cptr == '#') {
+        break;
+      }
+      if (*Cptr == '"') {
+        Cptr = strchr (Cptr + 1, '"');
+        if (Cptr == NULL) {
+          Error (ManifestFileName, LineNumber, 2000, "Invalid parameter", "missing closing quote.");
+          return EFI_ABORTED;
+        }
+        Cptr++;
+      } else {
+        while (*Cptr != '\0' && *Cptr != ' ' && *Cptr != '\t' && *Cptr != '\r') {
+          Cptr++;
         }
       }
     }
-  } else if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
-    Optional64 = (EFI_IMAGE_OPTIONAL_HEADER64 *)&PeHdr->Pe32.OptionalHeader;
-    Optional64->MajorOperatingSystemVersion = 0;
-    Optional64->MinorOperatingSystemVersion = 0;
-    Optional64->MajorImageVersion           = 0;
-    Optional64->MinorImageVersion           = 0;
-    Optional64->MajorSubsystemVersion       = 0;
-    Optional64->MinorSubsystemVersion       = 0;
-    Optional64->Win32VersionValue           = 0;
-    Optional64->CheckSum                    = 0;
-    Optional64->SizeOfStackReserve = 0;
-    Optional64->SizeOfStackCommit  = 0;
-    Optional64->SizeOfHeapReserve  = 0;
-    Optional64->SizeOfHeapCommit   = 0;
-
-    TEImageHeader.AddressOfEntryPoint = Optional64->AddressOfEntryPoint;
-    TEImageHeader.BaseOfCode          = Optional64->BaseOfCode;
-    TEImageHeader.ImageBase           = (UINT64) (Optional64->ImageBase);
+    if (Argc == 0) {
+      continue;
+    }
 
-    if (Optional64->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC) {
-      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress;
-      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size = Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size;
+    if (*JobNumber == MaxNumber) {
+      MaxNumber = MaxNumber == 0 ? 64 : MaxNumber * 2;
+      NewBuffer = realloc (*Jobs, MaxNumber * sizeof (GENFW_BATCH_JOB));
+      if (NewBuffer == NULL) {
+        Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+        return EFI_OUT_OF_RESOURCES;
+      }
+      *Jobs = (GENFW_BATCH_JOB *) NewBuffer;
+    }
+    Job = &(*Jobs)[*JobNumber];
+    memset (Job, 0, sizeof (GENFW_BATCH_JOB));
+    Job->LineNumber = LineNumber;
+    Job->Argv       = (char **) malloc ((Argc + 1) * sizeof (char *));
+    if (Job->Argv == NULL) {
+      Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+      return EFI_OUT_OF_RESOURCES;
     }
+    (*JobNumber)++;
 
-    if (Optional64->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_DEBUG) {
-      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_DEBUG].VirtualAddress = Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_DEBUG].VirtualAddress;
-      TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_DEBUG].Size = Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_DEBUG].Size;
+    for (Cptr = Line; Job->Argc < Argc; ) {
+      while (*Cptr == ' ' || *Cptr == '\t' || *Cptr == '\r') {
+        Cptr++;
+      }
+      if (*Cptr == '"') {
+        Job->Argv[Job->Argc++] = ++Cptr;
+        Cptr = strchr (Cptr, '"');
+      } else {
+        Job->Argv[Job->Argc++] = Cptr;
+        while (*Cptr != '\0' && *Cptr != ' ' && *Cptr != '\t' && *Cptr != '\r') {
+          Cptr++;
+        }
+      }
+      if (*Cptr != '\0') {
+        *Cptr++ = '\0';
+      }
     }
+    Job->Argv[Argc] = NULL;
+  }
 
-    //
-    // Zero the .pdata section for X64 machine and don't check the Debug Directory is empty
-    // For Itaninum and X64 Image, remove .pdata section.
-    //
-    if ((!KeepExceptionTableFlag && PeHdr->Pe32.FileHeader.Machine == IMAGE_FILE_MACHINE_X64) || PeHdr->Pe32.FileHeader.Machine == IMAGE_FILE_MACHINE_IA64) {
-      if (Optional64->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION &&
-        Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].VirtualAddress != 0 &&
-        Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].Size != 0) {
-          SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
-          for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index++, SectionHeader++) {
-            if (SectionHeader->VirtualAddress == Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].VirtualAddress) {
-              //
-              // Zero .pdata Section header name
-              //
-              memset (SectionHeader->Name, 0, sizeof (SectionHeader->Name));
+  return EFI_SUCCESS;
+}
 
-              RuntimeFunction = (RUNTIME_FUNCTION *)(FileBuffer + SectionHeader->PointerToRawData);
-              for (Index1 = 0; Index1 < Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].Size / sizeof (RUNTIME_FUNCTION); Index1++, RuntimeFunction++) {
-                SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
-                for (Index2 = 0; Index2 < PeHdr->Pe32.FileHeader.NumberOfSections; Index2++, SectionHeader++) {
-                  if (RuntimeFunction->UnwindInfoAddress >= SectionHeader->VirtualAddress && RuntimeFunction->UnwindInfoAddress < (SectionHeader->VirtualAddress + SectionHeader->SizeOfRawData)) {
-                    UnwindInfo = (UNWIND_INFO *)(FileBuffer + SectionHeader->PointerToRawData + (RuntimeFunction->UnwindInfoAddress - SectionHeader->VirtualAddress));
-                    if (UnwindInfo->Version == 1) {
-                      memset (UnwindInfo + 1, 0, UnwindInfo->CountOfUnwindCodes * sizeof (UINT16));
-                      memset (UnwindInfo, 0, sizeof (UNWIND_INFO));
-                    }
-                    break;
-                  }
-                }
-                memset (RuntimeFunction, 0, sizeof (RUNTIME_FUNCTION));
-              }
-              //
-              // Zero Execption Table
-              //
-              Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].Size = 0;
-              Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_EXCEPTION].VirtualAddress = 0;
-              DebugMsg (NULL, 0, 9, "Zero the .pdata section if the machine type is X64 for PE32+ image", NULL);
-              break;
-            }
-          }
+STATIC
+int
+CompareBatchFile (
+  const VOID *File1,
+  const VOID *File2
+  )
+{
+  return strcmp (((const GENFW_BATCH_FILE *) File1)->Name, ((const GENFW_BATCH_FILE *) File2)->Name);
+}
+
+STATIC
+EFI_STATUS
+OrderBatchJobs (
+  IN OUT GENFW_BATCH_JOB  *Jobs,
+  IN     UINTN            JobNumber,
+  OUT    UINTN            *LevelNumber
+  )
+/*++
+
+Routine Description:
+
+  Give each command of a batch the level it runs at. A command that uses a
+  file written by an earlier command, or writes a file used by an earlier
+  command, runs at a later level. The commands of a level are independent
+  and run at the same time.
+
+  A command writes the file given with -o, and with -r its last input file.
+  The other arguments that are neither options nor option values are its
+  input files. Files are compared by their name in the manifest.
+
+Arguments:
+
+  Jobs        - The commands, in manifest order. Receive their level.
+  JobNumber   - Number of commands.
+  LevelNumber - Receives the number of levels.
+
+Returns:
+
+  EFI_SUCCESS           - The levels are set.
+  EFI_OUT_OF_RESOURCES  - No resource to sort the files.
+
+--*/
+{
+  GENFW_BATCH_FILE  *Files;
+  GENFW_BATCH_FILE  *File;
+  GENFW_BATCH_FILE  Key;
+  UINTN             FileNumber;
+  UINTN             Index;
+  UINTN             Pass;
+  int               Arg;
+  int               LastInput;
+  BOOLEAN           Replace;
+  BOOLEAN           Write;
+
+  *LevelNumber = 0;
+
+  //
+  // One entry per distinct argument.
+  //
+  FileNumber = 0;
+  for (Index = 0; Index < JobNumber; Index++) {
+    FileNumber += Jobs[Index].Argc;
+  }
+  Files = (GENFW_BATCH_FILE *) malloc ((FileNumber + 1) * sizeof (GENFW_BATCH_FILE));
+  if (Files == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    return EFI_OUT_OF_RESOURCES;
+  }
+  FileNumber = 0;
+  for (Index = 0; Index < JobNumber; Index++) {
+    for (Arg = 0; Arg < Jobs[Index].Argc; Arg++) {
+      Files[FileNumber].Name       = Jobs[Index].Argv[Arg];
+      Files[FileNumber].WriteLevel = 0;
+      Files[FileNumber].UseLevel   = 0;
+      FileNumber++;
+    }
+  }
+  qsort (Files, FileNumber, sizeof (GENFW_BATCH_FILE), CompareBatchFile);
+
+  for (Index = 0; Index < JobNumber; Index++) {
+    Replace   = FALSE;
+    LastInput = -1;
+    for (Arg = 0; Arg < Jobs[Index].Argc; Arg++) {
+      if ((stricmp (Jobs[Index].Argv[Arg], "-r") == 0) || (stricmp (Jobs[Index].Argv[Arg], "--replace") == 0)) {
+        Replace = TRUE;
+      } else if (IsValueOption (Jobs[Index].Argv[Arg])) {
+        Arg++;
+      } else if (Jobs[Index].Argv[Arg][0] != '-') {
+        LastInput = Arg;
       }
     }
 
     //
-    // Strip zero padding at the end of the .reloc section
+    // First pass finds the level of the command from its files, the second
+    // one records that the command uses them at this level. The levels of
+    // the files are 1 based, 0 when no command used the file yet.
     //
-    if (!KeepZeroPendingFlag && Optional64->NumberOfRvaAndSizes > EFI_IMAGE_DIRECTORY_ENTRY_DEBUG) {
-      if (Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size != 0) {
-        SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
-        for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index++, SectionHeader++) {
-          //
-          // Look for the Section Header that starts as the same virtual address as the Base Relocation Data Directory
-          //
-          if (SectionHeader->VirtualAddress == Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress) {
-            SectionHeader->Misc.VirtualSize = Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size;
-            AllignedRelocSize = (Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size + Optional64->FileAlignment - 1) & (~(Optional64->FileAlignment - 1));
-            //
-            // Check to see if there is zero padding at the end of the base relocations
-            //
-            if (AllignedRelocSize < SectionHeader->SizeOfRawData) {
-              //
-              // Check to see if the base relocations are at the end of the file
-              //
-              if (SectionHeader->PointerToRawData + SectionHeader->SizeOfRawData == Optional64->SizeOfImage) {
-                //
-                // All the required conditions are met to strip the zero padding of the end of the base relocations section
-                //
-                Optional64->SizeOfImage -= (SectionHeader->SizeOfRawData - AllignedRelocSize);
-                Optional64->SizeOfInitializedData -= (SectionHeader->SizeOfRawData - AllignedRelocSize);
-                SectionHeader->SizeOfRawData = AllignedRelocSize;
-                FileLength = Optional64->SizeOfImage;
-                DebugMsg (NULL, 0, 9, "Remove the zero padding bytes at the end of the base relocations", "The size of padding bytes is %u", (unsigned) (SectionHeader->SizeOfRawData - AllignedRelocSize));
-              }
-            }
+    for (Pass = 0; Pass < 2; Pass++) {
+      for (Arg = 0; Arg < Jobs[Index].Argc; Arg++) {
+        Write = FALSE;
+        if (IsValueOption (Jobs[Index].Argv[Arg])) {
+          if ((stricmp (Jobs[Index].Argv[Arg], "-o") != 0) && (stricmp (Jobs[Index].Argv[Arg], "--outputfile") != 0)) {
+            Arg++;
+            continue;
+          }
+          Arg++;
+          if (Arg == Jobs[Index].Argc) {
+            break;
+          }
+          Write = TRUE;
+        } else if (Jobs[Index].Argv[Arg][0] == '-') {
+          continue;
+        } else if (Replace && Arg == LastInput) {
+          Write = TRUE;
+        }
+
+        Key.Name = Jobs[Index].Argv[Arg];
+        File     = (GENFW_BATCH_FILE *) bsearch (&Key, Files, FileNumber, sizeof (GENFW_BATCH_FILE), CompareBatchFile);
+        if (Pass == 0) {
+          if (Jobs[Index].Level < File->WriteLevel) {
+            Jobs[Index].Level = File->WriteLevel;
+          }
+          if (Write && Jobs[Index].Level < File->UseLevel) {
+            Jobs[Index].Level = File->UseLevel;
+          }
+        } else {
+          if (File->UseLevel < Jobs[Index].Level + 1) {
+            File->UseLevel = Jobs[Index].Level + 1;
+          }
+          if (Write) {
+            File->WriteLevel = Jobs[Index].Level + 1;
           }
         }
       }
     }
-  } else {
-    Error (NULL, 0, 3000, "Invalid", "Magic 0x%x of PeImage %s is unknown.", PeHdr->Pe32.OptionalHeader.Magic, mInImageName);
-    goto Finish;
-  }
 
-  if (((PeHdr->Pe32.FileHeader.Characteristics & EFI_IMAGE_FILE_RELOCS_STRIPPED) == 0) && \
-    (TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress == 0) && \
-    (TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].Size == 0)) {
-      //
-      // PeImage can be loaded into memory, but it has no relocation section. 
-      // Fix TeImage Header to set VA of relocation data directory to not zero, the size is still zero.
-      //
-      if (Optional32 != NULL) {
-        TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = Optional32->SizeOfImage - sizeof (EFI_IMAGE_BASE_RELOCATION);
-      } else if (Optional64 != NULL) {
-        TEImageHeader.DataDirectory[EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress = Optional64->SizeOfImage - sizeof (EFI_IMAGE_BASE_RELOCATION);
-      }
+    if (*LevelNumber < Jobs[Index].Level + 1) {
+      *LevelNumber = Jobs[Index].Level + 1;
+    }
   }
 
-  //
-  // Fill HII section data
-  //
-  SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
-  for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index++) {
-    if (stricmp ((char *)SectionHeader[Index].Name, ".hii") == 0) {
-      //
-      // Update resource section header offset
-      //
-      SetHiiResourceHeader ((UINT8*) FileBuffer + SectionHeader[Index].PointerToRawData, SectionHeader[Index].VirtualAddress);
-      //
-      // Update resource section name
-      //
-      strcpy((char *) SectionHeader[Index].Name, ".rsrc");
-      //
-      // Update resource data directory.
-      //
-      if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-        Optional32 = (EFI_IMAGE_OPTIONAL_HEADER32 *)&PeHdr->Pe32.OptionalHeader;
-        Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_RESOURCE].VirtualAddress = SectionHeader[Index].VirtualAddress;
-        Optional32->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_RESOURCE].Size = SectionHeader[Index].Misc.VirtualSize;
-      } else if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
-        Optional64 = (EFI_IMAGE_OPTIONAL_HEADER64 *)&PeHdr->Pe32.OptionalHeader;
-        Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_RESOURCE].VirtualAddress = SectionHeader[Index].VirtualAddress;
-        Optional64->DataDirectory[EFI_IMAGE_DIRECTORY_ENTRY_RESOURCE].Size = SectionHeader[Index].Misc.VirtualSize;
+  free (Files);
+  return EFI_SUCCESS;
+}
+
+STATIC
+VOID
+RunBatchJob (
+  IN VOID   *Context,
+  IN UINTN  JobIndex,
+  IN UINTN  WorkerIndex
+  )
+/*++
+
+Routine Description:
+
+  Run one command of a batch level, as a worker of RunParallelJobs.
+
+Arguments:
+
+  Context     - The commands of the level.
+  JobIndex    - Index of the command to run.
+  WorkerIndex - Index of the worker, not used.
+
+Returns:
+
+  None
+
+--*/
+{
+  GENFW_BATCH_JOB   *Job;
+
+  Job = ((GENFW_BATCH_JOB **) Context)[JobIndex];
+  Job->Status = ProcessImage (Job->Argc, Job->Argv, TRUE);
+  Job->Done   = TRUE;
+}
+
+STATIC
+STATUS
+ProcessBatch (
+  IN int   argc,
+  IN char  *argv[]
+  )
+/*++
+
+Routine Description:
+
+  Run the commands of a batch manifest, one GenFw command per line, on a
+  pool of threads. Commands run at the same time unless they share a file
+  that one of them writes, see OrderBatchJobs. Each failed command is
+  reported with its line in the manifest, and the commands that come after
+  it in the order are not run.
+
+Arguments:
+
+  argc - Number of options.
+  argv - The options: --batch, --threads and the message options.
+
+Returns:
+
+  STATUS_SUCCESS - All the commands succeeded.
+  STATUS_ERROR   - The manifest is not valid or a command failed.
+
+--*/
+{
+  CHAR8             *ManifestFileName;
+  CHAR8             *ManifestImage;
+  CHAR8             *Manifest;
+  UINT32            ManifestSize;
+  GENFW_BATCH_JOB   *Jobs;
+  GENFW_BATCH_JOB   **LevelJobs;
+  UINTN             JobNumber;
+  UINTN             LevelNumber;
+  UINTN             Level;
+  UINTN             Number;
+  UINTN             Index;
+  UINTN             FailedNumber;
+  UINTN             WorkerCount;
+  UINT64            Temp64;
+  UINT64            LogLevel;
+  EFI_STATUS        Status;
+
+  ManifestFileName = NULL;
+  Manifest         = NULL;
+  Jobs             = NULL;
+  LevelJobs        = NULL;
+  JobNumber        = 0;
+  FailedNumber     = 0;
+  WorkerCount      = 0;
+
+  while (argc > 0) {
+    if (stricmp (argv[0], "--batch") == 0) {
+      if (argv[1] == NULL || argv[1][0] == '-') {
+        Error (NULL, 0, 1003, "Invalid option value", "Batch manifest is missing for --batch option");
+        return STATUS_ERROR;
       }
-      break;
+      ManifestFileName = argv[1];
+      argc -= 2;
+      argv += 2;
+      continue;
     }
-  }
 
-  //
-  // Zero ExceptionTable Xdata
-  //
-  if (!KeepExceptionTableFlag) {
-    SectionHeader = (EFI_IMAGE_SECTION_HEADER *) ((UINT8 *) &(PeHdr->Pe32.OptionalHeader) + PeHdr->Pe32.FileHeader.SizeOfOptionalHeader);
-    for (Index = 0; Index < PeHdr->Pe32.FileHeader.NumberOfSections; Index++) {
-      if (stricmp ((char *)SectionHeader[Index].Name, ".xdata") == 0) {
-        //
-        // zero .xdata section
-        //
-        memset (FileBuffer + SectionHeader[Index].PointerToRawData, 0, SectionHeader[Index].SizeOfRawData);
-        DebugMsg (NULL, 0, 9, NULL, "Zero the .xdata section for PE image at Offset 0x%x and Length 0x%x", (unsigned) SectionHeader[Index].PointerToRawData, (unsigned) SectionHeader[Index].SizeOfRawData);
-        break;
+    if (stricmp (argv[0], "--threads") == 0) {
+      Status = AsciiStringToUint64 (argv[1], FALSE, &Temp64);
+      if (EFI_ERROR (Status) || Temp64 == 0 || Temp64 > MAX_PARALLEL_WORKERS) {
+        Error (NULL, 0, 1003, "Invalid option value", "%s = %s, it must be between 1 and %u", argv[0], argv[1], (unsigned) MAX_PARALLEL_WORKERS);
+        return STATUS_ERROR;
       }
+      WorkerCount = (UINTN) Temp64;
+      argc -= 2;
+      argv += 2;
+      continue;
     }
-  }
-
-  //
-  // Zero Time/Data field
-  //
-  ZeroDebugData (FileBuffer, FALSE);
 
-  if (mOutImageType == FW_TE_IMAGE) {
-    if ((PeHdr->Pe32.FileHeader.NumberOfSections &~0xFF) || (Type &~0xFF)) {
-      //
-      // Pack the subsystem and NumberOfSections into 1 byte. Make sure they fit both.
-      //
-      Error (NULL, 0, 3000, "Invalid", "Image's subsystem or NumberOfSections of PeImage %s cannot be packed into 1 byte.", mInImageName);
-      goto Finish;
+    if ((stricmp (argv[0], "-v") == 0) || (stricmp (argv[0], "--verbose") == 0)) {
+      SetPrintLevel (VERBOSE_LOG_LEVEL);
+      VerboseMsg ("Verbose output Mode Set!");
+      argc --;
+      argv ++;
+      continue;
     }
 
-    if ((PeHdr->Pe32.OptionalHeader.SectionAlignment != PeHdr->Pe32.OptionalHeader.FileAlignment)) {
-      //
-      // TeImage has the same section alignment and file alignment.
-      //
-      Error (NULL, 0, 3000, "Invalid", "Section-Alignment and File-Alignment of PeImage %s do not match, they must be equal for a TeImage.", mInImageName);
-      goto Finish;
+    if ((stricmp (argv[0], "-q") == 0) || (stricmp (argv[0], "--quiet") == 0)) {
+      SetPrintLevel (KEY_LOG_LEVEL);
+      KeyMsg ("Quiet output Mode Set!");
+      argc --;
+      argv ++;
+      continue;
     }
 
-    DebugMsg (NULL, 0, 9, "TeImage Header Info", "Machine type is %X, Number of sections is %X, Stripped size is %X, EntryPoint is %X, BaseOfCode is %X, ImageBase is %llX",
-      TEImageHeader.Machine, TEImageHeader.NumberOfSections, TEImageHeader.StrippedSize, (unsigned) TEImageHeader.AddressOfEntryPoint, (unsigned) TEImageHeader.BaseOfCode, (unsigned long long) TEImageHeader.ImageBase);
-    //
-    // Update Image to TeImage
-    //
-    FileLength = FileLength - TEImageHeader.StrippedSize;
-    memmove (FileBuffer + sizeof (EFI_TE_IMAGE_HEADER), FileBuffer + TEImageHeader.StrippedSize, FileLength);
-    FileLength = FileLength + sizeof (EFI_TE_IMAGE_HEADER);
-    memcpy (FileBuffer, &TEImageHeader, sizeof (EFI_TE_IMAGE_HEADER));
-    VerboseMsg ("the size of output file is %u bytes", (unsigned) (FileLength));
-  } else {
-
-    //
-    // Following codes are to fix the objcopy's issue:
-    // objcopy in binutil 2.50.18 will set PE image's charactices to "RELOC_STRIPPED" if image has no ".reloc" section
-    // It cause issue for EFI image which has no ".reloc" sections.
-    // Following codes will be removed when objcopy in binutil fix this problem for PE image.
-    //
-    if ((PeHdr->Pe32.FileHeader.Characteristics & EFI_IMAGE_FILE_RELOCS_STRIPPED) != 0) {
-      if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
-        Optional32 = (EFI_IMAGE_OPTIONAL_HEADER32 *)&PeHdr->Pe32.OptionalHeader;
-        if (Optional32->ImageBase == 0) {
-          PeHdr->Pe32.FileHeader.Characteristics &= ~EFI_IMAGE_FILE_RELOCS_STRIPPED;
-        }
-      } else if (PeHdr->Pe32.OptionalHeader.Magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
-        Optional64 = (EFI_IMAGE_OPTIONAL_HEADER64 *)&PeHdr->Pe32.OptionalHeader;
-        if (Optional64->ImageBase == 0) {
-          PeHdr->Pe32.FileHeader.Characteristics &= ~EFI_IMAGE_FILE_RELOCS_STRIPPED;
-        }
+    if ((stricmp (argv[0], "-d") == 0) || (stricmp (argv[0], "--debug") == 0)) {
+      Status = AsciiStringToUint64 (argv[1], FALSE, &LogLevel);
+      if (EFI_ERROR (Status)) {
+        Error (NULL, 0, 1003, "Invalid option value", "%s = %s", argv[0], argv[1]);
+        return STATUS_ERROR;
+      }
+      if (LogLevel > 9) {
+        Error (NULL, 0, 1003, "Invalid option value", "Debug Level range is 0-9, currnt input level is %d", (int) LogLevel);
+        return STATUS_ERROR;
       }
+      SetPrintLevel (LogLevel);
+      DebugMsg (NULL, 0, 9, "Debug Mode Set", "Debug Output Mode Level %s is set!", argv[1]);
+      argc -= 2;
+      argv += 2;
+      continue;
     }
+
+    Error (NULL, 0, 1000, "Invalid option", "--batch can only be combined with --threads and the message options, %s belongs in the manifest.", argv[0]);
+    return STATUS_ERROR;
   }
 
-WriteFile:
+  VerboseMsg ("%s tool start.", UTILITY_NAME);
+  VerboseMsg ("the batch manifest is %s", ManifestFileName);
+
   //
-  // Update Image to EfiImage or TE image
+  // Read the manifest, with room for a terminating NULL.
   //
-  if (ReplaceFlag) {
-    if ((FileLength != InputFileLength) || (memcmp (FileBuffer, InputFileBuffer, FileLength) != 0)) {
-      //
-      // Update File when File is changed.
-      //
-      fpInOut = fopen (mInImageName, "wb");
-      if (fpInOut == NULL) {
-        Error (NULL, 0, 0001, "Error opening file", mInImageName);
-        goto Finish;
+  if (GetFileImage (ManifestFileName, &ManifestImage, &ManifestSize) != EFI_SUCCESS) {
+    return STATUS_ERROR;
+  }
+  Manifest = (CHAR8 *) malloc (ManifestSize + 1);
+  if (Manifest == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    free (ManifestImage);
+    return STATUS_ERROR;
+  }
+  memcpy (Manifest, ManifestImage, ManifestSize);
+  Manifest[ManifestSize] = '\0';
+  free (ManifestImage);
+
+  if (ReadBatchManifest (ManifestFileName, Manifest, &Jobs, &JobNumber) != EFI_SUCCESS) {
+    Error (ManifestFileName, 0, 0003, "Error parsing file", "the batch manifest %s.", ManifestFileName);
+    goto Finish;
+  }
+  if (OrderBatchJobs (Jobs, JobNumber, &LevelNumber) != EFI_SUCCESS) {
+    goto Finish;
+  }
+  LevelJobs = (GENFW_BATCH_JOB **) malloc ((JobNumber + 1) * sizeof (GENFW_BATCH_JOB *));
+  if (LevelJobs == NULL) {
+    Error (NULL, 0, 4001, "Resource", "memory cannot be allocated!");
+    goto Finish;
+  }
+
+  if (WorkerCount == 0) {
+    WorkerCount = GetProcessorCount ();
+  }
+  VerboseMsg ("Run %u commands in %u steps on %u threads", (unsigned) JobNumber, (unsigned) LevelNumber, (unsigned) WorkerCount);
+
+  //
+  // Levels run one after the other, the commands of a level at the same
+  // time. Stop after the level where a command failed, as the commands of
+  // the next levels may need its output.
+  //
+  for (Level = 0; Level < LevelNumber && FailedNumber == 0; Level++) {
+    for (Index = 0, Number = 0; Index < JobNumber; Index++) {
+      if (Jobs[Index].Level == Level) {
+        LevelJobs[Number++] = &Jobs[Index];
       }
-      fwrite (FileBuffer, 1, FileLength, fpInOut);
-      VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
     }
-  } else {
-    if ((OutputFileTime < InputFileTime) || (FileLength != OutputFileLength) || (memcmp (FileBuffer, OutputFileBuffer, FileLength) != 0)) {
-      //
-      // Update File when File is changed or File is old.
-      //
-      fpOut = fopen (OutImageName, "wb");
-      if (fpOut == NULL) {
-        Error (NULL, 0, 0001, "Error opening output file", OutImageName);
-        goto Finish;
+    RunParallelJobs (RunBatchJob, LevelJobs, Number, WorkerCount);
+    for (Index = 0; Index < Number; Index++) {
+      if (LevelJobs[Index]->Status != STATUS_SUCCESS) {
+        Error (ManifestFileName, LevelJobs[Index]->LineNumber, 3000, "Invalid", "the command of this line failed.");
+        FailedNumber++;
       }
-      fwrite (FileBuffer, 1, FileLength, fpOut);
-      VerboseMsg ("the size of output file is %u bytes", (unsigned) FileLength);
     }
   }
-  mImageSize = FileLength;
 
-Finish:
-  if (fpInOut != NULL) {
-    if (GetUtilityStatus () != STATUS_SUCCESS) {
-      //
-      // when file updates failed, original file is still recovered.
-      //
-      fwrite (InputFileBuffer, 1, InputFileLength, fpInOut);
+  for (Index = 0, Number = 0; Index < JobNumber; Index++) {
+    if (!Jobs[Index].Done) {
+      Number++;
     }
-    //
-    // Write converted data into fpInOut file and close input file.
-    //
-    fclose (fpInOut);
   }
-
-  if (FileBuffer != NULL) {
-    free (FileBuffer);
+  if (Number != 0) {
+    Error (ManifestFileName, 0, 3000, "Invalid", "%u commands failed, %u commands were not run.", (unsigned) FailedNumber, (unsigned) Number);
   }
 
-  if (InputFileName != NULL) {
-    free (InputFileName);
+Finish:
+  for (Index = 0; Index < JobNumber; Index++) {
+    free (Jobs[Index].Argv);
   }
+  free (Jobs);
+  free (LevelJobs);
+  free (Manifest);
+  return GetUtilityStatus ();
+}
 
-  if (fpOut != NULL) {
-    //
-    // Write converted data into fpOut file and close output file.
-    //
-    fclose (fpOut);
-    if (GetUtilityStatus () != STATUS_SUCCESS) {
-      if (OutputFileBuffer == NULL) {
-        remove (OutImageName);
-      } else {
-        fpOut = fopen (OutImageName, "wb");
-        fwrite (OutputFileBuffer, 1, OutputFileLength, fpOut);
-        fclose (fpOut);
-      }
-    }
+int
+main (
+  int  argc,
+  char *argv[]
+  )
+/*++
+
+Routine Description:
+
+  Main function.
+
+Arguments:
+
+  argc - Number of command line parameters.
+  argv - Array of pointers to command line parameter strings.
+
+Returns:
+  STATUS_SUCCESS - Utility exits successfully.
+  STATUS_ERROR   - Some error occurred during execution.
+
+--*/
+{
+  int     Index;
+
+  SetUtilityName (UTILITY_NAME);
+
+  if (argc == 1) {
+    Error (NULL, 0, 1001, "Missing options", "No input options.");
+    Usage ();
+    return STATUS_ERROR;
   }
-  
-  if (InputFileBuffer != NULL) {
-    free (InputFileBuffer);
+
+  if ((stricmp (argv[1], "-h") == 0) || (stricmp (argv[1], "--help") == 0)) {
+    Version ();
+    Usage ();
+    return STATUS_SUCCESS;
   }
 
-  if (OutputFileBuffer != NULL) {
-    free (OutputFileBuffer);
+  if (stricmp (argv[1], "--version") == 0) {
+    Version ();
+    return STATUS_SUCCESS;
   }
 
   //
-  // Write module size and time stamp to report file.
+  // With --batch the commands come from the manifest.
   //
-  if (OutImageName != NULL) {
-    FileLen = strlen (OutImageName);
-  }
-  if (FileLen >= 4 && strcmp (OutImageName + (FileLen - 4), ".efi") == 0) {
-    ReportFileName = (CHAR8 *) malloc (FileLen + 1);
-    if (ReportFileName != NULL) {
-      strcpy (ReportFileName, OutImageName);
-      strcpy (ReportFileName + (FileLen - 4), ".txt"); 
-      ReportFile = fopen (ReportFileName, "w+");
-      if (ReportFile != NULL) {
-        fprintf (ReportFile, "MODULE_SIZE = %u\n", (unsigned) mImageSize);
-        fprintf (ReportFile, "TIME_STAMP = %u\n", (unsigned) mImageTimeStamp);
-        fclose(ReportFile);
-      }
-      free (ReportFileName);
+  for (Index = 1; Index < argc; Index++) {
+    if (stricmp (argv[Index], "--batch") == 0) {
+      ProcessBatch (argc - 1, argv + 1);
+      break;
     }
   }
+  if (Index == argc) {
+    ProcessImage (argc - 1, argv + 1, FALSE);
+  }
+
   VerboseMsg ("%s tool done with return code is 0x%x.", UTILITY_NAME, GetUtilityStatus ());
 
   return GetUtilityStatus ();
@@ -2740,7 +3695,8 @@ STATIC
 EFI_STATUS
 ZeroDebugData (
   IN OUT UINT8   *FileBuffer,
-  BOOLEAN        ZeroDebugFlag
+  BOOLEAN        ZeroDebugFlag,
+  OUT UINT32     *ImageTimeStamp
   )
 /*++
 
@@ -2752,6 +3708,7 @@ Arguments:
 
   FileBuffer    - Pointer to PeImage.
   ZeroDebugFlag - TRUE to zero Debug information, FALSE to only zero time/stamp
+  ImageTimeStamp - Receives the new time stamp of the image, 0.
 
 Returns:
 
@@ -2865,7 +3822,7 @@ Returns:
   //Zero Debug Data and TimeStamp
   //
   FileHdr->TimeDateStamp = 0;
-  mImageTimeStamp = 0;
+  *ImageTimeStamp = 0;
   if (ExportDirectoryEntryFileOffset != 0) {
     NewTimeStamp  = (UINT32 *) (FileBuffer + ExportDirectoryEntryFileOffset + sizeof (UINT32));
     *NewTimeStamp = 0;
@@ -2879,7 +3836,7 @@ Returns:
   if (DebugDirectoryEntryFileOffset != 0) {
     DebugEntry = (EFI_IMAGE_DEBUG_DIRECTORY_ENTRY *) (FileBuffer + DebugDirectoryEntryFileOffset);
     DebugEntry->TimeDateStamp = 0;
-    mImageTimeStamp = 0;
+    *ImageTimeStamp = 0;
     if (ZeroDebugFlag) {
       memset (FileBuffer + DebugEntry->FileOffset, 0, DebugEntry->SizeOfData);
       memset (DebugEntry, 0, sizeof (EFI_IMAGE_DEBUG_DIRECTORY_ENTRY));
@@ -2893,7 +3850,8 @@ STATIC
 EFI_STATUS
 SetStamp (
   IN OUT UINT8  *FileBuffer,
-  IN     CHAR8  *TimeStamp
+  IN     CHAR8  *TimeStamp,
+  OUT    UINT32 *ImageTimeStamp
   )
 /*++
 
@@ -2906,6 +3864,7 @@ Arguments:
 
   FileBuffer    - Pointer to PeImage.
   TimeStamp     - Time stamp string.
+  ImageTimeStamp - Receives the time stamp set in the image.
 
 Returns:
 
@@ -3022,8 +3981,11 @@ Returns:
     }
 
     //
-    // convert the date and time to time_t format
+    // convert the date and time to time_t format. tm_isdst is not read by
+    // sscanf, let mktime find whether daylight saving time applies rather
+    // than use whatever the stack held.
     //
+    stime.tm_isdst = -1;
     newtime = mktime (&stime);
     if (newtime == (time_t) - 1) {
       Error (NULL, 0, 3000, "Invalid", "%s Invalid or unsupported datetime!", TimeStamp);
@@ -3031,7 +3993,14 @@ Returns:
     }
   }
 
+  //
+  // localtime of the Microsoft C library already uses a buffer per thread.
+  //
+#ifdef __GNUC__
+  ptime = localtime_r (&newtime, &stime);
+#else
   ptime = localtime (&newtime);
+#endif
   DebugMsg (NULL, 0, 9, "New Image Time Stamp", "%04d-%02d-%02d %02d:%02d:%02d",
             ptime->tm_year + 1900, ptime->tm_mon + 1, ptime->tm_mday, ptime->tm_hour, ptime->tm_min, ptime->tm_sec);
   //
@@ -3106,7 +4075,7 @@ Returns:
   // Set new stamp
   //
   FileHdr->TimeDateStamp = (UINT32) newtime;
-  mImageTimeStamp = (UINT32) newtime;
+  *ImageTimeStamp = (UINT32) newtime;
   if (ExportDirectoryEntryRva != 0) {
     NewTimeStamp  = (UINT32 *) (FileBuffer + ExportDirectoryEntryFileOffset + sizeof (UINT32));
     *NewTimeStamp = (UINT32) newtime;
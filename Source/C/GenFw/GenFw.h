@@ -48,8 +48,12 @@ IsElfHeader (
 
 BOOLEAN
 ConvertElf (
+  UINT8  *ElfBuffer,
+  CHAR8  *InImageName,
+  UINT32 OutImageType,
   UINT8  **FileBuffer,
-  UINT32 *FileLength
+  UINT32 *FileLength,
+  UINT32 *ImageTimeStamp
   );
 
 #endif
@@ -18,6 +18,7 @@
 
 #define _CRT_SECURE_NO_WARNINGS
 
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -35,6 +36,10 @@
 typedef enum {
   NoConverter, 
   X86Converter,
+  ArmConverter,
+  ArmThumbConverter,
+  Ia64Converter,
+  Arm64Converter,
   MaxConverter
 } CONVERTER_TYPE;
 
@@ -42,6 +47,7 @@ const char *kCantReadMessage = "Can not read input file";
 const char *kCantWriteMessage = "Can not write output file";
 const char *kCantAllocateMessage = "Can not allocate memory";
 const char *kDataErrorMessage = "Data error";
+const char *kParamErrorMessage = "Invalid encoder properties";
 
 static void *SzAlloc(void *p, size_t size) { p = p; return MyAlloc(size); }
 static void SzFree(void *p, void *address) { p = p; MyFree(address); }
@@ -49,6 +55,9 @@ static ISzAlloc g_Alloc = { SzAlloc, SzFree };
 
 static Bool mQuietMode = False;
 static CONVERTER_TYPE mConType = NoConverter;
+static CLzmaEncProps mEncProps;
+static Bool mAutoDictSize = False;
+static Bool mStreamMode = False;
 
 #define UTILITY_NAME "LzmaCompress"
 #define UTILITY_MAJOR_VERSION 0
@@ -65,6 +74,25 @@ void PrintHelp(char *buffer)
              "  -d: decode file\n"
              "  -o FileName, --output FileName: specify the output filename\n"
              "  --f86: enable converter for x86 code\n"
+             "  --farm: enable converter for ARM code\n"
+             "  --farmt: enable converter for ARM Thumb code\n"
+             "  --fia64: enable converter for IA64 code\n"
+             "  --farm64: enable converter for AArch64 code\n"
+             "  --threads N: use N threads to encode, any value above 1\n"
+             "      enables the multi-threaded match finder (default 1)\n"
+             "  --level [0-9]: compression level, selects the defaults of\n"
+             "      the options below (default 5)\n"
+             "  --dict-size N|auto: dictionary size in bytes, K and M\n"
+             "      suffixes are allowed, auto shrinks the level's dictionary\n"
+             "      to the smallest power of two covering the input\n"
+             "  --fb N: number of fast bytes [5-273]\n"
+             "  --lc N: number of literal context bits [0-8]\n"
+             "  --lp N: number of literal position bits [0-4]\n"
+             "  --pb N: number of position bits [0-4]\n"
+             "  --mc N: match finder cycles\n"
+             "  --mf hc4|bt2|bt3|bt4: match finder\n"
+             "  --stream: encode or decode through fixed size buffers, memory\n"
+             "      use is bounded by the dictionary size, not the file size\n"
              "  -v, --verbose: increase output messages\n"
              "  -q, --quiet: reduce output messages\n"
              "  --debug [0-9]: set debug level\n"
@@ -97,6 +125,74 @@ void PrintVersion(char *buffer)
   sprintf (buffer, "%s Version %d.%d %s ", UTILITY_NAME, UTILITY_MAJOR_VERSION, UTILITY_MINOR_VERSION, __BUILD_VERSION);
 }
 
+//
+// Runs the selected branch converter over a block of data. The converters
+// may leave a few bytes at the end of the block unprocessed, the return value
+// is the number of bytes converted.
+//
+static SizeT Convert(Byte *data, SizeT size, UInt32 ip, UInt32 *x86State, int encoding)
+{
+  switch (mConType) {
+  case X86Converter:
+    return x86_Convert(data, size, ip, x86State, encoding);
+  case ArmConverter:
+    return ARM_Convert(data, size, ip, encoding);
+  case ArmThumbConverter:
+    return ARMT_Convert(data, size, ip, encoding);
+  case Ia64Converter:
+    return IA64_Convert(data, size, ip, encoding);
+  case Arm64Converter:
+    return ARM64_Convert(data, size, ip, encoding);
+  default:
+    return size;
+  }
+}
+
+static Bool ParseNumber(const char *string, UInt32 minValue, UInt32 maxValue, UInt32 *value)
+{
+  char *end;
+  unsigned long number;
+  unsigned shift = 0;
+
+  if (*string < '0' || *string > '9')
+    return False;
+  errno = 0;
+  number = strtoul(string, &end, 10);
+  if (errno == ERANGE)
+    return False;
+  if (*end == 'K' || *end == 'k') {
+    shift = 10;
+    end++;
+  } else if (*end == 'M' || *end == 'm') {
+    shift = 20;
+    end++;
+  }
+  if (*end != '\0' || number > (maxValue >> shift))
+    return False;
+  number <<= shift;
+  if (number < minValue)
+    return False;
+  *value = (UInt32)number;
+  return True;
+}
+
+static void GetEncodeProps(CLzmaEncProps *props, UInt64 fileSize)
+{
+  *props = mEncProps;
+  if (mAutoDictSize)
+    props->dictSize = 0;
+  LzmaEncProps_Normalize(props);
+
+  if (mAutoDictSize) {
+    //
+    // The match finder tables scale with the dictionary, so do not use
+    // more of it than the input can ever reference.
+    //
+    while ((props->dictSize >> 1) >= fileSize && (props->dictSize >> 1) >= (1 << 12))
+      props->dictSize >>= 1;
+  }
+}
+
 static SRes Encode(ISeqOutStream *outStream, ISeqInStream *inStream, UInt64 fileSize)
 {
   SRes res;
@@ -107,8 +203,7 @@ static SRes Encode(ISeqOutStream *outStream, ISeqInStream *inStream, UInt64 file
   size_t outSize;
   CLzmaEncProps props;
 
-  LzmaEncProps_Init(&props);
-  LzmaEncProps_Normalize(&props);
+  GetEncodeProps(&props, fileSize);
 
   if (inSize != 0) {
     inBuffer = (Byte *)MyAlloc(inSize);
@@ -146,12 +241,10 @@ static SRes Encode(ISeqOutStream *outStream, ISeqInStream *inStream, UInt64 file
     }
     memcpy(filteredStream, inBuffer, inSize);
     
-    if (mConType == X86Converter) {
-      {
-        UInt32 x86State;
-        x86_Convert_Init(x86State);
-        x86_Convert(filteredStream, (SizeT) inSize, 0, &x86State, 1);
-      }
+    {
+      UInt32 x86State;
+      x86_Convert_Init(x86State);
+      Convert(filteredStream, (SizeT) inSize, 0, &x86State, 1);
     }
   }
 
@@ -228,11 +321,11 @@ static SRes Decode(ISeqOutStream *outStream, ISeqInStream *inStream, UInt64 file
   if (res != SZ_OK)
     goto Done;
 
-  if (mConType == X86Converter)
+  if (mConType != NoConverter)
   {
     UInt32 x86State;
     x86_Convert_Init(x86State);
-    x86_Convert(outBuffer, (SizeT) outSize, 0, &x86State, 0);
+    Convert(outBuffer, (SizeT) outSize, 0, &x86State, 0);
   }
 
   if (outStream->Write(outStream, outBuffer, outSize) != outSize)
@@ -245,6 +338,212 @@ Done:
   return res;
 }
 
+#define STREAM_BUF_SIZE (1 << 16)
+
+//
+// ISeqInStream that runs the branch converter over the data read from another
+// stream. The converters leave up to sixteen bytes of a buffer unprocessed when
+// they may start an instruction, so they are kept back until more data
+// arrives or the input ends.
+//
+typedef struct {
+  ISeqInStream s;
+  ISeqInStream *inStream;
+  UInt32 ip;
+  UInt32 state;
+  size_t pos;
+  size_t converted;
+  size_t size;
+  Byte buf[STREAM_BUF_SIZE];
+} CFilterInStream;
+
+static SRes FilterInStream_Read(void *pp, void *buf, size_t *size)
+{
+  CFilterInStream *p = (CFilterInStream *)pp;
+  size_t available;
+
+  while (p->pos == p->converted) {
+    size_t readSize;
+    memmove(p->buf, p->buf + p->converted, p->size - p->converted);
+    p->size -= p->converted;
+    p->pos = p->converted = 0;
+
+    readSize = STREAM_BUF_SIZE - p->size;
+    RINOK(p->inStream->Read(p->inStream, p->buf + p->size, &readSize));
+    p->size += readSize;
+    if (readSize == 0) {
+      p->converted = p->size;
+      if (p->size == 0) {
+        *size = 0;
+        return SZ_OK;
+      }
+    } else {
+      p->converted = Convert(p->buf, p->size, p->ip, &p->state, 1);
+      p->ip += (UInt32)p->converted;
+    }
+  }
+
+  available = p->converted - p->pos;
+  if (*size > available)
+    *size = available;
+  memcpy(buf, p->buf + p->pos, *size);
+  p->pos += *size;
+  return SZ_OK;
+}
+
+static SRes EncodeStream(ISeqOutStream *outStream, ISeqInStream *inStream, UInt64 fileSize)
+{
+  SRes res;
+  CLzmaEncHandle enc;
+  CLzmaEncProps props;
+  CFilterInStream *filter = 0;
+  Byte header[LZMA_HEADER_SIZE];
+  size_t headerSize = LZMA_PROPS_SIZE;
+  int i;
+
+  if (fileSize == 0)
+    return SZ_ERROR_INPUT_EOF;
+
+  enc = LzmaEnc_Create(&g_Alloc);
+  if (enc == 0)
+    return SZ_ERROR_MEM;
+
+  GetEncodeProps(&props, fileSize);
+  res = LzmaEnc_SetProps(enc, &props);
+  if (res == SZ_OK)
+    res = LzmaEnc_WriteProperties(enc, header, &headerSize);
+  if (res != SZ_OK)
+    goto Done;
+
+  for (i = 0; i < 8; i++)
+    header[i + LZMA_PROPS_SIZE] = (Byte)(fileSize >> (8 * i));
+  if (outStream->Write(outStream, header, LZMA_HEADER_SIZE) != LZMA_HEADER_SIZE) {
+    res = SZ_ERROR_WRITE;
+    goto Done;
+  }
+
+  if (mConType != NoConverter) {
+    filter = (CFilterInStream *)MyAlloc(sizeof(CFilterInStream));
+    if (filter == 0) {
+      res = SZ_ERROR_MEM;
+      goto Done;
+    }
+    filter->s.Read = FilterInStream_Read;
+    filter->inStream = inStream;
+    filter->ip = 0;
+    x86_Convert_Init(filter->state);
+    filter->pos = filter->converted = filter->size = 0;
+    inStream = &filter->s;
+  }
+
+  res = LzmaEnc_Encode(enc, outStream, inStream, NULL, &g_Alloc, &g_Alloc);
+
+Done:
+  MyFree(filter);
+  LzmaEnc_Destroy(enc, &g_Alloc, &g_Alloc);
+  return res;
+}
+
+static SRes DecodeStream(ISeqOutStream *outStream, ISeqInStream *inStream, UInt64 fileSize)
+{
+  SRes res;
+  CLzmaDec state;
+  Byte header[LZMA_HEADER_SIZE];
+  Byte *inBuf;
+  Byte *outBuf;
+  size_t inPos = 0;
+  size_t inSize = 0;
+  size_t outPos = 0;
+  UInt64 unpackSize = 0;
+  UInt32 ip = 0;
+  UInt32 x86State;
+  int i;
+
+  if (fileSize < LZMA_HEADER_SIZE)
+    return SZ_ERROR_INPUT_EOF;
+  if (SeqInStream_Read(inStream, header, LZMA_HEADER_SIZE) != SZ_OK)
+    return SZ_ERROR_READ;
+  for (i = 0; i < 8; i++)
+    unpackSize += ((UInt64)header[LZMA_PROPS_SIZE + i]) << (i * 8);
+  if (unpackSize == 0)
+    return SZ_OK;
+
+  inBuf = (Byte *)MyAlloc(STREAM_BUF_SIZE * 2);
+  if (inBuf == 0)
+    return SZ_ERROR_MEM;
+  outBuf = inBuf + STREAM_BUF_SIZE;
+
+  LzmaDec_Construct(&state);
+  res = LzmaDec_Allocate(&state, header, LZMA_PROPS_SIZE, &g_Alloc);
+  if (res != SZ_OK)
+    goto Done;
+  LzmaDec_Init(&state);
+  x86_Convert_Init(x86State);
+
+  for (;;) {
+    SizeT inProcessed;
+    SizeT outProcessed;
+    SizeT converted;
+    ELzmaFinishMode finishMode = LZMA_FINISH_ANY;
+    ELzmaStatus status;
+
+    if (inPos == inSize) {
+      inSize = STREAM_BUF_SIZE;
+      res = inStream->Read(inStream, inBuf, &inSize);
+      if (res != SZ_OK) {
+        res = SZ_ERROR_READ;
+        break;
+      }
+      inPos = 0;
+    }
+
+    inProcessed = inSize - inPos;
+    outProcessed = STREAM_BUF_SIZE - outPos;
+    if (outProcessed > unpackSize) {
+      outProcessed = (SizeT)unpackSize;
+      finishMode = LZMA_FINISH_END;
+    }
+    res = LzmaDec_DecodeToBuf(&state, outBuf + outPos, &outProcessed,
+        inBuf + inPos, &inProcessed, finishMode, &status);
+    inPos += inProcessed;
+    outPos += outProcessed;
+    unpackSize -= outProcessed;
+    if (res != SZ_OK)
+      break;
+
+    //
+    // Bytes the converter could not process yet stay at the start of
+    // the buffer, they are converted together with the next block. At the
+    // end of the data they are written as they are.
+    //
+    converted = outPos;
+    if (mConType != NoConverter) {
+      converted = Convert(outBuf, outPos, ip, &x86State, 0);
+      ip += (UInt32)converted;
+      if (unpackSize == 0)
+        converted = outPos;
+    }
+    if (outStream->Write(outStream, outBuf, converted) != converted) {
+      res = SZ_ERROR_WRITE;
+      break;
+    }
+    memmove(outBuf, outBuf + converted, outPos - converted);
+    outPos -= converted;
+
+    if (unpackSize == 0)
+      break;
+    if (inProcessed == 0 && outProcessed == 0) {
+      res = SZ_ERROR_DATA;
+      break;
+    }
+  }
+
+Done:
+  LzmaDec_Free(&state, &g_Alloc);
+  MyFree(inBuf);
+  return res;
+}
+
 int main2(int numArgs, const char *args[], char *rs)
 {
   CFileSeqInStream inStream;
@@ -255,8 +554,12 @@ int main2(int numArgs, const char *args[], char *rs)
   const char *inputFile = NULL;
   const char *outputFile = "file.tmp";
   int param;
+  UInt32 value;
   UInt64 fileSize;
 
+  LzmaEncProps_Init(&mEncProps);
+  mEncProps.numThreads = 1;
+
   FileSeqInStream_CreateVTable(&inStream);
   File_Construct(&inStream.file);
 
@@ -275,12 +578,106 @@ int main2(int numArgs, const char *args[], char *rs)
       modeWasSet = True;
     } else if (strcmp(args[param], "--f86") == 0) {
       mConType = X86Converter;
+    } else if (strcmp(args[param], "--farm") == 0) {
+      mConType = ArmConverter;
+    } else if (strcmp(args[param], "--farmt") == 0) {
+      mConType = ArmThumbConverter;
+    } else if (strcmp(args[param], "--fia64") == 0) {
+      mConType = Ia64Converter;
+    } else if (strcmp(args[param], "--farm64") == 0) {
+      mConType = Arm64Converter;
     } else if (strcmp(args[param], "-o") == 0 ||
                strcmp(args[param], "--output") == 0) {
       if (numArgs < (param + 2)) {
         return PrintUserError(rs);
       }
       outputFile = args[++param];
+    } else if (strcmp(args[param], "--stream") == 0) {
+      mStreamMode = True;
+    } else if (strcmp(args[param], "--threads") == 0) {
+      if (numArgs < (param + 2)) {
+        return PrintUserError(rs);
+      }
+      if (!ParseNumber(args[++param], 1, 64, &value)) {
+        return PrintError(rs, "Invalid thread count");
+      }
+      mEncProps.numThreads = (int)value;
+    } else if (strcmp(args[param], "--level") == 0) {
+      if (numArgs < (param + 2)) {
+        return PrintUserError(rs);
+      }
+      if (!ParseNumber(args[++param], 0, 9, &value)) {
+        return PrintError(rs, "Invalid level");
+      }
+      mEncProps.level = (int)value;
+    } else if (strcmp(args[param], "--dict-size") == 0) {
+      if (numArgs < (param + 2)) {
+        return PrintUserError(rs);
+      }
+      param++;
+      if (strcmp(args[param], "auto") == 0) {
+        mAutoDictSize = True;
+      } else if (ParseNumber(args[param], 1 << 12, 1 << 30, &value)) {
+        mAutoDictSize = False;
+        mEncProps.dictSize = value;
+      } else {
+        return PrintError(rs, "Invalid dictionary size");
+      }
+    } else if (strcmp(args[param], "--fb") == 0) {
+      if (numArgs < (param + 2)) {
+        return PrintUserError(rs);
+      }
+      if (!ParseNumber(args[++param], 5, 273, &value)) {
+        return PrintError(rs, "Invalid --fb value");
+      }
+      mEncProps.fb = (int)value;
+    } else if (strcmp(args[param], "--lc") == 0) {
+      if (numArgs < (param + 2)) {
+        return PrintUserError(rs);
+      }
+      if (!ParseNumber(args[++param], 0, 8, &value)) {
+        return PrintError(rs, "Invalid --lc value");
+      }
+      mEncProps.lc = (int)value;
+    } else if (strcmp(args[param], "--lp") == 0) {
+      if (numArgs < (param + 2)) {
+        return PrintUserError(rs);
+      }
+      if (!ParseNumber(args[++param], 0, 4, &value)) {
+        return PrintError(rs, "Invalid --lp value");
+      }
+      mEncProps.lp = (int)value;
+    } else if (strcmp(args[param], "--pb") == 0) {
+      if (numArgs < (param + 2)) {
+        return PrintUserError(rs);
+      }
+      if (!ParseNumber(args[++param], 0, 4, &value)) {
+        return PrintError(rs, "Invalid --pb value");
+      }
+      mEncProps.pb = (int)value;
+    } else if (strcmp(args[param], "--mc") == 0) {
+      if (numArgs < (param + 2)) {
+        return PrintUserError(rs);
+      }
+      if (!ParseNumber(args[++param], 1, 1 << 30, &value)) {
+        return PrintError(rs, "Invalid --mc value");
+      }
+      mEncProps.mc = value;
+    } else if (strcmp(args[param], "--mf") == 0) {
+      const char *mf;
+      if (numArgs < (param + 2)) {
+        return PrintUserError(rs);
+      }
+      mf = args[++param];
+      if (strcmp(mf, "hc4") == 0) {
+        mEncProps.btMode = 0;
+        mEncProps.numHashBytes = 4;
+      } else if (strcmp(mf, "bt2") == 0 || strcmp(mf, "bt3") == 0 || strcmp(mf, "bt4") == 0) {
+        mEncProps.btMode = 1;
+        mEncProps.numHashBytes = mf[2] - '0';
+      } else {
+        return PrintError(rs, "Invalid match finder");
+      }
     } else if (strcmp(args[param], "--debug") == 0) {
       if (numArgs < (param + 2)) {
         return PrintUserError(rs);
@@ -343,14 +740,22 @@ int main2(int numArgs, const char *args[], char *rs)
     if (!mQuietMode) {
       printf("Encoding\n");
     }
-    res = Encode(&outStream.s, &inStream.s, fileSize);
+    if (mStreamMode) {
+      res = EncodeStream(&outStream.s, &inStream.s, fileSize);
+    } else {
+      res = Encode(&outStream.s, &inStream.s, fileSize);
+    }
   }
   else
   {
     if (!mQuietMode) {
       printf("Decoding\n");
     }
-    res = Decode(&outStream.s, &inStream.s, fileSize);
+    if (mStreamMode) {
+      res = DecodeStream(&outStream.s, &inStream.s, fileSize);
+    } else {
+      res = Decode(&outStream.s, &inStream.s, fileSize);
+    }
   }
 
   File_Close(&outStream.file);
@@ -362,6 +767,8 @@ int main2(int numArgs, const char *args[], char *rs)
       return PrintError(rs, kCantAllocateMessage);
     else if (res == SZ_ERROR_DATA)
       return PrintError(rs, kDataErrorMessage);
+    else if (res == SZ_ERROR_PARAM)
+      return PrintError(rs, kParamErrorMessage);
     else if (res == SZ_ERROR_WRITE)
       return PrintError(rs, kCantWriteMessage);
     else if (res == SZ_ERROR_READ)
@@ -32,6 +32,7 @@ in CALL instructions to increase the compression ratio.
   PPC     big        4          0
   SPARC   big        4          0
   IA64   little     16          0
+  ARM64  little      4          0
 
   size must be >= Alignment + LookAhead, if it's not last block.
   If (size < Alignment + LookAhead), converter returns 0.
@@ -56,5 +57,6 @@ SizeT ARMT_Convert(Byte *data, SizeT size, UInt32 ip, int encoding);
 SizeT PPC_Convert(Byte *data, SizeT size, UInt32 ip, int encoding);
 SizeT SPARC_Convert(Byte *data, SizeT size, UInt32 ip, int encoding);
 SizeT IA64_Convert(Byte *data, SizeT size, UInt32 ip, int encoding);
+SizeT ARM64_Convert(Byte *data, SizeT size, UInt32 ip, int encoding);
 
 #endif
@@ -0,0 +1,60 @@
+/* BraArm64.c -- Converter for AArch64 code
+Public domain */
+
+#include "Bra.h"
+
+/*
+AArch64 has fixed 4-byte little-endian instructions. Two of them carry the
+PC relative displacements that dominate code in PE32+ images:
+
+  BL   100101 imm26            ; target = PC + imm26 * 4
+  ADRP 1 immlo 10000 immhi Rd  ; target = (PC & ~0xFFF) + (immhi:immlo) * 4096
+
+Both immediates are replaced by their absolute values (modulo the field
+width), so repeated calls and page references to the same target become
+identical byte sequences. Other instructions are left unchanged.
+*/
+
+SizeT ARM64_Convert(Byte *data, SizeT size, UInt32 ip, int encoding)
+{
+  SizeT i;
+  if (size < 4)
+    return 0;
+  size -= 4;
+  for (i = 0; i <= size; i += 4)
+  {
+    UInt32 pc = ip + (UInt32)i;
+    UInt32 instr =
+      ((UInt32)data[i + 3] << 24) |
+      ((UInt32)data[i + 2] << 16) |
+      ((UInt32)data[i + 1] << 8) |
+      ((UInt32)data[i + 0]);
+    
+    if ((instr & 0xFC000000) == 0x94000000)
+    {
+      UInt32 dest;
+      if (encoding)
+        dest = instr + (pc >> 2);
+      else
+        dest = instr - (pc >> 2);
+      instr = 0x94000000 | (dest & 0x03FFFFFF);
+    }
+    else if ((instr & 0x9F000000) == 0x90000000)
+    {
+      UInt32 dest = ((instr >> 29) & 0x3) | ((instr >> 3) & 0x1FFFFC);
+      if (encoding)
+        dest += pc >> 12;
+      else
+        dest -= pc >> 12;
+      instr = (instr & 0x9F00001F) | ((dest & 0x3) << 29) | ((dest << 3) & 0x00FFFFE0);
+    }
+    else
+      continue;
+    
+    data[i + 3] = (Byte)(instr >> 24);
+    data[i + 2] = (Byte)(instr >> 16);
+    data[i + 1] = (Byte)(instr >> 8);
+    data[i + 0] = (Byte)instr;
+  }
+  return i;
+}
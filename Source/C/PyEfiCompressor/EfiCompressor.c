@@ -13,6 +13,7 @@ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
 
 #include <Python.h>
 #include <Decompress.h>
+#include <Compress.h>
 
 /*
  UefiDecompress(data_buffer, size, original_size)
@@ -171,6 +172,104 @@ ERROR:
 }
 
 
+/*
+ Compress data_buffer with Compressor. The encoders keep their state in a
+ per-call context, so the interpreter lock is released while compressing
+ and several threads may compress at the same time.
+*/
+STATIC
+PyObject*
+CompressBuffer(
+  PyObject            *Args,
+  COMPRESS_FUNCTION   Compressor
+  )
+{
+  PyObject      *SrcData;
+  PyObject      *Result;
+  UINT32        SrcDataSize;
+  UINT32        DstDataSize;
+  UINTN         Status;
+  UINT8         *SrcBuf;
+  UINT8         *DstBuf;
+  UINT8         *TmpBuf;
+  Py_ssize_t    SegNum;
+  Py_ssize_t    Index;
+
+  Status = PyArg_ParseTuple(
+            Args,
+            "Oi",
+            &SrcData,
+            &SrcDataSize
+            );
+  if (Status == 0) {
+    return NULL;
+  }
+
+  if (SrcData->ob_type->tp_as_buffer == NULL
+      || SrcData->ob_type->tp_as_buffer->bf_getreadbuffer == NULL
+      || SrcData->ob_type->tp_as_buffer->bf_getsegcount == NULL) {
+    PyErr_SetString(PyExc_Exception, "First argument is not a buffer\n");
+    return NULL;
+  }
+
+  Result = NULL;
+  DstBuf = NULL;
+  SrcBuf = PyMem_Malloc(SrcDataSize);
+  if (SrcBuf == NULL) {
+    PyErr_SetString(PyExc_Exception, "Not enough memory\n");
+    goto DONE;
+  }
+
+  SegNum = SrcData->ob_type->tp_as_buffer->bf_getsegcount((PyObject *)SrcData, NULL);
+  TmpBuf = SrcBuf;
+  for (Index = 0; Index < SegNum; ++Index) {
+    VOID *BufSeg;
+    Py_ssize_t Len;
+
+    Len = SrcData->ob_type->tp_as_buffer->bf_getreadbuffer((PyObject *)SrcData, Index, &BufSeg);
+    if (Len < 0 || TmpBuf + Len > SrcBuf + SrcDataSize) {
+      PyErr_SetString(PyExc_Exception, "Buffer segment is not available\n");
+      goto DONE;
+    }
+    memcpy(TmpBuf, BufSeg, Len);
+    TmpBuf += Len;
+  }
+
+  //
+  // Incompressible data grows by a few bytes per block, so try with a little
+  // headroom first and retry with the exact size if that is not enough.
+  //
+  DstDataSize = SrcDataSize + SrcDataSize / 8 + 64;
+  do {
+    PyMem_Free(DstBuf);
+    DstBuf = PyMem_Malloc(DstDataSize);
+    if (DstBuf == NULL) {
+      PyErr_SetString(PyExc_Exception, "Not enough memory\n");
+      goto DONE;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    Status = Compressor(SrcBuf, SrcDataSize, DstBuf, &DstDataSize);
+    Py_END_ALLOW_THREADS
+  } while (Status == EFI_BUFFER_TOO_SMALL);
+
+  if (Status != EFI_SUCCESS) {
+    PyErr_SetString(PyExc_Exception, "Failed to compress\n");
+    goto DONE;
+  }
+
+  Result = PyString_FromStringAndSize((CONST INT8*)DstBuf, (Py_ssize_t)DstDataSize);
+
+DONE:
+  PyMem_Free(SrcBuf);
+  PyMem_Free(DstBuf);
+  return Result;
+}
+
+
+/*
+ UefiCompress(data_buffer, size)
+*/
 STATIC
 PyObject*
 UefiCompress(
@@ -178,7 +277,7 @@ UefiCompress(
   PyObject    *Args
   )
 {
-  return NULL;
+  return CompressBuffer(Args, EfiCompress);
 }
 
 
@@ -189,7 +288,7 @@ FrameworkCompress(
   PyObject    *Args
   )
 {
-  return NULL;
+  return CompressBuffer(Args, TianoCompress);
 }
 
 STATIC INT8 DecompressDocs[] = "Decompress(): Decompress data using UEFI standard algorithm\n";
@@ -197,9 +296,9 @@ STATIC INT8 CompressDocs[] = "Compress(): Compress data using UEFI standard algo
 
 STATIC PyMethodDef EfiCompressor_Funcs[] = {
   {"UefiDecompress", (PyCFunction)UefiDecompress, METH_VARARGS, DecompressDocs},
-  {"UefiCompress", (PyCFunction)UefiCompress, METH_VARARGS, DecompressDocs},
+  {"UefiCompress", (PyCFunction)UefiCompress, METH_VARARGS, CompressDocs},
   {"FrameworkDecompress", (PyCFunction)FrameworkDecompress, METH_VARARGS, DecompressDocs},
-  {"FrameworkCompress", (PyCFunction)FrameworkCompress, METH_VARARGS, DecompressDocs},
+  {"FrameworkCompress", (PyCFunction)FrameworkCompress, METH_VARARGS, CompressDocs},
   {NULL, NULL, 0, NULL}
 };
 
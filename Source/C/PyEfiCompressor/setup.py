@@ -30,6 +30,8 @@ setup(
             'EfiCompressor',
             sources=[
                 os.path.join(BaseToolsDir, 'Source', 'C', 'Common', 'Decompress.c'),
+                os.path.join(BaseToolsDir, 'Source', 'C', 'Common', 'EfiCompress.c'),
+                os.path.join(BaseToolsDir, 'Source', 'C', 'Common', 'TianoCompress.c'),
                 'EfiCompressor.c'
                 ],
             include_dirs=[
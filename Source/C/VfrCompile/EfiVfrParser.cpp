@@ -0,0 +1,2220 @@
+/*
+ * EfiVfrParser: P a r s e r  S u p p o r t
+ *
+ * Generated from: VfrSyntax.g
+ *
+ * Terence Parr, Russell Quong, Will Cohen, and Hank Dietz: 1989-2001
+ * Parr Research Corporation
+ * with Purdue University Electrical Engineering
+ * with AHPCRC, University of Minnesota
+ * ANTLR Version 1.33MR33
+ */
+
+#define ANTLR_VERSION	13333
+#include "pcctscfg.h"
+#include "pccts_stdio.h"
+#define ANTLR_SUPPORT_CODE
+#include "VfrTokens.h"
+#include "EfiVfrParser.h"
+
+const ANTLRChar *EfiVfrParser::tokenName(int tok)   { return _token_tbl[tok]; }
+
+const ANTLRChar *EfiVfrParser::_token_tbl[]={
+	/* 00 */	"Invalid",
+	/* 01 */	"@",
+	/* 02 */	"TheString",
+	/* 03 */	"~[\\n]*",
+	/* 04 */	"\\n",
+	/* 05 */	"//",
+	/* 06 */	"[\\ \\t]",
+	/* 07 */	"\\n",
+	/* 08 */	"extern",
+	/* 09 */	"formpkgtype",
+	/* 10 */	"{",
+	/* 11 */	"}",
+	/* 12 */	"(",
+	/* 13 */	")",
+	/* 14 */	"[",
+	/* 15 */	"]",
+	/* 16 */	"LineDefinition",
+	/* 17 */	"devicepath",
+	/* 18 */	"formset",
+	/* 19 */	"formsetid",
+	/* 20 */	"endformset",
+	/* 21 */	"title",
+	/* 22 */	"formid",
+	/* 23 */	"oneof",
+	/* 24 */	"endoneof",
+	/* 25 */	"prompt",
+	/* 26 */	"orderedlist",
+	/* 27 */	"maxcontainers",
+	/* 28 */	"endlist",
+	/* 29 */	"endform",
+	/* 30 */	"form",
+	/* 31 */	"formmap",
+	/* 32 */	"maptitle",
+	/* 33 */	"mapguid",
+	/* 34 */	"subtitle",
+	/* 35 */	"help",
+	/* 36 */	"text",
+	/* 37 */	"option",
+	/* 38 */	"flags",
+	/* 39 */	"date",
+	/* 40 */	"enddate",
+	/* 41 */	"year",
+	/* 42 */	"month",
+	/* 43 */	"day",
+	/* 44 */	"time",
+	/* 45 */	"endtime",
+	/* 46 */	"hour",
+	/* 47 */	"minute",
+	/* 48 */	"second",
+	/* 49 */	"grayoutif",
+	/* 50 */	"label",
+	/* 51 */	"timeout",
+	/* 52 */	"inventory",
+	/* 53 */	"_NON_NV_DATA_MAP",
+	/* 54 */	"struct",
+	/* 55 */	"BOOLEAN",
+	/* 56 */	"UINT64",
+	/* 57 */	"UINT32",
+	/* 58 */	"UINT16",
+	/* 59 */	"CHAR16",
+	/* 60 */	"UINT8",
+	/* 61 */	"guid",
+	/* 62 */	"checkbox",
+	/* 63 */	"endcheckbox",
+	/* 64 */	"numeric",
+	/* 65 */	"endnumeric",
+	/* 66 */	"minimum",
+	/* 67 */	"maximum",
+	/* 68 */	"step",
+	/* 69 */	"default",
+	/* 70 */	"password",
+	/* 71 */	"endpassword",
+	/* 72 */	"string",
+	/* 73 */	"endstring",
+	/* 74 */	"minsize",
+	/* 75 */	"maxsize",
+	/* 76 */	"encoding",
+	/* 77 */	"suppressif",
+	/* 78 */	"disableif",
+	/* 79 */	"hidden",
+	/* 80 */	"goto",
+	/* 81 */	"formsetguid",
+	/* 82 */	"inconsistentif",
+	/* 83 */	"nosubmitif",
+	/* 84 */	"endif",
+	/* 85 */	"key",
+	/* 86 */	"DEFAULT",
+	/* 87 */	"MANUFACTURING",
+	/* 88 */	"INTERACTIVE",
+	/* 89 */	"NV_ACCESS",
+	/* 90 */	"RESET_REQUIRED",
+	/* 91 */	"LATE_CHECK",
+	/* 92 */	"READ_ONLY",
+	/* 93 */	"OPTIONS_ONLY",
+	/* 94 */	"class",
+	/* 95 */	"subclass",
+	/* 96 */	"classguid",
+	/* 97 */	"typedef",
+	/* 98 */	"restore",
+	/* 99 */	"save",
+	/* 100 */	"defaults",
+	/* 101 */	"banner",
+	/* 102 */	"align",
+	/* 103 */	"left",
+	/* 104 */	"right",
+	/* 105 */	"center",
+	/* 106 */	"line",
+	/* 107 */	"name",
+	/* 108 */	"varid",
+	/* 109 */	"question",
+	/* 110 */	"questionid",
+	/* 111 */	"image",
+	/* 112 */	"locked",
+	/* 113 */	"rule",
+	/* 114 */	"endrule",
+	/* 115 */	"value",
+	/* 116 */	"read",
+	/* 117 */	"write",
+	/* 118 */	"resetbutton",
+	/* 119 */	"endresetbutton",
+	/* 120 */	"defaultstore",
+	/* 121 */	"attribute",
+	/* 122 */	"varstore",
+	/* 123 */	"efivarstore",
+	/* 124 */	"varsize",
+	/* 125 */	"namevaluevarstore",
+	/* 126 */	"action",
+	/* 127 */	"config",
+	/* 128 */	"endaction",
+	/* 129 */	"refresh",
+	/* 130 */	"interval",
+	/* 131 */	"varstoredevice",
+	/* 132 */	"guidop",
+	/* 133 */	"endguidop",
+	/* 134 */	"datatype",
+	/* 135 */	"data",
+	/* 136 */	"modal",
+	/* 137 */	"NONDEVICE",
+	/* 138 */	"DISK_DEVICE",
+	/* 139 */	"VIDEO_DEVICE",
+	/* 140 */	"NETWORK_DEVICE",
+	/* 141 */	"INPUT_DEVICE",
+	/* 142 */	"ONBOARD_DEVICE",
+	/* 143 */	"OTHER_DEVICE",
+	/* 144 */	"SETUP_APPLICATION",
+	/* 145 */	"GENERAL_APPLICATION",
+	/* 146 */	"FRONT_PAGE",
+	/* 147 */	"SINGLE_USE",
+	/* 148 */	"show",
+	/* 149 */	"push",
+	/* 150 */	"pop",
+	/* 151 */	",",
+	/* 152 */	"string identifier",
+	/* 153 */	"numeric value",
+	/* 154 */	"\\#pragma",
+	/* 155 */	"pack",
+	/* 156 */	";",
+	/* 157 */	"EFI_STRING_ID",
+	/* 158 */	"EFI_HII_DATE",
+	/* 159 */	"EFI_HII_TIME",
+	/* 160 */	"EFI_HII_REF",
+	/* 161 */	"=",
+	/* 162 */	"STRING_TOKEN",
+	/* 163 */	"\\|",
+	/* 164 */	".",
+	/* 165 */	"TRUE",
+	/* 166 */	"FALSE",
+	/* 167 */	"ONE",
+	/* 168 */	"ONES",
+	/* 169 */	"ZERO",
+	/* 170 */	":",
+	/* 171 */	"/",
+	/* 172 */	"HORIZONTAL",
+	/* 173 */	"CHECKBOX_DEFAULT",
+	/* 174 */	"CHECKBOX_DEFAULT_MFG",
+	/* 175 */	"YEAR_SUPPRESS",
+	/* 176 */	"MONTH_SUPPRESS",
+	/* 177 */	"DAY_SUPPRESS",
+	/* 178 */	"STORAGE_NORMAL",
+	/* 179 */	"STORAGE_TIME",
+	/* 180 */	"STORAGE_WAKEUP",
+	/* 181 */	"NUMERIC_SIZE_1",
+	/* 182 */	"NUMERIC_SIZE_2",
+	/* 183 */	"NUMERIC_SIZE_4",
+	/* 184 */	"NUMERIC_SIZE_8",
+	/* 185 */	"DISPLAY_INT_DEC",
+	/* 186 */	"DISPLAY_UINT_DEC",
+	/* 187 */	"DISPLAY_UINT_HEX",
+	/* 188 */	"MULTI_LINE",
+	/* 189 */	"UNIQUE",
+	/* 190 */	"NOEMPTY",
+	/* 191 */	"HOUR_SUPPRESS",
+	/* 192 */	"MINUTE_SUPPRESS",
+	/* 193 */	"SECOND_SUPPRESS",
+	/* 194 */	"IMAGE_TOKEN",
+	/* 195 */	"refreshguid",
+	/* 196 */	"OPTION_DEFAULT",
+	/* 197 */	"OPTION_DEFAULT_MFG",
+	/* 198 */	"dup",
+	/* 199 */	"vareqval",
+	/* 200 */	"var",
+	/* 201 */	"ideqval",
+	/* 202 */	"ideqid",
+	/* 203 */	"ideqvallist",
+	/* 204 */	"questionref",
+	/* 205 */	"ruleref",
+	/* 206 */	"stringref",
+	/* 207 */	"pushthis",
+	/* 208 */	"security",
+	/* 209 */	"get",
+	/* 210 */	"UNDEFINED",
+	/* 211 */	"VERSION",
+	/* 212 */	"length",
+	/* 213 */	"AND",
+	/* 214 */	"OR",
+	/* 215 */	"NOT",
+	/* 216 */	"set",
+	/* 217 */	"~",
+	/* 218 */	"boolval",
+	/* 219 */	"stringval",
+	/* 220 */	"unintval",
+	/* 221 */	"toupper",
+	/* 222 */	"tolower",
+	/* 223 */	"match",
+	/* 224 */	"catenate",
+	/* 225 */	"questionrefval",
+	/* 226 */	"stringrefval",
+	/* 227 */	"map",
+	/* 228 */	"&",
+	/* 229 */	"==",
+	/* 230 */	"!=",
+	/* 231 */	"<",
+	/* 232 */	"<=",
+	/* 233 */	">",
+	/* 234 */	">=",
+	/* 235 */	"\\<<",
+	/* 236 */	"\\>>",
+	/* 237 */	"\\+",
+	/* 238 */	"\\-",
+	/* 239 */	"\\*",
+	/* 240 */	"%",
+	/* 241 */	"Format",
+	/* 242 */	"FLAG",
+	/* 243 */	"cond",
+	/* 244 */	"find",
+	/* 245 */	"mid",
+	/* 246 */	"token",
+	/* 247 */	"span",
+	/* 248 */	"?",
+	/* 249 */	"SENSITIVE",
+	/* 250 */	"INSENSITIVE",
+	/* 251 */	"LAST_NON_MATCH",
+	/* 252 */	"FIRST_NON_MATCH"
+};
+
+EfiVfrParser::EfiVfrParser(ANTLRTokenBuffer *input) : ANTLRParser(input,4,0,0,32)
+{
+	token_tbl = _token_tbl;
+	traceOptionValueDefault=0;		// MR10 turn trace OFF
+}
+
+SetWordType EfiVfrParser::err1[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x60,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err2[32] = {0x0,0x20,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err3[32] = {0x0,0x0,0x4,0x0, 0x0,0x0,0x40,0x0, 0x0,0x0,0x0,0x0,
+	0x2,0x0,0x0,0x0, 0x0,0x0,0x0,0x7, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err4[32] = {0x0,0x20,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd1[253] = {0x0,0x4,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xd8,0x0,
+	0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x10,0x0,0x20,0x21,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err5[32] = {0x0,0x20,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x70,0x2, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err6[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x40,0x0, 0x0,0x0,0x0,0x0,
+	0x2,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err7[32] = {0x0,0x4,0x0,0x0, 0x0,0x0,0x20,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x1, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err8[32] = {0x0,0x4,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x1, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err9[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x11, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err10[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err11[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd2[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x4,0xc0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0xa,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa,
+	0x90,0x90,0x90,0xb0,0xb0,0x90,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0xa,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1,
+	0x0,0x94,0x0,0xa,0x0,0x0,0x90,0x90,
+	0x90,0x90,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err12[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0xc, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err13[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err14[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err15[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err16[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err17[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err18[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err19[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err20[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd3[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xff,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xff,0xff,0xff,0xff,0xff,0xff,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0xff,0x0,0x0,0x0,0x0,0xff,0xff,
+	0xff,0xff,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err21[32] = {0x0,0x4,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err22[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x0, 0x8,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err23[32] = {0x0,0x4,0x10,0xc0, 0x0,0x0,0x0,0x0, 0x0,0x60,0x0,0xc0,
+	0x0,0x80,0x0,0x2d, 0x10,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err24[32] = {0x0,0x10,0x40,0x0, 0x40,0x0,0x0,0x3f, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0xd3, 0xe3,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err25[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x0, 0x8,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err26[32] = {0x0,0x0,0x10,0xc0, 0x0,0x0,0x0,0x0, 0x0,0x60,0x0,0xc0,
+	0x1,0x80,0x0,0x2d, 0x10,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err27[32] = {0x0,0x0,0x10,0xc0, 0x0,0x0,0x0,0x0, 0x0,0x60,0x0,0xc0,
+	0x0,0x80,0x0,0x2d, 0x10,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd4[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x10,0x3,0x20,0x4,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xd0,0x0,0x20,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd0,
+	0xd0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x1,0x21,0x21,0x21,0x21,0x21,0x20,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xd0,0xd0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,
+	0xd0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xd0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0xd0,0x0,0xd0,0xd0,0x0,0xd0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xd0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xc,0x21,0x20,0x0,0x0,0x24,0x1,0x21,
+	0x21,0x21,0x20,0x0,0xc,0x0,0x20,0x20,
+	0x20,0x20,0x20,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,
+	0x20,0x0,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x0,0x0,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x20,0x20,0x20,0x20,
+	0x20,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err28[32] = {0x0,0x0,0x10,0xc0, 0x0,0x0,0x0,0x0, 0x0,0x60,0x0,0x80,
+	0x0,0x80,0x0,0x2d, 0x10,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err29[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err30[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err31[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err32[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd5[253] = {0x0,0x2,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,
+	0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x5,
+	0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x5,0x0,0x5,0x5,0x0,0x5,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xf0,0x0,0x0,0x0,0x0,0xf0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err33[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err34[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err35[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err36[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err37[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err38[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err39[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x17, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0xe1, 0x1,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err40[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err41[32] = {0x0,0x0,0x90,0xf5, 0xb4,0x31,0x16,0xc0, 0xe3,0xe3,0x1d,0x0,
+	0x2c,0x80,0x7b,0x6d, 0x7b,0x1,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err42[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd6[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x80,0x0,0x0,
+	0x80,0x80,0x0,0x80,0x0,0x80,0x80,0x80,
+	0x80,0x0,0x0,0x80,0x0,0x80,0x80,0x0,
+	0x80,0x80,0x0,0x0,0x0,0x80,0x80,0x0,
+	0x0,0x0,0x80,0x80,0x0,0x80,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,
+	0x80,0x80,0x80,0x0,0x0,0x0,0x80,0x80,
+	0x80,0x80,0x80,0x0,0x0,0x0,0x80,0x80,
+	0x80,0x80,0x0,0x80,0x80,0x80,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x80,0x80,0x0,0x80,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x80,0x80,0x80,0x0,0x80,0x80,0x80,0x80,
+	0x0,0x80,0x0,0x80,0x80,0x0,0x80,0x80,
+	0x0,0x80,0x80,0x0,0x80,0x80,0x80,0x0,
+	0x0,0x80,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x7f,0x0,0x0,0x0,0x0,0xff,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err43[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x12,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err44[32] = {0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x12,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err45[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err46[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x1f, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0xc1, 0x1,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err47[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x20,0x0,
+	0x0,0x18,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err48[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x18,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err49[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x1f, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0xc1, 0x1,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err50[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x10,0x0,0x2, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err51[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x8,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err52[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x2,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err53[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x1, 0x4,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd7[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xd1,0x0,0x0,
+	0x1,0x1,0x0,0x1,0x0,0x1,0x1,0xd1,
+	0xd1,0x0,0x0,0x1,0x0,0x1,0x1,0x0,
+	0x1,0x1,0x0,0x0,0x0,0x1,0x1,0x0,
+	0x0,0x0,0x1,0x1,0x0,0x1,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,
+	0x1,0x1,0x1,0x0,0x0,0x0,0x1,0x1,
+	0x1,0x1,0x1,0x0,0x0,0x0,0xd1,0xd1,
+	0x1,0x1,0x0,0x1,0x1,0xd1,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x1,0x1,0x0,0x1,0x0,
+	0x0,0x0,0x0,0x0,0x20,0x20,0x0,0x0,
+	0xd1,0x1,0x1,0x0,0x1,0x1,0x1,0x1,
+	0x0,0xd1,0x0,0xd1,0xd1,0x0,0xd1,0x1,
+	0x0,0x1,0x1,0x0,0x1,0xd1,0x1,0x0,
+	0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0,0x0,0x9,0x0,0x0,
+	0x0,0x0,0x6,0x0,0x0,0x6,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err54[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0xfe,0x0,0x2, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err55[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0xf,0x2, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err56[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::setwd8[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xa2,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa2,
+	0xa2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xa2,0xa2,
+	0x0,0x0,0x0,0x0,0x0,0xa2,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xa2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0xa2,0x0,0xa2,0xa2,0x0,0xa2,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xa2,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x1d,0x0,0x40,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x9,0x0,0x40,0x40,
+	0x40,0x40,0x40,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x40,
+	0x40,0x0,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x40,0x40,0x40,0x40,0x40,0x40,0x0,0x0,
+	0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x40,0x40,0x40,0x40,0x40,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x40,0x40,0x40,0x40,
+	0x40,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err57[32] = {0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x58,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err58[32] = {0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x50,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err59[32] = {0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err60[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x3f,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err61[32] = {0x0,0x60,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x0, 0x18,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err62[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x1, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err63[32] = {0x0,0x60,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x0, 0x18,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd9[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x6,0x0,0x0,0x10,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x10,0x10,
+	0x0,0x0,0x0,0x10,0x10,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x6,
+	0x10,0x10,0x0,0x0,0x10,0x10,0x10,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x10,0x0,0x10,0x10,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xf9,0x0,0x0,0x0,0x0,0x19,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xf0,0x60,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x10,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err64[32] = {0x0,0x60,0x0,0x11, 0x20,0x21,0x2,0x80, 0xa2,0x62,0x1c,0x0,
+	0x0,0x80,0x3d,0x0, 0x1a,0x0,0x80,0x10, 0x18,0xc,0x0,0x0,
+	0x8,0x0,0x60,0x0, 0xf0,0xff,0x1,0x1};
+SetWordType EfiVfrParser::err65[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x1, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err66[32] = {0x0,0x60,0x0,0x11, 0x20,0x21,0x2,0x80, 0xa2,0x62,0x1c,0x0,
+	0x0,0x80,0x3d,0x0, 0x1a,0x0,0x80,0x10, 0x18,0xc,0x0,0x0,
+	0x8,0x0,0x60,0x0, 0xf0,0xff,0x1,0x1};
+SetWordType EfiVfrParser::err67[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe4,0x3,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err68[32] = {0x0,0x10,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0xc,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd10[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x50,0x7,0x0,0x50,0x0,0x7,0x0,0x0,
+	0x0,0x0,0x0,0x30,0x0,0x30,0x7,0x0,
+	0x50,0x7,0x0,0x0,0x0,0x50,0x7,0x0,
+	0x0,0x0,0x97,0x10,0x0,0x10,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,
+	0x7,0x50,0x7,0x0,0x0,0x0,0x17,0x50,
+	0x7,0x50,0x7,0x0,0x0,0x0,0x97,0x97,
+	0x10,0x30,0x0,0x97,0x7,0x7,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x10,0x10,0x0,0x10,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x17,0x17,0x10,0x7,0x7,0x7,0x7,0x30,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x50,
+	0x0,0x0,0x7,0x0,0x7,0x17,0x0,0x0,
+	0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xf,0x0,0x0,0x0,0x0,0x7,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x7,0x3,0x0,0x0,
+	0x0,0x0,0x0,0x7,0x7,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x7,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x7,0x7,0x7,
+	0x7,0x7,0x7,0x7,0x7,0x7,0x7,0x7,
+	0x7,0x7,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x7,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err69[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x8,0x0, 0x0,0x0,0x0,0x0, 0x2,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd11[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x42,0x0,0x0,
+	0x94,0x0,0x0,0x94,0x0,0x0,0x80,0x42,
+	0x42,0x0,0x0,0x8c,0x0,0x8c,0x0,0x0,
+	0x94,0x0,0x0,0x0,0x0,0x94,0x0,0x0,
+	0x0,0x0,0xa4,0x84,0x0,0x81,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x94,
+	0x0,0x94,0x0,0x0,0x0,0x0,0x84,0x94,
+	0x0,0x94,0x0,0x0,0x0,0x0,0xe6,0xe6,
+	0x81,0x8c,0x0,0xa4,0x0,0x42,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x81,0x81,0x0,0x84,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xc6,0x84,0x84,0x0,0x0,0x0,0x0,0x8c,
+	0x0,0x42,0x0,0x42,0x42,0x0,0x42,0x94,
+	0x0,0x0,0x0,0x0,0x0,0xc6,0x0,0x0,
+	0x0,0x84,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err70[32] = {0x0,0x0,0x80,0x35, 0xb4,0x31,0x16,0xc0, 0xe3,0xe3,0x1d,0x0,
+	0x2c,0x80,0x7b,0x41, 0x1a,0x1,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err71[32] = {0x0,0x0,0x0,0x0, 0x14,0x0,0x0,0x0, 0x0,0x0,0x1,0x0,
+	0x0,0x0,0x40,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err72[32] = {0x0,0x0,0x80,0x4, 0x80,0x10,0x0,0x40, 0x41,0x1,0x0,0x0,
+	0x0,0x0,0x0,0x40, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err73[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x2,0x0, 0x0,0x60,0x4,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd12[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xab,0x3,0x0,0x8b,0x0,0x3,0x8b,0x0,
+	0x0,0x0,0x0,0x8b,0x0,0x8b,0x3,0x0,
+	0x8b,0x3,0x0,0x0,0x0,0x8b,0x3,0x0,
+	0x0,0x0,0x8b,0x8b,0x0,0x8b,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9b,
+	0x3,0xab,0x3,0x0,0x0,0x0,0x8b,0xcb,
+	0x3,0xcb,0x3,0x0,0x0,0x0,0x8b,0x8b,
+	0x8b,0x8f,0x0,0x8b,0x3,0x8b,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x8b,0x8b,0x0,0x8b,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x8b,0x8b,0x8b,0x0,0x3,0x3,0x3,0x8f,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9b,
+	0x0,0x0,0x3,0x0,0x3,0x8b,0x0,0x0,
+	0x0,0x8b,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err74[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x2,0x0, 0x0,0x60,0x4,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err75[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x20,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err76[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err77[32] = {0x0,0x10,0x0,0x0, 0x0,0x0,0x80,0x17, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x13, 0xea,0xb,0x0,0x0,
+	0xc0,0xff,0xff,0xff, 0xff,0xff,0xfb,0x0};
+SetWordType EfiVfrParser::setwd13[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xbc,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x43,0x0,0x0,0x43,0x0,0x0,0x41,0x0,
+	0x0,0x0,0x0,0x43,0x0,0x43,0x0,0x94,
+	0x43,0x0,0x0,0x0,0x0,0x43,0x0,0x0,
+	0x0,0x0,0x43,0x43,0x0,0x43,0x0,0x0,
+	0x28,0x28,0x28,0x28,0x0,0x28,0x0,0x43,
+	0x0,0x43,0x0,0x0,0x0,0x0,0x41,0x43,
+	0x0,0x43,0x0,0x0,0x0,0x0,0x43,0x43,
+	0x43,0x43,0x0,0x43,0x0,0x2,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x43,0x43,0x0,0x41,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x41,0x41,0x41,0x0,0x0,0x0,0x0,0x43,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x43,
+	0x0,0x0,0x0,0x0,0x0,0x43,0x0,0x0,
+	0x0,0x41,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x28,0xbc,0x0,0x0,0x28,0x0,0x0,
+	0x0,0x0,0x28,0x0,0x28,0x0,0xbc,0xbc,
+	0xbc,0xbc,0xbc,0x0,0x28,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xbc,
+	0xbc,0x28,0xbc,0xbc,0xbc,0xbc,0xbc,0xbc,
+	0xbc,0xbc,0xbc,0xbc,0xbc,0xbc,0x28,0x28,
+	0xbc,0xbc,0xbc,0xbc,0xbc,0xbc,0xbc,0xbc,
+	0xbc,0xbc,0xbc,0xbc,0xbc,0x28,0x28,0x28,
+	0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+	0x28,0x28,0x28,0x0,0xbc,0xbc,0xbc,0xbc,
+	0xbc,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err78[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x2,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err79[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err80[32] = {0x0,0x10,0x0,0x0, 0x0,0x0,0x80,0x17, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x13, 0xea,0xb,0x0,0x0,
+	0xc0,0xff,0xff,0xff, 0xff,0xff,0xfb,0x0};
+SetWordType EfiVfrParser::err81[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x10,0x0, 0x0,0x80,0x0,0x0,
+	0xc,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err82[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0xc0,0xf,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd14[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x28,0x80,0x0,0x28,0x0,0x80,0x28,0x0,
+	0x0,0x0,0x0,0x28,0x0,0x28,0x80,0x2,
+	0x28,0x80,0x0,0x0,0x0,0x28,0x80,0x0,
+	0x0,0x0,0xa8,0x28,0x0,0x28,0x0,0x0,
+	0x5,0x5,0x5,0x5,0x0,0x5,0x0,0x28,
+	0x80,0x28,0x80,0x0,0x0,0x0,0xa8,0x28,
+	0x80,0x28,0x80,0x0,0x0,0x0,0xa8,0xa8,
+	0x28,0x28,0x0,0xa8,0x80,0xa0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x38,0x38,0x0,0x28,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xa8,0xa8,0x28,0x0,0x80,0x80,0x80,0x28,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x28,
+	0x0,0x0,0x80,0x0,0x80,0xa8,0x0,0x0,
+	0x0,0x28,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xc0,0x5,0x7,0x0,0x0,0xc5,0x0,0x0,
+	0x0,0x0,0x5,0x0,0x45,0x0,0x7,0x7,
+	0x7,0x7,0x7,0x0,0x5,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x7,
+	0x7,0x5,0x7,0x7,0x7,0x7,0x7,0x7,
+	0x7,0x7,0x7,0x7,0x7,0x7,0x5,0x5,
+	0x7,0x7,0x7,0x7,0x7,0x7,0x7,0x7,
+	0x7,0x7,0x7,0x7,0x7,0x5,0x5,0x5,
+	0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x5,
+	0x5,0x5,0x5,0x0,0x7,0x7,0x7,0x7,
+	0x7,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err83[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x80,0x1,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err84[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x80,0x1,0x0, 0x0,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err85[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x10,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd15[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x10,0x3,0x0,0x10,0x0,0x3,0x10,0x0,
+	0x0,0x0,0x0,0x10,0x0,0x10,0x3,0x0,
+	0x10,0x3,0x0,0x0,0x0,0x10,0x3,0x0,
+	0x0,0x0,0x13,0x10,0x0,0x10,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,
+	0x3,0x10,0x3,0x0,0x0,0x0,0x13,0x10,
+	0x3,0x10,0x3,0x0,0x0,0x0,0x13,0x13,
+	0x10,0x10,0x0,0x13,0x3,0x13,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x10,0x10,0x0,0x10,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x7f,0x7f,0x10,0x0,0x3,0x3,0x3,0x10,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,
+	0x0,0x0,0x3,0x0,0x3,0x13,0x0,0x0,
+	0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x80,0x0,0x0,0x0,0x0,0xe7,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err86[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err87[32] = {0x0,0x0,0x80,0x24, 0xd4,0x10,0x16,0x40, 0x61,0xe1,0x15,0x0,
+	0x2c,0x80,0x43,0x40, 0x10,0x1,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err88[32] = {0x0,0x10,0x62,0x2, 0x58,0x42,0x0,0x20, 0x0,0x0,0x2,0x0,
+	0x10,0x58,0x8,0x1, 0x0,0x0,0x80,0x13, 0xe2,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err89[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err90[32] = {0x0,0x0,0x80,0x24, 0xd4,0x10,0x16,0x40, 0x61,0xe1,0x15,0x0,
+	0x2c,0x80,0x43,0x40, 0x10,0x1,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err91[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err92[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x3f,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err93[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x1,0x0,
+	0x0,0x0,0x40,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err94[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x3, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd16[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,
+	0x0,0x0,0x2,0x0,0x0,0x0,0x2,0x2,
+	0x99,0x0,0x2,0x99,0x0,0x0,0x99,0x0,
+	0x0,0x0,0x0,0x99,0x2,0x9b,0x0,0x3,
+	0x99,0x0,0x2,0x0,0x0,0x99,0x0,0x2,
+	0x0,0x0,0x99,0x99,0x0,0x99,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x99,
+	0x0,0x99,0x0,0x0,0x0,0x0,0x99,0x99,
+	0x0,0x99,0x0,0x0,0x0,0x0,0x99,0x99,
+	0x99,0x99,0x2,0x99,0x0,0x99,0x0,0x0,
+	0x0,0x20,0x20,0x20,0x20,0x20,0x20,0x0,
+	0x0,0x0,0x0,0x99,0x99,0x2,0x99,0x0,
+	0x0,0x0,0x0,0x0,0x2,0x2,0x0,0x2,
+	0x99,0x99,0x99,0x0,0x2,0x0,0x0,0x99,
+	0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x99,
+	0x0,0x0,0x0,0x0,0x0,0x99,0x0,0x0,
+	0x0,0x99,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x46,0x2,0x2,0x0,0x0,0x6,0x0,0x0,
+	0x0,0x0,0x2,0x0,0x40,0x0,0x2,0x2,
+	0x2,0x2,0x2,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,
+	0x2,0x0,0x2,0x2,0x2,0x2,0x2,0x2,
+	0x2,0x2,0x2,0x2,0x2,0x2,0x0,0x0,
+	0x2,0x2,0x2,0x2,0x2,0x2,0x2,0x2,
+	0x2,0x2,0x2,0x2,0x2,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x2,0x2,0x2,0x2,
+	0x2,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err95[32] = {0x0,0x0,0x42,0x2, 0x0,0x0,0x0,0x0, 0x0,0x0,0x2,0x0,
+	0x0,0x58,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err96[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err97[32] = {0x0,0x0,0x80,0x24, 0xf4,0x10,0x16,0x40, 0x61,0xe1,0x3d,0x0,
+	0x2c,0x80,0x7b,0x40, 0x1a,0x1,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err98[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err99[32] = {0x0,0x0,0x80,0x24, 0xb4,0x10,0x16,0x40, 0x61,0xe1,0x3d,0x0,
+	0x2c,0x80,0x7b,0x40, 0x1a,0x1,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err100[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err101[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x3f,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd17[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x34,0x0,0x1,0x34,0x0,0x0,0x34,0x0,
+	0x0,0x0,0x0,0x34,0x0,0x34,0x14,0x0,
+	0x34,0x0,0x0,0x0,0x0,0x34,0x0,0x0,
+	0x0,0x0,0x34,0x34,0x0,0x34,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x34,
+	0x0,0x34,0x0,0x0,0x0,0x0,0x34,0x34,
+	0x0,0x34,0x0,0x0,0x0,0x0,0x34,0x34,
+	0x34,0x34,0x0,0x34,0x14,0x34,0x4,0x0,
+	0x0,0x80,0x80,0x80,0x80,0x80,0x80,0x0,
+	0x0,0x0,0x0,0x34,0x34,0x0,0x34,0x0,
+	0x0,0x0,0x0,0x0,0x1,0x1,0x0,0x1,
+	0x34,0x34,0x34,0x0,0x14,0x14,0x14,0x34,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x34,
+	0x0,0x0,0x14,0x0,0x14,0x34,0x0,0x0,
+	0x0,0x34,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x4a,0x0,0x0,0x0,0x0,0x5e,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x14,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err102[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x80,0x81,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err103[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x40, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x40, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err104[32] = {0x0,0x0,0x0,0x0, 0x60,0x0,0x2,0x80, 0x20,0x60,0x2c,0x0,
+	0x0,0x80,0x39,0x0, 0x1a,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err105[32] = {0x0,0x0,0x0,0x0, 0x20,0x0,0x2,0x80, 0x20,0x60,0x2c,0x0,
+	0x0,0x80,0x39,0x0, 0x1a,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd18[253] = {0x0,0x2,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x98,0x0,0x0,0x98,0x0,0x0,0x98,0x0,
+	0x0,0x0,0x0,0x98,0x0,0x98,0x60,0x0,
+	0x98,0x0,0x0,0x0,0x0,0x98,0x0,0x0,
+	0x0,0x0,0xf8,0x98,0x0,0x98,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x98,
+	0x60,0x98,0x0,0x0,0x0,0x0,0xf8,0x98,
+	0x0,0x98,0x0,0x0,0x0,0x0,0xf8,0xf8,
+	0x98,0x98,0x0,0xf8,0x60,0x98,0x20,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x98,0x98,0x0,0x98,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xfc,0xfc,0x98,0x0,0x60,0x60,0x60,0x98,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x98,
+	0x0,0x0,0x60,0x0,0x60,0xf8,0x0,0x0,
+	0x0,0x98,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x1,0x0,0x0,0x0,0x0,0x1,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x60,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err106[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0xc0,0x3f,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x60,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err107[32] = {0x0,0x0,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x80, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err108[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x3f,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd19[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x8,0x0,0x80,0x8,0x0,0x0,0x8,0x0,
+	0x0,0x0,0x0,0x8,0x0,0x8,0x0,0x0,
+	0x8,0x0,0x0,0x0,0x0,0x8,0x0,0x0,
+	0x0,0x0,0x8,0x8,0x0,0x8,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,
+	0x0,0x8,0x0,0x0,0x0,0x0,0x8,0x8,
+	0x0,0x8,0x0,0x0,0x0,0x0,0x8,0x8,
+	0x8,0x8,0x0,0x8,0x0,0x8,0x0,0x0,
+	0x0,0x22,0x22,0x22,0x22,0x22,0x22,0x0,
+	0x0,0x0,0x0,0x8,0x8,0x0,0x8,0x0,
+	0x0,0x0,0x0,0x0,0x80,0x80,0x0,0x80,
+	0x8,0x8,0x8,0x0,0x0,0x0,0x0,0x8,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,
+	0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,
+	0x0,0x8,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x55,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x44,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err109[32] = {0x0,0x0,0x0,0x0, 0x60,0x1,0x2,0x0, 0x20,0x60,0xc,0x0,
+	0x0,0x80,0x39,0x0, 0x1a,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err110[32] = {0x0,0x0,0x0,0x0, 0x40,0x1,0x0,0x0, 0x0,0x0,0x4,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err111[32] = {0x0,0x0,0x0,0x2, 0x0,0x2,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x58,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err112[32] = {0x0,0x0,0x0,0x0, 0x40,0xd,0x0,0x0, 0x30,0x0,0x4,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err113[32] = {0x0,0x0,0x0,0x0, 0x40,0xd,0x0,0x0, 0x20,0x0,0x4,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err114[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x80,0x1f,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err115[32] = {0x0,0x0,0x80,0x0, 0x0,0x0,0x0,0x0, 0x1,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd20[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x4,0x0,0x0,0x4,0x0,0x0,0x4,0x0,
+	0x0,0x0,0x0,0x4,0x0,0x4,0x1,0x38,
+	0x4,0x3b,0x0,0x38,0x38,0x4,0x0,0x0,
+	0x0,0x0,0x5,0x4,0x0,0x4,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,
+	0x0,0x4,0x0,0x0,0x0,0x0,0xd,0x4,
+	0x0,0x4,0x0,0x0,0x0,0x0,0x5,0x5,
+	0x4,0x4,0x0,0x3f,0x1,0x4,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x4,0x4,0x0,0x4,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x5,0x5,0x4,0x0,0x1,0x1,0x1,0x4,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,
+	0x0,0x0,0x1,0x0,0x1,0x5,0x0,0x0,
+	0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xc0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err116[32] = {0x0,0x0,0x0,0x1, 0x20,0x0,0x2,0x0, 0x32,0x60,0xc,0x0,
+	0x0,0x80,0x39,0x0, 0x1a,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err117[32] = {0x0,0x0,0x0,0x0, 0x40,0x0,0x0,0x0, 0x4,0x0,0x20,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err118[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x4,0x0,0x20,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err119[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x3f,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0xe0,0xf,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd21[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x11,0x6,0x0,0x11,0x0,0x0,0x11,0x0,
+	0x0,0x0,0x0,0x11,0x0,0x11,0x6,0x0,
+	0x11,0x0,0x0,0x0,0x0,0x11,0x0,0x0,
+	0x0,0x0,0x17,0x11,0x0,0x11,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,
+	0x0,0x11,0x6,0x8,0x0,0x0,0x17,0x11,
+	0x0,0x11,0x0,0x0,0x0,0x0,0x17,0x17,
+	0x11,0x11,0x0,0x17,0x6,0x11,0x8,0x0,
+	0x0,0x40,0x40,0x40,0x40,0x40,0x40,0x0,
+	0x0,0x0,0x0,0x11,0x11,0x0,0x11,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x17,0x17,0x11,0x0,0x6,0x6,0x6,0x11,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11,
+	0x0,0x0,0x6,0x0,0x6,0x17,0x0,0x0,
+	0x0,0x11,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xa0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x80,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x6,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err120[32] = {0x0,0x0,0x0,0x1, 0x60,0x0,0x2,0x0, 0x24,0x60,0xc,0x0,
+	0x0,0x80,0x39,0x0, 0x1a,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err121[32] = {0x0,0x0,0x0,0x1, 0x20,0x0,0x2,0x0, 0x24,0x60,0xc,0x0,
+	0x0,0x80,0x39,0x0, 0x1a,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err122[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x40,0x1,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err123[32] = {0x0,0x0,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x4,0x20,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err124[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x4,0x20,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd22[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x54,0x3,0x0,0x54,0x0,0x0,0x54,0x0,
+	0x0,0x0,0x0,0x54,0x0,0x54,0x3,0x0,
+	0x54,0x0,0x0,0x0,0x0,0x54,0x0,0x0,
+	0x0,0x0,0x57,0x54,0x0,0x54,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x54,
+	0x0,0x54,0x0,0x1,0x0,0x0,0x57,0x54,
+	0x0,0x54,0x0,0x20,0x0,0x0,0x57,0x57,
+	0x54,0x54,0x0,0x57,0x3,0x54,0x20,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x54,0x54,0x0,0x54,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x57,0x57,0x54,0x0,0x3,0x3,0x3,0x54,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x54,
+	0x0,0x0,0x3,0x0,0x3,0x57,0x0,0x0,
+	0x0,0x54,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x88,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err125[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x3f,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x10,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err126[32] = {0x0,0x0,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x4,0x20,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err127[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x4,0x20,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err128[32] = {0x0,0x0,0x0,0x0, 0x20,0x0,0x2,0x0, 0xa0,0x70,0xc,0x0,
+	0x0,0x80,0x39,0x0, 0x1a,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err129[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x3f,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd23[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x10,0x0,0x0,0x10,0x0,0x0,0x10,0x0,
+	0x0,0x0,0x0,0x10,0x0,0x10,0x8,0x0,
+	0x10,0x0,0x0,0x0,0x0,0x10,0x0,0x0,
+	0x0,0x0,0x18,0x10,0x0,0x10,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,
+	0x0,0x10,0x0,0x0,0x0,0x0,0x18,0x10,
+	0x8,0x10,0x0,0x4,0x0,0x0,0x18,0x18,
+	0x10,0x10,0x0,0x18,0x8,0x10,0x4,0x0,
+	0x0,0x41,0x41,0x41,0x41,0x41,0x41,0x0,
+	0x0,0x0,0x0,0x10,0x10,0x0,0x10,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x18,0x18,0x10,0x0,0x8,0x8,0x8,0x10,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10,
+	0x0,0x0,0x8,0x0,0x8,0x18,0x0,0x0,
+	0x0,0x10,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xa2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x82,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x8,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err130[32] = {0x0,0x0,0x0,0x18, 0x60,0x0,0x2,0x0, 0x20,0x60,0xc,0x0,
+	0x0,0x80,0x39,0x0, 0x1a,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err131[32] = {0x0,0x0,0x0,0x10, 0x60,0x0,0x2,0x0, 0x20,0x60,0xc,0x0,
+	0x0,0x80,0x39,0x0, 0x1a,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err132[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x3f,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x60,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err133[32] = {0x0,0x0,0x0,0x0, 0x60,0x20,0x2,0x0, 0x20,0x60,0xc,0x0,
+	0x0,0x80,0x39,0x0, 0x1a,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd24[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x4,0x0,0x40,0x4,0x0,0x2b,0x4,0x0,
+	0x0,0x0,0x0,0x4,0x0,0x4,0xab,0x1,
+	0x4,0x0,0x0,0x0,0x0,0x4,0x80,0x0,
+	0x0,0x0,0xaf,0x4,0x0,0x4,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,
+	0x0,0x4,0x0,0x0,0x0,0x0,0xaf,0x4,
+	0x0,0x4,0x0,0x0,0x0,0x0,0xaf,0xaf,
+	0x4,0x4,0x0,0xaf,0xab,0x4,0x0,0x0,
+	0x0,0x10,0x10,0x10,0x10,0x10,0x10,0x0,
+	0x0,0x0,0x0,0x4,0x4,0x0,0x4,0x0,
+	0x0,0x0,0x0,0x0,0x40,0x40,0x0,0x40,
+	0xaf,0xaf,0x4,0x0,0xab,0xab,0xab,0x4,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,
+	0x0,0x0,0xab,0x0,0xab,0xaf,0x0,0x0,
+	0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xab,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err134[32] = {0x0,0x0,0x0,0x0, 0x40,0x20,0x0,0x0, 0x0,0x0,0x4,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err135[32] = {0x0,0x0,0x0,0x2, 0x0,0x40,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x58,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err136[32] = {0x0,0x0,0x0,0x0, 0x40,0xa0,0x1,0x0, 0x30,0x0,0x4,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err137[32] = {0x0,0x0,0x0,0x0, 0x40,0xa0,0x1,0x0, 0x20,0x0,0x4,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err138[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0x1c,0x80,
+	0x3,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err139[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x40,0xc,0x0,
+	0x0,0x80,0x1,0x0, 0x1a,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd25[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x2,0x0,0x0,0x2,0x0,0x0,0x2,0x0,
+	0x0,0x0,0x0,0x2,0x0,0x2,0x0,0x1c,
+	0x2,0x0,0x0,0x0,0x0,0x2,0x1d,0x0,
+	0x1c,0x1c,0x2,0x2,0x0,0x2,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,
+	0x0,0x2,0x0,0x0,0x0,0x0,0x6,0x2,
+	0x0,0x2,0x0,0x0,0x0,0x0,0x2,0x2,
+	0x2,0x2,0x0,0x1f,0x0,0x2,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x2,0x2,0x0,0x2,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x82,0x82,0x2,0x0,0x0,0x0,0x0,0x2,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,
+	0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,
+	0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x60,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x40,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err140[32] = {0x0,0x0,0x0,0x0, 0x20,0x0,0x2,0x0, 0x20,0x20,0x0,0x0,
+	0x0,0x0,0x38,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd26[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x89,0x0,0x0,0x0,0x89,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x59,0x0,
+	0x0,0x89,0x0,0x0,0x0,0x0,0x89,0x0,
+	0x0,0x0,0x59,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x89,0x0,0x89,0x0,0x0,0x0,0x59,0x0,
+	0x89,0x0,0x89,0x0,0x0,0x0,0x59,0x3b,
+	0x0,0x0,0x0,0x3b,0x3b,0x89,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x3b,0x3b,0x0,0x0,0x59,0x59,0x59,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x5,0x3b,0x0,0x3b,0x3b,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x89,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x3b,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err141[32] = {0x0,0x0,0x80,0x4, 0x94,0x10,0x16,0x40, 0x41,0xe1,0x5,0x0,
+	0xc,0x0,0x40,0x40, 0x10,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err142[32] = {0x0,0x0,0x80,0x4, 0x94,0x10,0x14,0x40, 0x41,0x81,0x1,0x0,
+	0xc,0x0,0x40,0x40, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd27[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x52,0x0,0x0,0x52,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x31,0x0,0x31,0x0,0x0,
+	0x52,0x0,0x0,0x0,0x0,0x52,0x0,0x0,
+	0x0,0x0,0x14,0x10,0x0,0x98,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x52,
+	0x0,0x52,0x0,0x0,0x0,0x0,0x0,0x52,
+	0x0,0x52,0x0,0x0,0x0,0x0,0x14,0x14,
+	0x98,0x31,0x0,0x14,0x0,0x10,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x98,0x98,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x52,
+	0x0,0x0,0x0,0x0,0x0,0x10,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err143[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err144[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err145[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::setwd28[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xa8,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x57,0x0,0x0,0x57,0x0,0x0,0x14,0x0,
+	0x0,0x0,0x0,0x57,0x0,0x57,0x0,0x0,
+	0x57,0x0,0x0,0x0,0x0,0x57,0x0,0x0,
+	0x0,0x0,0x16,0x57,0x0,0x57,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x57,
+	0x0,0x57,0x0,0x0,0x0,0x0,0x14,0x57,
+	0x0,0x57,0x0,0x0,0x0,0x0,0x16,0x16,
+	0x57,0x57,0x0,0x16,0x0,0x55,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x57,0x57,0x0,0x14,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x14,0x14,0x14,0x0,0x0,0x0,0x0,0x57,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x57,
+	0x0,0x0,0x0,0x0,0x0,0x16,0x0,0x0,
+	0x0,0x14,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0xa8,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xa8,0xa8,
+	0xa8,0xa8,0xa8,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa8,
+	0xa8,0x0,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,
+	0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0x0,0x0,
+	0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,
+	0xa8,0xa8,0xa8,0xa8,0xa8,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xa8,0xa8,0xa8,0xa8,
+	0xa8,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err146[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err147[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err148[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::setwd29[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x92,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x6d,0x0,0x0,0x6d,0x0,0x0,0x48,0x0,
+	0x0,0x0,0x0,0x6d,0x0,0x6d,0x0,0x0,
+	0x6d,0x0,0x0,0x0,0x0,0x6d,0x0,0x0,
+	0x0,0x0,0x6c,0x6d,0x0,0x6d,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6d,
+	0x0,0x6d,0x0,0x0,0x0,0x0,0x48,0x6d,
+	0x0,0x6d,0x0,0x0,0x0,0x0,0x6c,0x6c,
+	0x6d,0x6d,0x0,0x6c,0x0,0x49,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x6d,0x6d,0x0,0x48,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x48,0x48,0x48,0x0,0x0,0x0,0x0,0x6d,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6d,
+	0x0,0x0,0x0,0x0,0x0,0x6c,0x0,0x0,
+	0x0,0x48,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x92,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x92,0x92,
+	0x92,0x92,0x92,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x92,
+	0x92,0x0,0x92,0x92,0x92,0x92,0x92,0x92,
+	0x92,0x92,0x92,0x92,0x92,0x92,0x0,0x0,
+	0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,
+	0x92,0x92,0x92,0x92,0x92,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x92,0x92,0x92,0x92,
+	0x92,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err149[32] = {0x0,0x0,0x80,0x4, 0x94,0x10,0x16,0x40, 0x41,0x81,0x11,0x0,
+	0xc,0x0,0x40,0x40, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err150[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err151[32] = {0x0,0x0,0x80,0x4, 0x94,0x10,0x14,0x40, 0x41,0xa1,0x11,0x0,
+	0xc,0x0,0x40,0x40, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd30[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x8,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x77,0x0,0x0,0x77,0x0,0x0,0x44,0x0,
+	0x0,0x0,0x0,0x77,0x0,0x77,0x0,0x0,
+	0x77,0x0,0x0,0x0,0x0,0x77,0x0,0x0,
+	0x0,0x0,0x44,0x77,0x0,0x77,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x77,
+	0x0,0x77,0x0,0x0,0x0,0x0,0x44,0x77,
+	0x0,0x77,0x0,0x0,0x0,0x0,0x44,0x44,
+	0x77,0x77,0x0,0x44,0x0,0x11,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x77,0x77,0x0,0x44,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x44,0x44,0x44,0x0,0x0,0x0,0x0,0x77,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x77,
+	0x0,0x0,0x0,0x0,0x0,0x44,0x0,0x0,
+	0x0,0x44,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x80,0x0,0x8,0x0,0x0,0x80,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x8,0x8,
+	0x8,0x8,0x8,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8,
+	0x8,0x0,0x8,0x8,0x8,0x8,0x8,0x8,
+	0x8,0x8,0x8,0x8,0x8,0x8,0x0,0x0,
+	0x8,0x8,0x8,0x8,0x8,0x8,0x8,0x8,
+	0x8,0x8,0x8,0x8,0x8,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x8,0x8,0x8,0x8,
+	0x8,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err152[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x80,0x1,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd31[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,
+	0xc0,0x0,0x0,0xc0,0x0,0x0,0xc0,0x40,
+	0x40,0x0,0x0,0xc0,0x0,0xc0,0x0,0x0,
+	0xc0,0x0,0x0,0x0,0x0,0xc0,0x0,0x0,
+	0x0,0x0,0xc0,0xc0,0x0,0xc0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc0,
+	0x0,0xc0,0x0,0x0,0x0,0x0,0xc0,0xc0,
+	0x0,0xc0,0x0,0x0,0x0,0x0,0xc0,0xc0,
+	0xc0,0xc0,0x0,0xc0,0x0,0x40,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0xc0,0xc0,0x0,0xc0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xc8,0xc8,0xc0,0x0,0x0,0x0,0x0,0xc0,
+	0x0,0x40,0x0,0x40,0x40,0x0,0x40,0xc0,
+	0x0,0x0,0x0,0x0,0x0,0xc0,0x0,0x0,
+	0x0,0xc0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x35,0x0,0x0,0x0,0x0,0x37,0x0,0x0,
+	0x0,0x0,0x10,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err153[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err154[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::setwd32[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xa,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x1,0xf4,0x0,0x1,0x0,0xf4,0x1,0x0,
+	0x0,0x0,0x0,0x1,0x0,0x1,0xf4,0x0,
+	0x1,0xf4,0x0,0x0,0x0,0x1,0xf4,0x0,
+	0x0,0x0,0xf5,0x1,0x0,0x1,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,
+	0xf4,0x1,0xf4,0x0,0x0,0x0,0xf5,0x1,
+	0xf4,0x1,0xf4,0x0,0x0,0x0,0xf5,0xf5,
+	0x1,0x1,0x0,0xf5,0xf4,0xf4,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x1,0x1,0x0,0x1,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xf5,0xf5,0x1,0x0,0xf4,0xf4,0xf4,0x1,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,
+	0x0,0xf4,0xf4,0x0,0xf4,0xf5,0x0,0x0,
+	0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0xa,0x0,0x0,0xf4,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xa,0xa,
+	0xa,0xa,0xa,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xf4,0x0,0x0,0xa,
+	0xa,0x0,0xa,0xa,0xa,0xa,0xa,0xa,
+	0xa,0xa,0xa,0xa,0xa,0xa,0x0,0x0,
+	0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+	0xa,0xa,0xa,0xa,0xa,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xa,0xa,0xa,0xa,
+	0xa,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err155[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err156[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err157[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err158[32] = {0x0,0x0,0x0,0x11, 0x20,0x21,0x2,0x80, 0xa2,0x62,0x3c,0x0,
+	0x0,0x80,0x39,0x0, 0x1a,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x8,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd33[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xa,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0xb5,0x0,0x0,0x0,0xb5,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xb5,0x0,
+	0x0,0xb5,0x0,0x0,0x0,0x0,0xb5,0x0,
+	0x0,0x0,0xb5,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xb5,0x0,0xb5,0x0,0x0,0x0,0xb5,0x0,
+	0xb5,0x0,0xb5,0x0,0x0,0x0,0xb5,0xb5,
+	0x0,0x0,0x0,0xb5,0xb5,0xb5,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xb5,0xb5,0x0,0x0,0xb5,0xb5,0xb5,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x1,0xb5,0x0,0xb5,0xb5,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x40,0x0,0xa,0x0,0x0,0xf5,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xa,0xa,
+	0xa,0xa,0xa,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xb5,0x0,0x0,0xa,
+	0xa,0x0,0xa,0xa,0xa,0xa,0xa,0xa,
+	0xa,0xa,0xa,0xa,0xa,0xa,0x0,0x0,
+	0xa,0xa,0xa,0xa,0xa,0xa,0xa,0xa,
+	0xa,0xa,0xa,0xa,0xa,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xa,0xa,0xa,0xa,
+	0xa,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err159[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0xc0,0xf,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x0,
+	0x30,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err160[32] = {0x0,0x0,0x20,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err161[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x80,0x3,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err162[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x8,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x4,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err163[32] = {0x0,0x10,0x0,0x0, 0x40,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err164[32] = {0x0,0x0,0x0,0x0, 0x10,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd34[253] = {0x0,0x80,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x40,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x38,0x1,0x0,0x38,0x0,0x1,0x38,0x0,
+	0x0,0x0,0x0,0x38,0x0,0x38,0x1,0x0,
+	0x38,0x1,0x0,0x0,0x0,0x38,0x1,0x0,
+	0x0,0x0,0x39,0x38,0x0,0x38,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x38,
+	0x1,0x38,0x1,0x0,0x0,0x0,0x39,0x38,
+	0x1,0x38,0x1,0x0,0x0,0x0,0x39,0x39,
+	0x38,0x38,0x0,0x39,0x1,0x29,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x38,0x38,0x0,0x38,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x39,0x39,0x38,0x0,0x1,0x1,0x1,0x38,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x38,
+	0x0,0x0,0x1,0x0,0x1,0x39,0x0,0x0,
+	0x0,0x38,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x6,0x0,0x40,0x0,0x0,0x7,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x4,0x0,0x40,0x40,
+	0x40,0x40,0x40,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x40,
+	0x40,0x0,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x40,0x40,0x40,0x40,0x40,0x40,0x0,0x0,
+	0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+	0x40,0x40,0x40,0x40,0x40,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x40,0x40,0x40,0x40,
+	0x40,0x0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err165[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0xc,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err166[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err167[32] = {0x0,0x0,0x80,0x24, 0xd4,0x10,0x16,0x40, 0x61,0xe1,0x35,0x0,
+	0x2c,0x80,0x43,0x40, 0x10,0x1,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err168[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x10, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd35[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xd,0xd0,0x0,0xd,0x0,0xd0,0xd,0x0,
+	0x0,0x0,0x0,0xd,0x0,0xd,0xd0,0x0,
+	0xd,0xd0,0x0,0x0,0x0,0xd,0xd0,0x0,
+	0x0,0x0,0xdd,0xd,0x0,0xd,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,
+	0xd0,0xd,0xd0,0x0,0x0,0x0,0xdd,0xd,
+	0xd0,0xd,0xd0,0x0,0x0,0x0,0xdd,0xdd,
+	0xd,0xd,0x0,0xdd,0xd0,0xdd,0x4,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0xd,0xd,0x0,0xd,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xdd,0xdd,0xd,0xd0,0xd0,0xd0,0xd0,0xd,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd,
+	0x0,0x0,0xd0,0x0,0xd0,0xdd,0x0,0x0,
+	0x0,0xd,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xf2,0x0,0x0,0x0,0x0,0xd2,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0xe0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xd0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x80,0xc0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0xe0,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd36[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x55,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x55,0x0,0x0,0x0,0x55,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x55,0x0,
+	0x0,0x55,0x0,0x0,0x0,0x0,0x55,0x0,
+	0x0,0x0,0x55,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x55,0x0,0x55,0x0,0x0,0x0,0x55,0x0,
+	0x55,0x0,0x55,0x0,0x0,0x0,0x55,0x55,
+	0x0,0x0,0x0,0x55,0x55,0x55,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x55,0x55,0x0,0x55,0x55,0x55,0x55,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x55,0x0,0x55,0x55,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x55,0x0,0x0,0x0,0x0,0x55,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x55,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x55,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x55,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x55,0x55,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x54,0x52,0x52,
+	0x48,0x48,0x48,0x48,0x20,0x20,0x80,0x80,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x55,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err169[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x17, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd37[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x15,0x0,0x0,0x0,0x15,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x15,0x0,
+	0x0,0x15,0x0,0x0,0x0,0x0,0x15,0x0,
+	0x0,0x0,0x15,0x0,0x0,0x0,0x0,0x0,
+	0x8,0x8,0x8,0x8,0x0,0x8,0x0,0x0,
+	0x15,0x0,0x15,0x0,0x0,0x0,0x15,0x0,
+	0x15,0x0,0x15,0x0,0x0,0x0,0x15,0x15,
+	0x0,0x0,0x0,0x15,0x15,0x15,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x15,0x15,0x0,0x15,0x15,0x15,0x15,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x15,0x0,0x15,0x15,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x15,0x0,0x40,0x0,0x0,0x15,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x15,0x0,0x40,0x40,
+	0x40,0x40,0x40,0x15,0x12,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x15,0x0,0x0,0x20,
+	0x20,0x0,0x20,0x20,0x20,0x20,0x20,0x20,
+	0x20,0x20,0x20,0x40,0x40,0x80,0x15,0x15,
+	0x0,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+	0x0,0x0,0x80,0x80,0x0,0x15,0x15,0x15,
+	0x15,0x15,0x15,0x15,0x15,0x15,0x14,0x14,
+	0x12,0x12,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x15,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err170[32] = {0x0,0x10,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err171[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0xc0,0xfe,0x3,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err172[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0xa0,0x7,0x0,0x0};
+SetWordType EfiVfrParser::err173[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0xa0,0x7,0x0,0x0};
+SetWordType EfiVfrParser::setwd38[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xfe,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0xfe,0x0,0x0,0x0,0xfe,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xfe,0x0,
+	0x0,0xfe,0x0,0x0,0x0,0x0,0xfe,0x0,
+	0x0,0x0,0xfe,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xfe,0x0,0xfe,0x0,0x0,0x0,0xfe,0x0,
+	0xfe,0x0,0xfe,0x0,0x0,0x0,0xfe,0xfe,
+	0x0,0x0,0x0,0xfe,0xfe,0xfe,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xfe,0xfe,0x0,0xfe,0xfe,0xfe,0xfe,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0xfe,0x0,0xfe,0xfe,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xfe,0x0,0x0,0x0,0x0,0xfe,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xfe,0x0,0x0,0x0,
+	0x0,0x0,0x0,0xfe,0xfe,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xfe,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xfe,0xfe,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xfe,0xfe,0xfe,
+	0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,0xfe,
+	0xfe,0xfe,0x0,0x0,0x1,0x1,0x1,0x1,
+	0x1,0xfe,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err174[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0xa0,0x7,0x0,0x0};
+SetWordType EfiVfrParser::err175[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x3, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err176[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x4,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err177[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0xe0,0x1,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::setwd39[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xff,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0xff,0x0,0x0,0x0,0xff,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xff,0x0,
+	0x0,0xff,0x0,0x0,0x0,0x0,0xff,0x0,
+	0x0,0x0,0xff,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xff,0x0,0xff,0x0,0x0,0x0,0xff,0x0,
+	0xff,0x0,0xff,0x0,0x0,0x0,0xff,0xff,
+	0x0,0x0,0x0,0xff,0xff,0xff,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xff,0xff,0x0,0xff,0xff,0xff,0xff,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0xff,0x0,0xff,0xff,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xff,0x0,0x0,0x0,0x0,0xff,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xff,0x0,0x0,0x0,
+	0x0,0x0,0x0,0xff,0xff,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xff,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xff,0xff,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xff,0xff,0xff,
+	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	0xff,0xff,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0xff,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err178[32] = {0x0,0x20,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x8,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err179[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0x0,0x0,0xc,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err180[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x10,0x7f, 0x6,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err181[32] = {0x0,0x10,0x2,0x0, 0x0,0x0,0x0,0x20, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::err182[32] = {0x0,0x10,0x0,0x0, 0x0,0x0,0x0,0x20, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0xe0,0x3,0x0,0x0,
+	0xc0,0xfe,0x9f,0xff, 0xf,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::setwd40[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xc0,0x3f,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x3e,0x0,0x0,0x0,0x3e,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x3e,0x0,
+	0x0,0x3e,0x0,0x0,0x0,0x0,0x3e,0x0,
+	0x0,0x0,0x3e,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x40,0x0,
+	0x3e,0x0,0x3e,0x0,0x0,0x0,0x3e,0x0,
+	0x3e,0x0,0x3e,0x0,0x0,0x0,0x3e,0x3e,
+	0x0,0x0,0x0,0x3e,0x3e,0x3e,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x3e,0x3e,0x0,0x3e,0x3e,0x3e,0x3e,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x3e,0x0,0x3e,0x3e,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x3f,0x0,0xc0,0x0,0x0,0x3e,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x3e,0x0,0xc0,0xc0,
+	0xc0,0xc0,0xc0,0x3e,0x3e,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x3e,0x0,0x0,0xc0,
+	0xc0,0x0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+	0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x3e,0x3e,
+	0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+	0xc0,0xc0,0xc0,0xc0,0xc0,0x3e,0x3e,0x3e,
+	0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,
+	0x3e,0x3e,0x0,0x0,0xc0,0xc0,0xc0,0xc0,
+	0xc0,0x3e,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err183[32] = {0x0,0x10,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x2,0x0};
+SetWordType EfiVfrParser::err184[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x80,0x0, 0x8,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err185[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0xf8,0x0};
+SetWordType EfiVfrParser::setwd41[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xff,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0xff,0x0,0x0,0x0,0xff,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xff,0x0,
+	0x0,0xff,0x0,0x0,0x0,0x0,0xff,0x0,
+	0x0,0x0,0xff,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xff,0x0,0xff,0x0,0x0,0x0,0xff,0x0,
+	0xff,0x0,0xff,0x0,0x0,0x0,0xff,0xff,
+	0x0,0x0,0x0,0xff,0xff,0xff,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xff,0xff,0x0,0xff,0xff,0xff,0xff,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0xff,0x0,0xff,0xff,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0xff,0x0,0x0,0x0,0x0,0xff,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xff,0x0,0x0,0x0,
+	0x0,0x0,0x0,0xff,0xff,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0xff,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0xff,0xff,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0xff,0xff,0xff,
+	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	0xff,0xff,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0xff,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err186[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x6};
+SetWordType EfiVfrParser::setwd42[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x80,0x77,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x77,0x0,0x0,0x0,0x77,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x77,0x0,
+	0x0,0x77,0x0,0x0,0x0,0x0,0x77,0x0,
+	0x0,0x0,0x77,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x77,0x0,0x77,0x0,0x0,0x0,0x77,0x0,
+	0x77,0x0,0x77,0x0,0x0,0x0,0x77,0x77,
+	0x0,0x0,0x0,0x77,0x77,0x77,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x77,0x77,0x0,0x77,0x77,0x77,0x77,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x77,0x0,0x77,0x77,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x7f,0x0,0x80,0x0,0x0,0x77,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x7f,0x0,0x80,0x80,
+	0x80,0x80,0x80,0x77,0x77,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x77,0x0,0x0,0x80,
+	0x80,0x0,0x80,0x80,0x80,0x80,0x80,0x80,
+	0x80,0x80,0x80,0x80,0x80,0x80,0x77,0x77,
+	0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+	0x80,0x80,0x80,0x80,0x80,0x77,0x77,0x77,
+	0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,
+	0x77,0x77,0x0,0x0,0x80,0x80,0x80,0x80,
+	0x80,0x77,0x0,0x0,0x0,0x0};
+SetWordType EfiVfrParser::err187[32] = {0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x2, 0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0, 0x0,0x0,0x0,0x18};
+SetWordType EfiVfrParser::setwd43[253] = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x1,0x0,0x0,0x0,0x1,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,
+	0x0,0x1,0x0,0x0,0x0,0x0,0x1,0x0,
+	0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x1,0x0,0x1,0x0,0x0,0x0,0x1,0x0,
+	0x1,0x0,0x1,0x0,0x0,0x0,0x1,0x1,
+	0x0,0x0,0x0,0x1,0x1,0x1,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x1,0x1,0x0,0x1,0x1,0x1,0x1,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x1,0x0,0x1,0x1,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x3,0x0,0x0,0x0,0x0,0x1,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x3,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x1,0x1,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1,
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x0,0x0,0x0,0x0,0x1,0x1,0x1,
+	0x1,0x1,0x1,0x1,0x1,0x1,0x1,0x1,
+	0x1,0x1,0x0,0x0,0x0,0x0,0x0,0x0,
+	0x0,0x1,0x0,0x0,0x0,0x0};
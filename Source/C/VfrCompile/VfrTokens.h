@@ -0,0 +1,200 @@
+#ifndef VfrTokens_h
+#define VfrTokens_h
+/* VfrTokens.h -- List of labelled tokens and stuff
+ *
+ * Generated from: VfrSyntax.g
+ *
+ * Terence Parr, Will Cohen, and Hank Dietz: 1989-2001
+ * Purdue University Electrical Engineering
+ * ANTLR Version 1.33MR33
+ */
+enum ANTLRTokenType {
+	TheString=2,
+	FormPkgType=9,
+	OpenBrace=10,
+	CloseBrace=11,
+	OpenParen=12,
+	CloseParen=13,
+	OpenBracket=14,
+	CloseBracket=15,
+	LineDefinition=16,
+	DevicePath=17,
+	FormSet=18,
+	FormSetId=19,
+	EndFormSet=20,
+	Title=21,
+	FormId=22,
+	OneOf=23,
+	EndOneOf=24,
+	Prompt=25,
+	OrderedList=26,
+	MaxContainers=27,
+	EndList=28,
+	EndForm=29,
+	Form=30,
+	FormMap=31,
+	MapTitle=32,
+	MapGuid=33,
+	Subtitle=34,
+	Help=35,
+	Text=36,
+	Option=37,
+	FLAGS=38,
+	Date=39,
+	EndDate=40,
+	Year=41,
+	Month=42,
+	Day=43,
+	Time=44,
+	EndTime=45,
+	Hour=46,
+	Minute=47,
+	Second=48,
+	GrayOutIf=49,
+	Label=50,
+	Timeout=51,
+	Inventory=52,
+	NonNvDataMap=53,
+	Struct=54,
+	Boolean=55,
+	Uint64=56,
+	Uint32=57,
+	Uint16=58,
+	Char16=59,
+	Uint8=60,
+	Uuid=61,
+	CheckBox=62,
+	EndCheckBox=63,
+	Numeric=64,
+	EndNumeric=65,
+	Minimum=66,
+	Maximum=67,
+	STEP=68,
+	Default=69,
+	Password=70,
+	EndPassword=71,
+	String=72,
+	EndString=73,
+	MinSize=74,
+	MaxSize=75,
+	Encoding=76,
+	SuppressIf=77,
+	DisableIf=78,
+	Hidden=79,
+	Goto=80,
+	FormSetGuid=81,
+	InconsistentIf=82,
+	NoSubmitIf=83,
+	EndIf=84,
+	Key=85,
+	DefaultFlag=86,
+	ManufacturingFlag=87,
+	InteractiveFlag=88,
+	NVAccessFlag=89,
+	ResetRequiredFlag=90,
+	LateCheckFlag=91,
+	ReadOnlyFlag=92,
+	OptionOnlyFlag=93,
+	Class=94,
+	Subclass=95,
+	ClassGuid=96,
+	TypeDef=97,
+	Restore=98,
+	Save=99,
+	Defaults=100,
+	Banner=101,
+	Align=102,
+	Left=103,
+	Right=104,
+	Center=105,
+	Line=106,
+	Name=107,
+	VarId=108,
+	Question=109,
+	QuestionId=110,
+	Image=111,
+	Locked=112,
+	Rule=113,
+	EndRule=114,
+	Value=115,
+	Read=116,
+	Write=117,
+	ResetButton=118,
+	EndResetButton=119,
+	DefaultStore=120,
+	Attribute=121,
+	Varstore=122,
+	Efivarstore=123,
+	VarSize=124,
+	NameValueVarStore=125,
+	Action=126,
+	Config=127,
+	EndAction=128,
+	Refresh=129,
+	Interval=130,
+	VarstoreDevice=131,
+	GuidOp=132,
+	EndGuidOp=133,
+	DataType=134,
+	Data=135,
+	Modal=136,
+	ClassNonDevice=137,
+	ClassDiskDevice=138,
+	ClassVideoDevice=139,
+	ClassNetworkDevice=140,
+	ClassInputDevice=141,
+	ClassOnBoardDevice=142,
+	ClassOtherDevice=143,
+	SubclassSetupApplication=144,
+	SubclassGeneralApplication=145,
+	SubclassFrontPage=146,
+	SubclassSingleUse=147,
+	StringIdentifier=152,
+	Number=153,
+	True=165,
+	False=166,
+	One=167,
+	Ones=168,
+	Zero=169,
+	RefreshGuid=195,
+	Dup=198,
+	VarEqVal=199,
+	Var=200,
+	IdEqVal=201,
+	IdEqId=202,
+	IdEqValList=203,
+	QuestionRef=204,
+	RuleRef=205,
+	StringRef=206,
+	PushThis=207,
+	Security=208,
+	Get=209,
+	Undefined=210,
+	Version=211,
+	Length=212,
+	AND=213,
+	OR=214,
+	NOT=215,
+	Set=216,
+	BitWiseNot=217,
+	BoolVal=218,
+	StringVal=219,
+	UnIntVal=220,
+	ToUpper=221,
+	ToLower=222,
+	Match=223,
+	Catenate=224,
+	QuestionRefVal=225,
+	StringRefVal=226,
+	Map=227,
+	Format=241,
+	FLAG=242,
+	Cond=243,
+	Find=244,
+	Mid=245,
+	Tok=246,
+	Span=247,
+	DLGminToken=0,
+	DLGmaxToken=9999};
+
+#endif
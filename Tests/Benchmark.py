@@ -0,0 +1,102 @@
+## @file
+# Tests for the codec benchmark and its regression check
+#
+#  Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+#
+#  This program and the accompanying materials
+#  are licensed and made available under the terms and conditions of the BSD License
+#  which accompanies this distribution.  The full text of the license may be found at
+#  http://opensource.org/licenses/bsd-license.php
+#
+#  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+#
+
+##
+# Import Modules
+#
+import json
+import os
+import random
+import sys
+import unittest
+
+import TestTools
+
+class Tests(TestTools.BaseToolsTest):
+
+    def setUp(self):
+        TestTools.BaseToolsTest.setUp(self)
+        self.toolName = 'Benchmark'
+        #
+        # Benchmark is not part of the default build.
+        #
+        if self.RunTool('--version') != 0:
+            self.skipTest("Benchmark is not built, use 'make benchmark'")
+
+    def runCodecs(self, *args):
+        result = self.RunTool('-n', '1', 'codecs', *args, logFile='log')
+        if result != 0:
+            self.DisplayFile('log')
+        return result
+
+    def testCodecCycles(self):
+        samples = (
+            'E',
+            ''.join([chr(random.randint(0, 255)) for i in xrange(64 * 1024)]),
+            'EFI_FIRMWARE_VOLUME' * 10000,
+            )
+        args = []
+        for i in range(len(samples)):
+            name = 'input%d' % i
+            self.WriteTmpFile(name, samples[i])
+            args += ['-i', self.GetTmpFilePath(name)]
+        toolPath = os.path.dirname(self.FindToolBin('LzmaCompress'))
+        self.assertTrue(self.runCodecs('--tool-path', toolPath, '--json', self.GetTmpFilePath('results'), *args) == 0)
+
+        results = json.loads(self.ReadTmpFile('results'))
+        variants = set()
+        for result in results:
+            self.assertTrue(result['size'] == sum(map(len, samples)))
+            self.assertTrue(result['mbps'] > 0)
+            if result['benchmark'] == 'encode':
+                self.assertTrue(result['compressed'] > 0)
+            variants.add((result['benchmark'], result['variant']))
+        for variant in ('efi', 'tiano', 'lzma', 'lzma-mt', 'tiano-tool', 'lzma-tool'):
+            self.assertTrue(('encode', variant) in variants)
+            self.assertTrue(('decode', variant) in variants)
+
+    def testBaseline(self):
+        self.assertTrue(self.runCodecs('-s', '65536', '--json', self.GetTmpFilePath('baseline')) == 0)
+        self.assertTrue(self.runCodecs('-s', '65536', '--baseline', self.GetTmpFilePath('baseline'), '--margin', '100') == 0)
+
+        #
+        # No codec can reach a thousand times the measured throughput.
+        #
+        results = json.loads(self.ReadTmpFile('baseline'))
+        for result in results:
+            result['mbps'] *= 1000
+        self.WriteTmpFile('baseline', json.dumps(results).replace('}, ', '},\n'))
+        self.assertTrue(self.runCodecs('-s', '65536', '--baseline', self.GetTmpFilePath('baseline')) != 0)
+
+    def testRebase(self):
+        result = self.RunTool('-s', '65536', '-n', '2', 'rebase', '--json', self.GetTmpFilePath('results'), logFile='log')
+        if result != 0:
+            self.DisplayFile('log')
+        self.assertTrue(result == 0)
+
+        results = json.loads(self.ReadTmpFile('results'))
+        variants = set()
+        for result in results:
+            self.assertTrue(result['benchmark'] == 'rebase')
+            self.assertTrue(result['mbps'] > 0)
+            variants.add(result['variant'])
+        for variant in ('x64-walk', 'x64-index', 'x64-build', 'ia32-walk', 'ia32-index', 'ia32-build'):
+            self.assertTrue(variant in variants)
+
+    def testBadMargin(self):
+        for margin in ('101', 'x'):
+            result = self.RunTool('--margin', margin, 'codecs')
+            self.assertTrue(result != 0)
+
+TheTestSuite = TestTools.MakeTheTestSuite(locals())
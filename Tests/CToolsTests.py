@@ -19,8 +19,22 @@ import os
 import sys
 import unittest
 
+import Benchmark
+import Decompress
+import GenCrc32
+import GenFv
+import GenFw
+import LzmaCompress
+import PyEfiCompressor
 import TianoCompress
 modules = (
+    Benchmark,
+    Decompress,
+    GenCrc32,
+    GenFv,
+    GenFw,
+    LzmaCompress,
+    PyEfiCompressor,
     TianoCompress,
     )
 
@@ -0,0 +1,68 @@
+## @file
+# Bit exact tests for the Efi and Tiano decoders in Common/Decompress.c
+#
+#  Copyright (c) 2008, Intel Corporation. All rights reserved.<BR>
+#
+#  This program and the accompanying materials
+#  are licensed and made available under the terms and conditions of the BSD License
+#  which accompanies this distribution.  The full text of the license may be found at
+#  http://opensource.org/licenses/bsd-license.php
+#
+#  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+#
+
+##
+# Import Modules
+#
+import os
+import random
+import sys
+import unittest
+
+import TestTools
+
+class Tests(TestTools.BaseToolsTest):
+
+    #
+    # The decompress benchmark compresses every input with EfiCompress and
+    # TianoCompress, decodes it with both the current and the reference
+    # decoder and fails unless each result matches the original input.
+    #
+    def setUp(self):
+        TestTools.BaseToolsTest.setUp(self)
+        self.toolName = 'Benchmark'
+        #
+        # Benchmark is not part of the default build.
+        #
+        if self.RunTool('--version') != 0:
+            self.skipTest("Benchmark is not built, use 'make benchmark'")
+
+    def decodeTestCycle(self, samples):
+        args = []
+        for i in range(len(samples)):
+            name = 'input%d' % i
+            self.WriteTmpFile(name, samples[i])
+            args += ['-i', self.GetTmpFilePath(name)]
+        result = self.RunTool('-n', '1', 'decompress', *args, logFile='log')
+        if result != 0:
+            self.DisplayFile('log')
+        self.assertTrue(result == 0)
+
+    def testGeneratedSizes(self):
+        for size in ('1', '255', '65536', '1048577'):
+            result = self.RunTool('-s', size, '-n', '1', 'decompress', logFile='log')
+            self.assertTrue(result == 0)
+
+    def testSampleCycles(self):
+        samples = (
+            'E',
+            self.GetRandomString(1024, 2048),
+            ''.join([chr(random.randint(0, 255)) for i in xrange(200 * 1024)]),
+            ''.join([chr(random.randint(0, 3)) for i in xrange(300 * 1024)]),
+            '\0' * (512 * 1024),
+            'EFI_FIRMWARE_VOLUME' * 20000,
+            )
+        self.decodeTestCycle(samples)
+
+TheTestSuite = TestTools.MakeTheTestSuite(locals())
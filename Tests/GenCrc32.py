@@ -0,0 +1,90 @@
+## @file
+# Unit tests for GenCrc32 utility
+#
+#  Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+#
+#  This program and the accompanying materials
+#  are licensed and made available under the terms and conditions of the BSD License
+#  which accompanies this distribution.  The full text of the license may be found at
+#  http://opensource.org/licenses/bsd-license.php
+#
+#  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+#
+
+##
+# Import Modules
+#
+import os
+import random
+import struct
+import sys
+import unittest
+import zlib
+
+import TestTools
+
+class Tests(TestTools.BaseToolsTest):
+
+    def setUp(self):
+        TestTools.BaseToolsTest.setUp(self)
+        self.toolName = 'GenCrc32'
+
+    def testHelp(self):
+        result = self.RunTool('--help', logFile='help')
+        self.assertTrue(result == 0)
+
+    def crc32TestCycle(self, data):
+        self.WriteTmpFile('input', data)
+        result = self.RunTool(
+            '-e',
+            '-o', self.GetTmpFilePath('output1'),
+            self.GetTmpFilePath('input')
+            )
+        self.assertTrue(result == 0)
+        encoded = self.ReadTmpFile('output1')
+        crc = struct.unpack('<I', encoded[:4])[0]
+        self.assertEqual(crc, zlib.crc32(data) & 0xffffffff)
+        self.assertEqual(encoded[4:], data)
+        result = self.RunTool(
+            '-d',
+            '-o', self.GetTmpFilePath('output2'),
+            self.GetTmpFilePath('output1')
+            )
+        self.assertTrue(result == 0)
+        self.assertEqual(self.ReadTmpFile('output2'), data)
+
+    def testSizesAroundBlockBoundaries(self):
+        #
+        # Cover the byte, slice-by-8 and folding paths and their tails.
+        #
+        for size in (1, 7, 8, 15, 63, 64, 65, 127, 128, 1000, 70001):
+            self.crc32TestCycle(self.GetRandomString(size))
+            self.CleanUpTmpDir()
+
+    def testCorruptedDataIsRejected(self):
+        data = self.GetRandomString(4096)
+        self.WriteTmpFile('input', data)
+        result = self.RunTool(
+            '-e',
+            '-o', self.GetTmpFilePath('output1'),
+            self.GetTmpFilePath('input')
+            )
+        self.assertTrue(result == 0)
+        encoded = self.ReadTmpFile('output1')
+        index = random.randint(4, len(encoded) - 1)
+        corrupted = encoded[:index] + chr(ord(encoded[index]) ^ 0x01) + encoded[index + 1:]
+        self.WriteTmpFile('output1', corrupted)
+        result = self.RunTool(
+            '-d',
+            '-o', self.GetTmpFilePath('output2'),
+            self.GetTmpFilePath('output1')
+            )
+        self.assertTrue(result != 0)
+
+TheTestSuite = TestTools.MakeTheTestSuite(locals())
+
+if __name__ == '__main__':
+    allTests = TheTestSuite()
+    unittest.TextTestRunner().run(allTests)
+
@@ -0,0 +1,723 @@
+## @file
+# Unit tests for GenFv utility
+#
+#  Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+#
+#  This program and the accompanying materials
+#  are licensed and made available under the terms and conditions of the BSD License
+#  which accompanies this distribution.  The full text of the license may be found at
+#  http://opensource.org/licenses/bsd-license.php
+#
+#  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+#
+
+##
+# Import Modules
+#
+import json
+import os
+import random
+import struct
+import subprocess
+import sys
+import unittest
+import uuid
+
+import TestTools
+
+TEXT_ADDRESS = 0x401000
+DATA_ADDRESS = 0x402000
+DATA_SIZE = 0x4000
+
+R_X86_64_64 = 1
+R_X86_64_32 = 10
+
+EFI_FFS_VOLUME_TOP_FILE_GUID = '1ba0062e-c779-4582-8566-336ae8f78f09'
+IA32_X64_VTF_SIGNATURE_OFFSET = 0x14
+
+FFS_FILE_TYPES = {
+    'DXE_DRIVER': 'EFI_FV_FILETYPE_DRIVER',
+    'PEIM': 'EFI_FV_FILETYPE_PEIM',
+    }
+
+EFI_IMAGE_FILE_RELOCS_STRIPPED = 0x0001
+EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC = 5
+
+CAPSULE_GUID = '3b6686bd-0d76-4030-b70e-b5519e2fc5a1'
+CAPSULE_FLAGS_PERSIST_ACROSS_RESET = 0x00010000
+
+#
+# Replaces sendfile in GenFv: the first call sends at most 0x1000 bytes,
+# the next calls fail as if the files did not support sendfile, so GenFv
+# continues with its buffered copy. Each failure is logged to the file
+# named by SENDFILE_FAILURE_LOG.
+#
+SENDFILE_SHIM = r'''
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+
+static int mCalls;
+
+ssize_t sendfile (int OutFd, int InFd, off_t *Offset, size_t Count)
+{
+  ssize_t (*Real) (int, int, off_t *, size_t);
+  FILE    *Log;
+
+  if (mCalls++ == 0) {
+    Real = (ssize_t (*) (int, int, off_t *, size_t)) dlsym (RTLD_NEXT, "sendfile");
+    return Real (OutFd, InFd, Offset, Count < 0x1000 ? Count : 0x1000);
+  }
+  Log = fopen (getenv ("SENDFILE_FAILURE_LOG"), "a");
+  if (Log != NULL) {
+    fputs ("EINVAL\n", Log);
+    fclose (Log);
+  }
+  errno = EINVAL;
+  return -1;
+}
+'''
+
+def MakeElf64(relocs):
+    #
+    # An X64 executable with a .text page and a .data section of several
+    # pages, and the relocations of .data kept by the linker (-q). Each
+    # relocation is (offset in .data, type, section index of the target,
+    # offset of the target in its section).
+    #
+    text = '\xc3' + '\x00' * 0xff
+    data = bytearray(DATA_SIZE)
+    for offset, type, shndx, target in relocs:
+        value = (TEXT_ADDRESS, DATA_ADDRESS)[shndx - 1] + target
+        if type == R_X86_64_64:
+            struct.pack_into('<Q', data, offset, value)
+        else:
+            struct.pack_into('<I', data, offset, value)
+    rela = ''.join([
+        struct.pack('<QQq', DATA_ADDRESS + offset, (shndx << 32) | type, target)
+        for offset, type, shndx, target in relocs
+        ])
+    symtab = '\x00' * 24 + ''.join([
+        struct.pack('<IBBHQQ', 0, 3, 0, shndx, 0, 0) for shndx in (1, 2)
+        ])
+    shstrtab = '\x00.text\x00.data\x00.rela.data\x00.symtab\x00.shstrtab\x00'
+
+    relaOffset = 0x2000 + DATA_SIZE
+    symtabOffset = relaOffset + len(rela)
+    shstrtabOffset = symtabOffset + len(symtab)
+    shOffset = (shstrtabOffset + len(shstrtab) + 7) & ~7
+    sections = [
+        (0, 0, 0, 0, 0, 0, 0, 0, 0, 0),
+        (1, 1, 6, TEXT_ADDRESS, 0x1000, len(text), 0, 0, 16, 0),
+        (7, 1, 3, DATA_ADDRESS, 0x2000, DATA_SIZE, 0, 0, 16, 0),
+        (13, 4, 0x40, 0, relaOffset, len(rela), 4, 2, 8, 24),
+        (24, 2, 0, 0, symtabOffset, len(symtab), 5, 3, 8, 24),
+        (32, 3, 0, 0, shstrtabOffset, len(shstrtab), 0, 0, 1, 0),
+        ]
+    header = struct.pack(
+        '<4sBBBBB7sHHIQQQIHHHHHH',
+        '\x7fELF', 2, 1, 1, 0, 0, '\x00' * 7,
+        2, 62, 1, TEXT_ADDRESS, 0, shOffset, 0,
+        64, 56, 0, 64, len(sections), 5
+        )
+    image = bytearray(shOffset)
+    image[0:len(header)] = header
+    image[0x1000:0x1000 + len(text)] = text
+    image[0x2000:0x2000 + DATA_SIZE] = data
+    image[relaOffset:symtabOffset] = rela
+    image[symtabOffset:shstrtabOffset] = symtab
+    image[shstrtabOffset:shstrtabOffset + len(shstrtab)] = shstrtab
+    for section in sections:
+        image += struct.pack('<IIQQQQIIQQ', *section)
+    return str(image)
+
+class Tests(TestTools.BaseToolsTest):
+
+    def setUp(self):
+        TestTools.BaseToolsTest.setUp(self)
+        self.toolName = 'GenFv'
+
+    def testHelp(self):
+        result = self.RunTool('--help', logFile='help')
+        self.assertTrue(result == 0)
+
+    def runTool(self, toolName, *args):
+        result = self.RunTool(*args, logFile='log', toolName=toolName)
+        if result != 0:
+            self.DisplayFile('log')
+        self.assertTrue(result == 0)
+
+    def makeDriver(self, name, index, seed, rawSize=0, align=None, moduleType='DXE_DRIVER'):
+        #
+        # A DXE driver or PEIM FFS file with a PE32 section whose relocations
+        # are at offsets that depend on index, to targets that depend on seed,
+        # and an optional raw section of rawSize bytes.
+        #
+        random.seed(index)
+        offsets = random.sample(xrange(0, DATA_SIZE, 8), 100)
+        random.seed(seed)
+        relocs = []
+        for offset in offsets:
+            if random.randint(0, 3) == 0:
+                relocs.append((offset, R_X86_64_32, 2, random.randrange(0, DATA_SIZE)))
+            else:
+                relocs.append((offset, R_X86_64_64, random.choice((1, 2)), random.randrange(0, 0x100)))
+        self.WriteTmpFile(name + '.elf', MakeElf64(relocs))
+        self.runTool(
+            'GenFw', '-e', moduleType,
+            '-o', self.GetTmpFilePath(name + '.efi'),
+            self.GetTmpFilePath(name + '.elf')
+            )
+        self.runTool(
+            'GenSec', '-s', 'EFI_SECTION_PE32',
+            '-o', self.GetTmpFilePath(name + '.pe32'),
+            self.GetTmpFilePath(name + '.efi')
+            )
+        sections = ['-i', self.GetTmpFilePath(name + '.pe32')]
+        if rawSize:
+            self.WriteTmpFile(name + '.bin', self.GetRandomString(rawSize))
+            self.runTool(
+                'GenSec', '-s', 'EFI_SECTION_RAW',
+                '-o', self.GetTmpFilePath(name + '.raw'),
+                self.GetTmpFilePath(name + '.bin')
+                )
+            sections += ['-i', self.GetTmpFilePath(name + '.raw')]
+        options = []
+        if align is not None:
+            options = ['-a', align]
+        self.runTool(
+            'GenFfs', '-t', FFS_FILE_TYPES[moduleType],
+            '-g', self.makeGuid(index),
+            '-o', self.GetTmpFilePath(name + '.ffs'),
+            *(options + sections)
+            )
+        return self.GetTmpFilePath(name + '.ffs')
+
+    def stripRelocs(self, image, offset=0):
+        #
+        # Marks the PE32+ image at offset in image as having no relocations,
+        # the way GenFw --stripped does for an image that ends in .reloc.
+        #
+        image = bytearray(image)
+        peOffset = offset + struct.unpack_from('<I', image, offset + 0x3c)[0]
+        characteristics, = struct.unpack_from('<H', image, peOffset + 22)
+        struct.pack_into('<H', image, peOffset + 22, characteristics | EFI_IMAGE_FILE_RELOCS_STRIPPED)
+        struct.pack_into('<II', image, peOffset + 24 + 112 + EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC * 8, 0, 0)
+        return str(image)
+
+    def writePeMap(self, name, symbols):
+        #
+        # The PE map file GenFv reads for a driver made by makeDriver, named
+        # after the ELF file GenFw records as the debug file of the image.
+        #
+        lines = [
+            ' Preferred load address is %016x' % (TEXT_ADDRESS & ~0xfff),
+            '',
+            '  Address         Publics by Value              Rva+Base               Lib:Object',
+            '',
+            ]
+        for index, symbol in enumerate(symbols):
+            lines.append(
+                ' 0001:%08x       %-26s %016x f   %s.obj' %
+                (index * 0x10, symbol, TEXT_ADDRESS + index * 0x10, name)
+                )
+        self.WriteTmpFile(name + '.map', '\n'.join(lines) + '\n')
+
+    def makeRaw(self, name, index, size):
+        self.WriteTmpFile(name + '.bin', self.GetRandomString(size))
+        self.runTool(
+            'GenSec', '-s', 'EFI_SECTION_RAW',
+            '-o', self.GetTmpFilePath(name + '.raw'),
+            self.GetTmpFilePath(name + '.bin')
+            )
+        self.runTool(
+            'GenFfs', '-t', 'EFI_FV_FILETYPE_FREEFORM',
+            '-g', self.makeGuid(index),
+            '-o', self.GetTmpFilePath(name + '.ffs'),
+            '-i', self.GetTmpFilePath(name + '.raw')
+            )
+        return self.GetTmpFilePath(name + '.ffs')
+
+    def makeVtf0(self, name):
+        #
+        # A volume top file with the VTF0 signature of the IA32 and X64
+        # reset vectors at its end.
+        #
+        self.WriteTmpFile(
+            name + '.bin',
+            self.GetRandomString(0x20) + 'VTF\0' + '\0' * (IA32_X64_VTF_SIGNATURE_OFFSET - 4)
+            )
+        self.runTool(
+            'GenSec', '-s', 'EFI_SECTION_RAW',
+            '-o', self.GetTmpFilePath(name + '.raw'),
+            self.GetTmpFilePath(name + '.bin')
+            )
+        self.runTool(
+            'GenFfs', '-t', 'EFI_FV_FILETYPE_RAW',
+            '-g', EFI_FFS_VOLUME_TOP_FILE_GUID,
+            '-o', self.GetTmpFilePath(name + '.ffs'),
+            '-i', self.GetTmpFilePath(name + '.raw')
+            )
+        return self.GetTmpFilePath(name + '.ffs')
+
+    def makeGuid(self, index):
+        return '8c1a46b4-0b1d-4f3e-9a52-%012x' % index
+
+    def writeInf(self, name, baseAddress, files):
+        lines = [
+            '[options]',
+            'EFI_BASE_ADDRESS = 0x%x' % baseAddress,
+            'EFI_BLOCK_SIZE = 0x1000',
+            'EFI_NUM_BLOCKS = 0x100',
+            '[attributes]',
+            'EFI_ERASE_POLARITY = 1',
+            '[files]',
+            ]
+        lines += ['EFI_FILE_NAME = ' + file for file in files]
+        self.WriteTmpFile(name, '\n'.join(lines) + '\n')
+        return self.GetTmpFilePath(name)
+
+    def genFv(self, inf, fv, *options):
+        self.runTool(
+            'GenFv',
+            *(options + (
+            '-i', inf,
+            '-o', self.GetTmpFilePath(fv),
+            '-m', self.GetTmpFilePath(fv + '.map'),
+            ))
+            )
+
+    def readReport(self, fv):
+        #
+        # The FvName.txt report holds the sizes as "NAME = value" lines and
+        # one "offset guid" line per file.
+        #
+        sizes = {}
+        files = []
+        for line in self.ReadTmpFile(fv + '.txt').splitlines():
+            if '=' in line:
+                key, value = line.split('=')
+                sizes[key.strip()] = int(value, 16)
+            elif line.strip():
+                offset, guid = line.split()
+                files.append(guid.lower())
+        return sizes, files
+
+    def assertSameFv(self, fv1, fv2):
+        self.assertTrue(self.ReadTmpFile(fv1) == self.ReadTmpFile(fv2))
+        self.assertTrue(self.ReadTmpFile(fv1 + '.map') == self.ReadTmpFile(fv2 + '.map'))
+
+    def testManyFiles(self):
+        #
+        # More files than the 1000 entries of the former fixed file table.
+        #
+        self.WriteTmpFile('raw.bin', self.GetRandomString(0x20))
+        self.runTool(
+            'GenSec', '-s', 'EFI_SECTION_RAW',
+            '-o', self.GetTmpFilePath('raw.sec'),
+            self.GetTmpFilePath('raw.bin')
+            )
+        files = []
+        for i in range(1200):
+            files.append(self.GetTmpFilePath('f%d.ffs' % i))
+            self.runTool(
+                'GenFfs', '-t', 'EFI_FV_FILETYPE_FREEFORM',
+                '-g', self.makeGuid(i),
+                '-o', files[-1],
+                '-i', self.GetTmpFilePath('raw.sec')
+                )
+        inf = self.writeInf('fv.inf', 0xFF000000, files)
+        self.genFv(inf, 'many.fv')
+
+        result = self.RunTool(self.GetTmpFilePath('many.fv'), logFile='volinfo', toolName='VolInfo')
+        self.assertTrue(result == 0)
+        guids = [
+            line.split()[2].lower()
+            for line in self.ReadTmpFile('volinfo').splitlines()
+            if line.startswith('File Name:')
+            ]
+        self.assertEqual(guids, [self.makeGuid(i) for i in range(len(files))])
+
+    def genInfLines(self, name, lines):
+        self.WriteTmpFile(name + '.inf', '\n'.join(lines) + '\n')
+        return self.RunTool(
+            '-i', self.GetTmpFilePath(name + '.inf'),
+            '-o', self.GetTmpFilePath(name + '.fv'),
+            logFile=name + '.log'
+            )
+
+    def assertInfReadAs(self, lines, canonical):
+        #
+        # An INF with duplicate keys, missing sections or unusual spelling
+        # gives the FV of the INF that spells out what the per lookup
+        # FindToken scan of the file read from it.
+        #
+        self.assertEqual(self.genInfLines('odd', lines), 0)
+        self.assertEqual(self.genInfLines('canonical', canonical), 0)
+        self.assertTrue(self.ReadTmpFile('odd.fv') == self.ReadTmpFile('canonical.fv'))
+        self.assertTrue(self.ReadTmpFile('odd.fv.txt') == self.ReadTmpFile('canonical.fv.txt'))
+
+    def testInfSyntax(self):
+        files = [self.makeDriver('d%d' % i, i, i) for i in range(2)]
+        files += [self.makeRaw('r%d' % i, 2 + i, 0x80) for i in range(2)]
+        base = ['EFI_BASE_ADDRESS = 0xFF000000']
+        blocks = ['EFI_BLOCK_SIZE = 0x1000', 'EFI_NUM_BLOCKS = 0x100']
+        attributes = ['[attributes]', 'EFI_ERASE_POLARITY = 1', 'EFI_READ_STATUS = TRUE', 'EFI_WRITE_STATUS = FALSE']
+        names = ['EFI_FILE_NAME = ' + file for file in files]
+        canonical = ['[options]'] + base + blocks + attributes + ['[files]'] + names
+
+        #
+        # The first instance of a key is used, except for the repeated block
+        # map entries and file names, which are all used in file order. Only
+        # the first section of a name is read.
+        #
+        self.assertInfReadAs(
+            ['[options]'] + base + blocks + ['EFI_BASE_ADDRESS = 0xFE000000', 'EFI_BLOCK_SIZE = 0x2000', 'EFI_NUM_BLOCKS = 0x80'] +
+            attributes + ['EFI_ERASE_POLARITY = 0', 'EFI_READ_STATUS = FALSE'] + ['[files]'] + names,
+            ['[options]'] + base + blocks + ['EFI_BLOCK_SIZE = 0x2000', 'EFI_NUM_BLOCKS = 0x80'] + attributes + ['[files]'] + names
+            )
+        self.assertInfReadAs(
+            canonical[:-2] + ['[options]', 'EFI_BLOCK_SIZE = 0x2000', '[files]'] + names[2:],
+            canonical[:-2]
+            )
+
+        #
+        # Missing sections and keys leave their defaults, a section header
+        # at the end of the file is ignored.
+        #
+        self.assertInfReadAs(['[options]'] + base + blocks + ['[files]'] + names, ['[options]'] + base + blocks + ['[attributes]', '[files]'] + names)
+        self.assertInfReadAs(['[options]'] + base + blocks + attributes, ['[options]'] + base + blocks + attributes + ['[files]'])
+        self.assertInfReadAs(['[files]'] + names + attributes + ['[options]'] + base + blocks, canonical)
+        self.assertInfReadAs(canonical + ['[attributes]'], canonical)
+
+        #
+        # Sections and keys are case sensitive, so differently cased ones are
+        # missing, and a required one missing fails the FV.
+        #
+        self.assertInfReadAs(
+            ['[options]'] + base + blocks + ['efi_block_size = 0x2000', 'Efi_Num_Blocks = 0x80'] + attributes +
+            ['efi_erase_polarity = 0'] + ['[files]'] + names + ['efi_file_name = ' + files[0]],
+            canonical
+            )
+        self.assertNotEqual(self.genInfLines('odd', [line.title() if line[0] == '[' else line for line in canonical]), 0)
+
+        #
+        # Leading and trailing blanks and tabs do not matter, but the key
+        # ends at the first blank, so "KEY=value" is not the key. A section
+        # name is also found in a comment or after other text on its line.
+        #
+        self.assertInfReadAs(['\t' + line.replace(' = ', '\t=\t') + '  ' for line in canonical], canonical)
+        self.assertInfReadAs(
+            ['[options]', 'EFI_BASE_ADDRESS=0xFF000000', 'EFI_BLOCK_SIZE=0x1000', 'EFI_BLOCK_SIZE =0x1000', 'EFI_NUM_BLOCKS = 0x100'] +
+            attributes + ['[files]', 'EFI_FILE_NAME=' + files[0], 'EFI_FILE_NAME= ' + files[1]] + ['EFI_FILE_NAME =' + file for file in files[2:]],
+            ['[options]'] + blocks + attributes + ['[files]'] + names[2:]
+            )
+        self.assertInfReadAs(
+            ['[options] # options'] + base + blocks + ['', '# EFI_BLOCK_SIZE = 0x2000', '   '] + attributes +
+            ['#[files]', '[files]'] + names,
+            ['[options]'] + base + blocks + attributes + ['[files]']
+            )
+
+    def testThreads(self):
+        files = [
+            self.makeDriver('d%d' % i, i, i, align=('4K', None)[i % 2])
+            for i in range(8)
+            ]
+        inf = self.writeInf('fv.inf', 0xFF000000, files)
+        self.genFv(inf, 'one.fv', '--threads', '1')
+        self.genFv(inf, 'eight.fv', '--threads', '8')
+        self.assertSameFv('one.fv', 'eight.fv')
+
+    def testBatch(self):
+        files = [self.makeDriver('d%d' % i, i, i) for i in range(4)]
+        infs = [
+            self.writeInf('fv0.inf', 0xFE100000, files),
+            self.writeInf('fv1.inf', 0xFE200000, files[::-1]),
+            self.writeInf('fv2.inf', 0xFE300000, files[1:]),
+            ]
+        lines = ['[options]'] + ['EFI_FV = F%d' % i for i in range(len(infs))]
+        for i in range(len(infs)):
+            lines += [
+                '[F%d]' % i,
+                'EFI_FV_INF_FILE = ' + infs[i],
+                'EFI_FV_OUTPUT_FILE = ' + self.GetTmpFilePath('batch%d.fv' % i),
+                'EFI_FV_MAP_FILE = ' + self.GetTmpFilePath('batch%d.fv.map' % i),
+                ]
+        lines.append('EFI_FV_DEPENDS = F0')
+        self.WriteTmpFile('batch.ini', '\n'.join(lines) + '\n')
+        self.runTool('GenFv', '--threads', '3', '--batch', self.GetTmpFilePath('batch.ini'))
+
+        for i in range(len(infs)):
+            self.genFv(infs[i], 'single%d.fv' % i)
+            self.assertSameFv('batch%d.fv' % i, 'single%d.fv' % i)
+
+    def testIncremental(self):
+        files = [
+            self.makeDriver('d%d' % i, i, i, rawSize=0x800)
+            for i in range(4)
+            ]
+        inf = self.writeInf('fv.inf', 0xFF000000, files)
+        self.genFv(inf, 'inc.fv', '--incremental')
+        self.assertTrue(os.path.exists(self.GetTmpFilePath('inc.fv.layout')))
+
+        #
+        # The same relocations to other targets keep the size of the file,
+        # a larger raw section grows it and moves the files after it.
+        #
+        size = os.path.getsize(files[1])
+        for seed, rawSize in ((100, 0x800), (101, 0x3000)):
+            self.makeDriver('d1', 1, seed, rawSize=rawSize)
+            self.assertEqual(os.path.getsize(files[1]) == size, rawSize == 0x800)
+            self.genFv(inf, 'inc.fv', '--incremental')
+            self.genFv(inf, 'full.fv')
+            self.assertSameFv('inc.fv', 'full.fv')
+
+        #
+        # An unchanged file whose PE map file changed gets new map lines.
+        #
+        for i in range(4):
+            self.writePeMap('d%d' % i, ['_ModuleEntryPoint', 'Helper%d' % i])
+        self.genFv(inf, 'inc.fv', '--incremental')
+        self.assertTrue('_ModuleEntryPoint' in self.ReadTmpFile('inc.fv.map'))
+        self.writePeMap('d3', ['_ChangedEntry', 'Helper3'])
+        self.genFv(inf, 'inc.fv', '--incremental')
+        self.genFv(inf, 'full.fv')
+        self.assertSameFv('inc.fv', 'full.fv')
+        self.assertTrue('_ChangedEntry' in self.ReadTmpFile('inc.fv.map'))
+
+    def testStrippedPeim(self):
+        #
+        # A PEIM whose PE32 section has no relocations is rebased with the
+        # relocations of the .efi file next to its FFS file.
+        #
+        self.makeDriver('peim', 0, 0, moduleType='PEIM')
+        self.genFv(self.writeInf('reference.inf', 0xFF000000, [self.GetTmpFilePath('peim.ffs')]), 'reference.fv')
+        efi = self.ReadTmpFile('peim.efi')
+        self.WriteTmpFile('image.efi', self.stripRelocs(efi))
+        self.runTool(
+            'GenSec', '-s', 'EFI_SECTION_PE32',
+            '-o', self.GetTmpFilePath('stripped.pe32'),
+            self.GetTmpFilePath('image.efi')
+            )
+        self.runTool(
+            'GenFfs', '-t', 'EFI_FV_FILETYPE_PEIM',
+            '-g', self.makeGuid(0),
+            '-o', self.GetTmpFilePath('stripped.ffs'),
+            '-i', self.GetTmpFilePath('stripped.pe32')
+            )
+        inf = self.writeInf('stripped.inf', 0xFF000000, [self.GetTmpFilePath('stripped.ffs')])
+        self.genFv(inf, 'unrelocated.fv')
+        self.WriteTmpFile('stripped.efi', efi)
+        self.genFv(inf, 'stripped.fv')
+
+        reference = self.ReadTmpFile('reference.fv')
+        offset = reference.index(efi[:0x40])
+        self.assertTrue(self.ReadTmpFile('stripped.fv') == self.stripRelocs(reference, offset))
+        self.assertTrue(self.ReadTmpFile('stripped.fv.map') == self.ReadTmpFile('reference.fv.map'))
+        self.assertTrue(self.ReadTmpFile('unrelocated.fv') != self.ReadTmpFile('stripped.fv'))
+
+    def testSymbolCache(self):
+        #
+        # The FV map file is the same whether the symbols of the driver maps
+        # are parsed or read from a cold, warm or damaged symbol cache.
+        #
+        stamp = 1300000000
+        files = []
+        for i in range(4):
+            files.append(self.makeDriver('d%d' % i, i, i))
+            self.writePeMap('d%d' % i, ['Symbol%d_%03d' % (i, n) for n in range(200)])
+            os.utime(self.GetTmpFilePath('d%d.map' % i), (stamp, stamp))
+        inf = self.writeInf('fv.inf', 0xFF000000, files)
+
+        self.genFv(inf, 'cold.fv')
+        self.assertTrue('Symbol3_199' in self.ReadTmpFile('cold.fv.map'))
+        for i in range(4):
+            self.assertTrue(os.path.exists(self.GetTmpFilePath('d%d.symcache' % i)))
+        self.genFv(inf, 'warm.fv')
+        self.assertSameFv('cold.fv', 'warm.fv')
+
+        #
+        # A damaged cache is parsed again and rewritten.
+        #
+        cache = self.ReadTmpFile('d1.symcache')
+        self.WriteTmpFile('d1.symcache', cache[:-1] + chr(ord(cache[-1]) ^ 0x55))
+        self.WriteTmpFile('d2.symcache', cache[:len(cache) // 2])
+        self.WriteTmpFile('d3.symcache', '')
+        self.genFv(inf, 'damaged.fv')
+        self.assertSameFv('cold.fv', 'damaged.fv')
+        self.assertTrue(self.ReadTmpFile('d1.symcache') == cache)
+
+        #
+        # A warm cache is used without reading the map file, which is only
+        # parsed again once its size or modification time changes.
+        #
+        self.writePeMap('d0', ['Symbox0_%03d' % n for n in range(200)])
+        os.utime(self.GetTmpFilePath('d0.map'), (stamp, stamp))
+        self.genFv(inf, 'stale.fv')
+        self.assertSameFv('cold.fv', 'stale.fv')
+        os.utime(self.GetTmpFilePath('d0.map'), (stamp + 1, stamp + 1))
+        self.genFv(inf, 'new.fv')
+        self.assertTrue('Symbox0_199' in self.ReadTmpFile('new.fv.map'))
+        self.assertTrue('Symbol0_199' not in self.ReadTmpFile('new.fv.map'))
+
+    def testProfile(self):
+        #
+        # A FV ending at 4GB with a volume top file goes through every phase.
+        #
+        files = []
+        for i in range(3):
+            files.append(self.makeDriver('d%d' % i, i, i))
+            self.writePeMap('d%d' % i, ['_ModuleEntryPoint', 'Helper%d' % i])
+        files.append(self.makeVtf0('vtf'))
+        inf = self.writeInf('fv.inf', 0xFFF00000, files)
+        self.genFv(inf, 'fv.fv', '--threads', '2', '--profile', self.GetTmpFilePath('profile.json'))
+        profile = json.loads(self.ReadTmpFile('profile.json'))
+        self.assertEqual(profile['tool'], 'GenFv')
+        self.assertTrue(profile['bytes_written'] >= os.path.getsize(self.GetTmpFilePath('fv.fv')))
+
+        records = profile['records']
+        for record in records:
+            for key in ('wall_us', 'cpu_us', 'bytes_read', 'bytes_written', 'peak_rss_kb'):
+                self.assertTrue(record[key] >= 0)
+        roots = [record for record in records if record['parent'] is None]
+        self.assertEqual(len(roots), 1)
+        self.assertEqual(roots[0]['name'], 'GenerateFvImage')
+        self.assertEqual(roots[0]['item'], self.GetTmpFilePath('fv.fv'))
+
+        #
+        # Each phase is recorded under the FV, the merge of the map lines of
+        # the rebase threads under the rebase, and each FFS file under the
+        # phases that handle files one by one.
+        #
+        phases = dict((record['name'], record) for record in records if record['item'] is None)
+        for name in ('ParseFvInf', 'CalculateFvSize', 'AddFile', 'FfsRebase', 'UpdateResetVector'):
+            self.assertTrue(name in phases, name)
+            self.assertEqual(phases[name]['parent'], roots[0]['id'])
+        self.assertEqual(phases['WriteMapFile']['parent'], phases['FfsRebase']['id'])
+        for name in ('AddFile', 'FfsRebase'):
+            items = [
+                record['item'] for record in records
+                if record['parent'] == phases[name]['id'] and record['item'] is not None
+                ]
+            self.assertEqual(sorted(items), sorted(files))
+        for file in files:
+            loads = [
+                record for record in records
+                if record['name'] == 'LoadFvFiles' and record['item'] == file
+                ]
+            self.assertEqual(len(loads), 1)
+            self.assertEqual(loads[0]['bytes_read'], os.path.getsize(file))
+        for i in range(3):
+            maps = [
+                record for record in records
+                if record['name'] == 'WriteMapFile' and record['item'] == self.GetTmpFilePath('d%d.elf' % i)
+                ]
+            self.assertEqual(len(maps), 1)
+            self.assertTrue(maps[0]['bytes_written'] > 0)
+
+    def testPackFiles(self):
+        #
+        # The 4K aligned drivers leave pad files between them that the
+        # small files listed after them can fill.
+        #
+        files = [self.makeDriver('d%d' % i, i, i, align='4K') for i in range(4)]
+        files += [self.makeRaw('r%d' % i, 4 + i, 0x100) for i in range(8)]
+        inf = self.writeInf('fv.inf', 0xFF000000, files)
+
+        self.genFv(inf, 'default.fv')
+        sizes, order = self.readReport('default.fv')
+        self.assertTrue('EFI_FV_PAD_SAVED_SIZE' not in sizes)
+        self.assertEqual(order, [self.makeGuid(i) for i in range(len(files))])
+        defaultTaken = sizes['EFI_FV_TAKEN_SIZE']
+
+        self.genFv(inf, 'packed.fv', '--pack-files')
+        sizes, order = self.readReport('packed.fv')
+        self.assertTrue(sizes['EFI_FV_PAD_SAVED_SIZE'] > 0)
+        self.assertEqual(sorted(order), [self.makeGuid(i) for i in range(len(files))])
+        self.assertTrue(sizes['EFI_FV_TAKEN_SIZE'] < defaultTaken)
+
+        #
+        # The option only changes the FV it is given to.
+        #
+        self.genFv(inf, 'again.fv')
+        self.assertSameFv('default.fv', 'again.fv')
+
+    def makeCapsule(self, sizes):
+        #
+        # Writes the payload files and the capsule INF, and returns the
+        # INF and the capsule GenFv is expected to generate from it.
+        #
+        files = []
+        payloads = []
+        for index, size in enumerate(sizes):
+            payload = self.GetRandomString(size)
+            self.WriteTmpFile('payload%d.bin' % index, payload)
+            files.append(self.GetTmpFilePath('payload%d.bin' % index))
+            payloads.append(payload)
+        lines = [
+            '[options]',
+            'EFI_CAPSULE_GUID = ' + CAPSULE_GUID,
+            'EFI_CAPSULE_HEADER_SIZE = 0x40',
+            'EFI_CAPSULE_FLAGS = PersistAcrossReset',
+            '[files]',
+            ]
+        lines += ['EFI_FILE_NAME = ' + file for file in files]
+        self.WriteTmpFile('cap.inf', '\n'.join(lines) + '\n')
+        body = ''.join(payloads)
+        header = uuid.UUID(CAPSULE_GUID).bytes_le + struct.pack(
+            '<III', 0x40, CAPSULE_FLAGS_PERSIST_ACROSS_RESET, 0x40 + len(body)
+            )
+        return self.GetTmpFilePath('cap.inf'), header.ljust(0x40, '\0') + body
+
+    def genCapsule(self, inf, cap):
+        self.runTool('GenFv', '-c', '-i', inf, '-o', self.GetTmpFilePath(cap))
+
+    def testCapsule(self):
+        #
+        # The payloads are appended after the header in INF order, including
+        # an empty one and ones larger than the copy buffer of GenFv.
+        #
+        inf, expected = self.makeCapsule((0x1234, 0, 1, 0x10000, 0x25003))
+        self.genCapsule(inf, 'cap.bin')
+        self.assertTrue(self.ReadTmpFile('cap.bin') == expected)
+
+    def testCapsuleCopyFallback(self):
+        #
+        # Without sendfile support GenFv copies the payloads through its
+        # buffer, starting where sendfile stopped.
+        #
+        if not sys.platform.startswith('linux'):
+            self.skipTest('sendfile is only used on Linux')
+        self.WriteTmpFile('shim.c', SENDFILE_SHIM)
+        shim = self.GetTmpFilePath('shim.so')
+        log = open(self.GetTmpFilePath('cc.log'), 'w')
+        rc = subprocess.call(
+            ['cc', '-shared', '-fPIC', '-o', shim, self.GetTmpFilePath('shim.c'), '-ldl'],
+            stdout=log, stderr=subprocess.STDOUT
+            )
+        log.close()
+        if rc != 0:
+            self.skipTest('cannot build the sendfile shim')
+
+        inf, expected = self.makeCapsule((0x1234, 0, 0x25003, 0x10001))
+        environ = dict(os.environ)
+        os.environ['LD_PRELOAD'] = shim
+        os.environ['SENDFILE_FAILURE_LOG'] = self.GetTmpFilePath('failures.log')
+        try:
+            self.genCapsule(inf, 'cap.bin')
+        finally:
+            os.environ.clear()
+            os.environ.update(environ)
+        self.assertEqual(self.ReadTmpFile('failures.log').split(), ['EINVAL'] * 3)
+        self.assertTrue(self.ReadTmpFile('cap.bin') == expected)
+
+TheTestSuite = TestTools.MakeTheTestSuite(locals())
+
+if __name__ == '__main__':
+    allTests = TheTestSuite()
+    unittest.TextTestRunner().run(allTests)
+
@@ -0,0 +1,226 @@
+## @file
+# Unit tests for GenFw utility
+#
+#  Copyright (c) 2012, Intel Corporation. All rights reserved.<BR>
+#
+#  This program and the accompanying materials
+#  are licensed and made available under the terms and conditions of the BSD License
+#  which accompanies this distribution.  The full text of the license may be found at
+#  http://opensource.org/licenses/bsd-license.php
+#
+#  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+#
+
+##
+# Import Modules
+#
+import os
+import random
+import struct
+import sys
+import unittest
+
+import TestTools
+from GenFv import MakeElf64, DATA_SIZE, R_X86_64_64, R_X86_64_32
+
+EFI_IMAGE_REL_BASED_HIGHLOW = 3
+EFI_IMAGE_REL_BASED_DIR64 = 10
+
+class Tests(TestTools.BaseToolsTest):
+
+    def setUp(self):
+        TestTools.BaseToolsTest.setUp(self)
+        self.toolName = 'GenFw'
+
+    def testHelp(self):
+        result = self.RunTool('--help', logFile='help')
+        self.assertTrue(result == 0)
+
+    def ParsePe(self, image):
+        peOffset = struct.unpack_from('<I', image, 0x3c)[0]
+        sectionNumber, optionalSize = struct.unpack_from('<2xH12xH', image, peOffset + 4)
+        imageBase = struct.unpack_from('<Q', image, peOffset + 24 + 24)[0]
+        relocAddress, relocSize = struct.unpack_from('<II', image, peOffset + 24 + 112 + 5 * 8)
+        sections = {}
+        for index in range(sectionNumber):
+            offset = peOffset + 24 + optionalSize + index * 40
+            name = image[offset:offset + 8].rstrip('\x00')
+            sections[name] = struct.unpack_from('<I', image, offset + 12)[0]
+        blocks = []
+        offset = relocAddress
+        while offset < relocAddress + relocSize:
+            page, blockSize = struct.unpack_from('<II', image, offset)
+            entries = struct.unpack_from('<%dH' % ((blockSize - 8) / 2), image, offset + 8)
+            blocks.append((page, blockSize, entries))
+            offset += blockSize
+        return imageBase, sections, blocks
+
+    def testRelocationsSortedByPage(self):
+        #
+        # Relocations in no particular page order, with duplicates, must give
+        # one block per page with the fixups in offset order.
+        #
+        random.seed(0)
+        relocs = []
+        for offset in random.sample(xrange(0, DATA_SIZE, 8), 300):
+            if random.randint(0, 3) == 0:
+                relocs.append((offset, R_X86_64_32, 2, random.randrange(0, DATA_SIZE)))
+            else:
+                relocs.append((offset, R_X86_64_64, random.choice((1, 2)), random.randrange(0, 0x100)))
+        relocs += random.sample(relocs, 50)
+        random.shuffle(relocs)
+        self.WriteTmpFile('input.elf', MakeElf64(relocs))
+        result = self.RunTool(
+            '-e', 'UEFI_APPLICATION',
+            '-o', self.GetTmpFilePath('image.efi'),
+            self.GetTmpFilePath('input.elf')
+            )
+        self.assertTrue(result == 0)
+        image = self.ReadTmpFile('image.efi')
+        imageBase, sections, blocks = self.ParsePe(image)
+        dataAddress = sections['.data']
+
+        expected = sorted(set([
+            (dataAddress + offset, (EFI_IMAGE_REL_BASED_HIGHLOW, EFI_IMAGE_REL_BASED_DIR64)[type == R_X86_64_64])
+            for offset, type, shndx, target in relocs
+            ]))
+        pages = [page for page, blockSize, entries in blocks]
+        self.assertEqual(pages, sorted(set([offset & ~0xfff for offset, type in expected])))
+        fixups = []
+        for page, blockSize, entries in blocks:
+            self.assertEqual(blockSize % 4, 0)
+            types = [entry >> 12 for entry in entries]
+            self.assertTrue(0 not in types or types[types.index(0):] == [0] * (len(types) - types.index(0)))
+            fixups += [(page + (entry & 0xfff), entry >> 12) for entry in entries if entry >> 12 != 0]
+        self.assertEqual(fixups, expected)
+
+        #
+        # PeCoffLoaderRelocateImage adds the delta at each fixup, and only there.
+        #
+        newBase = 0x180000000
+        result = self.RunTool(
+            '--rebase', hex(newBase).rstrip('L'),
+            '-o', self.GetTmpFilePath('rebased.efi'),
+            self.GetTmpFilePath('image.efi')
+            )
+        self.assertTrue(result == 0)
+        rebased = self.ReadTmpFile('rebased.efi')
+        self.assertEqual(self.ParsePe(rebased)[0], newBase)
+        delta = newBase - imageBase
+        patched = bytearray(image)
+        for offset, type in fixups:
+            if type == EFI_IMAGE_REL_BASED_DIR64:
+                value = struct.unpack_from('<Q', image, offset)[0]
+                struct.pack_into('<Q', patched, offset, (value + delta) & 0xffffffffffffffff)
+            else:
+                value = struct.unpack_from('<I', image, offset)[0]
+                struct.pack_into('<I', patched, offset, (value + delta) & 0xffffffff)
+        self.assertEqual(
+            rebased[dataAddress:dataAddress + DATA_SIZE],
+            str(patched[dataAddress:dataAddress + DATA_SIZE])
+            )
+        self.assertEqual(
+            rebased[sections['.text']:dataAddress],
+            image[sections['.text']:dataAddress]
+            )
+
+    def testBatch(self):
+        #
+        # Commands given in a manifest, some using the output of others, must
+        # give the same files as when they run one by one.
+        #
+        random.seed(1)
+        relocs = [
+            (offset, R_X86_64_64, random.choice((1, 2)), random.randrange(0, 0x100))
+            for offset in random.sample(xrange(0, DATA_SIZE, 8), 100)
+            ]
+        self.WriteTmpFile('input.elf', MakeElf64(relocs))
+        input = self.GetTmpFilePath('input.elf')
+        extensions = ('efi', 'te', 'rebased', 'stripped', 'zeroed')
+
+        def Commands(prefix):
+            path = dict([(ext, self.GetTmpFilePath(prefix + '.' + ext)) for ext in extensions])
+            return [
+                ('-e', 'UEFI_APPLICATION', '-o', path['efi'], input),
+                ('-t', '-o', path['te'], path['efi']),
+                ('--rebase', '0x800000', '-o', path['rebased'], path['efi']),
+                ('-l', '-o', path['stripped'], path['efi']),
+                ('-z', '-o', path['zeroed'], path['stripped']),
+                ]
+
+        manifest = '# GenFw batch\n'
+        for index in range(4):
+            for command in Commands('batch%d' % index):
+                manifest += ' '.join(['"%s"' % arg for arg in command]) + '\n'
+        self.WriteTmpFile('batch.txt', manifest)
+        result = self.RunTool('--batch', self.GetTmpFilePath('batch.txt'), '--threads', '3')
+        self.assertTrue(result == 0)
+
+        for command in Commands('single'):
+            result = self.RunTool(*command)
+            self.assertTrue(result == 0)
+        for extension in extensions:
+            single = self.ReadTmpFile('single.' + extension)
+            for index in range(4):
+                self.assertEqual(self.ReadTmpFile('batch%d.%s' % (index, extension)), single)
+
+        #
+        # A failing command fails the batch.
+        #
+        self.WriteTmpFile('failing.txt', '-t -o "%s" "%s"\n' % (
+            self.GetTmpFilePath('missing.te'),
+            self.GetTmpFilePath('missing.efi')
+            ))
+        result = self.RunTool('--batch', self.GetTmpFilePath('failing.txt'), logFile='failing')
+        self.assertTrue(result != 0)
+
+    def testChain(self):
+        #
+        # Chained actions must give the same image as GenFw run once per
+        # action, without the intermediate files.
+        #
+        random.seed(2)
+        relocs = [
+            (offset, R_X86_64_64, random.choice((1, 2)), random.randrange(0, 0x100))
+            for offset in random.sample(xrange(0, DATA_SIZE, 8), 100)
+            ]
+        self.WriteTmpFile('input.elf', MakeElf64(relocs))
+        actions = [
+            ('-e', 'DXE_DRIVER'),
+            ('--rebase', '0x800000'),
+            ('-z',),
+            ('-l',),
+            ('-e', 'DXE_DRIVER', '-t'),
+            ]
+        input = self.GetTmpFilePath('input.elf')
+        for index, action in enumerate(actions):
+            output = self.GetTmpFilePath('step%d.efi' % index)
+            result = self.RunTool(*(action + ('-o', output, input)))
+            self.assertTrue(result == 0)
+            input = output
+        result = self.RunTool(
+            '--chain', '-e', 'DXE_DRIVER', '--rebase', '0x800000', '-z', '-l', '-t',
+            '-o', self.GetTmpFilePath('chain.efi'),
+            self.GetTmpFilePath('input.elf')
+            )
+        self.assertTrue(result == 0)
+        self.assertEqual(self.ReadTmpFile('chain.efi'), self.ReadTmpFile('step%d.efi' % (len(actions) - 1)))
+        self.assertEqual(self.ReadTmpFile('chain.txt'), self.ReadTmpFile('step%d.txt' % (len(actions) - 1)))
+
+        #
+        # Only the last action can make something else than an image.
+        #
+        result = self.RunTool(
+            '--chain', '-e', 'DXE_DRIVER', '-b', '-t',
+            '-o', self.GetTmpFilePath('bin.efi'),
+            self.GetTmpFilePath('input.elf'),
+            logFile='chain'
+            )
+        self.assertTrue(result != 0)
+
+TheTestSuite = TestTools.MakeTheTestSuite(locals())
+
+if __name__ == '__main__':
+    allTests = TheTestSuite()
+    unittest.TextTestRunner().run(allTests)
@@ -0,0 +1,181 @@
+## @file
+# Unit tests for LzmaCompress utility
+#
+#  Copyright (c) 2008, Intel Corporation. All rights reserved.<BR>
+#
+#  This program and the accompanying materials
+#  are licensed and made available under the terms and conditions of the BSD License
+#  which accompanies this distribution.  The full text of the license may be found at
+#  http://opensource.org/licenses/bsd-license.php
+#
+#  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+#
+
+##
+# Import Modules
+#
+import os
+import random
+import sys
+import unittest
+
+import TestTools
+
+class Tests(TestTools.BaseToolsTest):
+
+    def setUp(self):
+        TestTools.BaseToolsTest.setUp(self)
+        self.toolName = 'LzmaCompress'
+
+    def testHelp(self):
+        result = self.RunTool('--help', logFile='help')
+        self.assertTrue(result == 0)
+
+    def compress(self, inputName, outputName, *options):
+        result = self.RunTool(
+            '-q', '-e',
+            *(options + (
+            '-o', self.GetTmpFilePath(outputName),
+            self.GetTmpFilePath(inputName)
+            ))
+            )
+        self.assertTrue(result == 0)
+        return self.ReadTmpFile(outputName)
+
+    def testThreadsMatchSingleThread(self):
+        #
+        # The multi-threaded match finder must produce exactly the same
+        # stream as the single threaded one.
+        #
+        samples = (
+            self.GetRandomString(1024, 2048),
+            'EFI_FIRMWARE_VOLUME' * 40000,
+            ''.join([chr(random.randint(0, 3)) for i in xrange(600 * 1024)]),
+            )
+        for data in samples:
+            self.WriteTmpFile('input', data)
+            single = self.compress('input', 'output1')
+            for threads in ('2', '4'):
+                multi = self.compress('input', 'output2', '--threads', threads)
+                self.assertTrue(single == multi)
+            result = self.RunTool(
+                '-q', '-d',
+                '-o', self.GetTmpFilePath('output3'),
+                self.GetTmpFilePath('output2')
+                )
+            self.assertTrue(result == 0)
+            self.assertTrue(self.ReadTmpFile('output3') == data)
+            self.CleanUpTmpDir()
+
+    def testStreamMatchesMemory(self):
+        samples = (
+            'x',
+            self.GetRandomString(1024, 2048),
+            ''.join([chr(random.randint(0, 3)) for i in xrange(300 * 1024)]),
+            )
+        for data in samples:
+            self.WriteTmpFile('input', data)
+            for converter in self.converters:
+                memory = self.compress('input', 'output1', *converter)
+                stream = self.compress('input', 'output2', *(converter + ('--stream',)))
+                self.assertTrue(memory == stream)
+                result = self.RunTool(
+                    '-q', '-d', '--stream',
+                    *(converter + (
+                    '-o', self.GetTmpFilePath('output3'),
+                    self.GetTmpFilePath('output2')
+                    ))
+                    )
+                self.assertTrue(result == 0)
+                self.assertTrue(self.ReadTmpFile('output3') == data)
+            self.CleanUpTmpDir()
+
+    converters = ((), ('--f86',), ('--farm',), ('--farmt',), ('--fia64',), ('--farm64',))
+
+    def testConverterCycles(self):
+        data = ''.join([chr(random.randint(0, 255)) for i in xrange(100 * 1024)])
+        self.WriteTmpFile('input', data)
+        for converter in self.converters:
+            self.compress('input', 'output1', *converter)
+            result = self.RunTool(
+                '-q', '-d',
+                *(converter + (
+                '-o', self.GetTmpFilePath('output2'),
+                self.GetTmpFilePath('output1')
+                ))
+                )
+            self.assertTrue(result == 0)
+            self.assertTrue(self.ReadTmpFile('output2') == data)
+
+    def testArm64Converter(self):
+        #
+        # BL instructions calling the same function from different places
+        # only become repetitive once the converter makes them absolute.
+        #
+        code = []
+        for pc in xrange(0, 256 * 1024, 4):
+            if pc % 16 == 0:
+                instr = 0x94000000 | (((0x100000 - pc) >> 2) & 0x03FFFFFF)
+            else:
+                instr = random.choice((0xD503201F, 0xAA0003E0, 0x910003FD))
+            code.append(''.join([chr((instr >> shift) & 0xFF) for shift in (0, 8, 16, 24)]))
+        data = ''.join(code)
+        self.WriteTmpFile('input', data)
+        plain = self.compress('input', 'output1')
+        filtered = self.compress('input', 'output2', '--farm64')
+        self.assertTrue(len(filtered) < len(plain))
+        result = self.RunTool(
+            '-q', '-d', '--farm64',
+            '-o', self.GetTmpFilePath('output3'),
+            self.GetTmpFilePath('output2')
+            )
+        self.assertTrue(result == 0)
+        self.assertTrue(self.ReadTmpFile('output3') == data)
+
+    def testTuningCycles(self):
+        data = ''.join([chr(random.randint(0, 3)) for i in xrange(200 * 1024)])
+        self.WriteTmpFile('input', data)
+        for options in (
+            ('--level', '0'),
+            ('--level', '9'),
+            ('--dict-size', 'auto'),
+            ('--dict-size', '64K'),
+            ('--fb', '273', '--mc', '1000'),
+            ('--lc', '0', '--lp', '2', '--pb', '0'),
+            ('--mf', 'hc4'),
+            ('--mf', 'bt2'),
+            ('--mf', 'bt3', '--threads', '2'),
+            ):
+            self.compress('input', 'output1', *options)
+            result = self.RunTool(
+                '-q', '-d',
+                '-o', self.GetTmpFilePath('output2'),
+                self.GetTmpFilePath('output1')
+                )
+            self.assertTrue(result == 0)
+            self.assertTrue(self.ReadTmpFile('output2') == data)
+
+    def testBadTuning(self):
+        self.WriteTmpFile('input', 'data')
+        for options in (
+            ('--level', '10'),
+            ('--dict-size', '1K'),
+            ('--dict-size', '1025M'),
+            ('--dict-size', '17592186044417M'),
+            ('--dict-size', '0x10000'),
+            ('--fb', '4'),
+            ('--lc', '9'),
+            ('--mc', '0'),
+            ('--mf', 'bt5'),
+            ):
+            result = self.RunTool('-e', *(options + (self.GetTmpFilePath('input'),)))
+            self.assertTrue(result != 0)
+
+    def testBadThreads(self):
+        self.WriteTmpFile('input', 'data')
+        for threads in ('0', 'x'):
+            result = self.RunTool('-e', '--threads', threads, self.GetTmpFilePath('input'))
+            self.assertTrue(result != 0)
+
+TheTestSuite = TestTools.MakeTheTestSuite(locals())
@@ -0,0 +1,95 @@
+## @file
+# Unit tests for the PyEfiCompressor extension
+#
+#  Copyright (c) 2008, Intel Corporation. All rights reserved.<BR>
+#
+#  This program and the accompanying materials
+#  are licensed and made available under the terms and conditions of the BSD License
+#  which accompanies this distribution.  The full text of the license may be found at
+#  http://opensource.org/licenses/bsd-license.php
+#
+#  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+#
+
+##
+# Import Modules
+#
+import os
+import random
+import sys
+import threading
+import unittest
+
+import TestTools
+
+class Tests(TestTools.BaseToolsTest):
+
+    def setUp(self):
+        TestTools.BaseToolsTest.setUp(self)
+        #
+        # The extension is not part of the default build. Use the one built
+        # in place in its source directory, or an installed one.
+        #
+        sys.path.insert(0, os.path.join(TestTools.CSourceDir, 'PyEfiCompressor'))
+        try:
+            import EfiCompressor
+        except ImportError:
+            self.skipTest("EfiCompressor is not built, use 'python setup.py build_ext --inplace' in Source/C/PyEfiCompressor")
+        self.compressors = (
+            (EfiCompressor.UefiCompress, EfiCompressor.UefiDecompress),
+            (EfiCompressor.FrameworkCompress, EfiCompressor.FrameworkDecompress),
+            )
+
+    def getSamples(self):
+        return (
+            'E',
+            '\0' * 0x10000,
+            self.GetRandomString(64 * 1024),
+            'EFI_FIRMWARE_VOLUME' * 10000,
+            ''.join([chr(random.randint(0, 3)) for i in xrange(256 * 1024)]),
+            )
+
+    def testCycles(self):
+        for compress, decompress in self.compressors:
+            for data in self.getSamples():
+                output = compress(data, len(data))
+                self.assertTrue(str(decompress(output, len(output))) == data)
+
+    def testThreads(self):
+        #
+        # The compressors release the interpreter lock, so the worker threads
+        # compress at the same time, each with its own encoder context. Every
+        # result must be the one of the same compression done alone.
+        #
+        samples = self.getSamples()
+        expected = []
+        for compress, decompress in self.compressors:
+            expected.append([compress(data, len(data)) for data in samples])
+
+        jobs = [(i, j) for i in range(len(self.compressors)) for j in range(len(samples))] * 2
+        results = [[] for thread in range(4)]
+
+        def worker(results):
+            order = jobs[:]
+            random.shuffle(order)
+            for i, j in order:
+                compress = self.compressors[i][0]
+                results.append((i, j, compress(samples[j], len(samples[j]))))
+
+        threads = [threading.Thread(target=worker, args=(result,)) for result in results]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        for result in results:
+            self.assertEqual(len(result), len(jobs))
+            for i, j, output in result:
+                self.assertTrue(output == expected[i][j])
+
+TheTestSuite = TestTools.MakeTheTestSuite(locals())
+
+if __name__ == '__main__':
+    allTests = TheTestSuite()
+    unittest.TextTestRunner().run(allTests)
@@ -33,13 +33,15 @@ class Tests(TestTools.BaseToolsTest):
         #self.DisplayFile('help')
         self.assertTrue(result == 0)
 
-    def compressionTestCycle(self, data):
+    def compressionTestCycle(self, data, *options):
         path = self.GetTmpFilePath('input')
         self.WriteTmpFile('input', data)
         result = self.RunTool(
             '-e',
+            *(options + (
             '-o', self.GetTmpFilePath('output1'),
             self.GetTmpFilePath('input')
+            ))
             )
         self.assertTrue(result == 0)
         result = self.RunTool(
@@ -65,6 +67,45 @@ class Tests(TestTools.BaseToolsTest):
             self.compressionTestCycle(data)
             self.CleanUpTmpDir()
 
+    def testLevelCycles(self):
+        #
+        # Random data has few matches, so also use repetitive data to
+        # exercise long matches and the window slide of every match finder.
+        #
+        samples = (
+            self.GetRandomString(1024, 2048),
+            'EFI_FIRMWARE_VOLUME' * 40000,
+            ''.join([chr(random.randint(0, 3)) for i in xrange(600 * 1024)]),
+            )
+        for level in ('1', '2', '3', '4'):
+            for data in samples:
+                self.compressionTestCycle(data, '--level', level)
+                self.CleanUpTmpDir()
+
+    def testHighLevelsNotLarger(self):
+        samples = (
+            open(self.FindToolBin(self.toolName), 'rb').read(),
+            'EFI_FIRMWARE_VOLUME' * 40000,
+            ''.join([chr(random.randint(0, 3)) for i in xrange(600 * 1024)]),
+            '\0' * 10000,
+            '\0' * 1000000,
+            )
+        for data in samples:
+            self.WriteTmpFile('input', data)
+            sizes = {}
+            for level in ('2', '3', '4'):
+                result = self.RunTool('-e', '--level', level, '-o', self.GetTmpFilePath('output'), self.GetTmpFilePath('input'))
+                self.assertTrue(result == 0)
+                sizes[level] = len(self.ReadTmpFile('output'))
+            self.assertTrue(sizes['3'] <= sizes['2'])
+            self.assertTrue(sizes['4'] <= sizes['2'])
+            self.CleanUpTmpDir()
+
+    def testBadLevel(self):
+        self.WriteTmpFile('input', 'data')
+        result = self.RunTool('-e', '--level', '5', self.GetTmpFilePath('input'))
+        self.assertTrue(result != 0)
+
 TheTestSuite = TestTools.MakeTheTestSuite(locals())
 
 if __name__ == '__main__':